@@ -372,6 +372,9 @@ public:
   /** Make the type of set with the given parameterization. */
   SetType mkSetType(Type elementType) const;
 
+  /** Make the type of sequences with the given element type. */
+  SequenceType mkSequenceType(Type elementType) const;
+
   /** Make a type representing the given datatype. */
   DatatypeType mkDatatypeType(Datatype& datatype);
 
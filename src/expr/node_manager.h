@@ -854,6 +854,9 @@ public:
   /** Make the type of arrays with the given parameterization */
   inline TypeNode mkSetType(TypeNode elementType);
 
+  /** Make the type of sequences with the given element type */
+  inline TypeNode mkSequenceType(TypeNode elementType);
+
   /** Make a type representing a constructor with the given parameterization */
   TypeNode mkConstructorType(const DatatypeConstructor& constructor, TypeNode range);
 
@@ -1141,6 +1144,14 @@ inline TypeNode NodeManager::mkSetType(TypeNode elementType) {
   return mkTypeNode(kind::SET_TYPE, elementType);
 }
 
+inline TypeNode NodeManager::mkSequenceType(TypeNode elementType) {
+  CheckArgument(!elementType.isNull(), elementType,
+                "unexpected NULL element type");
+  CheckArgument(elementType.isFirstClass(), elementType,
+                "cannot store types that are not first-class in sequences");
+  return mkTypeNode(kind::SEQUENCE_TYPE, elementType);
+}
+
 inline TypeNode NodeManager::mkSelectorType(TypeNode domain, TypeNode range) {
   CheckArgument(domain.isDatatype(), domain,
                 "cannot create non-datatype selector type");
@@ -51,6 +51,7 @@ class RoundingModeType;
 class BitVectorType;
 class ArrayType;
 class SetType;
+class SequenceType;
 class DatatypeType;
 class ConstructorType;
 class SelectorType;
@@ -319,6 +320,12 @@ protected:
    */
   bool isSet() const;
 
+  /**
+   * Is this a Sequence type?
+   * @return true if the type is a Sequence type
+   */
+  bool isSequence() const;
+
  /**
    * Is this a datatype type?
    * @return true if the type is a datatype type
@@ -471,6 +478,16 @@ class CVC4_PUBLIC SetType : public Type {
   Type getElementType() const;
 };/* class SetType */
 
+/** Class encapsulating a sequence type. */
+class CVC4_PUBLIC SequenceType : public Type {
+ public:
+  /** Construct from the base type */
+  SequenceType(const Type& type = Type());
+
+  /** Get the element type */
+  Type getElementType() const;
+};/* class SequenceType */
+
 /** Class encapsulating a user-defined sort. */
 class CVC4_PUBLIC SortType : public Type {
  public:
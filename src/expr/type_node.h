@@ -488,6 +488,12 @@ public:
   /** Is this a Set type? */
   bool isSet() const;
 
+  /** Is this a Sequence type? */
+  bool isSequence() const;
+
+  /** Is this the String type or a Sequence type? */
+  bool isStringLike() const;
+
   /** Get the index type (for array types) */
   TypeNode getArrayIndexType() const;
 
@@ -500,6 +506,9 @@ public:
   /** Get the element type (for set types) */
   TypeNode getSetElementType() const;
 
+  /** Get the element type (for sequence types) */
+  TypeNode getSequenceElementType() const;
+
   /**
    * Is this a function type?  Function-like things (e.g. datatype
    * selectors) that aren't actually functions are NOT considered
@@ -898,6 +907,19 @@ inline TypeNode TypeNode::getSetElementType() const {
   return (*this)[0];
 }
 
+inline bool TypeNode::isSequence() const {
+  return getKind() == kind::SEQUENCE_TYPE;
+}
+
+inline bool TypeNode::isStringLike() const {
+  return isString() || isSequence();
+}
+
+inline TypeNode TypeNode::getSequenceElementType() const {
+  Assert(isSequence());
+  return (*this)[0];
+}
+
 inline bool TypeNode::isFunction() const {
   return getKind() == kind::FUNCTION_TYPE;
 }
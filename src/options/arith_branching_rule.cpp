@@ -0,0 +1,39 @@
+/*********************                                                        */
+/*! \file arith_branching_rule.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Rules for choosing the integer variable to branch on
+ **
+ ** Rules for choosing the integer variable to branch on.
+ **/
+
+#include "options/arith_branching_rule.h"
+
+namespace CVC4 {
+
+std::ostream& operator<<(std::ostream& out, ArithBranchingRule rule) {
+  switch(rule) {
+  case ROUND_ROBIN_BRANCHING:
+    out << "ROUND_ROBIN_BRANCHING";
+    break;
+  case MOST_FRACTIONAL_BRANCHING:
+    out << "MOST_FRACTIONAL_BRANCHING";
+    break;
+  case PSEUDO_COST_BRANCHING:
+    out << "PSEUDO_COST_BRANCHING";
+    break;
+  default:
+    out << "ArithBranchingRule!UNKNOWN";
+  }
+
+  return out;
+}
+
+}/* CVC4 namespace */
@@ -0,0 +1,39 @@
+/*********************                                                        */
+/*! \file arith_branching_rule.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Rules for choosing the integer variable to branch on
+ **
+ ** Rules for choosing the integer variable to branch on.
+ **/
+
+#include "cvc4_public.h"
+
+#ifndef __CVC4__THEORY__ARITH__ARITH_BRANCHING_RULE_H
+#define __CVC4__THEORY__ARITH__ARITH_BRANCHING_RULE_H
+
+#include <iostream>
+
+namespace CVC4 {
+
+enum ArithBranchingRule {
+  /** The next fractional variable after the last one branched on. */
+  ROUND_ROBIN_BRANCHING,
+  /** The variable whose fractional part is closest to 1/2. */
+  MOST_FRACTIONAL_BRANCHING,
+  /** The variable whose earlier branches reduced infeasibility the most. */
+  PSEUDO_COST_BRANCHING
+};
+
+std::ostream& operator<<(std::ostream& out, ArithBranchingRule rule) CVC4_PUBLIC;
+
+}/* CVC4 namespace */
+
+#endif /* __CVC4__THEORY__ARITH__ARITH_BRANCHING_RULE_H */
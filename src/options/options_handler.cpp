@@ -30,6 +30,7 @@
 #include "base/output.h"
 #include "lib/strtok_r.h"
 #include "gmp.h"
+#include "options/arith_branching_rule.h"
 #include "options/arith_heuristic_pivot_rule.h"
 #include "options/arith_propagation_mode.h"
 #include "options/arith_unate_lemma_mode.h"
@@ -169,6 +170,18 @@ This decides on kind of propagation arithmetic attempts to do during the search.
 +both\n\
 ";
 
+const std::string OptionsHandler::s_arithBranchingRuleHelp = "\
+This decides on the integer variable that branch and bound branches on.\n\
+Branching rules available:\n\
++rr\n\
+  The next variable with a fractional value, in round-robin order. (default)\n\
++most-frac\n\
+  The variable whose fractional part is closest to 1/2.\n\
++pseudo-cost\n\
+  The variable whose earlier branches reduced the total fractionality of\n\
+  the integer variables the most, per unit of rounding.\n\
+";
+
 const std::string OptionsHandler::s_errorSelectionRulesHelp = "\
 This decides on the rule used by simplex during heuristic rounds\n\
 for deciding the next basic variable to select.\n\
@@ -221,6 +234,24 @@ ArithPropagationMode OptionsHandler::stringToArithPropagationMode(
   }
 }
 
+ArithBranchingRule OptionsHandler::stringToArithBranchingRule(
+    std::string option, std::string optarg)
+{
+  if(optarg == "rr") {
+    return ROUND_ROBIN_BRANCHING;
+  } else if(optarg == "most-frac") {
+    return MOST_FRACTIONAL_BRANCHING;
+  } else if(optarg == "pseudo-cost") {
+    return PSEUDO_COST_BRANCHING;
+  } else if(optarg == "help") {
+    puts(s_arithBranchingRuleHelp.c_str());
+    exit(1);
+  } else {
+    throw OptionException(std::string("unknown option for --arith-branching: `") +
+                          optarg + "'.  Try --arith-branching help.");
+  }
+}
+
 ErrorSelectionRule OptionsHandler::stringToErrorSelectionRule(
     std::string option, std::string optarg)
 {
@@ -23,6 +23,7 @@
 #include <string>
 
 #include "base/modal_exception.h"
+#include "options/arith_branching_rule.h"
 #include "options/arith_heuristic_pivot_rule.h"
 #include "options/arith_propagation_mode.h"
 #include "options/arith_unate_lemma_mode.h"
@@ -73,6 +74,8 @@ public:
                                                   std::string optarg);
   ArithPropagationMode stringToArithPropagationMode(std::string option,
                                                     std::string optarg);
+  ArithBranchingRule stringToArithBranchingRule(std::string option,
+                                                std::string optarg);
   ErrorSelectionRule stringToErrorSelectionRule(std::string option,
                                                 std::string optarg);
 
@@ -254,6 +257,7 @@ public:
   static const std::string s_ufssModeHelp;
   static const std::string s_userPatModeHelp;
   static const std::string s_fmfBoundMinModeModeHelp;
+  static const std::string s_arithBranchingRuleHelp;
   static const std::string s_errorSelectionRulesHelp;
   static const std::string s_arithPropagationModeHelp;
   static const std::string s_arithUnateLemmasHelp;
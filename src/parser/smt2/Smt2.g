@@ -1892,6 +1892,11 @@ termNonVariable[CVC4::Expr& expr, CVC4::Expr& expr2]
         expr = MK_CONST( ::CVC4::EmptySet(type) );
       } else if(f.getKind() == CVC4::kind::UNIVERSE_SET) {
         expr = EXPR_MANAGER->mkNullaryOperator(type, kind::UNIVERSE_SET);
+      } else if(f.getKind() == CVC4::kind::EMPTY_SEQUENCE) {
+        if(!type.isSequence()) {
+          PARSER_STATE->parseError("Type ascription of seq.empty is not a sequence type.");
+        }
+        expr = EXPR_MANAGER->mkNullaryOperator(type, kind::EMPTY_SEQUENCE);
       } else if(f.getKind() == CVC4::kind::SEP_NIL) {
         //We don't want the nil reference to be a constant: for instance, it
         //could be of type Int but is not a const rational. However, the
@@ -2393,6 +2398,10 @@ termNonVariable[CVC4::Expr& expr, CVC4::Expr& expr2]
     { //booleanType is placeholder here since we don't have type info without type annotation
       expr = EXPR_MANAGER->mkNullaryOperator(EXPR_MANAGER->booleanType(), kind::UNIVERSE_SET); }
 
+  | SEQ_EMPTY_TOK
+    { //booleanType is placeholder here since we don't have type info without type annotation
+      expr = EXPR_MANAGER->mkNullaryOperator(EXPR_MANAGER->booleanType(), kind::EMPTY_SEQUENCE); }
+
   | NILREF_TOK
     { //booleanType is placeholder here since we don't have type info without type annotation
       expr = EXPR_MANAGER->mkNullaryOperator(EXPR_MANAGER->booleanType(), kind::SEP_NIL); }
@@ -2917,6 +2926,12 @@ sortSymbol[CVC4::Type& t, CVC4::parser::DeclarationCheck check]
             PARSER_STATE->parseError("Illegal set type.");
           }
           t = EXPR_MANAGER->mkSetType( args[0] );
+        } else if(name == "Seq" &&
+                  PARSER_STATE->isTheoryEnabled(Smt2::THEORY_STRINGS) ) {
+          if(args.size() != 1) {
+            PARSER_STATE->parseError("Illegal sequence type.");
+          }
+          t = EXPR_MANAGER->mkSequenceType( args[0] );
         } else if(name == "Tuple") {
           t = EXPR_MANAGER->mkTupleType(args); 
         } else if(check == CHECK_DECLARED ||
@@ -3214,6 +3229,7 @@ INST_CLOSURE_TOK : 'inst-closure';
 
 EMPTYSET_TOK: { PARSER_STATE->isTheoryEnabled(Smt2::THEORY_SETS) }? 'emptyset';
 UNIVSET_TOK: { PARSER_STATE->isTheoryEnabled(Smt2::THEORY_SETS) }? 'univset';
+SEQ_EMPTY_TOK: { PARSER_STATE->isTheoryEnabled(Smt2::THEORY_STRINGS) }? 'seq.empty';
 NILREF_TOK: { PARSER_STATE->isTheoryEnabled(Smt2::THEORY_SEP) }? 'sep.nil';
 TUPLE_CONST_TOK: { PARSER_STATE->isTheoryEnabled(Smt2::THEORY_DATATYPES) }? 'mkTuple';
 TUPLE_SEL_TOK: { PARSER_STATE->isTheoryEnabled(Smt2::THEORY_DATATYPES) }? 'tupSel';
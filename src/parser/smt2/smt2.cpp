@@ -156,6 +156,14 @@ void Smt2::addStringOperators() {
   addOperator(kind::STRING_CODE, "str.code");
   addOperator(kind::STRING_LT, "str.<");
   addOperator(kind::STRING_LEQ, "str.<=");
+  // operators on sequences, where concatenation, length and extraction are
+  // shared with strings
+  addOperator(kind::STRING_CONCAT, "seq.++");
+  addOperator(kind::STRING_LENGTH, "seq.len");
+  addOperator(kind::STRING_SUBSTR, "seq.extract");
+  addOperator(kind::SEQ_UNIT, "seq.unit");
+  addOperator(kind::SEQ_NTH, "seq.nth");
+  addOperator(kind::SEQ_UPDATE, "seq.update");
 }
 
 void Smt2::addFloatingPointOperators() {
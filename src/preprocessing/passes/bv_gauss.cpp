@@ -23,6 +23,8 @@
 #include "theory/bv/theory_bv_rewrite_rules_normalization.h"
 #include "util/bitvector.h"
 
+#include <cstdint>
+#include <limits>
 #include <unordered_map>
 #include <vector>
 
@@ -264,6 +266,187 @@ unsigned getMinBwExpr(Node expr)
   return visited[expr];
 }
 
+/**
+ * Compute the multiplicative inverse of 'a' modulo 'prime' on machine words
+ * via the extended Euclidean algorithm. Both 'a' and 'prime' are expected
+ * to be < 2^32. Returns 0 if 'a' and 'prime' are not coprime.
+ */
+uint64_t modInverseWord(uint64_t a, uint64_t prime)
+{
+  Assert(prime > 1);
+  Assert(a < prime);
+  int64_t t = 0, newt = 1;
+  int64_t r = prime, newr = a;
+  while (newr != 0)
+  {
+    int64_t q = r / newr;
+    int64_t tmp = t - q * newt;
+    t = newt;
+    newt = tmp;
+    tmp = r - q * newr;
+    r = newr;
+    newr = tmp;
+  }
+  if (r != 1)
+  {
+    return 0; /* not coprime */
+  }
+  return t < 0 ? static_cast<uint64_t>(t + static_cast<int64_t>(prime))
+               : static_cast<uint64_t>(t);
+}
+
+/**
+ * Compute (a - b * mul) modulo 'prime' on machine words, where a, b and mul
+ * are normalized to values modulo 'prime' < 2^32.
+ */
+inline uint64_t modSubMulWord(uint64_t a,
+                              uint64_t b,
+                              uint64_t mul,
+                              uint64_t prime)
+{
+  uint64_t sub = (b * mul) % prime;
+  return a >= sub ? a - sub : a + prime - sub;
+}
+
+/**
+ * Apply Gaussian Elimination modulo a (prime) number < 2^32 on machine
+ * words. This is the word-level counterpart of gaussElim below and performs
+ * the same steps in the same order, but all elements of the given matrix
+ * must be normalized to values modulo 'prime' beforehand. Since all
+ * elements are < 2^32, the product of two elements always fits into 64
+ * bits.
+ *
+ * The elements of the pivot row are mostly zero in practice. Their
+ * non-zero columns are therefore collected once per pivot, and rows are
+ * only updated in these columns.
+ */
+Result gaussElimWord(uint64_t prime,
+                     std::vector<uint64_t>& rhs,
+                     std::vector<std::vector<uint64_t>>& lhs)
+{
+  Assert(prime > 1);
+  Assert(prime <= std::numeric_limits<uint32_t>::max());
+
+  size_t nrows = lhs.size();
+  size_t ncols = lhs[0].size();
+  /* the non-zero columns >= pcol of the current pivot row */
+  std::vector<size_t> nzcols;
+
+  for (size_t pcol = 0, prow = 0; pcol < ncols && prow < nrows; ++pcol, ++prow)
+  {
+    for (size_t j = prow; j < nrows; ++j)
+    {
+#ifdef CVC4_ASSERTIONS
+      for (size_t k = 0; k < ncols; ++k) { Assert(lhs[j][k] < prime); }
+      for (size_t k = 0; k < pcol; ++k) { Assert(lhs[j][k] == 0); }
+#endif
+      /* exchange rows if pivot elem is 0 */
+      if (j == prow)
+      {
+        while (lhs[j][pcol] == 0)
+        {
+          for (size_t k = prow + 1; k < nrows; ++k)
+          {
+            if (lhs[k][pcol] != 0)
+            {
+              std::swap(rhs[j], rhs[k]);
+              std::swap(lhs[j], lhs[k]);
+              break;
+            }
+          }
+          if (pcol >= ncols - 1) break;
+          if (lhs[j][pcol] == 0) pcol += 1;
+        }
+      }
+
+      if (lhs[j][pcol] != 0)
+      {
+        /* (1) */
+        if (lhs[j][pcol] != 1)
+        {
+          uint64_t inv = modInverseWord(lhs[j][pcol], prime);
+          if (inv == 0)
+          {
+            return Result::INVALID; /* not coprime */
+          }
+          for (size_t k = pcol; k < ncols; ++k)
+          {
+            lhs[j][k] = (lhs[j][k] * inv) % prime;
+          }
+          rhs[j] = (rhs[j] * inv) % prime;
+          if (j > prow)
+          {
+            for (size_t k : nzcols)
+            {
+              lhs[j][k] = modSubMulWord(lhs[j][k], lhs[prow][k], 1, prime);
+            }
+            rhs[j] = modSubMulWord(rhs[j], rhs[prow], 1, prime);
+          }
+        }
+        /* (2) */
+        else if (j != prow)
+        {
+          for (size_t k : nzcols)
+          {
+            lhs[j][k] = modSubMulWord(lhs[j][k], lhs[prow][k], 1, prime);
+          }
+          rhs[j] = modSubMulWord(rhs[j], rhs[prow], 1, prime);
+        }
+      }
+
+      if (j == prow)
+      {
+        nzcols.clear();
+        for (size_t k = pcol; k < ncols; ++k)
+        {
+          if (lhs[prow][k] != 0) nzcols.push_back(k);
+        }
+      }
+    }
+    /* (3) */
+    for (size_t j = 0; j < prow; ++j)
+    {
+      uint64_t mul = lhs[j][pcol];
+      if (mul != 0)
+      {
+        for (size_t k : nzcols)
+        {
+          lhs[j][k] = modSubMulWord(lhs[j][k], lhs[prow][k], mul, prime);
+        }
+        rhs[j] = modSubMulWord(rhs[j], rhs[prow], mul, prime);
+      }
+    }
+  }
+
+  bool ispart = false;
+  for (size_t i = 0; i < nrows; ++i)
+  {
+    size_t pcol = i;
+    while (pcol < ncols && lhs[i][pcol] == 0) ++pcol;
+    if (pcol >= ncols)
+    {
+      if (rhs[i] != 0)
+      {
+        /* no solution */
+        return Result::NONE;
+      }
+      continue;
+    }
+    for (size_t j = pcol + 1; j < ncols; ++j)
+    {
+      if (lhs[i][j] != 0)
+      {
+        ispart = true;
+        break;
+      }
+    }
+  }
+
+  if (ispart) { return Result::PARTIAL; }
+
+  return Result::UNIQUE;
+}
+
 /**
  * Apply Gaussian Elimination modulo a (prime) number.
  * The given equation system is represented as a matrix of Integers.
@@ -305,6 +488,35 @@ Result gaussElim(
   #ifdef CVC4_ASSERTIONS
   for (size_t i = 1; i < nrows; ++i) Assert(lhs[i].size() == ncols);
   #endif
+
+  /* The modulus is usually small enough to perform GE on machine words. */
+  if (prime.fitsUnsignedInt())
+  {
+    uint64_t wprime = prime.getUnsignedLong();
+    std::vector<uint64_t> wrhs(nrows);
+    std::vector<std::vector<uint64_t>> wlhs(nrows,
+                                            std::vector<uint64_t>(ncols));
+    for (size_t i = 0; i < nrows; ++i)
+    {
+      wrhs[i] = rhs[i].euclidianDivideRemainder(prime).getUnsignedLong();
+      for (size_t j = 0; j < ncols; ++j)
+      {
+        wlhs[i][j] =
+            lhs[i][j].euclidianDivideRemainder(prime).getUnsignedLong();
+      }
+    }
+    Result ret = gaussElimWord(wprime, wrhs, wlhs);
+    for (size_t i = 0; i < nrows; ++i)
+    {
+      rhs[i] = Integer(wrhs[i]);
+      for (size_t j = 0; j < ncols; ++j)
+      {
+        lhs[i][j] = Integer(wlhs[i][j]);
+      }
+    }
+    return ret;
+  }
+
   /* (1) if element in pivot column is non-zero and != 1, divide row elements
    *     by element in pivot column modulo prime, i.e., multiply row with
    *     multiplicative inverse of element in pivot column modulo prime
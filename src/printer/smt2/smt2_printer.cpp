@@ -498,7 +498,7 @@ void Smt2Printer::toStream(std::ostream& out,
       }
       return;
     }
-    out << "str.++ ";
+    out << (n[0].getType().isSequence() ? "seq.++ " : "str.++ ");
     break;
   case kind::STRING_IN_REGEXP: {
     stringstream ss;
@@ -516,6 +516,19 @@ void Smt2Printer::toStream(std::ostream& out,
   }
   case kind::STRING_LENGTH:
   case kind::STRING_SUBSTR:
+    if (n[0].getType().isSequence())
+    {
+      out << (k == kind::STRING_LENGTH ? "seq.len " : "seq.extract ");
+    }
+    else
+    {
+      out << smtKindString(k, d_variant) << " ";
+    }
+    break;
+  case kind::SEQUENCE_TYPE:
+  case kind::SEQ_UNIT:
+  case kind::SEQ_NTH:
+  case kind::SEQ_UPDATE: out << smtKindString(k, d_variant) << " "; break;
   case kind::STRING_CHARAT:
   case kind::STRING_STRCTN:
   case kind::STRING_STRIDOF:
@@ -608,6 +621,9 @@ void Smt2Printer::toStream(std::ostream& out,
   case kind::SINGLETON:
   case kind::COMPLEMENT: out << smtKindString(k, d_variant) << " "; break;
   case kind::UNIVERSE_SET:out << "(as univset " << n.getType() << ")";break;
+  case kind::EMPTY_SEQUENCE:
+    out << "(as seq.empty " << n.getType() << ")";
+    break;
 
     // fp theory
   case kind::FLOATINGPOINT_FP:
@@ -1084,6 +1100,10 @@ static string smtKindString(Kind k, Variant v)
   case kind::REGEXP_OPT: return "re.opt";
   case kind::REGEXP_RANGE: return "re.range";
   case kind::REGEXP_LOOP: return "re.loop";
+  case kind::SEQUENCE_TYPE: return "Seq";
+  case kind::SEQ_UNIT: return "seq.unit";
+  case kind::SEQ_NTH: return "seq.nth";
+  case kind::SEQ_UPDATE: return "seq.update";
 
   //sep theory
   case kind::SEP_STAR: return "sep";
@@ -100,6 +100,7 @@
 #include "smt_util/node_visitor.h"
 #include "theory/booleans/circuit_propagator.h"
 #include "theory/bv/theory_bv_rewriter.h"
+#include "theory/evaluator.h"
 #include "theory/logic_info.h"
 #include "theory/quantifiers/fun_def_process.h"
 #include "theory/quantifiers/global_negate.h"
@@ -214,6 +215,8 @@ struct SmtEngineStatistics {
   TimerStat d_checkProofTime;
   /** time spent in checkUnsatCore() */
   TimerStat d_checkUnsatCoreTime;
+  /** time spent in minimizeUnsatCore() */
+  TimerStat d_minimizeUnsatCoreTime;
   /** time spent in PropEngine::checkSat() */
   TimerStat d_solveTime;
   /** time spent in pushing/popping */
@@ -245,6 +248,7 @@ struct SmtEngineStatistics {
     d_checkModelTime("smt::SmtEngine::checkModelTime"),
     d_checkProofTime("smt::SmtEngine::checkProofTime"),
     d_checkUnsatCoreTime("smt::SmtEngine::checkUnsatCoreTime"),
+    d_minimizeUnsatCoreTime("smt::SmtEngine::minimizeUnsatCoreTime"),
     d_solveTime("smt::SmtEngine::solveTime"),
     d_pushPopTime("smt::SmtEngine::pushPopTime"),
     d_processAssertionsTime("smt::SmtEngine::processAssertionsTime"),
@@ -270,6 +274,7 @@ struct SmtEngineStatistics {
     smtStatisticsRegistry()->registerStat(&d_checkModelTime);
     smtStatisticsRegistry()->registerStat(&d_checkProofTime);
     smtStatisticsRegistry()->registerStat(&d_checkUnsatCoreTime);
+    smtStatisticsRegistry()->registerStat(&d_minimizeUnsatCoreTime);
     smtStatisticsRegistry()->registerStat(&d_solveTime);
     smtStatisticsRegistry()->registerStat(&d_pushPopTime);
     smtStatisticsRegistry()->registerStat(&d_processAssertionsTime);
@@ -296,6 +301,7 @@ struct SmtEngineStatistics {
     smtStatisticsRegistry()->unregisterStat(&d_checkModelTime);
     smtStatisticsRegistry()->unregisterStat(&d_checkProofTime);
     smtStatisticsRegistry()->unregisterStat(&d_checkUnsatCoreTime);
+    smtStatisticsRegistry()->unregisterStat(&d_minimizeUnsatCoreTime);
     smtStatisticsRegistry()->unregisterStat(&d_solveTime);
     smtStatisticsRegistry()->unregisterStat(&d_pushPopTime);
     smtStatisticsRegistry()->unregisterStat(&d_processAssertionsTime);
@@ -1712,6 +1718,16 @@ void SmtEngine::setDefaults() {
     options::bvLazyRewriteExtf.set(false);
   }
 
+  // The difference logic solver only handles QF_IDL and QF_RDL
+  if (d_theoryEngine->useTheoryAlternative("idl")
+      && !(d_logic.isPure(THEORY_ARITH) && d_logic.isDifferenceLogic()
+           && !d_logic.isQuantified()))
+  {
+    Warning() << "SmtEngine: the difference logic solver (--use-theory=idl) "
+              << "is incomplete for logics other than QF_IDL and QF_RDL"
+              << endl;
+  }
+
   // Turn on arith rewrite equalities only for pure arithmetic
   if(! options::arithRewriteEq.wasSetByUser()) {
     bool arithRewriteEq = d_logic.isPure(THEORY_ARITH) && d_logic.isLinear() && !d_logic.isQuantified();
@@ -4647,6 +4663,12 @@ Result SmtEngine::checkSatisfiability(const vector<Expr>& assumptions,
     Trace("smt") << "SmtEngine::" << (isQuery ? "query" : "checkSat") << "("
                  << assumptions << ") => " << r << endl;
 
+    // Print the instantiation profile if requested
+    if (options::quantProfile())
+    {
+      d_theoryEngine->printQuantProfile(*options::err());
+    }
+
     // Check that SAT results generate a model correctly.
     if(options::checkModels()) {
       // TODO (#1693) check model when unknown result?
@@ -4973,7 +4995,7 @@ Expr SmtEngine::getValue(const Expr& ex) const
   }
 
   Trace("smt") << "--- getting value of " << n << endl;
-  TheoryModel* m = d_theoryEngine->getModel();
+  TheoryModel* m = d_theoryEngine->getBuiltModel(n);
   Node resultNode;
   if(m != NULL) {
     resultNode = m->getValue(n);
@@ -5060,7 +5082,7 @@ vector<pair<Expr, Expr>> SmtEngine::getAssignment()
   if (d_assignments != nullptr)
   {
     TypeNode boolType = d_nodeManager->booleanType();
-    TheoryModel* m = d_theoryEngine->getModel();
+    TheoryModel* m = d_theoryEngine->getBuiltModel();
     for (AssignmentSet::key_iterator i = d_assignments->key_begin(),
                                      iend = d_assignments->key_end();
          i != iend;
@@ -5151,7 +5173,7 @@ Model* SmtEngine::getModel() {
       "Cannot get model when produce-models options is off.";
     throw ModalException(msg);
   }
-  TheoryModel* m = d_theoryEngine->getModel();
+  TheoryModel* m = d_theoryEngine->getBuiltModel();
   m->d_inputName = d_filename;
   return m;
 }
@@ -5197,6 +5219,95 @@ void SmtEngine::checkUnsatCore() {
   }
 }
 
+void SmtEngine::minimizeUnsatCore(std::vector<Expr>& core)
+{
+  TimerStat::CodeTimer minimizeTimer(d_stats->d_minimizeUnsatCoreTime);
+  Notice() << "SmtEngine::minimizeUnsatCore(): minimizing core of size "
+           << core.size() << endl;
+
+  // the cores and proofs of the checks below are neither checked nor
+  // minimized
+  const bool checkUnsatCores = options::checkUnsatCores();
+  const bool minimizeUnsatCores = options::minimizeUnsatCores();
+  const bool checkProofs = options::checkProofs();
+  options::checkUnsatCores.set(false);
+  options::minimizeUnsatCores.set(false);
+  options::checkProofs.set(false);
+  try
+  {
+    // the assertions core[0], ..., core[i-1] are necessary
+    size_t i = 0;
+    while (i < core.size())
+    {
+      std::vector<Expr> candidate(core.begin(), core.begin() + i);
+      candidate.insert(candidate.end(), core.begin() + i + 1, core.end());
+
+      SmtEngine coreChecker(d_exprManager);
+      coreChecker.setLogic(getLogicInfo());
+      PROOF(
+      std::vector<Command*>::const_iterator itg = d_defineCommands.begin();
+      for (; itg != d_defineCommands.end();  ++itg) {
+        (*itg)->invoke(&coreChecker);
+      }
+      );
+      for (const Expr& e : candidate)
+      {
+        coreChecker.assertFormula(e);
+      }
+      Result r = coreChecker.checkSat();
+      if (r.asSatisfiabilityResult().isSat() != Result::UNSAT)
+      {
+        // core[i] is necessary, or we could not show that it is not
+        Notice() << "SmtEngine::minimizeUnsatCore(): keeping " << core[i]
+                 << " (" << r << ")" << endl;
+        i++;
+        continue;
+      }
+      Notice() << "SmtEngine::minimizeUnsatCore(): removing " << core[i]
+               << endl;
+
+      // The core of the remaining assertions may be smaller still. It
+      // contains all the assertions that are necessary in candidate, in
+      // particular those before i, unless the checks for them were unknown.
+      UnsatCore subcore = coreChecker.getUnsatCore();
+      std::unordered_set<Expr, ExprHashFunction> inSubcore(subcore.begin(),
+                                                           subcore.end());
+      std::vector<Expr> ncore;
+      size_t ni = 0;
+      for (size_t j = 0, size = candidate.size(); j < size; j++)
+      {
+        if (inSubcore.find(candidate[j]) != inSubcore.end())
+        {
+          ncore.push_back(candidate[j]);
+          ni += j < i ? 1 : 0;
+        }
+      }
+      if (ncore.size() == inSubcore.size())
+      {
+        core.swap(ncore);
+        i = ni;
+      }
+      else
+      {
+        // the core is not given in terms of the assertions of candidate
+        core.swap(candidate);
+      }
+    }
+  }
+  catch (...)
+  {
+    options::checkUnsatCores.set(checkUnsatCores);
+    options::minimizeUnsatCores.set(minimizeUnsatCores);
+    options::checkProofs.set(checkProofs);
+    throw;
+  }
+  options::checkUnsatCores.set(checkUnsatCores);
+  options::minimizeUnsatCores.set(minimizeUnsatCores);
+  options::checkProofs.set(checkProofs);
+  Notice() << "SmtEngine::minimizeUnsatCore(): minimized core has size "
+           << core.size() << endl;
+}
+
 void SmtEngine::checkModel(bool hardFailure) {
   // --check-model implies --produce-assertions, which enables the
   // assertion list, so we should be ok.
@@ -5210,7 +5321,7 @@ void SmtEngine::checkModel(bool hardFailure) {
   // and if Notice() is on, the user gave --verbose (or equivalent).
 
   Notice() << "SmtEngine::checkModel(): generating model" << endl;
-  TheoryModel* m = d_theoryEngine->getModel();
+  TheoryModel* m = d_theoryEngine->getBuiltModel();
 
   // check-model is not guaranteed to succeed if approximate values were used
   if (m->hasApproximations())
@@ -5230,6 +5341,9 @@ void SmtEngine::checkModel(bool hardFailure) {
   // to be context-dependent)
   context::Context fakeContext;
   SubstitutionMap substitutions(&fakeContext, /* substituteUnderQuantifiers = */ false);
+  // The same substitution, as arguments for the evaluator
+  std::vector<Node> substVars;
+  std::vector<Node> substVals;
 
   for(size_t k = 0; k < m->getNumCommands(); ++k) {
     const DeclareFunctionCommand* c = dynamic_cast<const DeclareFunctionCommand*>(m->getCommand(k));
@@ -5306,6 +5420,8 @@ void SmtEngine::checkModel(bool hardFailure) {
       // (4) checks complete, add the substitution
       Debug("boolean-terms") << "cm: adding subs " << func << " :=> " << val << endl;
       substitutions.addSubstitution(func, val);
+      substVars.push_back(Node::fromExpr(func));
+      substVals.push_back(val);
     }
   }
 
@@ -5321,6 +5437,17 @@ void SmtEngine::checkModel(bool hardFailure) {
     }
     Notice() << "SmtEngine::checkModel(): -- expands to " << n << endl;
 
+    // Most assertions can be evaluated directly on the model values, which
+    // avoids constructing and rewriting the substituted assertion. If this
+    // does not give true, we go through the steps below, which give the
+    // diagnostics for the assertion.
+    Node nv = Evaluator().eval(n, substVars, substVals);
+    if (!nv.isNull() && nv.getConst<bool>())
+    {
+      Notice() << "SmtEngine::checkModel(): -- evaluates to true" << endl;
+      continue;
+    }
+
     // Apply our model value substitutions.
     Debug("boolean-terms") << "applying subses to " << n << endl;
     n = substitutions.apply(n);
@@ -5522,7 +5649,12 @@ UnsatCore SmtEngine::getUnsatCore() {
   }
 
   d_proofManager->traceUnsatCore();// just to trigger core creation
-  return UnsatCore(this, d_proofManager->extractUnsatCore());
+  std::vector<Expr> core = d_proofManager->extractUnsatCore();
+  if (options::minimizeUnsatCores())
+  {
+    minimizeUnsatCore(core);
+  }
+  return UnsatCore(this, core);
 #else /* IS_PROOFS_BUILD */
   throw ModalException("This build of CVC4 doesn't have proof support (required for unsat cores).");
 #endif /* IS_PROOFS_BUILD */
@@ -288,6 +288,16 @@ class CVC4_PUBLIC SmtEngine {
    */
   void checkUnsatCore();
 
+  /**
+   * Minimize the unsatisfiable core, given as a list of assertions, by
+   * deletion: each assertion in turn is removed from the core, and stays
+   * removed if the remaining assertions are unsatisfiable, as determined by
+   * a separate SmtEngine. In that case, the core is further reduced to the
+   * unsatisfiable core computed by that SmtEngine. The result is minimal in
+   * that removing any single assertion gives a satisfiable (or unknown) set.
+   */
+  void minimizeUnsatCore(std::vector<Expr>& core);
+
   /**
    * Check that a generated Model (via getModel()) actually satisfies
    * all user assertions.
@@ -17,8 +17,10 @@
 #include "theory/arith/approx_simplex.h"
 
 #include <math.h>
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
+#include <limits>
 #include <unordered_set>
 
 #include "base/output.h"
@@ -360,6 +362,443 @@ public:
   double sumInfeasibilities(bool mip) const override { return 0.0; }
 };
 
+/**
+ * A built-in floating-point simplex for the real relaxation. It does not
+ * depend on GLPK and does not support the MIP and cut functionality.
+ *
+ * The relaxation is solved on a dense tableau of doubles, starting from the
+ * basis of the auxiliary variables, first with a dual-style pivoting loop
+ * (fix the most violated basic variable, as the exact simplex does) and, if
+ * that runs out of pivots, with a primal phase one that minimizes the sum of
+ * infeasibilities. The final basis is then handed to the exact simplex via
+ * extractRelaxation(), which verifies and repairs it.
+ */
+class ApproxFloatingPoint : public ApproximateSimplex {
+public:
+  ApproxFloatingPoint(const ArithVariables& v, TreeLog& l,
+                      ApproximateStatistics& s);
+  ~ApproxFloatingPoint(){}
+
+  LinResult solveRelaxation() override;
+  Solution extractRelaxation() const override;
+
+  ArithRatPairVec heuristicOptCoeffs() const override
+  {
+    return ArithRatPairVec();
+  }
+
+  MipResult solveMIP(bool al) override { return MipUnknown; }
+  Solution extractMIP() const override { return Solution(); }
+
+  void setOptCoeffs(const ArithRatPairVec& ref) override {}
+
+  void tryCut(int nid, CutInfo& cut) override {}
+
+  std::vector<const CutInfo*> getValidCuts(const NodeLog& node) override
+  {
+    return std::vector<const CutInfo*>();
+  }
+
+  ArithVar getBranchVar(const NodeLog& nl) const override
+  {
+    return ARITHVAR_SENTINEL;
+  }
+
+  double sumInfeasibilities(bool mip) const override;
+
+private:
+  /** Where a non-basic variable sits. */
+  enum NonBasicPos { AtLower, AtUpper, AtValue };
+
+  /** Returns the violation of the bounds of var i, < 0 below, > 0 above. */
+  double violation(uint32_t i) const;
+  /** Adds delta to non-basic i and updates the basic variables. */
+  void updateNonBasic(uint32_t i, double delta);
+  /** Exchanges the basic variable of row r with non-basic i. */
+  void pivot(uint32_t r, uint32_t i);
+  /** Recomputes the values of the basic variables from the non-basics. */
+  void recomputeBasicValues();
+
+  LinResult dualLoop(int pivotLimit);
+  LinResult primalPhaseOne(int pivotLimit);
+
+  /** Entries of absolute value below this are treated as 0. */
+  static const double s_zeroTolerance;
+  /** Bounds are considered satisfied up to this (relative) tolerance. */
+  static const double s_feasTolerance;
+  /** Tableaux with more entries than this are not attempted. */
+  static const size_t s_maxEntries;
+
+  /** Local index <-> ArithVar. */
+  std::vector<ArithVar> d_index2var;
+  DenseMap<uint32_t> d_var2index;
+
+  std::vector<double> d_lb;
+  std::vector<double> d_ub;
+  std::vector<bool> d_hasLb;
+  std::vector<bool> d_hasUb;
+  std::vector<double> d_value;
+  std::vector<NonBasicPos> d_pos;
+
+  /**
+   * d_rows[r] expresses d_basic[r] as a linear combination of the non-basic
+   * variables. d_rowOf[i] is the row of basic variable i, and -1 if i is
+   * non-basic.
+   */
+  std::vector<std::vector<double>> d_rows;
+  std::vector<uint32_t> d_basic;
+  std::vector<int> d_rowOf;
+
+  int d_numPivots;
+  bool d_solved;
+};
+
+const double ApproxFloatingPoint::s_zeroTolerance = 1e-11;
+const double ApproxFloatingPoint::s_feasTolerance = 1e-9;
+const size_t ApproxFloatingPoint::s_maxEntries = 1 << 23;
+
+ApproxFloatingPoint::ApproxFloatingPoint(const ArithVariables& v,
+                                         TreeLog& l,
+                                         ApproximateStatistics& s)
+  : ApproximateSimplex(v, l, s)
+  , d_numPivots(0)
+  , d_solved(false)
+{
+  for(ArithVariables::var_iterator vi = d_vars.var_begin(), vi_end = d_vars.var_end(); vi != vi_end; ++vi){
+    ArithVar v = *vi;
+    d_var2index.set(v, d_index2var.size());
+    d_index2var.push_back(v);
+  }
+  uint32_t n = d_index2var.size();
+  d_lb.resize(n, 0.0);
+  d_ub.resize(n, 0.0);
+  d_hasLb.resize(n, false);
+  d_hasUb.resize(n, false);
+  d_value.resize(n, 0.0);
+  d_pos.resize(n, AtValue);
+  d_rowOf.resize(n, -1);
+
+  for(uint32_t i = 0; i < n; ++i){
+    ArithVar v = d_index2var[i];
+    double cur = d_vars.getAssignment(v).approx(SMALL_FIXED_DELTA);
+    if(d_vars.hasLowerBound(v)){
+      d_hasLb[i] = true;
+      d_lb[i] = d_vars.getLowerBound(v).approx(SMALL_FIXED_DELTA);
+    }
+    if(d_vars.hasUpperBound(v)){
+      d_hasUb[i] = true;
+      d_ub[i] = d_vars.getUpperBound(v).approx(SMALL_FIXED_DELTA);
+    }
+    /* Non-basic variables start at the bound closest to their current
+     * assignment, free ones at their current assignment. */
+    if(d_hasLb[i] && (!d_hasUb[i] || cur - d_lb[i] <= d_ub[i] - cur)){
+      d_pos[i] = AtLower;
+      d_value[i] = d_lb[i];
+    }else if(d_hasUb[i]){
+      d_pos[i] = AtUpper;
+      d_value[i] = d_ub[i];
+    }else{
+      d_pos[i] = AtValue;
+      d_value[i] = cur;
+    }
+  }
+}
+
+double ApproxFloatingPoint::violation(uint32_t i) const{
+  double val = d_value[i];
+  if(d_hasLb[i] && val < d_lb[i] - s_feasTolerance * (1.0 + fabs(d_lb[i]))){
+    return val - d_lb[i];
+  }
+  if(d_hasUb[i] && val > d_ub[i] + s_feasTolerance * (1.0 + fabs(d_ub[i]))){
+    return val - d_ub[i];
+  }
+  return 0.0;
+}
+
+void ApproxFloatingPoint::updateNonBasic(uint32_t i, double delta){
+  Assert(d_rowOf[i] < 0);
+  d_value[i] += delta;
+  for(uint32_t r = 0; r < d_rows.size(); ++r){
+    double c = d_rows[r][i];
+    if(c != 0.0){
+      d_value[d_basic[r]] += c * delta;
+    }
+  }
+}
+
+void ApproxFloatingPoint::recomputeBasicValues(){
+  for(uint32_t r = 0; r < d_rows.size(); ++r){
+    const std::vector<double>& row = d_rows[r];
+    double sum = 0.0;
+    for(uint32_t k = 0; k < row.size(); ++k){
+      if(row[k] != 0.0){ sum += row[k] * d_value[k]; }
+    }
+    d_value[d_basic[r]] = sum;
+  }
+}
+
+void ApproxFloatingPoint::pivot(uint32_t r, uint32_t i){
+  uint32_t b = d_basic[r];
+  std::vector<double>& prow = d_rows[r];
+  double a = prow[i];
+  Assert(fabs(a) > s_zeroTolerance);
+
+  /* b = a i + rest  ==>  i = (1/a) b - (1/a) rest */
+  double inv = 1.0 / a;
+  for(uint32_t k = 0; k < prow.size(); ++k){
+    if(prow[k] != 0.0){ prow[k] *= -inv; }
+  }
+  prow[i] = 0.0;
+  prow[b] = inv;
+
+  for(uint32_t s = 0; s < d_rows.size(); ++s){
+    if(s == r){ continue; }
+    std::vector<double>& row = d_rows[s];
+    double c = row[i];
+    if(c == 0.0){ continue; }
+    row[i] = 0.0;
+    for(uint32_t k = 0; k < row.size(); ++k){
+      if(prow[k] != 0.0){
+        double v = row[k] + c * prow[k];
+        row[k] = fabs(v) < s_zeroTolerance ? 0.0 : v;
+      }
+    }
+  }
+
+  d_basic[r] = i;
+  d_rowOf[i] = r;
+  d_rowOf[b] = -1;
+  if(++d_numPivots % 100 == 0){
+    recomputeBasicValues();
+  }
+}
+
+LinResult ApproxFloatingPoint::dualLoop(int pivotLimit){
+  bool useBland = false;
+  uint32_t blandThreshold = 2 * d_index2var.size();
+  for(int iter = 0; iter < pivotLimit; ++iter){
+    useBland = useBland || (uint32_t)iter >= blandThreshold;
+
+    /* the leaving variable: the most violated basic one */
+    int leaving = -1;
+    double leavingViolation = 0.0;
+    for(uint32_t r = 0; r < d_rows.size(); ++r){
+      double viol = violation(d_basic[r]);
+      if(viol == 0.0){ continue; }
+      bool better = leaving < 0 ||
+        (useBland ? d_basic[r] < d_basic[leaving]
+                  : fabs(viol) > fabs(leavingViolation));
+      if(better){
+        leaving = r;
+        leavingViolation = viol;
+      }
+    }
+    if(leaving < 0){ return LinFeasible; }
+
+    /* the entering variable: one that can move the leaving variable towards
+     * its violated bound, preferring large coefficients for stability */
+    const std::vector<double>& row = d_rows[leaving];
+    bool increase = leavingViolation < 0;
+    int entering = -1;
+    for(uint32_t k = 0; k < row.size(); ++k){
+      double c = row[k];
+      if(fabs(c) <= s_zeroTolerance){ continue; }
+      bool up = (c > 0) == increase;
+      if(up ? (d_hasUb[k] && d_value[k] >= d_ub[k])
+            : (d_hasLb[k] && d_value[k] <= d_lb[k])){
+        continue;
+      }
+      bool better = entering < 0 ||
+        (useBland ? false : fabs(c) > fabs(row[entering]));
+      if(better){ entering = k; }
+    }
+    if(entering < 0){
+      /* the row of the leaving variable cannot be repaired */
+      return LinInfeasible;
+    }
+
+    uint32_t b = d_basic[leaving];
+    double target = increase ? d_lb[b] : d_ub[b];
+    updateNonBasic(entering, (target - d_value[b]) / row[entering]);
+    d_value[b] = target;
+    d_pos[b] = increase ? AtLower : AtUpper;
+    pivot(leaving, entering);
+  }
+  return LinExhausted;
+}
+
+LinResult ApproxFloatingPoint::primalPhaseOne(int pivotLimit){
+  uint32_t n = d_index2var.size();
+  std::vector<int> dir(d_rows.size());
+  std::vector<double> gradient(n);
+  for(int iter = 0; iter < pivotLimit; ++iter){
+    bool feasible = true;
+    for(uint32_t r = 0; r < d_rows.size(); ++r){
+      double viol = violation(d_basic[r]);
+      dir[r] = viol < 0 ? 1 : (viol > 0 ? -1 : 0);
+      feasible = feasible && dir[r] == 0;
+    }
+    if(feasible){ return LinFeasible; }
+
+    /* the rate at which moving each non-basic up decreases the sum of
+     * infeasibilities */
+    std::fill(gradient.begin(), gradient.end(), 0.0);
+    for(uint32_t r = 0; r < d_rows.size(); ++r){
+      if(dir[r] == 0){ continue; }
+      const std::vector<double>& row = d_rows[r];
+      for(uint32_t k = 0; k < n; ++k){
+        if(row[k] != 0.0){ gradient[k] += dir[r] * row[k]; }
+      }
+    }
+    int entering = -1;
+    for(uint32_t k = 0; k < n; ++k){
+      double g = gradient[k];
+      if(d_rowOf[k] >= 0 || fabs(g) <= s_zeroTolerance){ continue; }
+      if(g > 0 ? (d_hasUb[k] && d_value[k] >= d_ub[k])
+               : (d_hasLb[k] && d_value[k] <= d_lb[k])){
+        continue;
+      }
+      if(entering < 0 || fabs(g) > fabs(gradient[entering])){
+        entering = k;
+      }
+    }
+    if(entering < 0){
+      /* the sum of infeasibilities is at a positive minimum */
+      return LinInfeasible;
+    }
+
+    /* ratio test: stop at the first basic variable that reaches a bound it
+     * must not pass, or at the other bound of the entering variable */
+    double sgn = gradient[entering] > 0 ? 1.0 : -1.0;
+    double theta = std::numeric_limits<double>::infinity();
+    if(d_hasLb[entering] && d_hasUb[entering]){
+      theta = d_ub[entering] - d_lb[entering];
+    }
+    int leaving = -1;
+    double leavingTarget = 0.0;
+    for(uint32_t r = 0; r < d_rows.size(); ++r){
+      double rate = sgn * d_rows[r][entering];
+      if(fabs(rate) <= s_zeroTolerance){ continue; }
+      uint32_t b = d_basic[r];
+      bool bounded;
+      double bound;
+      if(rate > 0){
+        bounded = dir[r] > 0 ? true : (dir[r] == 0 && d_hasUb[b]);
+        bound = dir[r] > 0 ? d_lb[b] : d_ub[b];
+      }else{
+        bounded = dir[r] < 0 ? true : (dir[r] == 0 && d_hasLb[b]);
+        bound = dir[r] < 0 ? d_ub[b] : d_lb[b];
+      }
+      if(!bounded){ continue; }
+      double t = std::max(0.0, (bound - d_value[b]) / rate);
+      if(t < theta){
+        theta = t;
+        leaving = r;
+        leavingTarget = bound;
+      }
+    }
+    if(theta == std::numeric_limits<double>::infinity()){
+      /* only possible through numerically negligible coefficients */
+      return LinUnknown;
+    }
+
+    updateNonBasic(entering, sgn * theta);
+    if(leaving < 0){
+      /* bound flip */
+      d_pos[entering] = sgn > 0 ? AtUpper : AtLower;
+      d_value[entering] = sgn > 0 ? d_ub[entering] : d_lb[entering];
+      recomputeBasicValues();
+    }else{
+      uint32_t b = d_basic[leaving];
+      d_value[b] = leavingTarget;
+      d_pos[b] = (d_hasLb[b] && leavingTarget == d_lb[b]) ? AtLower : AtUpper;
+      pivot(leaving, entering);
+    }
+  }
+  return LinExhausted;
+}
+
+LinResult ApproxFloatingPoint::solveRelaxation(){
+  Assert(!d_solved);
+  uint32_t n = d_index2var.size();
+
+  /* the initial basis consists of the auxiliary variables */
+  for(uint32_t i = 0; i < n; ++i){
+    ArithVar v = d_index2var[i];
+    if(d_vars.isAuxiliary(v)){
+      d_rowOf[i] = d_rows.size();
+      d_basic.push_back(i);
+      d_rows.push_back(std::vector<double>());
+    }
+  }
+  if(d_rows.empty() || d_rows.size() * n > s_maxEntries){
+    return LinUnknown;
+  }
+  for(uint32_t r = 0; r < d_rows.size(); ++r){
+    std::vector<double>& row = d_rows[r];
+    row.resize(n, 0.0);
+    ArithVar v = d_index2var[d_basic[r]];
+    Polynomial p = Polynomial::parsePolynomial(d_vars.asNode(v));
+    for(Polynomial::iterator i = p.begin(), end = p.end(); i != end; ++i){
+      const Monomial& mono = *i;
+      Node var = mono.getVarList().getNode();
+      Assert(d_vars.hasArithVar(var));
+      uint32_t k = d_var2index[d_vars.asArithVar(var)];
+      if(d_rowOf[k] >= 0){
+        /* auxiliary variables over auxiliary variables are not supported */
+        return LinUnknown;
+      }
+      row[k] += mono.getConstant().getValue().getDouble();
+    }
+  }
+  recomputeBasicValues();
+
+  LinResult res = dualLoop(d_pivotLimit / 2);
+  if(res == LinExhausted){
+    recomputeBasicValues();
+    res = primalPhaseOne(d_pivotLimit - d_numPivots);
+  }
+  Debug("approx::fp") << "fp simplex " << res << " after " << d_numPivots
+                      << " pivots" << endl;
+  d_solved = res == LinFeasible || res == LinInfeasible;
+  return res;
+}
+
+ApproximateSimplex::Solution ApproxFloatingPoint::extractRelaxation() const{
+  Assert(d_solved);
+  Solution sol;
+  for(uint32_t i = 0; i < d_index2var.size(); ++i){
+    ArithVar v = d_index2var[i];
+    if(d_rowOf[i] >= 0){
+      sol.newBasis.add(v);
+      continue;
+    }
+    /* Non-basic variables only take exact bounds or keep their exact
+     * assignment, so no rounding is needed. */
+    switch(d_pos[i]){
+    case AtLower:
+      sol.newValues.set(v, d_vars.getLowerBound(v));
+      break;
+    case AtUpper:
+      sol.newValues.set(v, d_vars.getUpperBound(v));
+      break;
+    case AtValue:
+    default:
+      sol.newValues.set(v, d_vars.getAssignment(v));
+      break;
+    }
+  }
+  return sol;
+}
+
+double ApproxFloatingPoint::sumInfeasibilities(bool mip) const{
+  double infeas = 0.0;
+  for(uint32_t r = 0; r < d_basic.size(); ++r){
+    infeas += fabs(violation(d_basic[r]));
+  }
+  return infeas;
+}
+
 }/* CVC4::theory::arith namespace */
 }/* CVC4::theory namespace */
 }/* CVC4 namespace */
@@ -545,6 +984,9 @@ ApproximateSimplex* ApproximateSimplex::mkApproximateSimplexSolver(const ArithVa
   return new ApproxNoOp(vars, l, s);
 #endif
 }
+ApproximateSimplex* ApproximateSimplex::mkFloatingPointSimplexSolver(const ArithVariables& vars, TreeLog& l, ApproximateStatistics& s){
+  return new ApproxFloatingPoint(vars, l, s);
+}
 bool ApproximateSimplex::enabled() {
 #ifdef CVC4_USE_GLPK
   return true;
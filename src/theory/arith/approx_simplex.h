@@ -78,6 +78,13 @@ class ApproximateSimplex{
    * If glpk is disabled, return a subclass that does nothing.
    */
   static ApproximateSimplex* mkApproximateSimplexSolver(const ArithVariables& vars, TreeLog& l, ApproximateStatistics& s);
+
+  /**
+   * Returns the built-in floating-point simplex, which does not need glpk.
+   * It only solves the real relaxation; it does not solve MIPs or make cuts.
+   */
+  static ApproximateSimplex* mkFloatingPointSimplexSolver(const ArithVariables& vars, TreeLog& l, ApproximateStatistics& s);
+
   ApproximateSimplex(const ArithVariables& v, TreeLog& l, ApproximateStatistics& s);
   virtual ~ApproximateSimplex(){}
 
@@ -0,0 +1,380 @@
+/*********************                                                        */
+/*! \file basis_factorization.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Sparse LU factorization of a simplex basis.
+ **
+ ** Sparse LU factorization of a simplex basis with Forrest-Tomlin updates.
+ **/
+
+#include "theory/arith/basis_factorization.h"
+
+#include <algorithm>
+
+#include "base/cvc4_assert.h"
+#include "base/output.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+BasisFactorization::BasisFactorization(uint32_t maxUpdates)
+    : d_dim(0), d_maxUpdates(maxUpdates), d_numUpdates(0), d_valid(false)
+{
+}
+
+bool BasisFactorization::factorize(const std::vector<SparseVector>& columns)
+{
+  d_dim = columns.size();
+  d_numUpdates = 0;
+  d_valid = false;
+  d_letas.clear();
+  d_retas.clear();
+  d_urows.assign(d_dim, SparseRow());
+  d_ucols.assign(d_dim, std::set<uint32_t>());
+  d_rowAt.assign(d_dim, 0);
+  d_colAt.assign(d_dim, 0);
+  d_rowPos.assign(d_dim, 0);
+  d_colPos.assign(d_dim, 0);
+
+  /* The active submatrix, by rows and by columns. */
+  std::vector<SparseRow> rows(d_dim);
+  std::vector<std::set<uint32_t>> cols(d_dim);
+  for (uint32_t j = 0; j < d_dim; ++j)
+  {
+    for (const std::pair<uint32_t, Rational>& e : columns[j])
+    {
+      Assert(e.first < d_dim);
+      if (!e.second.isZero())
+      {
+        rows[e.first][j] = e.second;
+        cols[j].insert(e.first);
+      }
+    }
+  }
+
+  std::vector<bool> eliminated(d_dim, false);
+  for (uint32_t k = 0; k < d_dim; ++k)
+  {
+    /* Choose the sparsest active column and in it the sparsest row, which
+     * bounds the fill-in of this step by the Markowitz count. */
+    uint32_t q = d_dim;
+    for (uint32_t j = 0; j < d_dim; ++j)
+    {
+      if (!eliminated[j] && (q == d_dim || cols[j].size() < cols[q].size()))
+      {
+        q = j;
+      }
+    }
+    if (cols[q].empty())
+    {
+      Debug("arith::factor") << "singular basis at step " << k << std::endl;
+      return false;
+    }
+    uint32_t p = d_dim;
+    for (uint32_t i : cols[q])
+    {
+      if (p == d_dim || rows[i].size() < rows[p].size())
+      {
+        p = i;
+      }
+    }
+
+    Rational pivot = rows[p][q];
+    Eta eta;
+    eta.d_row = p;
+    std::vector<uint32_t> below(cols[q].begin(), cols[q].end());
+    for (uint32_t i : below)
+    {
+      if (i == p)
+      {
+        continue;
+      }
+      Rational mult = rows[i][q] / pivot;
+      for (const std::pair<const uint32_t, Rational>& e : rows[p])
+      {
+        uint32_t c = e.first;
+        Rational v = rows[i][c] - mult * e.second;
+        if (v.isZero())
+        {
+          rows[i].erase(c);
+          cols[c].erase(i);
+        }
+        else
+        {
+          rows[i][c] = v;
+          cols[c].insert(i);
+        }
+      }
+      eta.d_entries.push_back(std::make_pair(i, mult));
+    }
+    if (!eta.d_entries.empty())
+    {
+      d_letas.push_back(eta);
+    }
+
+    /* The remainder of row p is row p of U. */
+    for (const std::pair<const uint32_t, Rational>& e : rows[p])
+    {
+      cols[e.first].erase(p);
+      setU(p, e.first, e.second);
+    }
+    rows[p].clear();
+    eliminated[q] = true;
+    d_rowAt[k] = p;
+    d_colAt[k] = q;
+    d_rowPos[p] = k;
+    d_colPos[q] = k;
+  }
+
+  d_valid = true;
+  return true;
+}
+
+void BasisFactorization::applyEtas(DenseVector& x) const
+{
+  for (const Eta& eta : d_letas)
+  {
+    Rational xp = x[eta.d_row];
+    if (xp.isZero())
+    {
+      continue;
+    }
+    for (const std::pair<uint32_t, Rational>& e : eta.d_entries)
+    {
+      x[e.first] -= e.second * xp;
+    }
+  }
+  for (const Eta& eta : d_retas)
+  {
+    Rational& xp = x[eta.d_row];
+    for (const std::pair<uint32_t, Rational>& e : eta.d_entries)
+    {
+      if (!x[e.first].isZero())
+      {
+        xp -= e.second * x[e.first];
+      }
+    }
+  }
+}
+
+void BasisFactorization::ftran(DenseVector& x) const
+{
+  Assert(d_valid);
+  Assert(x.size() == d_dim);
+
+  applyEtas(x);
+  /* back substitution with U */
+  DenseVector res(d_dim);
+  for (uint32_t k = d_dim; k-- > 0;)
+  {
+    uint32_t p = d_rowAt[k];
+    uint32_t q = d_colAt[k];
+    const SparseRow& row = d_urows[p];
+    Rational v = x[p];
+    for (const std::pair<const uint32_t, Rational>& e : row)
+    {
+      if (e.first != q && !res[e.first].isZero())
+      {
+        v -= e.second * res[e.first];
+      }
+    }
+    if (!v.isZero())
+    {
+      res[q] = v / row.find(q)->second;
+    }
+  }
+  x.swap(res);
+}
+
+void BasisFactorization::btran(DenseVector& y) const
+{
+  Assert(d_valid);
+  Assert(y.size() == d_dim);
+
+  /* forward substitution with U^T */
+  DenseVector res(d_dim);
+  for (uint32_t k = 0; k < d_dim; ++k)
+  {
+    uint32_t p = d_rowAt[k];
+    uint32_t q = d_colAt[k];
+    if (y[q].isZero())
+    {
+      continue;
+    }
+    const SparseRow& row = d_urows[p];
+    res[p] = y[q] / row.find(q)->second;
+    for (const std::pair<const uint32_t, Rational>& e : row)
+    {
+      if (e.first != q)
+      {
+        y[e.first] -= e.second * res[p];
+      }
+    }
+  }
+  /* apply the transposed etas in reverse order */
+  for (std::vector<Eta>::const_reverse_iterator it = d_retas.rbegin(),
+                                                end = d_retas.rend();
+       it != end;
+       ++it)
+  {
+    Rational rp = res[it->d_row];
+    if (rp.isZero())
+    {
+      continue;
+    }
+    for (const std::pair<uint32_t, Rational>& e : it->d_entries)
+    {
+      res[e.first] -= e.second * rp;
+    }
+  }
+  for (std::vector<Eta>::const_reverse_iterator it = d_letas.rbegin(),
+                                                end = d_letas.rend();
+       it != end;
+       ++it)
+  {
+    Rational& rp = res[it->d_row];
+    for (const std::pair<uint32_t, Rational>& e : it->d_entries)
+    {
+      if (!res[e.first].isZero())
+      {
+        rp -= e.second * res[e.first];
+      }
+    }
+  }
+  y.swap(res);
+}
+
+bool BasisFactorization::replaceColumn(uint32_t pos, const SparseVector& column)
+{
+  Assert(d_valid);
+  Assert(pos < d_dim);
+
+  /* The spike M a is the new column pos of U. */
+  DenseVector spike(d_dim);
+  for (const std::pair<uint32_t, Rational>& e : column)
+  {
+    Assert(e.first < d_dim);
+    spike[e.first] += e.second;
+  }
+  applyEtas(spike);
+
+  std::set<uint32_t> old = d_ucols[pos];
+  for (uint32_t r : old)
+  {
+    setU(r, pos, Rational(0));
+  }
+  bool isZero = true;
+  uint32_t last = 0;
+  for (uint32_t i = 0; i < d_dim; ++i)
+  {
+    if (!spike[i].isZero())
+    {
+      setU(i, pos, spike[i]);
+      last = std::max(last, d_rowPos[i]);
+      isZero = false;
+    }
+  }
+
+  uint32_t k = d_colPos[pos];
+  uint32_t p = d_rowAt[k];
+  if (isZero || last < k)
+  {
+    d_valid = false;
+    return false;
+  }
+
+  /* Move row p and column pos to position last, and the rows and columns
+   * in between one position up. U is then upper triangular except for row
+   * p, which may have non-zeros in the columns at positions k to last - 1. */
+  for (uint32_t j = k; j < last; ++j)
+  {
+    d_rowAt[j] = d_rowAt[j + 1];
+    d_colAt[j] = d_colAt[j + 1];
+    d_rowPos[d_rowAt[j]] = j;
+    d_colPos[d_colAt[j]] = j;
+  }
+  d_rowAt[last] = p;
+  d_colAt[last] = pos;
+  d_rowPos[p] = last;
+  d_colPos[pos] = last;
+
+  /* Eliminate these with the rows above, recorded as a row eta. */
+  Eta eta;
+  eta.d_row = p;
+  for (uint32_t j = k; j < last; ++j)
+  {
+    uint32_t c = d_colAt[j];
+    SparseRow::const_iterator it = d_urows[p].find(c);
+    if (it == d_urows[p].end())
+    {
+      continue;
+    }
+    uint32_t r = d_rowAt[j];
+    Rational mult = it->second / d_urows[r].find(c)->second;
+    for (const std::pair<const uint32_t, Rational>& e : d_urows[r])
+    {
+      SparseRow::const_iterator pit = d_urows[p].find(e.first);
+      Rational v = pit == d_urows[p].end() ? Rational(0) : pit->second;
+      setU(p, e.first, v - mult * e.second);
+    }
+    Assert(d_urows[p].find(c) == d_urows[p].end());
+    eta.d_entries.push_back(std::make_pair(r, mult));
+  }
+  if (!eta.d_entries.empty())
+  {
+    d_retas.push_back(eta);
+  }
+  ++d_numUpdates;
+
+  if (d_urows[p].find(pos) == d_urows[p].end())
+  {
+    Debug("arith::factor") << "singular basis after update" << std::endl;
+    d_valid = false;
+    return false;
+  }
+  return true;
+}
+
+size_t BasisFactorization::getFactorSize() const
+{
+  size_t size = 0;
+  for (const Eta& eta : d_letas)
+  {
+    size += eta.d_entries.size();
+  }
+  for (const Eta& eta : d_retas)
+  {
+    size += eta.d_entries.size();
+  }
+  for (const SparseRow& row : d_urows)
+  {
+    size += row.size();
+  }
+  return size;
+}
+
+void BasisFactorization::setU(uint32_t row, uint32_t col, const Rational& value)
+{
+  if (value.isZero())
+  {
+    d_urows[row].erase(col);
+    d_ucols[col].erase(row);
+  }
+  else
+  {
+    d_urows[row][col] = value;
+    d_ucols[col].insert(row);
+  }
+}
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace CVC4
@@ -0,0 +1,155 @@
+/*********************                                                        */
+/*! \file basis_factorization.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Sparse LU factorization of a simplex basis.
+ **
+ ** Sparse LU factorization of a simplex basis with Forrest-Tomlin updates,
+ ** the core of a revised simplex tableau.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__THEORY__ARITH__BASIS_FACTORIZATION_H
+#define __CVC4__THEORY__ARITH__BASIS_FACTORIZATION_H
+
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "util/rational.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+/**
+ * Maintains an exact LU factorization of a square, non-singular basis matrix
+ * B, given by its columns.
+ *
+ * The explicit Tableau stores every row of B^{-1} A and updates all of them
+ * on a pivot. A revised simplex tableau instead keeps a factorization of B
+ * and computes the pieces of B^{-1} A it needs on demand:
+ *  - the column of a non-basic variable x_j is ftran(A_j), and
+ *  - the row of the r-th basic variable is btran(e_r)^T A.
+ * A pivot then only replaces one column of B (replaceColumn), which is
+ * applied as a Forrest-Tomlin update of the factors rather than by
+ * refactorizing.
+ *
+ * Internally, M B = U, where M = R_s ... R_1 L_t ... L_1 is a product of
+ * elimination etas (the L_i from factorize, the R_i from the updates), and U
+ * is upper triangular up to a permutation of its rows and columns. The
+ * pivots are chosen Markowitz-style, to keep the factors sparse.
+ *
+ * Rows of B are indexed by the rows of the constraint matrix, columns by the
+ * position of the basic variable in the basis, both from 0 to
+ * getDimension() - 1.
+ */
+class BasisFactorization
+{
+ public:
+  /** A sparse vector given as (index, non-zero value) pairs. */
+  typedef std::vector<std::pair<uint32_t, Rational>> SparseVector;
+  typedef std::vector<Rational> DenseVector;
+
+  /**
+   * Creates an empty factorization that asks to be refactorized after
+   * maxUpdates column replacements.
+   */
+  BasisFactorization(uint32_t maxUpdates);
+
+  /**
+   * Factorizes the basis matrix with the given columns. Returns false if the
+   * matrix is singular, in which case the factorization is not valid.
+   */
+  bool factorize(const std::vector<SparseVector>& columns);
+
+  /** Returns true if the factors represent the current basis. */
+  bool isValid() const { return d_valid; }
+
+  uint32_t getDimension() const { return d_dim; }
+
+  /** Solves B x = a. On entry x is a, on exit it is x. */
+  void ftran(DenseVector& x) const;
+
+  /** Solves y^T B = c^T. On entry y is c, on exit it is y. */
+  void btran(DenseVector& y) const;
+
+  /**
+   * Replaces column pos of the basis with the given column. Returns false if
+   * the new basis is singular, in which case the factorization is not valid
+   * any more and has to be recomputed.
+   */
+  bool replaceColumn(uint32_t pos, const SparseVector& column);
+
+  /** Returns the number of column replacements since the last factorize. */
+  uint32_t getNumUpdates() const { return d_numUpdates; }
+
+  /**
+   * Returns true if the updates made the factors large enough that calling
+   * factorize again is cheaper than going on.
+   */
+  bool needsRefactorization() const { return d_numUpdates >= d_maxUpdates; }
+
+  /** Returns the number of non-zeros in the etas and in U. */
+  size_t getFactorSize() const;
+
+ private:
+  typedef std::map<uint32_t, Rational> SparseRow;
+
+  /**
+   * An elimination eta with pivot row d_row. For the etas of L it performs
+   * x_i -= m_i * x_{d_row}, for the etas of R x_{d_row} -= m_i * x_i, for all
+   * (i, m_i) in d_entries.
+   */
+  struct Eta
+  {
+    uint32_t d_row;
+    SparseVector d_entries;
+  };
+
+  /** Computes M x, i.e., applies the L and R etas to x. */
+  void applyEtas(DenseVector& x) const;
+
+  /** Sets U[row][col] to value, keeping d_ucols in sync. */
+  void setU(uint32_t row, uint32_t col, const Rational& value);
+
+  /** The number of rows (and columns) of the basis. */
+  uint32_t d_dim;
+  /** Requested number of updates between two factorizations. */
+  uint32_t d_maxUpdates;
+  uint32_t d_numUpdates;
+  bool d_valid;
+
+  std::vector<Eta> d_letas;
+  std::vector<Eta> d_retas;
+
+  /** The rows of U. */
+  std::vector<SparseRow> d_urows;
+  /** The rows with a non-zero in each column of U. */
+  std::vector<std::set<uint32_t>> d_ucols;
+
+  /**
+   * U is upper triangular when its rows are taken in the order d_rowAt and
+   * its columns in the order d_colAt. d_rowPos and d_colPos are the
+   * inverses.
+   */
+  std::vector<uint32_t> d_rowAt;
+  std::vector<uint32_t> d_colAt;
+  std::vector<uint32_t> d_rowPos;
+  std::vector<uint32_t> d_colPos;
+}; /* class BasisFactorization */
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace CVC4
+
+#endif /* __CVC4__THEORY__ARITH__BASIS_FACTORIZATION_H */
@@ -0,0 +1,493 @@
+/*********************                                                        */
+/*! \file coverings_solver.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Conflicts for non-linear constraints by covering the real line.
+ **
+ ** Conflicts for non-linear constraints by covering the real line.
+ **/
+
+#include "theory/arith/coverings_solver.h"
+
+#include <map>
+
+#include "base/cvc4_assert.h"
+#include "base/output.h"
+
+using namespace CVC4::kind;
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+bool CoveringsSolver::mkPolynomial(Node t, Node& x, UnivariatePolynomial& p)
+{
+  switch (t.getKind())
+  {
+    case CONST_RATIONAL:
+      p = UnivariatePolynomial(t.getConst<Rational>());
+      return true;
+    case PLUS:
+    case MULT:
+    case NONLINEAR_MULT:
+    {
+      bool isPlus = t.getKind() == PLUS;
+      p = UnivariatePolynomial(Rational(isPlus ? 0 : 1));
+      for (const Node& tc : t)
+      {
+        UnivariatePolynomial pc;
+        if (!mkPolynomial(tc, x, pc))
+        {
+          return false;
+        }
+        p = isPlus ? p + pc : p * pc;
+      }
+      return true;
+    }
+    case MINUS:
+    {
+      UnivariatePolynomial p1;
+      if (!mkPolynomial(t[0], x, p) || !mkPolynomial(t[1], x, p1))
+      {
+        return false;
+      }
+      p = p - p1;
+      return true;
+    }
+    case UMINUS:
+      if (!mkPolynomial(t[0], x, p))
+      {
+        return false;
+      }
+      p = -p;
+      return true;
+    default:
+      if (!x.isNull() && x != t)
+      {
+        return false;
+      }
+      x = t;
+      p = UnivariatePolynomial::mkVariable();
+      return true;
+  }
+}
+
+bool CoveringsSolver::mkConstraint(Node lit, Node& x, Constraint& c)
+{
+  bool pol = lit.getKind() != NOT;
+  Node atom = pol ? lit : lit[0];
+  Kind k = atom.getKind();
+  if (k != EQUAL && k != GEQ && k != GT && k != LEQ && k != LT)
+  {
+    return false;
+  }
+  if (!atom[0].getType().isReal())
+  {
+    return false;
+  }
+  UnivariatePolynomial p0, p1;
+  if (!mkPolynomial(atom[0], x, p0) || !mkPolynomial(atom[1], x, p1))
+  {
+    return false;
+  }
+  if (x.isNull())
+  {
+    // a constant literal
+    return false;
+  }
+  c.d_lit = lit;
+  c.d_poly = p0 - p1;
+  if (pol)
+  {
+    c.d_rel = k;
+  }
+  else
+  {
+    switch (k)
+    {
+      case EQUAL: c.d_rel = DISTINCT; break;
+      case GEQ: c.d_rel = LT; break;
+      case GT: c.d_rel = LEQ; break;
+      case LEQ: c.d_rel = GT; break;
+      default: c.d_rel = GEQ; break;
+    }
+  }
+  return true;
+}
+
+bool CoveringsSolver::getVariables(Node lit,
+                                   std::set<Node>& vars,
+                                   bool& nonlinear)
+{
+  Node atom = lit.getKind() == NOT ? lit[0] : lit;
+  Kind k = atom.getKind();
+  if (k != EQUAL && k != GEQ && k != GT && k != LEQ && k != LT)
+  {
+    return false;
+  }
+  if (!atom[0].getType().isReal())
+  {
+    return false;
+  }
+  getTermVariables(atom[0], vars, nonlinear);
+  getTermVariables(atom[1], vars, nonlinear);
+  return true;
+}
+
+void CoveringsSolver::getTermVariables(Node t,
+                                       std::set<Node>& vars,
+                                       bool& nonlinear)
+{
+  switch (t.getKind())
+  {
+    case CONST_RATIONAL: break;
+    case NONLINEAR_MULT:
+    case PLUS:
+    case MULT:
+    case MINUS:
+    case UMINUS:
+      nonlinear = nonlinear || t.getKind() == NONLINEAR_MULT;
+      for (const Node& tc : t)
+      {
+        getTermVariables(tc, vars, nonlinear);
+      }
+      break;
+    default: vars.insert(t); break;
+  }
+}
+
+bool CoveringsSolver::holds(int s, Kind rel)
+{
+  switch (rel)
+  {
+    case EQUAL: return s == 0;
+    case DISTINCT: return s != 0;
+    case GEQ: return s >= 0;
+    case GT: return s > 0;
+    case LEQ: return s <= 0;
+    default: Assert(rel == LT); return s < 0;
+  }
+}
+
+std::vector<Node> CoveringsSolver::check(const std::vector<Node>& assertions,
+                                         std::map<Node, Node>& witnesses)
+{
+  std::vector<Node> lemmas;
+  // the constraints over each variable
+  std::map<Node, std::vector<Constraint> > cons;
+  std::map<Node, bool> nonlinear;
+  // the non-linear literals over each pair of variables
+  std::map<std::pair<Node, Node>, std::vector<Node> > lifted;
+  for (const Node& lit : assertions)
+  {
+    std::set<Node> vars;
+    bool nl = false;
+    if (!getVariables(lit, vars, nl))
+    {
+      continue;
+    }
+    if (vars.size() == 1)
+    {
+      Node x;
+      Constraint c;
+      if (mkConstraint(lit, x, c))
+      {
+        cons[x].push_back(c);
+        if (c.d_poly.getDegree() > 1)
+        {
+          nonlinear[x] = true;
+        }
+      }
+    }
+    else if (vars.size() == 2 && nl)
+    {
+      lifted[std::make_pair(*vars.begin(), *vars.rbegin())].push_back(lit);
+    }
+  }
+  NodeManager* nm = NodeManager::currentNM();
+  std::map<Node, Node> samples;
+  for (const std::pair<const Node, std::vector<Constraint> >& xc : cons)
+  {
+    std::vector<Node> core;
+    Node witness;
+    if (!checkCovering(xc.second, core, witness))
+    {
+      if (!witness.isNull())
+      {
+        samples[xc.first] = witness;
+      }
+    }
+    else if (nonlinear.find(xc.first) != nonlinear.end())
+    {
+      Node conf = core.size() == 1 ? core[0] : nm->mkNode(AND, core);
+      Node lem = conf.negate();
+      Trace("nl-cov") << "CoveringsSolver: conflict for " << xc.first << " : "
+                      << lem << std::endl;
+      lemmas.push_back(lem);
+    }
+    // linear constraints are decided by the simplex solver
+  }
+  if (!lemmas.empty())
+  {
+    return lemmas;
+  }
+
+  // Lift the sample of the smaller variable x of each pair to the larger
+  // variable y, once for each y. Pairs are ordered by x, so the sample of y
+  // is lifted before y is used as the smaller variable of a pair.
+  std::set<Node> liftedVars;
+  for (const std::pair<const std::pair<Node, Node>, std::vector<Node> >& pl :
+       lifted)
+  {
+    Node x = pl.first.first;
+    Node y = pl.first.second;
+    if (cons.find(x) == cons.end() && samples.find(x) == samples.end())
+    {
+      // x is unconstrained on its own
+      samples[x] = nm->mkConst(Rational(0));
+    }
+    std::map<Node, Node>::iterator its = samples.find(x);
+    if (its == samples.end() || liftedVars.find(y) != liftedVars.end())
+    {
+      continue;
+    }
+    liftedVars.insert(y);
+    Node s = its->second;
+    std::vector<Constraint> cs;
+    std::map<Node, std::vector<Constraint> >::iterator itc = cons.find(y);
+    if (itc != cons.end())
+    {
+      cs = itc->second;
+    }
+    for (const Node& lit : pl.second)
+    {
+      Node ly = y;
+      Constraint c;
+      if (mkConstraint(lit.substitute(TNode(x), TNode(s)), ly, c))
+      {
+        c.d_lit = lit;
+        cs.push_back(c);
+      }
+    }
+    std::vector<Node> core;
+    Node witness;
+    if (checkCovering(cs, core, witness))
+    {
+      core.push_back(x.eqNode(s));
+      Node lem = nm->mkNode(AND, core).negate();
+      Trace("nl-cov") << "CoveringsSolver: conflict for " << y << " at "
+                      << x << " = " << s << " : " << lem << std::endl;
+      lemmas.push_back(lem);
+    }
+    else if (!witness.isNull())
+    {
+      samples[y] = witness;
+    }
+    else
+    {
+      samples.erase(y);
+    }
+    nonlinear[x] = true;
+    nonlinear[y] = true;
+  }
+  if (!lemmas.empty())
+  {
+    return lemmas;
+  }
+
+  for (const std::pair<const Node, Node>& xs : samples)
+  {
+    const Node& x = xs.first;
+    if (!x.isVar() || nonlinear.find(x) == nonlinear.end())
+    {
+      continue;
+    }
+    if (x.getType().isInteger() && !xs.second.getConst<Rational>().isIntegral())
+    {
+      continue;
+    }
+    witnesses[x] = xs.second;
+  }
+  return lemmas;
+}
+
+bool CoveringsSolver::checkCovering(const std::vector<Constraint>& cs,
+                                    std::vector<Node>& core,
+                                    Node& witness)
+{
+  UnivariatePolynomial prod(Rational(1));
+  for (const Constraint& c : cs)
+  {
+    if (c.d_poly.getDegree() > 0)
+    {
+      prod = prod * c.d_poly.squareFreePart();
+    }
+  }
+  std::vector<RealRoot> roots;
+  if (prod.getDegree() > 0)
+  {
+    roots = isolateRealRoots(prod);
+  }
+  Trace("nl-cov-debug") << "CoveringsSolver: " << cs.size()
+                        << " constraints, " << roots.size() << " roots"
+                        << std::endl;
+
+  // The cells are ordered: sector 0, section 0, sector 1, ..., sector n.
+  // For each cell, the constraints it violates.
+  std::vector<std::vector<unsigned> > violated;
+  for (unsigned i = 0; i <= roots.size(); ++i)
+  {
+    // a rational sample in the sector below root i
+    Rational sample;
+    if (roots.empty())
+    {
+      sample = Rational(0);
+    }
+    else if (i == 0)
+    {
+      sample = roots[0].getLower() - Rational(1);
+    }
+    else if (i == roots.size())
+    {
+      sample = roots[i - 1].getUpper() + Rational(1);
+    }
+    else
+    {
+      while (roots[i - 1].getUpper() >= roots[i].getLower())
+      {
+        roots[i - 1].refine();
+        roots[i].refine();
+      }
+      sample = (roots[i - 1].getUpper() + roots[i].getLower()) / Rational(2);
+    }
+    violated.push_back(std::vector<unsigned>());
+    for (unsigned j = 0; j < cs.size(); ++j)
+    {
+      if (!holds(cs[j].d_poly.signAt(sample), cs[j].d_rel))
+      {
+        violated.back().push_back(j);
+      }
+    }
+    if (violated.back().empty())
+    {
+      Trace("nl-cov-debug") << "...satisfied at " << sample << std::endl;
+      witness = NodeManager::currentNM()->mkConst(sample);
+      return false;
+    }
+    if (i == roots.size())
+    {
+      break;
+    }
+    violated.push_back(std::vector<unsigned>());
+    for (unsigned j = 0; j < cs.size(); ++j)
+    {
+      if (!holds(roots[i].signOf(cs[j].d_poly), cs[j].d_rel))
+      {
+        violated.back().push_back(j);
+      }
+    }
+    if (violated.back().empty())
+    {
+      Trace("nl-cov-debug") << "...satisfied at " << roots[i] << std::endl;
+      if (roots[i].isRational())
+      {
+        witness = NodeManager::currentNM()->mkConst(roots[i].getLower());
+      }
+      return false;
+    }
+  }
+
+  // Every cell is excluded. Greedily choose constraints that exclude the
+  // most cells not excluded yet.
+  std::vector<std::vector<unsigned> > excludes(cs.size());
+  for (unsigned k = 0; k < violated.size(); ++k)
+  {
+    for (unsigned j : violated[k])
+    {
+      excludes[j].push_back(k);
+    }
+  }
+  std::vector<bool> covered(violated.size(), false);
+  std::vector<bool> chosen(cs.size(), false);
+  unsigned ncovered = 0;
+  while (ncovered < violated.size())
+  {
+    unsigned best = 0;
+    unsigned bestCount = 0;
+    for (unsigned j = 0; j < cs.size(); ++j)
+    {
+      unsigned count = 0;
+      for (unsigned k : excludes[j])
+      {
+        count += covered[k] ? 0 : 1;
+      }
+      if (count > bestCount)
+      {
+        best = j;
+        bestCount = count;
+      }
+    }
+    Assert(bestCount > 0);
+    chosen[best] = true;
+    for (unsigned k : excludes[best])
+    {
+      if (!covered[k])
+      {
+        covered[k] = true;
+        ncovered++;
+      }
+    }
+  }
+  // remove constraints that became redundant
+  std::vector<unsigned> ncover(violated.size(), 0);
+  for (unsigned j = 0; j < cs.size(); ++j)
+  {
+    if (chosen[j])
+    {
+      for (unsigned k : excludes[j])
+      {
+        ncover[k]++;
+      }
+    }
+  }
+  for (unsigned j = 0; j < cs.size(); ++j)
+  {
+    if (!chosen[j])
+    {
+      continue;
+    }
+    bool redundant = true;
+    for (unsigned k : excludes[j])
+    {
+      if (ncover[k] == 1)
+      {
+        redundant = false;
+        break;
+      }
+    }
+    if (redundant)
+    {
+      chosen[j] = false;
+      for (unsigned k : excludes[j])
+      {
+        ncover[k]--;
+      }
+    }
+    else
+    {
+      core.push_back(cs[j].d_lit);
+    }
+  }
+  return true;
+}
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace CVC4
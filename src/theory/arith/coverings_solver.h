@@ -0,0 +1,125 @@
+/*********************                                                        */
+/*! \file coverings_solver.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Conflicts for non-linear constraints by covering the real line.
+ **
+ ** Conflicts and witnesses for non-linear constraints over one variable,
+ ** computed by covering the real line with the regions excluded by the
+ ** constraints, and lifted to constraints over two variables.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__THEORY__ARITH__COVERINGS_SOLVER_H
+#define __CVC4__THEORY__ARITH__COVERINGS_SOLVER_H
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "expr/kind.h"
+#include "expr/node.h"
+#include "theory/arith/univariate_polynomial.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+/**
+ * Decides the satisfiability over the reals of sets of polynomial
+ * constraints that contain a single variable each, and lifts samples of
+ * such variables to constraints over two variables.
+ *
+ * This is the base case of the cylindrical algebraic coverings method of
+ * Abraham, Davenport, England and Kremer. The real roots of all polynomials
+ * of a variable x partition the real line into sections (the roots) and
+ * sectors (the open intervals between them), on which each polynomial has a
+ * constant sign. The constraints are infeasible if and only if every cell is
+ * excluded by one of them, and a subset of the constraints that still
+ * excludes every cell is an infeasible core. Otherwise, a rational sample of
+ * a cell that no constraint excludes is a witness for x.
+ *
+ * The lifting step substitutes the witness s of x in the constraints over x
+ * and a second variable y, and covers the real line for y. If y is refuted,
+ * the conflict holds for x = s only. The method is complete for refuting the
+ * constraints of one variable at a time, and for two variables at a given
+ * sample of the first, but it does not generalize samples to cells, which
+ * would need multivariate projection.
+ *
+ * Terms that are not arithmetic operators, e.g. sin(y) or f(y), are treated
+ * as variables, and integer variables are relaxed to the reals. Both keep
+ * the conflicts sound.
+ */
+class CoveringsSolver
+{
+ public:
+  /**
+   * Returns a conflict lemma ~(l_1 ^ ... ^ l_n) for each variable x such that
+   * the literals l_1 ... l_n in assertions over x alone (at least one of
+   * them non-linear) are unsatisfiable over the reals. If there are none,
+   * returns the lemmas ~(x = s ^ l_1 ^ ... ^ l_n) of the lifting step, for
+   * non-linear literals l_i over x and one other variable.
+   *
+   * If no lemmas are returned, witnesses maps variables of non-linear
+   * literals to constants that satisfy their literals over one variable,
+   * and their lifted literals over two.
+   */
+  std::vector<Node> check(const std::vector<Node>& assertions,
+                          std::map<Node, Node>& witnesses);
+
+ private:
+  /** A constraint d_poly <d_rel> 0, the meaning of the literal d_lit. */
+  struct Constraint
+  {
+    Node d_lit;
+    UnivariatePolynomial d_poly;
+    Kind d_rel;
+  };
+
+  /**
+   * Converts the arithmetic term t to a polynomial p in the term x. If x is
+   * null, it is set to the first non-arithmetic subterm of t. Returns false
+   * if t contains a second such subterm.
+   */
+  static bool mkPolynomial(Node t, Node& x, UnivariatePolynomial& p);
+  /**
+   * Converts the arithmetic literal lit to a constraint over the term x.
+   * Returns false if lit is not a polynomial constraint over a single term.
+   */
+  static bool mkConstraint(Node lit, Node& x, Constraint& c);
+  /**
+   * Adds the variables of the arithmetic literal lit to vars, and sets
+   * nonlinear to true if it has a non-linear multiplication. Returns false if
+   * lit is not an arithmetic literal.
+   */
+  static bool getVariables(Node lit, std::set<Node>& vars, bool& nonlinear);
+  /** Adds the variables of the arithmetic term t to vars. */
+  static void getTermVariables(Node t, std::set<Node>& vars, bool& nonlinear);
+  /** Returns true if a value with sign s satisfies the relation rel. */
+  static bool holds(int s, Kind rel);
+
+  /**
+   * Returns true if the constraints cs over the same variable are
+   * unsatisfiable, in which case core contains the literals of a subset of
+   * cs that is unsatisfiable. Otherwise, witness is set to a constant that
+   * satisfies cs, or stays null if they are only satisfied at irrational
+   * roots.
+   */
+  bool checkCovering(const std::vector<Constraint>& cs,
+                     std::vector<Node>& core,
+                     Node& witness);
+}; /* class CoveringsSolver */
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace CVC4
+
+#endif /* __CVC4__THEORY__ARITH__COVERINGS_SOLVER_H */
@@ -0,0 +1,171 @@
+/*********************                                                        */
+/*! \file cut_pool.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A pool of integer cuts indexed by their support.
+ **
+ ** A pool of integer cuts indexed by their support.
+ **/
+
+#include "theory/arith/cut_pool.h"
+
+#include <unordered_set>
+
+#include "base/output.h"
+#include "smt/smt_statistics_registry.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+CutPool::Statistics::Statistics() :
+  d_added("theory::arith::cutPool::added",0),
+  d_duplicates("theory::arith::cutPool::duplicates",0),
+  d_reoffered("theory::arith::cutPool::reoffered",0),
+  d_agedOut("theory::arith::cutPool::agedOut",0),
+  d_effective("theory::arith::cutPool::effective",0),
+  d_ineffective("theory::arith::cutPool::ineffective",0)
+{
+  smtStatisticsRegistry()->registerStat(&d_added);
+  smtStatisticsRegistry()->registerStat(&d_duplicates);
+  smtStatisticsRegistry()->registerStat(&d_reoffered);
+  smtStatisticsRegistry()->registerStat(&d_agedOut);
+  smtStatisticsRegistry()->registerStat(&d_effective);
+  smtStatisticsRegistry()->registerStat(&d_ineffective);
+}
+
+CutPool::Statistics::~Statistics(){
+  smtStatisticsRegistry()->unregisterStat(&d_added);
+  smtStatisticsRegistry()->unregisterStat(&d_duplicates);
+  smtStatisticsRegistry()->unregisterStat(&d_reoffered);
+  smtStatisticsRegistry()->unregisterStat(&d_agedOut);
+  smtStatisticsRegistry()->unregisterStat(&d_effective);
+  smtStatisticsRegistry()->unregisterStat(&d_ineffective);
+}
+
+CutPool::CutPool(context::UserContext* u, unsigned maxAge)
+    : d_maxAge(maxAge), d_emitted(u)
+{
+}
+
+bool CutPool::isEmitted(TNode lem) const { return d_emitted.contains(lem); }
+
+bool CutPool::add(TNode lem, const ArithVarVec& support)
+{
+  if (isEmitted(lem))
+  {
+    ++(d_statistics.d_duplicates);
+    Debug("arith::cutPool") << "duplicate cut " << lem << std::endl;
+    return false;
+  }
+  std::unordered_map<Node, Entry, NodeHashFunction>::iterator it =
+      d_pending.find(lem);
+  if (it != d_pending.end())
+  {
+    it->second.d_age = 0;
+    return true;
+  }
+  ++(d_statistics.d_added);
+  Entry& e = d_pending[lem];
+  e.d_support = support;
+  e.d_age = 0;
+  for (ArithVar v : support)
+  {
+    d_index[v].push_back(lem);
+  }
+  return true;
+}
+
+void CutPool::markEmitted(TNode lem)
+{
+  d_emitted.insert(lem);
+  std::unordered_map<Node, Entry, NodeHashFunction>::iterator it =
+      d_pending.find(lem);
+  if (it != d_pending.end())
+  {
+    d_emittedSinceRound.push_back(it->second.d_support);
+    d_pending.erase(it);
+  }
+}
+
+void CutPool::getCutsFor(const ArithVarVec& fractional,
+                         std::vector<Node>& cuts)
+{
+  std::unordered_set<Node, NodeHashFunction> found;
+  for (ArithVar v : fractional)
+  {
+    std::map<ArithVar, std::vector<Node> >::iterator it = d_index.find(v);
+    if (it == d_index.end())
+    {
+      continue;
+    }
+    std::vector<Node>& lems = it->second;
+    size_t j = 0;
+    for (size_t i = 0, N = lems.size(); i < N; ++i)
+    {
+      if (d_pending.find(lems[i]) == d_pending.end())
+      {
+        continue;
+      }
+      lems[j++] = lems[i];
+      if (found.insert(lems[i]).second)
+      {
+        cuts.push_back(lems[i]);
+        ++(d_statistics.d_reoffered);
+      }
+    }
+    lems.resize(j);
+  }
+}
+
+void CutPool::newRound(const ArithVarVec& fractional)
+{
+  std::unordered_set<ArithVar> fracs(fractional.begin(), fractional.end());
+  for (const ArithVarVec& support : d_emittedSinceRound)
+  {
+    bool integral = true;
+    for (ArithVar v : support)
+    {
+      if (fracs.find(v) != fracs.end())
+      {
+        integral = false;
+        break;
+      }
+    }
+    if (integral)
+    {
+      ++(d_statistics.d_effective);
+    }
+    else
+    {
+      ++(d_statistics.d_ineffective);
+    }
+  }
+  d_emittedSinceRound.clear();
+
+  std::unordered_map<Node, Entry, NodeHashFunction>::iterator it =
+      d_pending.begin();
+  while (it != d_pending.end())
+  {
+    if (++(it->second.d_age) > d_maxAge)
+    {
+      ++(d_statistics.d_agedOut);
+      it = d_pending.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace CVC4
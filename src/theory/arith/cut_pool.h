@@ -0,0 +1,132 @@
+/*********************                                                        */
+/*! \file cut_pool.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A pool of integer cuts indexed by their support.
+ **
+ ** A pool of integer cuts indexed by their support.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__THEORY__ARITH__CUT_POOL_H
+#define __CVC4__THEORY__ARITH__CUT_POOL_H
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "context/cdhashset.h"
+#include "context/context.h"
+#include "expr/node.h"
+#include "theory/arith/arithvar.h"
+#include "util/statistics_registry.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+/**
+ * Keeps the cuts found by the integer solving procedures (Gomory and MIR cuts
+ * replayed from the approximate solver, and Diophantine cuts) so that the
+ * work spent finding them is not lost.
+ *
+ * A cut is pending from the time it is added until it is emitted as a lemma.
+ * The approximate solver's cuts are queued in the SAT context and are lost
+ * if the search backtracks before they are emitted. Pending cuts are indexed
+ * by their support, the integer variables they mention, and are offered again
+ * once one of these variables has a fractional value. A pending cut that is
+ * not emitted within a number of integer rounds is aged out of the pool.
+ *
+ * The pool also remembers the cuts emitted in the current user context, so
+ * that the same cut found twice is not counted as progress.
+ */
+class CutPool
+{
+ public:
+  CutPool(context::UserContext* u, unsigned maxAge);
+
+  /** Returns true if lem has been emitted in the current user context. */
+  bool isEmitted(TNode lem) const;
+
+  /**
+   * Adds the cut lem over the integer variables support as pending.
+   * Returns false if lem was already emitted, in which case it is not added.
+   */
+  bool add(TNode lem, const ArithVarVec& support);
+
+  /** Records that lem was emitted as a lemma. */
+  void markEmitted(TNode lem);
+
+  /**
+   * Adds to cuts the pending cuts whose support contains one of the
+   * variables in fractional.
+   */
+  void getCutsFor(const ArithVarVec& fractional, std::vector<Node>& cuts);
+
+  /**
+   * Starts a new integer round in which the variables in fractional are the
+   * integer variables with fractional values. The cuts emitted since the last
+   * round are counted as effective if none of their support is fractional
+   * now. Pending cuts are aged, and the ones older than the maximum age are
+   * removed.
+   */
+  void newRound(const ArithVarVec& fractional);
+
+  /** Returns the number of pending cuts. */
+  size_t numPending() const { return d_pending.size(); }
+
+ private:
+  /** A pending cut. */
+  struct Entry
+  {
+    ArithVarVec d_support;
+    unsigned d_age;
+  };
+
+  /** The maximum number of rounds a cut remains pending. */
+  unsigned d_maxAge;
+
+  /** The cuts that have been emitted in the current user context. */
+  context::CDHashSet<Node, NodeHashFunction> d_emitted;
+
+  /** The pending cuts. */
+  std::unordered_map<Node, Entry, NodeHashFunction> d_pending;
+
+  /**
+   * For each variable, the pending cuts with the variable in their support.
+   * Cuts that are no longer pending are removed lazily.
+   */
+  std::map<ArithVar, std::vector<Node> > d_index;
+
+  /** The supports of the cuts emitted since the last round. */
+  std::vector<ArithVarVec> d_emittedSinceRound;
+
+  class Statistics {
+  public:
+    IntStat d_added;
+    IntStat d_duplicates;
+    IntStat d_reoffered;
+    IntStat d_agedOut;
+    IntStat d_effective;
+    IntStat d_ineffective;
+
+    Statistics();
+    ~Statistics();
+  };
+
+  Statistics d_statistics;
+}; /* class CutPool */
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace CVC4
+
+#endif /* __CVC4__THEORY__ARITH__CUT_POOL_H */
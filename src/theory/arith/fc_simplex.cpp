@@ -351,16 +351,31 @@ UpdateInfo FCSimplexDecisionProcedure::selectPrimalUpdate(ArithVar basic, Linear
 
   bool checkEverything = d_pivots == 0;
 
+  // The candidates are popped and their updates are computed in batches,
+  // and then considered one at a time in heap order.
+  size_t batchSize = d_linEq.speculativeBatchSize();
+  std::vector<LinearEqualityModule::UpdateCandidate> batch;
+  std::vector<UpdateInfo> proposals;
+  size_t next = 0;
+
   int candidatesAfterFocusImprove = 0;
-  while(i != end && (checkEverything || candidatesAfterFocusImprove <= s_maxCandidatesAfterImprove)){
-    std::pop_heap(i, end, colCmp);
-    --end;
-    Cand& cand = (*end);
-    ArithVar curr = cand.d_nb;
-    const Rational& coeff = *cand.d_coeff;
-
-    LinearEqualityModule::UpdatePreferenceFunction leavingPrefFunc = selectLeavingFunction(curr);
-    UpdateInfo currProposal = d_linEq.speculativeUpdate(curr, coeff, leavingPrefFunc);
+  while((next < batch.size() || i != end) && (checkEverything || candidatesAfterFocusImprove <= s_maxCandidatesAfterImprove)){
+    if(next == batch.size()){
+      batch.clear();
+      next = 0;
+      while(i != end && batch.size() < batchSize){
+        std::pop_heap(i, end, colCmp);
+        --end;
+        const Cand& cand = (*end);
+        batch.push_back(LinearEqualityModule::UpdateCandidate(
+            cand.d_nb, cand.d_coeff, selectLeavingFunction(cand.d_nb)));
+      }
+      d_linEq.speculativeUpdates(batch, proposals);
+    }
+    ArithVar curr = batch[next].d_nb;
+    const Rational& coeff = *batch[next].d_focusCoeff;
+    const UpdateInfo& currProposal = proposals[next];
+    ++next;
 
     Debug("arith::selectPrimalUpdate")
       << "selected " << selected << endl
@@ -15,6 +15,9 @@
  **/
 #include "theory/arith/linear_equality.h"
 
+#include <algorithm>
+#include <functional>
+
 #include "base/output.h"
 #include "smt/smt_statistics_registry.h"
 #include "theory/arith/constraint.h"
@@ -55,10 +58,9 @@ LinearEqualityModule::LinearEqualityModule(ArithVariables& vars, Tableau& t, Bou
   d_variables(vars),
   d_tableau(t),
   d_basicVariableUpdates(f),
-  d_increasing(1),
-  d_decreasing(-1),
-  d_upperBoundDifference(),
-  d_lowerBoundDifference(),
+  d_scratch(),
+  d_threadScratch(),
+  d_workers(),
   d_one(1),
   d_negOne(-1),
   d_btracking(boundsTracking),
@@ -75,7 +77,8 @@ LinearEqualityModule::Statistics::Statistics():
   d_weakeningSuccesses("theory::arith::weakening::success",0),
   d_weakenings("theory::arith::weakening::total",0),
   d_weakenTime("theory::arith::weakening::time"),
-  d_forceTime("theory::arith::forcing::time")
+  d_forceTime("theory::arith::forcing::time"),
+  d_parallelSpeculativeUpdates("theory::arith::parallelSpeculativeUpdates",0)
 {
   smtStatisticsRegistry()->registerStat(&d_statPivots);
   smtStatisticsRegistry()->registerStat(&d_statUpdates);
@@ -88,6 +91,8 @@ LinearEqualityModule::Statistics::Statistics():
   smtStatisticsRegistry()->registerStat(&d_weakenings);
   smtStatisticsRegistry()->registerStat(&d_weakenTime);
   smtStatisticsRegistry()->registerStat(&d_forceTime);
+
+  smtStatisticsRegistry()->registerStat(&d_parallelSpeculativeUpdates);
 }
 
 LinearEqualityModule::Statistics::~Statistics(){
@@ -102,6 +107,8 @@ LinearEqualityModule::Statistics::~Statistics(){
   smtStatisticsRegistry()->unregisterStat(&d_weakenings);
   smtStatisticsRegistry()->unregisterStat(&d_weakenTime);
   smtStatisticsRegistry()->unregisterStat(&d_forceTime);
+
+  smtStatisticsRegistry()->unregisterStat(&d_parallelSpeculativeUpdates);
 }
 
 void LinearEqualityModule::includeBoundUpdate(ArithVar v, const BoundsInfo& prev){
@@ -1010,7 +1017,7 @@ ArithVar LinearEqualityModule::minBy(const ArithVarVec& vec, VarPreferenceFuncti
   }
 }
 
-bool LinearEqualityModule::accumulateBorder(const Tableau::Entry& entry, bool ub){
+bool LinearEqualityModule::accumulateBorder(const Tableau::Entry& entry, bool ub, SpeculativeScratch& s){
   ArithVar currBasic = d_tableau.rowIndexToBasic(entry.getRowIndex());
 
   Assert(basicIsTracked(currBasic));
@@ -1026,7 +1033,7 @@ bool LinearEqualityModule::accumulateBorder(const Tableau::Entry& entry, bool ub
 
   const DeltaRational& assignment = d_variables.getAssignment(currBasic);
   DeltaRational toBound = bound->getValue() - assignment;
-  DeltaRational nbDiff = toBound/coeff;
+  DeltaRational nbDiff = ratio(toBound, coeff);
 
   // if ub
   // if toUB >= 0
@@ -1041,7 +1048,7 @@ bool LinearEqualityModule::accumulateBorder(const Tableau::Entry& entry, bool ub
 
   int diffSgn = nbDiff.sgn();
 
-  if(diffSgn != 0 && willBeInConflictAfterPivot(entry, nbDiff, ub)){
+  if(diffSgn != 0 && willBeInConflictAfterPivot(entry, nbDiff, ub, s)){
     return true;
   }else{
     bool areFixing = ub ? (toBound.sgn() < 0 ) : (toBound.sgn() > 0);
@@ -1060,28 +1067,28 @@ bool LinearEqualityModule::accumulateBorder(const Tableau::Entry& entry, bool ub
 
     if(increasing){
       Debug("handleBorders") << "push back increasing " << border << endl;
-      d_increasing.push_back(border);
+      s.d_increasing.push_back(border);
     }else{
       Debug("handleBorders") << "push back decreasing " << border << endl;
-      d_decreasing.push_back(border);
+      s.d_decreasing.push_back(border);
     }
     return false;
   }
 }
 
-bool LinearEqualityModule::willBeInConflictAfterPivot(const Tableau::Entry& entry, const DeltaRational& nbDiff, bool bToUB) const{
+bool LinearEqualityModule::willBeInConflictAfterPivot(const Tableau::Entry& entry, const DeltaRational& nbDiff, bool bToUB, const SpeculativeScratch& s) const{
   int nbSgn = nbDiff.sgn();
   Assert(nbSgn != 0);
 
   if(nbSgn > 0){
-    if (d_upperBoundDifference.nothing()
-        || nbDiff <= d_upperBoundDifference.value())
+    if (s.d_upperBoundDifference.nothing()
+        || nbDiff <= s.d_upperBoundDifference.value())
     {
       return false;
     }
   }else{
-    if (d_lowerBoundDifference.nothing()
-        || nbDiff >= d_lowerBoundDifference.value())
+    if (s.d_lowerBoundDifference.nothing()
+        || nbDiff >= s.d_lowerBoundDifference.value())
     {
       return false;
     }
@@ -1144,38 +1151,42 @@ UpdateInfo LinearEqualityModule::mkConflictUpdate(const Tableau::Entry& entry, b
   const Rational& coeff = entry.getCoefficient();
   const DeltaRational& assignment = d_variables.getAssignment(currBasic);
   DeltaRational toBound = bound->getValue() - assignment;
-  DeltaRational nbDiff = toBound/coeff;
+  DeltaRational nbDiff = ratio(toBound, coeff);
 
   return UpdateInfo::conflict(nb, nbDiff, coeff, bound);
 }
 
 UpdateInfo LinearEqualityModule::speculativeUpdate(ArithVar nb, const Rational& focusCoeff, UpdatePreferenceFunction pref){
-  Assert(d_increasing.empty());
-  Assert(d_decreasing.empty());
-  Assert(d_lowerBoundDifference.nothing());
-  Assert(d_upperBoundDifference.nothing());
-
-  int focusCoeffSgn = focusCoeff.sgn();
-
   static int instance = 0;
   ++instance;
   Debug("speculativeUpdate") << "speculativeUpdate " << instance << endl;
   Debug("speculativeUpdate") << "nb " << nb << endl;
   Debug("speculativeUpdate") << "focusCoeff " << focusCoeff << endl;
 
+  return speculativeUpdate(nb, focusCoeff, pref, d_scratch);
+}
+
+UpdateInfo LinearEqualityModule::speculativeUpdate(ArithVar nb, const Rational& focusCoeff, UpdatePreferenceFunction pref, SpeculativeScratch& s){
+  Assert(s.d_increasing.empty());
+  Assert(s.d_decreasing.empty());
+  Assert(s.d_lowerBoundDifference.nothing());
+  Assert(s.d_upperBoundDifference.nothing());
+
+  int focusCoeffSgn = focusCoeff.sgn();
+
   if(d_variables.hasUpperBound(nb)){
     ConstraintP ub = d_variables.getUpperBoundConstraint(nb);
-    d_upperBoundDifference = ub->getValue() - d_variables.getAssignment(nb);
-    Border border(ub, d_upperBoundDifference.value(), false, NULL, true);
+    s.d_upperBoundDifference = ub->getValue() - d_variables.getAssignment(nb);
+    Border border(ub, s.d_upperBoundDifference.value(), false, NULL, true);
     Debug("handleBorders") << "push back increasing " << border << endl;
-    d_increasing.push_back(border);
+    s.d_increasing.push_back(border);
   }
   if(d_variables.hasLowerBound(nb)){
     ConstraintP lb = d_variables.getLowerBoundConstraint(nb);
-    d_lowerBoundDifference = lb->getValue() - d_variables.getAssignment(nb);
-    Border border(lb, d_lowerBoundDifference.value(), false, NULL, false);
+    s.d_lowerBoundDifference = lb->getValue() - d_variables.getAssignment(nb);
+    Border border(lb, s.d_lowerBoundDifference.value(), false, NULL, false);
     Debug("handleBorders") << "push back decreasing " << border << endl;
-    d_decreasing.push_back(border);
+    s.d_decreasing.push_back(border);
   }
 
   Tableau::ColIterator colIter = d_tableau.colIterator(nb);
@@ -1183,34 +1194,89 @@ UpdateInfo LinearEqualityModule::speculativeUpdate(ArithVar nb, const Rational&
     const Tableau::Entry& entry = *colIter;
     Assert(entry.getColVar() == nb);
 
-    if(accumulateBorder(entry, true)){
-      clearSpeculative();
+    if(accumulateBorder(entry, true, s)){
+      s.clear();
       return mkConflictUpdate(entry, true);
     }
-    if(accumulateBorder(entry, false)){
-      clearSpeculative();
+    if(accumulateBorder(entry, false, s)){
+      s.clear();
       return mkConflictUpdate(entry, false);
     }
   }
 
   UpdateInfo selected;
-  BorderHeap& withSgn = focusCoeffSgn > 0 ? d_increasing : d_decreasing;
-  BorderHeap& againstSgn = focusCoeffSgn > 0 ? d_decreasing : d_increasing;
+  BorderHeap& withSgn = focusCoeffSgn > 0 ? s.d_increasing : s.d_decreasing;
+  BorderHeap& againstSgn = focusCoeffSgn > 0 ? s.d_decreasing : s.d_increasing;
 
   handleBorders(selected, nb, focusCoeff, withSgn, 0, pref);
   int m = 1 - selected.errorsChangeSafe(0);
   handleBorders(selected, nb, focusCoeff, againstSgn, m, pref);
 
-  clearSpeculative();
+  s.clear();
   return selected;
 }
 
-void LinearEqualityModule::clearSpeculative(){
-  // clear everything away
-  d_increasing.clear();
-  d_decreasing.clear();
-  d_lowerBoundDifference.clear();
-  d_upperBoundDifference.clear();
+namespace {
+/**
+ * The minimum number of column entries that the candidates of
+ * speculativeUpdates() must have in total for threads to pay off.
+ */
+const uint32_t s_minParallelColEntries = 4096;
+/** The number of candidates per thread in a batch. */
+const size_t s_candidatesPerThread = 4;
+}/* anonymous namespace */
+
+size_t LinearEqualityModule::speculativeBatchSize() const{
+  unsigned threads = options::arithPivotThreads();
+  return threads <= 1 ? 1 : threads * s_candidatesPerThread;
+}
+
+void LinearEqualityModule::speculativeUpdates(const std::vector<UpdateCandidate>& cands, std::vector<UpdateInfo>& updates){
+  size_t N = cands.size();
+  updates.clear();
+  updates.resize(N);
+
+  size_t threads = 1;
+#ifdef CVC4_GMP_IMP
+  threads = std::min<size_t>(options::arithPivotThreads(), N);
+  if(threads > 1){
+    uint32_t entries = 0;
+    for(const UpdateCandidate& c : cands){
+      entries += d_tableau.getColLength(c.d_nb);
+    }
+    if(entries < s_minParallelColEntries){
+      threads = 1;
+    }
+  }
+#endif /* CVC4_GMP_IMP */
+  if(threads <= 1){
+    for(size_t i = 0; i < N; ++i){
+      updates[i] = speculativeUpdate(cands[i].d_nb, *cands[i].d_focusCoeff, cands[i].d_pref);
+    }
+    return;
+  }
+
+  ++(d_statistics.d_parallelSpeculativeUpdates);
+  if(d_workers == nullptr){
+    size_t maxThreads = options::arithPivotThreads();
+    d_workers.reset(new WorkerPool(maxThreads - 1));
+    while(d_threadScratch.size() < maxThreads){
+      d_threadScratch.push_back(std::unique_ptr<SpeculativeScratch>(new SpeculativeScratch()));
+    }
+  }
+  size_t chunk = (N + threads - 1) / threads;
+  size_t chunks = (N + chunk - 1) / chunk;
+  d_workers->run(chunks, [&](size_t t){
+    speculativeUpdateRange(cands, t * chunk, std::min(N, (t + 1) * chunk),
+                           d_threadScratch[t].get(), &updates);
+  });
+}
+
+void LinearEqualityModule::speculativeUpdateRange(const std::vector<UpdateCandidate>& cands, size_t begin, size_t end, SpeculativeScratch* s, std::vector<UpdateInfo>* updates){
+  for(size_t i = begin; i < end; ++i){
+    const UpdateCandidate& c = cands[i];
+    (*updates)[i] = speculativeUpdate(c.d_nb, *c.d_focusCoeff, c.d_pref, *s);
+  }
 }
 
 void LinearEqualityModule::handleBorders(UpdateInfo& selected, ArithVar nb, const Rational& focusCoeff, BorderHeap& heap, int minimumFixes, UpdatePreferenceFunction pref){
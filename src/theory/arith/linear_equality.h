@@ -29,6 +29,10 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <vector>
+
 #include "options/arith_options.h"
 #include "theory/arith/arithvar.h"
 #include "theory/arith/constraint_forward.h"
@@ -38,6 +42,7 @@
 #include "theory/arith/tableau.h"
 #include "util/maybe.h"
 #include "util/statistics_registry.h"
+#include "util/worker_pool.h"
 
 namespace CVC4 {
 namespace theory {
@@ -191,6 +196,26 @@ public:
   }
 };
 
+/**
+ * The borders found while computing a speculative update for a nonbasic
+ * variable, and the distances from its assignment to its own bounds.
+ * Each thread computing speculative updates needs its own.
+ */
+struct SpeculativeScratch {
+  BorderHeap d_increasing;
+  BorderHeap d_decreasing;
+  Maybe<DeltaRational> d_upperBoundDifference;
+  Maybe<DeltaRational> d_lowerBoundDifference;
+
+  SpeculativeScratch() : d_increasing(1), d_decreasing(-1) {}
+
+  void clear(){
+    d_increasing.clear();
+    d_decreasing.clear();
+    d_lowerBoundDifference.clear();
+    d_upperBoundDifference.clear();
+  }
+};
 
 class LinearEqualityModule {
 public:
@@ -199,6 +224,15 @@ public:
 
   typedef bool (LinearEqualityModule::*UpdatePreferenceFunction)(const UpdateInfo&, const UpdateInfo&) const;
 
+  /** A candidate entering variable for speculativeUpdates(). */
+  struct UpdateCandidate {
+    ArithVar d_nb;
+    const Rational* d_focusCoeff;
+    UpdatePreferenceFunction d_pref;
+
+    UpdateCandidate(ArithVar nb, const Rational* c, UpdatePreferenceFunction pref)
+      : d_nb(nb), d_focusCoeff(c), d_pref(pref) {}
+  };
   
 private:
   /**
@@ -213,10 +247,12 @@ private:
   /** Called whenever the value of a basic variable is updated. */
   BasicVarModelUpdateCallBack d_basicVariableUpdates;
 
-  BorderHeap d_increasing;
-  BorderHeap d_decreasing;
-  Maybe<DeltaRational> d_upperBoundDifference;
-  Maybe<DeltaRational> d_lowerBoundDifference;
+  /** The scratch space of speculativeUpdate(). */
+  SpeculativeScratch d_scratch;
+  /** The scratch space of each thread of speculativeUpdates(). */
+  std::vector<std::unique_ptr<SpeculativeScratch> > d_threadScratch;
+  /** The worker threads of speculativeUpdates(), started on first use. */
+  std::unique_ptr<WorkerPool> d_workers;
 
   Rational d_one;
   Rational d_negOne;
@@ -665,7 +701,7 @@ public:
    * and update using its basic variable and one of the non-basic variables on
    * the row.
    */
-  bool willBeInConflictAfterPivot(const Tableau::Entry& entry, const DeltaRational& nbDiff, bool bToUB) const;
+  bool willBeInConflictAfterPivot(const Tableau::Entry& entry, const DeltaRational& nbDiff, bool bToUB, const SpeculativeScratch& s) const;
   UpdateInfo mkConflictUpdate(const Tableau::Entry& entry, bool ub) const;
 
   /**
@@ -673,7 +709,46 @@ public:
    */
   UpdateInfo speculativeUpdate(ArithVar nb, const Rational& focusCoeff, UpdatePreferenceFunction pref);
 
+  /**
+   * Sets updates[i] to the speculative update of cands[i] for each i.
+   *
+   * The candidates are split into contiguous chunks that are evaluated by
+   * up to options::arithPivotThreads() threads. The updates are the same as
+   * the ones computed one at a time by speculativeUpdate().
+   *
+   * The threads only read the tableau and the assignment, and copy the
+   * rationals they read. This is only safe with the GMP rationals, whose
+   * copies are deep; CLN rationals share reference counts that are not
+   * updated atomically, so with CLN the candidates are always evaluated
+   * serially.
+   */
+  void speculativeUpdates(const std::vector<UpdateCandidate>& cands, std::vector<UpdateInfo>& updates);
+
+  /**
+   * Returns the number of candidates the simplex procedures should pass
+   * to each call of speculativeUpdates().
+   */
+  size_t speculativeBatchSize() const;
+
 private:
+  UpdateInfo speculativeUpdate(ArithVar nb, const Rational& focusCoeff, UpdatePreferenceFunction pref, SpeculativeScratch& s);
+
+  /** Computes the speculative updates of cands[begin] to cands[end-1]. */
+  void speculativeUpdateRange(const std::vector<UpdateCandidate>& cands, size_t begin, size_t end, SpeculativeScratch* s, std::vector<UpdateInfo>* updates);
+
+  /**
+   * Returns toBound/coeff, avoiding the division for the common
+   * coefficients 1 and -1.
+   */
+  DeltaRational ratio(const DeltaRational& toBound, const Rational& coeff) const {
+    if(coeff.isOne()){
+      return toBound;
+    }else if(coeff.isNegativeOne()){
+      return -toBound;
+    }else{
+      return toBound/coeff;
+    }
+  }
 
   /**
    * Examines the effects of pivoting the entries column variable
@@ -692,11 +767,10 @@ private:
    * Returns true if this would be a conflict.
    * If it returns false, this
    */
-  bool accumulateBorder(const Tableau::Entry& entry, bool ub);
+  bool accumulateBorder(const Tableau::Entry& entry, bool ub, SpeculativeScratch& s);
 
   void handleBorders(UpdateInfo& selected, ArithVar nb, const Rational& focusCoeff, BorderHeap& heap, int minimumFixes, UpdatePreferenceFunction pref);
   void pop_block(BorderHeap& heap, int& brokenInBlock, int& fixesRemaining, int& negErrorChange);
-  void clearSpeculative();
   Rational updateCoefficient(BorderVec::const_iterator startBlock, BorderVec::const_iterator endBlock);
 
 private:
@@ -711,6 +785,8 @@ private:
     TimerStat d_weakenTime;
     TimerStat d_forceTime;
 
+    IntStat d_parallelSpeculativeUpdates;
+
     Statistics();
     ~Statistics();
   };
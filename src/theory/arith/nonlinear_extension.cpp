@@ -156,6 +156,8 @@ NonlinearExtension::NonlinearExtension(TheoryArith& containing,
                                        eq::EqualityEngine* ee)
     : d_lemmas(containing.getUserContext()),
       d_zero_split(containing.getUserContext()),
+      d_cov_split(containing.getUserContext()),
+      d_schemas(containing.getUserContext()),
       d_skolem_atoms(containing.getUserContext()),
       d_containing(containing),
       d_ee(ee),
@@ -653,6 +655,20 @@ Node NonlinearExtension::mkMonomialRemFactor(
 int NonlinearExtension::flushLemma(Node lem) {
   Trace("nl-ext-lemma-debug")
       << "NonlinearExtension::Lemma pre-rewrite : " << lem << std::endl;
+  std::map<Node, std::vector<Node> >::iterator its = d_lemma_schemas.find(lem);
+  if (its != d_lemma_schemas.end())
+  {
+    for (const Node& sc : its->second)
+    {
+      Assert(d_schema_pending[sc] > 0);
+      d_schema_pending[sc]--;
+      if (d_schema_pending[sc] == 0)
+      {
+        d_schemas.insert(sc);
+      }
+    }
+    d_lemma_schemas.erase(its);
+  }
   lem = Rewriter::rewrite(lem);
   if (Contains(d_lemmas, lem)) {
     Trace("nl-ext-lemma-debug")
@@ -699,6 +715,50 @@ int NonlinearExtension::flushLemmas(std::vector<Node>& lemmas) {
   return sum;
 }
 
+Node NonlinearExtension::getModelSignature(Node a)
+{
+  std::map<Node, Node>::iterator it = d_m_signature.find(a);
+  if (it != d_m_signature.end())
+  {
+    return it->second;
+  }
+  std::vector<Node> children;
+  children.push_back(a);
+  children.push_back(computeModelValue(a, 0));
+  children.push_back(computeModelValue(a, 1));
+  const NodeMultiset& a_exp = getMonomialExponentMap(a);
+  for (const std::pair<const Node, unsigned>& ae : a_exp)
+  {
+    children.push_back(computeModelValue(ae.first, 0));
+    children.push_back(computeModelValue(ae.first, 1));
+  }
+  Node sig = NodeManager::currentNM()->mkNode(SEXPR, children);
+  d_m_signature[a] = sig;
+  return sig;
+}
+
+bool NonlinearExtension::hasLemmaSchema(Node s) const
+{
+  return d_schemas.contains(s);
+}
+
+void NonlinearExtension::addLemmaSchema(Node s,
+                                        const std::vector<Node>& lemmas,
+                                        size_t start)
+{
+  Assert(start <= lemmas.size());
+  if (start == lemmas.size())
+  {
+    d_schemas.insert(s);
+    return;
+  }
+  for (size_t i = start; i < lemmas.size(); i++)
+  {
+    d_lemma_schemas[lemmas[i]].push_back(s);
+  }
+  d_schema_pending[s] += lemmas.size() - start;
+}
+
 void NonlinearExtension::getAssertions(std::vector<Node>& assertions)
 {
   Trace("nl-ext") << "Getting assertions..." << std::endl;
@@ -1287,6 +1347,9 @@ int NonlinearExtension::checkLastCall(const std::vector<Node>& assertions,
   d_tf_region.clear();
   d_tf_check_model_bounds.clear();
   d_waiting_lemmas.clear();
+  d_m_signature.clear();
+  d_lemma_schemas.clear();
+  d_schema_pending.clear();
 
   int lemmas_proc = 0;
   std::vector<Node> lemmas;
@@ -1430,6 +1493,38 @@ int NonlinearExtension::checkLastCall(const std::vector<Node>& assertions,
   }
   Trace("nl-ext") << "We have " << d_ms.size() << " monomials." << std::endl;
 
+  //-----------------------------------conflicts over a single variable
+  if (options::nlCov())
+  {
+    std::map<Node, Node> witnesses;
+    lemmas = d_coverings.check(assertions, witnesses);
+    lemmas_proc = flushLemmas(lemmas);
+    if (lemmas_proc > 0)
+    {
+      Trace("nl-ext") << "  ...finished with " << lemmas_proc
+                      << " coverings conflicts." << std::endl;
+      return lemmas_proc;
+    }
+    // guide the model towards the witnesses, once per user context
+    for (const std::pair<const Node, Node>& w : witnesses)
+    {
+      Node eq = w.first.eqNode(w.second);
+      if (d_cov_split.insert(eq))
+      {
+        Node literal = d_containing.getValuation().ensureLiteral(eq);
+        d_containing.getOutputChannel().requirePhase(literal, true);
+        lemmas.push_back(literal.orNode(literal.negate()));
+      }
+    }
+    lemmas_proc = flushLemmas(lemmas);
+    if (lemmas_proc > 0)
+    {
+      Trace("nl-ext") << "  ...finished with " << lemmas_proc
+                      << " coverings witness splits." << std::endl;
+      return lemmas_proc;
+    }
+  }
+
   // register constants
   registerMonomial(d_one);
   for (unsigned j = 0; j < d_order_points.size(); j++) {
@@ -2406,17 +2501,40 @@ std::vector<Node> NonlinearExtension::checkMonomialMagnitude( unsigned c ) {
   std::map<int, std::map<Node, std::map<Node, Node> > > cmp_infers;
   Trace("nl-ext") << "Get monomial comparison lemmas (order=" << r
                   << ", compare=" << c << ")..." << std::endl;
+  // The comparison of two monomials only depends on their model signatures.
+  // If incremental refinement is enabled, we skip the comparisons whose
+  // lemmas were already sent for the same signatures.
+  NodeManager* nm = NodeManager::currentNM();
+  bool incRefine = options::nlExtIncRefine();
+  Node cn = nm->mkConst(Rational(c));
+  unsigned nskip = 0;
   for (unsigned j = 0; j < d_ms.size(); j++) {
     Node a = d_ms[j];
     if (d_ms_proc.find(a) == d_ms_proc.end() && 
         d_m_nconst_factor.find( a )==d_m_nconst_factor.end()) {
+      Node a_sig = incRefine ? getModelSignature(a) : Node::null();
       if (c == 0) {
         // compare magnitude against 1
+        Node sc;
+        if (incRefine)
+        {
+          sc = nm->mkNode(SEXPR, cn, a_sig);
+          if (hasLemmaSchema(sc))
+          {
+            nskip++;
+            continue;
+          }
+        }
+        size_t start = lemmas.size();
         std::vector<Node> exp;
         NodeMultiset a_exp_proc;
         NodeMultiset b_exp_proc;
         compareMonomial(a, a, a_exp_proc, d_one, d_one, b_exp_proc, exp,
                         lemmas, cmp_infers);
+        if (incRefine)
+        {
+          addLemmaSchema(sc, lemmas, start);
+        }
       } else {
         std::map<Node, NodeMultiset>::iterator itmea = d_m_exp.find(a);
         Assert(itmea != d_m_exp.end());
@@ -2435,8 +2553,23 @@ std::vector<Node> NonlinearExtension::checkMonomialMagnitude( unsigned c ) {
                 b_exp_proc[v] = 1;
                 setMonomialFactor(a, v, a_exp_proc);
                 setMonomialFactor(v, a, b_exp_proc);
+                Node sc;
+                if (incRefine)
+                {
+                  sc = nm->mkNode(SEXPR, cn, a_sig, v);
+                  if (hasLemmaSchema(sc))
+                  {
+                    nskip++;
+                    continue;
+                  }
+                }
+                size_t start = lemmas.size();
                 compareMonomial(a, a, a_exp_proc, v, v, b_exp_proc, exp,
                                 lemmas, cmp_infers);
+                if (incRefine)
+                {
+                  addLemmaSchema(sc, lemmas, start);
+                }
               }
             }
           }
@@ -2483,14 +2616,32 @@ std::vector<Node> NonlinearExtension::checkMonomialMagnitude( unsigned c ) {
               b, b_exp_proc, exp, lemmas );
               }
               */
+              Node sc;
+              if (incRefine)
+              {
+                sc = nm->mkNode(SEXPR, cn, a_sig, getModelSignature(b));
+                if (hasLemmaSchema(sc))
+                {
+                  nskip++;
+                  continue;
+                }
+              }
+              size_t start = lemmas.size();
               compareMonomial(a, a, a_exp_proc, b, b, b_exp_proc, exp,
                               lemmas, cmp_infers);
+              if (incRefine)
+              {
+                addLemmaSchema(sc, lemmas, start);
+              }
             }
           }
         }
       }
     }
   }
+  Trace("nl-ext-comp") << "Skipped " << nskip
+                       << " comparisons whose lemmas were already sent."
+                       << std::endl;
   // remove redundant lemmas, e.g. if a > b, b > c, a > c were
   // inferred, discard lemma with conclusion a > c
   Trace("nl-ext-comp") << "Compute redundancies for " << lemmas.size()
@@ -2540,6 +2691,7 @@ std::vector<Node> NonlinearExtension::checkMonomialMagnitude( unsigned c ) {
 std::vector<Node> NonlinearExtension::checkTangentPlanes() {
   std::vector< Node > lemmas;
   Trace("nl-ext") << "Get monomial tangent plane lemmas..." << std::endl;
+  bool incRefine = options::nlExtIncRefine();
   unsigned kstart = d_ms_vars.size();
   for (unsigned k = kstart; k < d_mterms.size(); k++) {
     Node t = d_mterms[k];
@@ -2596,7 +2748,22 @@ std::vector<Node> NonlinearExtension::checkTangentPlanes() {
               for( unsigned p=0; p<pts[0].size(); p++ ){
                 Node a_v = pts[0][p];
                 Node b_v = pts[1][p];
-              
+                // the tangent plane lemmas for t at this point
+                Node sc;
+                if (incRefine)
+                {
+                  sc = NodeManager::currentNM()->mkNode(
+                      SEXPR, t, a, b, a_v, b_v);
+                  if (hasLemmaSchema(sc))
+                  {
+                    Trace("nl-ext-tplanes")
+                        << "...already sent for " << a_v << ", " << b_v
+                        << std::endl;
+                    continue;
+                  }
+                }
+                size_t start = lemmas.size();
+
                 // tangent plane
                 Node tplane = NodeManager::currentNM()->mkNode(
                     MINUS,
@@ -2618,6 +2785,10 @@ std::vector<Node> NonlinearExtension::checkTangentPlanes() {
                       << "Tangent plane lemma : " << tlem << std::endl;
                   lemmas.push_back(tlem);
                 }
+                if (incRefine)
+                {
+                  addLemmaSchema(sc, lemmas, start);
+                }
               }
             }
           }
@@ -3610,6 +3781,24 @@ bool NonlinearExtension::checkTfTangentPlanesFun(Node tf,
     return true;
   }
 
+  // If incremental refinement is enabled, we skip the refinement of tf at c
+  // if its lemmas were already sent for the same approximation. The secant
+  // lemmas also depend on the secant points next to c when they were sent,
+  // but they already rule out the value of tf at c. Moreover, c must not be
+  // added to the secant points twice.
+  bool incRefine = options::nlExtIncRefine();
+  Node sc;
+  if (incRefine)
+  {
+    sc = nm->mkNode(SEXPR, tf, nm->mkConst(Rational(d)), c, poly_approx);
+    if (hasLemmaSchema(sc))
+    {
+      Trace("nl-ext-tftp") << "...already sent for " << c << std::endl;
+      return false;
+    }
+  }
+  size_t start = lemmas.size();
+
   if (is_tangent)
   {
     // compute tangent plane
@@ -3781,6 +3970,10 @@ bool NonlinearExtension::checkTfTangentPlanesFun(Node tf,
       }
     }
   }
+  if (incRefine)
+  {
+    addLemmaSchema(sc, lemmas, start);
+  }
   return false;
 }
 
@@ -34,6 +34,7 @@
 #include "context/context.h"
 #include "expr/kind.h"
 #include "expr/node.h"
+#include "theory/arith/coverings_solver.h"
 #include "theory/arith/theory_arith.h"
 #include "theory/uf/equality_engine.h"
 
@@ -386,6 +387,32 @@ class NonlinearExtension {
    */
   int flushLemmas(std::vector<Node>& lemmas);
 
+  //---------------------------------------lemma schemas
+  /** get model signature
+   *
+   * Returns a node that determines the model values of monomial a and of
+   * all variables occurring in it in the current last call effort. The
+   * model-based refinements for a depend on these values only.
+   */
+  Node getModelSignature(Node a);
+  /** has lemma schema
+   *
+   * Returns true if the lemma schema s, a node that determines all lemmas of
+   * one refinement step, was marked done by addLemmaSchema. The lemmas of s
+   * then need not be computed again. This is used only if
+   * options::nlExtIncRefine() is true.
+   */
+  bool hasLemmaSchema(Node s) const;
+  /** add lemma schema
+   *
+   * Records that the lemmas of schema s are lemmas[start], lemmas[start+1],
+   * ... . Once all of them have been passed to flushLemma (in this or in a
+   * later call to flushLemmas), s is marked done. If there are none, s is
+   * marked done immediately.
+   */
+  void addLemmaSchema(Node s, const std::vector<Node>& lemmas, size_t start);
+  //---------------------------------------end lemma schemas
+
   // Returns the NodeMultiset for an existing monomial.
   const NodeMultiset& getMonomialExponentMap(Node monomial) const;
 
@@ -415,6 +442,23 @@ class NonlinearExtension {
   NodeSet d_lemmas;
   /** cache of terms t for which we have added the lemma ( t = 0 V t != 0 ). */
   NodeSet d_zero_split;
+  /**
+   * cache of equalities x = s for which we have added the lemma
+   * ( x = s V x != s ), where s is a witness of the coverings solver.
+   */
+  NodeSet d_cov_split;
+  /**
+   * Lemma schemas whose lemmas have all been sent on the output channel
+   * (user-context-dependent, like d_lemmas).
+   */
+  NodeSet d_schemas;
+  /**
+   * Map from lemmas (before rewriting) to the pending lemma schemas they
+   * belong to, and from pending schemas to their number of lemmas not flushed
+   * yet. These are cleared on each last call effort.
+   */
+  std::map<Node, std::vector<Node> > d_lemma_schemas;
+  std::map<Node, unsigned> d_schema_pending;
   
   /** 
    * The set of atoms with Skolems that this solver introduced. We do not
@@ -451,6 +495,8 @@ class NonlinearExtension {
   eq::EqualityEngine* d_ee;
   // needs last call effort
   bool d_needsLastCall;
+  /** The solver used for options::nlCov(). */
+  CoveringsSolver d_coverings;
 
   // if d_c_info[lit][x] = ( r, coeff, k ), then ( lit <=>  (coeff * x) <k> r )
   std::map<Node, std::map<Node, ConstraintInfo> > d_c_info;
@@ -508,6 +554,9 @@ class NonlinearExtension {
   std::map<Node, bool> d_ms_proc;
   std::vector<Node> d_mterms;
 
+  /** model signatures computed by getModelSignature */
+  std::map<Node, Node> d_m_signature;
+
   //list of monomials with factors whose model value is non-constant in model 
   //  e.g. y*cos( x )
   std::map<Node, bool> d_m_nconst_factor;
@@ -924,7 +973,9 @@ class NonlinearExtension {
    *
    * This runs Figure 3 of Cimatti et al., CADE 2017 for transcendental
    * function application tf for Taylor degree d. It may add a secant or
-   * tangent plane lemma to lems.
+   * tangent plane lemma to lems. If options::nlExtIncRefine() is true, these
+   * lemmas are recorded as the lemma schema of tf, d, the model value of tf[0]
+   * and the approximation, see addLemmaSchema.
    */
   bool checkTfTangentPlanesFun(Node tf, unsigned d, std::vector<Node>& lems);
   //-------------------------------------------- end lemma schemas
@@ -0,0 +1,91 @@
+/*********************                                                        */
+/*! \file pseudo_costs.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Pseudo-costs for choosing the integer variable to branch on.
+ **
+ ** Pseudo-costs for choosing the integer variable to branch on.
+ **/
+
+#include "theory/arith/pseudo_costs.h"
+
+#include <algorithm>
+
+#include "base/cvc4_assert.h"
+#include "base/output.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+namespace {
+/** Keeps the score of a branch with no gain on one side positive. */
+const double s_minGain = 1e-6;
+}  // namespace
+
+PseudoCosts::PseudoCosts()
+    : d_pending(ARITHVAR_SENTINEL), d_pendingFrac(0.0), d_pendingInfeas(0.0)
+{
+}
+
+double PseudoCosts::getScore(ArithVar x, double frac) const
+{
+  double down = d_allDown.average(1.0);
+  double up = d_allUp.average(1.0);
+  if (x < d_down.size())
+  {
+    down = d_down[x].average(down);
+    up = d_up[x].average(up);
+  }
+  return std::max(frac * down, s_minGain)
+         * std::max((1.0 - frac) * up, s_minGain);
+}
+
+void PseudoCosts::branched(ArithVar x,
+                           const Integer& floor,
+                           double frac,
+                           double infeas)
+{
+  d_pending = x;
+  d_pendingFloor = floor;
+  d_pendingFrac = frac;
+  d_pendingInfeas = infeas;
+}
+
+void PseudoCosts::observe(const DeltaRational& value, double infeas)
+{
+  Assert(hasPendingBranch());
+  ArithVar x = d_pending;
+  d_pending = ARITHVAR_SENTINEL;
+  double gain = std::max(d_pendingInfeas - infeas, 0.0);
+  if (x >= d_down.size())
+  {
+    d_down.resize(x + 1);
+    d_up.resize(x + 1);
+  }
+  if (value <= DeltaRational(Rational(d_pendingFloor)))
+  {
+    double s = gain / std::max(d_pendingFrac, s_minGain);
+    d_down[x].add(s);
+    d_allDown.add(s);
+    Debug("arith::pseudoCosts") << "down " << x << " " << s << std::endl;
+  }
+  else if (value >= DeltaRational(Rational(d_pendingFloor + 1)))
+  {
+    double s = gain / std::max(1.0 - d_pendingFrac, s_minGain);
+    d_up[x].add(s);
+    d_allUp.add(s);
+    Debug("arith::pseudoCosts") << "up " << x << " " << s << std::endl;
+  }
+}
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace CVC4
@@ -0,0 +1,110 @@
+/*********************                                                        */
+/*! \file pseudo_costs.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Pseudo-costs for choosing the integer variable to branch on.
+ **
+ ** Pseudo-costs for choosing the integer variable to branch on.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__THEORY__ARITH__PSEUDO_COSTS_H
+#define __CVC4__THEORY__ARITH__PSEUDO_COSTS_H
+
+#include <vector>
+
+#include "theory/arith/arithvar.h"
+#include "theory/arith/delta_rational.h"
+#include "util/integer.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+/**
+ * Estimates how much branching on an integer variable helps.
+ *
+ * Without an objective function, the gain of a branch is measured by the
+ * integer infeasibility of the assignment: the sum over the integer
+ * variables of the distance of their values to the closest integer. After
+ * branching on x with value v, the next assignment has x <= floor(v) (the
+ * down branch) or x >= floor(v)+1 (the up branch). The decrease of the
+ * infeasibility divided by the distance x was rounded is a sample of the
+ * down or up pseudo-cost of x. Variables are scored with the product of the
+ * expected gains of both branches.
+ */
+class PseudoCosts
+{
+ public:
+  PseudoCosts();
+
+  /**
+   * Returns the score of branching on x, whose value has the fractional part
+   * frac. Variables without samples use the average pseudo-cost over all
+   * variables.
+   */
+  double getScore(ArithVar x, double frac) const;
+
+  /**
+   * Records a branch on x, whose value had the floor floor and the fractional
+   * part frac, when the integer infeasibility was infeas.
+   */
+  void branched(ArithVar x, const Integer& floor, double frac, double infeas);
+
+  /** Returns true if the outcome of the last branch is not yet recorded. */
+  bool hasPendingBranch() const { return d_pending != ARITHVAR_SENTINEL; }
+  /** Returns the variable of the last branch. */
+  ArithVar getPendingBranch() const { return d_pending; }
+
+  /**
+   * Records the outcome of the last branch, where value is the current value
+   * of its variable and infeas is the current integer infeasibility. The
+   * outcome is ignored if value does not satisfy either side of the branch.
+   */
+  void observe(const DeltaRational& value, double infeas);
+
+ private:
+  /** The sum and number of samples of a pseudo-cost. */
+  struct Samples
+  {
+    Samples() : d_sum(0.0), d_count(0) {}
+    double d_sum;
+    unsigned d_count;
+    double average(double def) const
+    {
+      return d_count == 0 ? def : d_sum / d_count;
+    }
+    void add(double s)
+    {
+      d_sum += s;
+      d_count++;
+    }
+  };
+
+  /** The down and up pseudo-costs of each variable. */
+  std::vector<Samples> d_down;
+  std::vector<Samples> d_up;
+  /** The samples of all variables. */
+  Samples d_allDown;
+  Samples d_allUp;
+
+  /** The last branch, if its outcome is not yet recorded. */
+  ArithVar d_pending;
+  Integer d_pendingFloor;
+  double d_pendingFrac;
+  double d_pendingInfeas;
+}; /* class PseudoCosts */
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace CVC4
+
+#endif /* __CVC4__THEORY__ARITH__PSEUDO_COSTS_H */
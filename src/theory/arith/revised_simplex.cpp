@@ -0,0 +1,296 @@
+/*********************                                                        */
+/*! \file revised_simplex.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A revised simplex procedure on a factorized basis.
+ **
+ ** A revised simplex procedure on a factorized basis.
+ **/
+#include "theory/arith/revised_simplex.h"
+
+#include "base/output.h"
+#include "options/arith_options.h"
+#include "smt/smt_statistics_registry.h"
+#include "theory/arith/constraint.h"
+
+using namespace std;
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+const uint32_t RevisedSimplexDecisionProcedure::s_maxUpdates = 64;
+
+RevisedSimplexDecisionProcedure::RevisedSimplexDecisionProcedure(
+    LinearEqualityModule& linEq,
+    ErrorSet& errors,
+    RaiseConflict conflictChannel,
+    TempVarMalloc tvmalloc,
+    AttemptSolutionSDP& importer)
+  : SimplexDecisionProcedure(linEq, errors, conflictChannel, tvmalloc)
+  , d_importer(importer)
+  , d_factors(s_maxUpdates)
+  , d_statistics()
+{ }
+
+RevisedSimplexDecisionProcedure::Statistics::Statistics():
+  d_pivots("theory::arith::revised::pivots", 0),
+  d_refactorizations("theory::arith::revised::refactorizations", 0),
+  d_conflicts("theory::arith::revised::conflicts", 0),
+  d_recentViolationCatches("theory::arith::revised::recentViolationCatches", 0),
+  d_searchTime("theory::arith::revised::searchTime"),
+  d_importTime("theory::arith::revised::importTime"),
+  d_processSignalsTime("theory::arith::revised::processSignalsTime")
+{
+  smtStatisticsRegistry()->registerStat(&d_pivots);
+  smtStatisticsRegistry()->registerStat(&d_refactorizations);
+  smtStatisticsRegistry()->registerStat(&d_conflicts);
+  smtStatisticsRegistry()->registerStat(&d_recentViolationCatches);
+  smtStatisticsRegistry()->registerStat(&d_searchTime);
+  smtStatisticsRegistry()->registerStat(&d_importTime);
+  smtStatisticsRegistry()->registerStat(&d_processSignalsTime);
+}
+
+RevisedSimplexDecisionProcedure::Statistics::~Statistics(){
+  smtStatisticsRegistry()->unregisterStat(&d_pivots);
+  smtStatisticsRegistry()->unregisterStat(&d_refactorizations);
+  smtStatisticsRegistry()->unregisterStat(&d_conflicts);
+  smtStatisticsRegistry()->unregisterStat(&d_recentViolationCatches);
+  smtStatisticsRegistry()->unregisterStat(&d_searchTime);
+  smtStatisticsRegistry()->unregisterStat(&d_importTime);
+  smtStatisticsRegistry()->unregisterStat(&d_processSignalsTime);
+}
+
+Result::Sat RevisedSimplexDecisionProcedure::findModel(bool exactResult){
+  Assert(d_conflictVariables.empty());
+  d_pivots = 0;
+
+  if(d_errorSet.errorEmpty() && !d_errorSet.moreSignals()){
+    Debug("arith::revised") << "revisedFindModel() trivial" << endl;
+    return Result::SAT;
+  }
+
+  d_errorSet.reduceToSignals();
+  d_errorSet.setSelectionRule(VAR_ORDER);
+
+  if(processSignals()){
+    d_conflictVariables.purge();
+    Debug("arith::revised") << "revisedFindModel() early conflict" << endl;
+    return Result::UNSAT;
+  }else if(d_errorSet.errorEmpty()){
+    Debug("arith::revised") << "revisedFindModel() fixed itself" << endl;
+    return Result::SAT;
+  }
+
+  int32_t maxIterations = -1;
+  if(!exactResult && options::arithStandardCheckVarOrderPivots() >= 0){
+    maxIterations = options::arithStandardCheckVarOrderPivots();
+  }
+
+  ArithVar conflict = ARITHVAR_SENTINEL;
+  {
+    TimerStat::CodeTimer codeTimer(d_statistics.d_searchTime);
+    if(!initialize()){
+      return Result::SAT_UNKNOWN;
+    }
+    conflict = search(maxIterations);
+  }
+  Debug("arith::revised") << "revisedFindModel() " << d_pivots << " pivots, "
+                          << "conflict on " << conflict << endl;
+
+  TimerStat::CodeTimer codeTimer(d_statistics.d_importTime);
+  return importSolution(conflict);
+}
+
+bool RevisedSimplexDecisionProcedure::initialize(){
+  ArithVar numVars = d_variables.getNumberOfVariables();
+  d_rows.clear();
+  d_columns.assign(numVars, BasisFactorization::SparseVector());
+  d_values.assign(numVars, DeltaRational());
+  d_basicAt.clear();
+  d_posOf.assign(numVars, -1);
+
+  for(ArithVariables::var_iterator vi = d_variables.var_begin(),
+        vi_end = d_variables.var_end(); vi != vi_end; ++vi){
+    d_values[*vi] = d_variables.getAssignment(*vi);
+  }
+
+  for(Tableau::BasicIterator bi = d_tableau.beginBasic(),
+        bi_end = d_tableau.endBasic(); bi != bi_end; ++bi){
+    ArithVar basic = *bi;
+    uint32_t r = d_rows.size();
+    d_rows.push_back(Row());
+    d_posOf[basic] = r;
+    d_basicAt.push_back(basic);
+    for(Tableau::RowIterator ri = d_tableau.basicRowIterator(basic);
+        !ri.atEnd(); ++ri){
+      const Tableau::Entry& entry = *ri;
+      ArithVar v = entry.getColVar();
+      const Rational& coeff = entry.getCoefficient();
+      d_rows[r].push_back(make_pair(v, coeff));
+      d_columns[v].push_back(make_pair(r, coeff));
+    }
+  }
+  return refactorize();
+}
+
+bool RevisedSimplexDecisionProcedure::refactorize(){
+  ++(d_statistics.d_refactorizations);
+  std::vector<BasisFactorization::SparseVector> basis;
+  basis.reserve(d_basicAt.size());
+  for(ArithVar b : d_basicAt){
+    basis.push_back(d_columns[b]);
+  }
+  return d_factors.factorize(basis);
+}
+
+ArithVar RevisedSimplexDecisionProcedure::selectLeaving() const{
+  ArithVar leaving = ARITHVAR_SENTINEL;
+  for(ArithVar b : d_basicAt){
+    if(b < leaving &&
+       (d_variables.cmpToLowerBound(b, d_values[b]) < 0 ||
+        d_variables.cmpToUpperBound(b, d_values[b]) > 0)){
+      leaving = b;
+    }
+  }
+  return leaving;
+}
+
+void RevisedSimplexDecisionProcedure::computeRow(uint32_t pos,
+                                                 DenseMap<Rational>& alpha){
+  // y^T B = e_pos^T, then x_b = - sum_j (y^T A_j) x_j over the non-basics
+  BasisFactorization::DenseVector y(d_basicAt.size(), d_zero);
+  y[pos] = d_posOne;
+  d_factors.btran(y);
+
+  alpha.purge();
+  for(uint32_t r = 0, m = y.size(); r < m; ++r){
+    if(y[r].isZero()){
+      continue;
+    }
+    for(const std::pair<ArithVar, Rational>& e : d_rows[r]){
+      if(d_posOf[e.first] >= 0){
+        continue;
+      }
+      Rational prod = y[r] * e.second;
+      if(alpha.isKey(e.first)){
+        alpha.get(e.first) -= prod;
+      }else{
+        alpha.set(e.first, -prod);
+      }
+    }
+  }
+}
+
+void RevisedSimplexDecisionProcedure::updateNonBasic(ArithVar x_j,
+                                                     const DeltaRational& delta){
+  // B x_B + A_j x_j + ... = 0, so x_B moves by -(B^{-1} A_j) delta
+  BasisFactorization::DenseVector d(d_basicAt.size(), d_zero);
+  for(const std::pair<uint32_t, Rational>& e : d_columns[x_j]){
+    d[e.first] = e.second;
+  }
+  d_factors.ftran(d);
+  for(uint32_t p = 0, m = d.size(); p < m; ++p){
+    if(!d[p].isZero()){
+      ArithVar b = d_basicAt[p];
+      d_values[b] = d_values[b] - delta * d[p];
+    }
+  }
+  d_values[x_j] = d_values[x_j] + delta;
+}
+
+void RevisedSimplexDecisionProcedure::pivot(uint32_t pos, ArithVar x_j){
+  ArithVar leaving = d_basicAt[pos];
+  d_posOf[leaving] = -1;
+  d_posOf[x_j] = pos;
+  d_basicAt[pos] = x_j;
+  ++d_pivots;
+  ++(d_statistics.d_pivots);
+
+  if(d_factors.needsRefactorization() ||
+     !d_factors.replaceColumn(pos, d_columns[x_j])){
+    bool nonSingular CVC4_UNUSED = refactorize();
+    Assert(nonSingular);
+  }
+}
+
+ArithVar RevisedSimplexDecisionProcedure::search(int32_t maxIterations){
+  DenseMap<Rational> alpha;
+  for(int32_t iter = 0; maxIterations < 0 || iter < maxIterations; ++iter){
+    ArithVar x_i = selectLeaving();
+    if(x_i == ARITHVAR_SENTINEL){
+      return ARITHVAR_SENTINEL;
+    }
+    uint32_t pos = d_posOf[x_i];
+    computeRow(pos, alpha);
+
+    bool increase = d_variables.cmpToLowerBound(x_i, d_values[x_i]) < 0;
+    ArithVar x_j = ARITHVAR_SENTINEL;
+    for(DenseMap<Rational>::const_iterator i = alpha.begin(), i_end = alpha.end();
+        i != i_end; ++i){
+      ArithVar v = *i;
+      int sgn = alpha[v].sgn();
+      if(sgn == 0 || v > x_j){
+        continue;
+      }
+      bool up = (sgn > 0) == increase;
+      bool canMove = up ? d_variables.cmpToUpperBound(v, d_values[v]) < 0
+                        : d_variables.cmpToLowerBound(v, d_values[v]) > 0;
+      if(canMove){
+        x_j = v;
+      }
+    }
+    if(x_j == ARITHVAR_SENTINEL){
+      // no non-basic variable can repair the row of x_i
+      return x_i;
+    }
+
+    const DeltaRational& target = increase ? d_variables.getLowerBound(x_i)
+                                           : d_variables.getUpperBound(x_i);
+    DeltaRational delta = (target - d_values[x_i]) / alpha[x_j];
+    updateNonBasic(x_j, delta);
+    Assert(d_values[x_i] == target);
+    pivot(pos, x_j);
+  }
+  return ARITHVAR_SENTINEL;
+}
+
+Result::Sat RevisedSimplexDecisionProcedure::importSolution(ArithVar conflict){
+  ApproximateSimplex::Solution sol;
+  for(ArithVar b : d_basicAt){
+    sol.newBasis.add(b);
+  }
+  for(ArithVariables::var_iterator vi = d_variables.var_begin(),
+        vi_end = d_variables.var_end(); vi != vi_end; ++vi){
+    ArithVar v = *vi;
+    if(d_posOf[v] < 0){
+      sol.newValues.set(v, d_values[v]);
+    }
+  }
+
+  Result::Sat result = d_importer.attempt(sol);
+  if(result == Result::SAT_UNKNOWN && conflict != ARITHVAR_SENTINEL){
+    // the import stops pivoting once it finds a conflict, or when the basis
+    // is in place; the row of conflict is then in the tableau
+    Assert(d_tableau.isBasic(conflict));
+    if(!d_variables.assignmentIsConsistent(conflict) &&
+       checkBasicForConflict(conflict)){
+      reportConflict(conflict);
+      ++(d_statistics.d_conflicts);
+      d_conflictVariables.purge();
+      result = Result::UNSAT;
+    }
+  }
+  return result;
+}
+
+}/* CVC4::theory::arith namespace */
+}/* CVC4::theory namespace */
+}/* CVC4 namespace */
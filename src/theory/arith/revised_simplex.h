@@ -0,0 +1,139 @@
+/*********************                                                        */
+/*! \file revised_simplex.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A revised simplex procedure on a factorized basis.
+ **
+ ** A revised simplex procedure that searches for a feasible basis without
+ ** pivoting the explicit Tableau, computing the rows and columns it needs
+ ** from an LU factorization of the basis.
+ **/
+
+#include "cvc4_private.h"
+
+#pragma once
+
+#include <vector>
+
+#include "theory/arith/attempt_solution_simplex.h"
+#include "theory/arith/basis_factorization.h"
+#include "theory/arith/simplex.h"
+#include "util/statistics_registry.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+/**
+ * The tableau rows at the start of findModel() are taken as the constraint
+ * matrix A, with A x = 0, and the current basis as the initial basis B. The
+ * search then works on a BasisFactorization of B:
+ *  - the row of a basic variable is computed by btran, and combined with the
+ *    rows of A that it selects, and
+ *  - the column of the entering variable is computed by ftran,
+ * and a pivot only replaces a column of the factorization. The pivot rule is
+ * Bland's rule on a violated basic variable, as in the variable order phase
+ * of DualSimplexDecisionProcedure, which ensures termination.
+ *
+ * When the search stops, its basis and the assignment of its non-basic
+ * variables are imported into the Tableau by AttemptSolutionSDP, so the
+ * explicit tableau is only pivoted into the final basis. If the search finds
+ * a basic variable whose row cannot be repaired, that row is in the Tableau
+ * after the import and the conflict is explained from it as usual.
+ */
+class RevisedSimplexDecisionProcedure : public SimplexDecisionProcedure {
+public:
+  RevisedSimplexDecisionProcedure(LinearEqualityModule& linEq,
+                                  ErrorSet& errors,
+                                  RaiseConflict conflictChannel,
+                                  TempVarMalloc tvmalloc,
+                                  AttemptSolutionSDP& importer);
+
+  Result::Sat findModel(bool exactResult) override;
+
+private:
+  /** A row of A, as (variable, coefficient) pairs. */
+  typedef std::vector<std::pair<ArithVar, Rational> > Row;
+
+  /** Copies the tableau and the assignment, and factorizes the basis. */
+  bool initialize();
+
+  /** Refactorizes the current basis. */
+  bool refactorize();
+
+  /**
+   * Runs at most maxIterations pivots, or an unlimited number if
+   * maxIterations is negative. Returns the basic variable of a row that
+   * proves a conflict, or ARITHVAR_SENTINEL.
+   */
+  ArithVar search(int32_t maxIterations);
+
+  /** Returns the violated basic variable with the smallest index. */
+  ArithVar selectLeaving() const;
+
+  /**
+   * Computes the row of the basic variable at position pos, that is the
+   * coefficients alpha such that x_b = sum_j alpha_j x_j over the non-basic
+   * variables.
+   */
+  void computeRow(uint32_t pos, DenseMap<Rational>& alpha);
+
+  /** Moves the non-basic variable x_j by delta, and updates the basics. */
+  void updateNonBasic(ArithVar x_j, const DeltaRational& delta);
+
+  /** Replaces the basic variable at position pos by x_j. */
+  void pivot(uint32_t pos, ArithVar x_j);
+
+  /** Imports the final basis and assignment into the Tableau. */
+  Result::Sat importSolution(ArithVar conflict);
+
+  bool processSignals(){
+    TimerStat &timer = d_statistics.d_processSignalsTime;
+    IntStat& conflictStat  = d_statistics.d_recentViolationCatches;
+    return standardProcessSignals(timer, conflictStat);
+  }
+
+  /** Imports the result of the search into the Tableau. */
+  AttemptSolutionSDP& d_importer;
+
+  BasisFactorization d_factors;
+
+  /** The rows of A. */
+  std::vector<Row> d_rows;
+  /** The columns of A, as (row, coefficient) pairs. */
+  std::vector<BasisFactorization::SparseVector> d_columns;
+  /** The assignment of the search. */
+  std::vector<DeltaRational> d_values;
+  /** The basic variable at each position of the basis. */
+  std::vector<ArithVar> d_basicAt;
+  /** The position of each basic variable, or -1 for non-basic variables. */
+  std::vector<int32_t> d_posOf;
+
+  /** Number of pivots between two factorizations. */
+  static const uint32_t s_maxUpdates;
+
+  class Statistics {
+  public:
+    IntStat d_pivots;
+    IntStat d_refactorizations;
+    IntStat d_conflicts;
+    IntStat d_recentViolationCatches;
+    TimerStat d_searchTime;
+    TimerStat d_importTime;
+    TimerStat d_processSignalsTime;
+
+    Statistics();
+    ~Statistics();
+  } d_statistics;
+};/* class RevisedSimplexDecisionProcedure */
+
+}/* CVC4::theory::arith namespace */
+}/* CVC4::theory namespace */
+}/* CVC4 namespace */
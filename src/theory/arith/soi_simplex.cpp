@@ -279,16 +279,30 @@ UpdateInfo SumOfInfeasibilitiesSPD::selectUpdate(LinearEqualityModule::UpdatePre
   int maxCandidatesAfterImprove =
     (d_pivots <= 2) ?  std::numeric_limits<int>::max() : d_pivots/5;
 
+  // The candidates are popped and their updates are computed in batches,
+  // and then considered one at a time in heap order.
+  size_t batchSize = d_linEq.speculativeBatchSize();
+  std::vector<LinearEqualityModule::UpdateCandidate> batch;
+  std::vector<UpdateInfo> proposals;
+  size_t next = 0;
+
   int candidatesAfterFocusImprove = 0;
-  while(i != end && candidatesAfterFocusImprove <= maxCandidatesAfterImprove){
-    std::pop_heap(i, end, colCmp);
-    --end;
-    Cand& cand = (*end);
-    ArithVar curr = cand.d_nb;
-    const Rational& coeff = *cand.d_coeff;
-
-    LinearEqualityModule::UpdatePreferenceFunction leavingPrefFunc = selectLeavingFunction(curr);
-    UpdateInfo currProposal = d_linEq.speculativeUpdate(curr, coeff, leavingPrefFunc);
+  while((next < batch.size() || i != end) && candidatesAfterFocusImprove <= maxCandidatesAfterImprove){
+    if(next == batch.size()){
+      batch.clear();
+      next = 0;
+      while(i != end && batch.size() < batchSize){
+        std::pop_heap(i, end, colCmp);
+        --end;
+        const Cand& cand = (*end);
+        batch.push_back(LinearEqualityModule::UpdateCandidate(
+            cand.d_nb, cand.d_coeff, selectLeavingFunction(cand.d_nb)));
+      }
+      d_linEq.speculativeUpdates(batch, proposals);
+    }
+    const Rational& coeff = *batch[next].d_focusCoeff;
+    const UpdateInfo& currProposal = proposals[next];
+    ++next;
 
     Debug("soi::selectPrimalUpdate")
       << "selected " << selected << endl
@@ -19,8 +19,10 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <map>
 #include <queue>
+#include <unordered_set>
 #include <vector>
 
 #include "base/output.h"
@@ -115,6 +117,10 @@ TheoryArithPrivate::TheoryArithPrivate(TheoryArith& containing,
               d_rowTracking,
               BasicVarModelUpdateCallBack(*this)),
       d_diosolver(c),
+      d_cutPool(options::arithCutPool()
+                    ? new CutPool(u, options::arithCutPoolMaxAge())
+                    : nullptr),
+      d_pseudoCosts(),
       d_restartsCounter(0),
       d_tableauSizeHasBeenModified(false),
       d_tableauResetDensity(1.6),
@@ -136,6 +142,11 @@ TheoryArithPrivate::TheoryArithPrivate(TheoryArith& containing,
           d_linEq, d_errorSet, RaiseConflict(*this), TempVarMalloc(*this)),
       d_attemptSolSimplex(
           d_linEq, d_errorSet, RaiseConflict(*this), TempVarMalloc(*this)),
+      d_revisedSimplex(d_linEq,
+                       d_errorSet,
+                       RaiseConflict(*this),
+                       TempVarMalloc(*this),
+                       d_attemptSolSimplex),
       d_nonlinearExtension(NULL),
       d_pass1SDP(NULL),
       d_otherSDP(NULL),
@@ -2986,6 +2997,10 @@ bool TheoryArithPrivate::replayLemmas(ApproximateSimplex* approx){
         anythingnew = anythingnew || !isSatLiteral(implied);
 
         Node implication = asLemma.impNode(implied);
+        if(options::arithCutPool() &&
+           !d_cutPool->add(implication, cutSupport(implied))){
+          continue;
+        }
         // DO NOT CALL OUTPUT LEMMA!
         d_approxCuts.push_back(implication);
         Debug("approx::lemmas") << "cut["<<i<<"] " << implication << endl;
@@ -3178,6 +3193,8 @@ SimplexDecisionProcedure& TheoryArithPrivate::selectSimplex(bool pass1){
         d_pass1SDP = (SimplexDecisionProcedure*)(&d_fcSimplex);
       }else if(options::useSOI()){
         d_pass1SDP = (SimplexDecisionProcedure*)(&d_soiSimplex);
+      }else if(options::useRevisedSimplex()){
+        d_pass1SDP = (SimplexDecisionProcedure*)(&d_revisedSimplex);
       }else{
         d_pass1SDP = (SimplexDecisionProcedure*)(&d_dualSimplex);
       }
@@ -3266,30 +3283,33 @@ bool TheoryArithPrivate::solveRealRelaxation(Theory::Effort effortLevel){
   SimplexDecisionProcedure& simplex = selectSimplex(true);
 
   bool useApprox = options::useApprox() && ApproximateSimplex::enabled() && getSolveIntegerResource();
+  bool useFPSimplex = !useApprox && options::useFPSimplex();
 
   Debug("TheoryArithPrivate::solveRealRelaxation")
     << "solveRealRelaxation() approx"
     << " " <<  options::useApprox()
     << " " << ApproximateSimplex::enabled()
     << " " << useApprox
+    << " " << useFPSimplex
     << " " << safeToCallApprox()
     << endl;
   
-  bool noPivotLimitPass1 = noPivotLimit && !useApprox;
+  bool noPivotLimitPass1 = noPivotLimit && !useApprox && !useFPSimplex;
   d_qflraStatus = simplex.findModel(noPivotLimitPass1);
 
   Debug("TheoryArithPrivate::solveRealRelaxation")
     << "solveRealRelaxation()" << " pass1 " << d_qflraStatus << endl;
   
-  if(d_qflraStatus == Result::SAT_UNKNOWN && useApprox && safeToCallApprox()){
+  if(d_qflraStatus == Result::SAT_UNKNOWN && (useApprox || useFPSimplex) && safeToCallApprox()){
     // pass2: fancy-final
     static const int32_t relaxationLimit = 10000;
-    Assert(ApproximateSimplex::enabled());
+    Assert(!useApprox || ApproximateSimplex::enabled());
 
     TreeLog& tl = getTreeLog();
     ApproximateStatistics& stats = getApproxStats();
-    ApproximateSimplex* approxSolver =
-      ApproximateSimplex::mkApproximateSimplexSolver(d_partialModel, tl, stats);
+    ApproximateSimplex* approxSolver = useApprox
+      ? ApproximateSimplex::mkApproximateSimplexSolver(d_partialModel, tl, stats)
+      : ApproximateSimplex::mkFloatingPointSimplexSolver(d_partialModel, tl, stats);
 
     approxSolver->setPivotLimit(relaxationLimit);
 
@@ -3687,6 +3707,12 @@ void TheoryArithPrivate::check(Theory::Effort effortLevel){
       Node lem = d_approxCuts.front();
       d_approxCuts.pop();
       Debug("arith::approx::cuts") << "approximate cut:" << lem << endl;
+      if(options::arithCutPool()){
+        if(d_cutPool->isEmitted(lem)){
+          continue;
+        }
+        d_cutPool->markEmitted(lem);
+      }
       anyFresh = anyFresh || hasFreshArithLiteral(lem);
       Debug("arith::lemma") << "approximate cut:" << lem << endl;
       outputLemma(lem);
@@ -3779,6 +3805,12 @@ void TheoryArithPrivate::check(Theory::Effort effortLevel){
        << " hasintmodel " << hasIntegerModel() << endl;
 
   if(!emmittedConflictOrSplit && Theory::fullEffort(effortLevel) && !hasIntegerModel()){
+    ArithVarVec fractional;
+    if(options::arithCutPool()){
+      fractional = fractionalIntegerVariables();
+      d_cutPool->newRound(fractional);
+    }
+
     Node possibleConflict = Node::null();
     if(!emmittedConflictOrSplit && options::arithDioSolver()){
       possibleConflict = callDioSolver();
@@ -3791,21 +3823,37 @@ void TheoryArithPrivate::check(Theory::Effort effortLevel){
       }
     }
 
+    if(!emmittedConflictOrSplit && options::arithCutPool()){
+      emmittedConflictOrSplit = emitPooledCuts(fractional);
+    }
+
     if(!emmittedConflictOrSplit && d_hasDoneWorkSinceCut && options::arithDioSolver()){
       if(getDioCuttingResource()){
         Node possibleLemma = dioCutting();
+        if(!possibleLemma.isNull() && options::arithCutPool() &&
+           !d_cutPool->add(possibleLemma, cutSupport(possibleLemma))){
+          // The same cut was emitted before, so this is not progress.
+          d_hasDoneWorkSinceCut = false;
+          possibleLemma = Node::null();
+        }
         if(!possibleLemma.isNull()){
           emmittedConflictOrSplit = true;
           d_hasDoneWorkSinceCut = false;
           d_cutCount = d_cutCount + 1;
           Debug("arith::lemma") << "dio cut   " << possibleLemma << endl;
+          if(options::arithCutPool()){
+            d_cutPool->markEmitted(possibleLemma);
+          }
           outputLemma(possibleLemma);
         }
       }
     }
 
     if(!emmittedConflictOrSplit) {
-      Node possibleLemma = roundRobinBranch();
+      Node possibleLemma =
+          options::arithBranchingRule() == ROUND_ROBIN_BRANCHING
+              ? roundRobinBranch()
+              : heuristicBranch();
       if(!possibleLemma.isNull()){
         ++(d_statistics.d_externalBranchAndBounds);
         d_cutCount = d_cutCount + 1;
@@ -3926,6 +3974,93 @@ Node TheoryArithPrivate::roundRobinBranch(){
   }
 }
 
+Node TheoryArithPrivate::heuristicBranch(){
+  bool pseudoCost = options::arithBranchingRule() == PSEUDO_COST_BRANCHING;
+  ArithVar best = ARITHVAR_SENTINEL;
+  double bestScore = -1.0;
+  double infeasibility = 0.0;
+  for(var_iterator vi = var_begin(), vend = var_end(); vi != vend; ++vi){
+    ArithVar v = *vi;
+    if(!isIntegerInput(v) || d_partialModel.integralAssignment(v)){
+      continue;
+    }
+    const DeltaRational& d = d_partialModel.getAssignment(v);
+    double frac = (d.getNoninfinitesimalPart() - Rational(d.floor())).getDouble();
+    double dist = std::min(frac, 1.0 - frac);
+    infeasibility += dist;
+    double score = pseudoCost ? d_pseudoCosts.getScore(v, frac) : dist;
+    if(score > bestScore){
+      best = v;
+      bestScore = score;
+    }
+  }
+
+  if(pseudoCost && d_pseudoCosts.hasPendingBranch()){
+    ArithVar last = d_pseudoCosts.getPendingBranch();
+    d_pseudoCosts.observe(d_partialModel.getAssignment(last), infeasibility);
+  }
+  if(best == ARITHVAR_SENTINEL){
+    return Node::null();
+  }
+  Debug("arith::branch") << "branching on " << best << " with score "
+                         << bestScore << endl;
+  if(pseudoCost){
+    const DeltaRational& d = d_partialModel.getAssignment(best);
+    Integer floor = d.floor();
+    double frac = (d.getNoninfinitesimalPart() - Rational(floor)).getDouble();
+    d_pseudoCosts.branched(best, floor, frac, infeasibility);
+  }
+  return branchIntegerVariable(best);
+}
+
+ArithVarVec TheoryArithPrivate::fractionalIntegerVariables() const {
+  ArithVarVec fractional;
+  for(var_iterator vi = var_begin(), vend = var_end(); vi != vend; ++vi){
+    ArithVar v = *vi;
+    if(isIntegerInput(v) && !d_partialModel.integralAssignment(v)){
+      fractional.push_back(v);
+    }
+  }
+  return fractional;
+}
+
+ArithVarVec TheoryArithPrivate::cutSupport(TNode lem) const {
+  ArithVarVec support;
+  std::unordered_set<TNode, TNodeHashFunction> visited;
+  std::vector<TNode> visit;
+  visit.push_back(lem);
+  while(!visit.empty()){
+    TNode n = visit.back();
+    visit.pop_back();
+    if(!visited.insert(n).second){
+      continue;
+    }
+    if(d_partialModel.hasArithVar(n)){
+      ArithVar v = d_partialModel.asArithVar(n);
+      if(isIntegerInput(v)){
+        support.push_back(v);
+      }
+    }
+    visit.insert(visit.end(), n.begin(), n.end());
+  }
+  return support;
+}
+
+bool TheoryArithPrivate::emitPooledCuts(const ArithVarVec& fractional){
+  std::vector<Node> cuts;
+  d_cutPool->getCutsFor(fractional, cuts);
+  for(const Node& lem : cuts){
+    Debug("arith::lemma") << "pooled cut " << lem << endl;
+    d_cutPool->markEmitted(lem);
+    outputLemma(lem);
+  }
+  if(cuts.empty()){
+    return false;
+  }
+  d_cutCount = d_cutCount + 1;
+  return true;
+}
+
 bool TheoryArithPrivate::splitDisequalities(){
   bool splitSomething = false;
 
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <queue>
 #include <stdint.h>
 #include <vector>
@@ -43,6 +44,7 @@
 #include "theory/arith/congruence_manager.h"
 #include "theory/arith/constraint.h"
 #include "theory/arith/constraint.h"
+#include "theory/arith/cut_pool.h"
 #include "theory/arith/delta_rational.h"
 #include "theory/arith/delta_rational.h"
 #include "theory/arith/dio_solver.h"
@@ -55,6 +57,8 @@
 #include "theory/arith/normal_form.h"
 #include "theory/arith/partial_model.h"
 #include "theory/arith/partial_model.h"
+#include "theory/arith/pseudo_costs.h"
+#include "theory/arith/revised_simplex.h"
 #include "theory/arith/simplex.h"
 #include "theory/arith/soi_simplex.h"
 #include "theory/arith/theory_arith.h"
@@ -291,6 +295,15 @@ private:
    */
   DioSolver d_diosolver;
 
+  /**
+   * The integer cuts found so far. This is only created if
+   * options::arithCutPool(), so that its statistics are only registered then.
+   */
+  std::unique_ptr<CutPool> d_cutPool;
+
+  /** The pseudo-costs of branching on the integer variables. */
+  PseudoCosts d_pseudoCosts;
+
   /** Counts the number of notifyRestart() calls to the theory. */
   uint32_t d_restartsCounter;
 
@@ -373,6 +386,7 @@ private:
   FCSimplexDecisionProcedure d_fcSimplex;
   SumOfInfeasibilitiesSPD d_soiSimplex;
   AttemptSolutionSDP d_attemptSolSimplex;
+  RevisedSimplexDecisionProcedure d_revisedSimplex;
   
   /** non-linear algebraic approach */
   NonlinearExtension * d_nonlinearExtension;
@@ -519,6 +533,28 @@ private:
    */
   Node roundRobinBranch();
 
+  /**
+   * Issues a branch on the integer variable with a non-integer assignment
+   * chosen by options::arithBranchingRule().
+   * If there is an integer model, this returns Node::null().
+   */
+  Node heuristicBranch();
+
+  /**
+   * Returns the integer input variables that have non-integer assignments.
+   * These are the candidates for branching, see isIntegerInput().
+   */
+  ArithVarVec fractionalIntegerVariables() const;
+
+  /** Returns the integer input variables that occur in the cut lem. */
+  ArithVarVec cutSupport(TNode lem) const;
+
+  /**
+   * Emits the pending cuts of d_cutPool over one of the variables in
+   * fractional. Returns true if a cut was emitted.
+   */
+  bool emitPooledCuts(const ArithVarVec& fractional);
+
 public:
   /**
    * This requests a new unique ArithVar value for x.
@@ -0,0 +1,436 @@
+/*********************                                                        */
+/*! \file univariate_polynomial.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Univariate polynomials over the rationals and their real roots.
+ **
+ ** Univariate polynomials over the rationals and their real roots. Roots are
+ ** isolated by bisection with Sturm sequences.
+ **/
+
+#include "theory/arith/univariate_polynomial.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include "base/cvc4_assert.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+UnivariatePolynomial::UnivariatePolynomial(const Rational& c)
+{
+  if (!c.isZero())
+  {
+    d_coeffs.push_back(c);
+  }
+}
+
+UnivariatePolynomial UnivariatePolynomial::mkVariable()
+{
+  UnivariatePolynomial x;
+  x.d_coeffs.push_back(Rational(0));
+  x.d_coeffs.push_back(Rational(1));
+  return x;
+}
+
+Rational UnivariatePolynomial::getCoefficient(unsigned i) const
+{
+  return i < d_coeffs.size() ? d_coeffs[i] : Rational(0);
+}
+
+const Rational& UnivariatePolynomial::getLeadingCoefficient() const
+{
+  Assert(!isZero());
+  return d_coeffs.back();
+}
+
+void UnivariatePolynomial::normalize()
+{
+  while (!d_coeffs.empty() && d_coeffs.back().isZero())
+  {
+    d_coeffs.pop_back();
+  }
+}
+
+UnivariatePolynomial UnivariatePolynomial::operator+(
+    const UnivariatePolynomial& p) const
+{
+  UnivariatePolynomial res;
+  res.d_coeffs.resize(std::max(d_coeffs.size(), p.d_coeffs.size()));
+  for (unsigned i = 0; i < res.d_coeffs.size(); ++i)
+  {
+    res.d_coeffs[i] = getCoefficient(i) + p.getCoefficient(i);
+  }
+  res.normalize();
+  return res;
+}
+
+UnivariatePolynomial UnivariatePolynomial::operator-(
+    const UnivariatePolynomial& p) const
+{
+  return *this + (-p);
+}
+
+UnivariatePolynomial UnivariatePolynomial::operator*(
+    const UnivariatePolynomial& p) const
+{
+  UnivariatePolynomial res;
+  if (isZero() || p.isZero())
+  {
+    return res;
+  }
+  res.d_coeffs.resize(d_coeffs.size() + p.d_coeffs.size() - 1);
+  for (unsigned i = 0; i < d_coeffs.size(); ++i)
+  {
+    if (d_coeffs[i].isZero())
+    {
+      continue;
+    }
+    for (unsigned j = 0; j < p.d_coeffs.size(); ++j)
+    {
+      res.d_coeffs[i + j] += d_coeffs[i] * p.d_coeffs[j];
+    }
+  }
+  res.normalize();
+  return res;
+}
+
+UnivariatePolynomial UnivariatePolynomial::operator-() const
+{
+  UnivariatePolynomial res(*this);
+  for (Rational& c : res.d_coeffs)
+  {
+    c = -c;
+  }
+  return res;
+}
+
+void UnivariatePolynomial::divide(const UnivariatePolynomial& d,
+                                  UnivariatePolynomial& q,
+                                  UnivariatePolynomial& r) const
+{
+  Assert(!d.isZero());
+  q = UnivariatePolynomial();
+  r = *this;
+  int dd = d.getDegree();
+  if (r.getDegree() < dd)
+  {
+    return;
+  }
+  q.d_coeffs.resize(r.getDegree() - dd + 1);
+  const Rational& lc = d.getLeadingCoefficient();
+  while (!r.isZero() && r.getDegree() >= dd)
+  {
+    int shift = r.getDegree() - dd;
+    Rational c = r.getLeadingCoefficient() / lc;
+    q.d_coeffs[shift] = c;
+    for (int i = 0; i <= dd; ++i)
+    {
+      r.d_coeffs[i + shift] -= c * d.d_coeffs[i];
+    }
+    Assert(r.d_coeffs.back().isZero());
+    r.normalize();
+  }
+  q.normalize();
+}
+
+UnivariatePolynomial UnivariatePolynomial::derivative() const
+{
+  UnivariatePolynomial res;
+  for (unsigned i = 1; i < d_coeffs.size(); ++i)
+  {
+    res.d_coeffs.push_back(d_coeffs[i] * Rational(i));
+  }
+  res.normalize();
+  return res;
+}
+
+UnivariatePolynomial UnivariatePolynomial::gcd(const UnivariatePolynomial& a,
+                                               const UnivariatePolynomial& b)
+{
+  UnivariatePolynomial x = a;
+  UnivariatePolynomial y = b;
+  while (!y.isZero())
+  {
+    UnivariatePolynomial q, r;
+    x.divide(y, q, r);
+    x = y;
+    y = r;
+  }
+  if (!x.isZero())
+  {
+    Rational lc = x.getLeadingCoefficient();
+    for (Rational& c : x.d_coeffs)
+    {
+      c = c / lc;
+    }
+  }
+  return x;
+}
+
+UnivariatePolynomial UnivariatePolynomial::squareFreePart() const
+{
+  Assert(!isZero());
+  UnivariatePolynomial g = gcd(*this, derivative());
+  UnivariatePolynomial q, r;
+  divide(g, q, r);
+  Assert(r.isZero());
+  return gcd(q, q);
+}
+
+Rational UnivariatePolynomial::evaluate(const Rational& x) const
+{
+  Rational res(0);
+  for (unsigned i = d_coeffs.size(); i-- > 0;)
+  {
+    res = res * x + d_coeffs[i];
+  }
+  return res;
+}
+
+void UnivariatePolynomial::print(std::ostream& out) const
+{
+  if (isZero())
+  {
+    out << "0";
+    return;
+  }
+  bool first = true;
+  for (unsigned i = d_coeffs.size(); i-- > 0;)
+  {
+    if (d_coeffs[i].isZero())
+    {
+      continue;
+    }
+    if (!first)
+    {
+      out << " + ";
+    }
+    first = false;
+    out << d_coeffs[i];
+    if (i > 0)
+    {
+      out << "*x^" << i;
+    }
+  }
+}
+
+std::ostream& operator<<(std::ostream& out, const UnivariatePolynomial& p)
+{
+  p.print(out);
+  return out;
+}
+
+namespace {
+
+/** Returns the Sturm sequence p, p', ... of the square-free polynomial p. */
+std::vector<UnivariatePolynomial> mkSturmSequence(const UnivariatePolynomial& p)
+{
+  std::vector<UnivariatePolynomial> seq;
+  seq.push_back(p);
+  seq.push_back(p.derivative());
+  while (!seq.back().isZero())
+  {
+    UnivariatePolynomial q, r;
+    seq[seq.size() - 2].divide(seq.back(), q, r);
+    seq.push_back(-r);
+  }
+  seq.pop_back();
+  return seq;
+}
+
+/** Returns the number of sign changes in the Sturm sequence at x. */
+unsigned signVariations(const std::vector<UnivariatePolynomial>& seq,
+                        const Rational& x)
+{
+  unsigned res = 0;
+  int prev = 0;
+  for (const UnivariatePolynomial& p : seq)
+  {
+    int s = p.signAt(x);
+    if (s != 0)
+    {
+      if (prev != 0 && s != prev)
+      {
+        res++;
+      }
+      prev = s;
+    }
+  }
+  return res;
+}
+
+/** Returns the number of roots in (l, u], where l is not a root. */
+unsigned countRoots(const std::vector<UnivariatePolynomial>& seq,
+                    const Rational& l,
+                    const Rational& u)
+{
+  unsigned vl = signVariations(seq, l);
+  unsigned vu = signVariations(seq, u);
+  Assert(vl >= vu);
+  return vl - vu;
+}
+
+/**
+ * Adds to roots the count roots of p in (l, u), in increasing order, where
+ * neither l nor u is a root.
+ */
+void isolate(const UnivariatePolynomial& p,
+             const std::vector<UnivariatePolynomial>& seq,
+             const Rational& l,
+             const Rational& u,
+             unsigned count,
+             std::vector<RealRoot>& roots)
+{
+  if (count == 0)
+  {
+    return;
+  }
+  if (count == 1)
+  {
+    roots.push_back(RealRoot(p, l, u));
+    return;
+  }
+  Rational m = (l + u) / Rational(2);
+  if (p.signAt(m) != 0)
+  {
+    unsigned cl = countRoots(seq, l, m);
+    isolate(p, seq, l, m, cl, roots);
+    isolate(p, seq, m, u, count - cl, roots);
+    return;
+  }
+  // m is a root, find a neighborhood of m that contains no other root
+  Rational d = (u - l) / Rational(4);
+  Rational ml = m - d;
+  Rational mu = m + d;
+  while (p.signAt(ml) == 0 || p.signAt(mu) == 0
+         || countRoots(seq, ml, mu) != 1)
+  {
+    d = d / Rational(2);
+    ml = m - d;
+    mu = m + d;
+  }
+  unsigned cl = countRoots(seq, l, ml);
+  isolate(p, seq, l, ml, cl, roots);
+  roots.push_back(RealRoot(p, m));
+  isolate(p, seq, mu, u, count - cl - 1, roots);
+}
+
+}  // namespace
+
+RealRoot::RealRoot(const UnivariatePolynomial& p, const Rational& r)
+    : d_poly(p), d_isRational(true), d_lower(r), d_upper(r)
+{
+  Assert(p.signAt(r) == 0);
+}
+
+RealRoot::RealRoot(const UnivariatePolynomial& p,
+                   const Rational& l,
+                   const Rational& u)
+    : d_poly(p), d_isRational(false), d_lower(l), d_upper(u)
+{
+  Assert(l < u);
+  Assert(p.signAt(l) * p.signAt(u) < 0);
+}
+
+void RealRoot::refine()
+{
+  if (d_isRational)
+  {
+    return;
+  }
+  Rational m = (d_lower + d_upper) / Rational(2);
+  int sm = d_poly.signAt(m);
+  if (sm == 0)
+  {
+    d_isRational = true;
+    d_lower = m;
+    d_upper = m;
+  }
+  else if (sm == d_poly.signAt(d_lower))
+  {
+    d_lower = m;
+  }
+  else
+  {
+    d_upper = m;
+  }
+}
+
+int RealRoot::signOf(const UnivariatePolynomial& q) const
+{
+  if (d_isRational)
+  {
+    return q.signAt(d_lower);
+  }
+  // since d_poly is square-free, the root is a root of q if and only if it
+  // is a root of their gcd, which has at most one root in the interval
+  UnivariatePolynomial g = UnivariatePolynomial::gcd(q, d_poly);
+  if (g.getDegree() > 0 && g.signAt(d_lower) * g.signAt(d_upper) < 0)
+  {
+    return 0;
+  }
+  if (q.getDegree() <= 0)
+  {
+    return q.isZero() ? 0 : q.getLeadingCoefficient().sgn();
+  }
+  // otherwise, refine until q has no root in the interval
+  std::vector<UnivariatePolynomial> seq =
+      mkSturmSequence(q.squareFreePart());
+  RealRoot r(*this);
+  while (!r.d_isRational
+         && (q.signAt(r.d_lower) == 0 || q.signAt(r.d_upper) == 0
+             || countRoots(seq, r.d_lower, r.d_upper) > 0))
+  {
+    r.refine();
+  }
+  return q.signAt(r.d_lower);
+}
+
+std::ostream& operator<<(std::ostream& out, const RealRoot& r)
+{
+  if (r.isRational())
+  {
+    return out << r.getLower();
+  }
+  return out << "(" << r.getLower() << ", " << r.getUpper() << ")";
+}
+
+std::vector<RealRoot> isolateRealRoots(const UnivariatePolynomial& p)
+{
+  Assert(!p.isZero());
+  std::vector<RealRoot> roots;
+  if (p.getDegree() == 0)
+  {
+    return roots;
+  }
+  UnivariatePolynomial sf = p.squareFreePart();
+  // all roots are in (-b, b), by Cauchy's bound
+  Rational b(0);
+  const Rational& lc = sf.getLeadingCoefficient();
+  for (int i = 0; i < sf.getDegree(); ++i)
+  {
+    Rational c = (sf.getCoefficient(i) / lc).abs();
+    if (c > b)
+    {
+      b = c;
+    }
+  }
+  b = b + Rational(1);
+  std::vector<UnivariatePolynomial> seq = mkSturmSequence(sf);
+  isolate(sf, seq, -b, b, countRoots(seq, -b, b), roots);
+  return roots;
+}
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace CVC4
@@ -0,0 +1,143 @@
+/*********************                                                        */
+/*! \file univariate_polynomial.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Univariate polynomials over the rationals and their real roots.
+ **
+ ** Univariate polynomials over the rationals, and real algebraic numbers
+ ** given as roots of such polynomials.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__THEORY__ARITH__UNIVARIATE_POLYNOMIAL_H
+#define __CVC4__THEORY__ARITH__UNIVARIATE_POLYNOMIAL_H
+
+#include <iosfwd>
+#include <vector>
+
+#include "util/rational.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+/**
+ * A polynomial in one variable x with rational coefficients. The zero
+ * polynomial has degree -1.
+ */
+class UnivariatePolynomial
+{
+ public:
+  /** Creates the zero polynomial. */
+  UnivariatePolynomial() {}
+  /** Creates the constant polynomial c. */
+  explicit UnivariatePolynomial(const Rational& c);
+  /** Returns the polynomial x. */
+  static UnivariatePolynomial mkVariable();
+
+  bool isZero() const { return d_coeffs.empty(); }
+  int getDegree() const { return static_cast<int>(d_coeffs.size()) - 1; }
+  /** Returns the coefficient of x^i. */
+  Rational getCoefficient(unsigned i) const;
+  /** Returns the coefficient of x^getDegree(). Requires !isZero(). */
+  const Rational& getLeadingCoefficient() const;
+
+  UnivariatePolynomial operator+(const UnivariatePolynomial& p) const;
+  UnivariatePolynomial operator-(const UnivariatePolynomial& p) const;
+  UnivariatePolynomial operator*(const UnivariatePolynomial& p) const;
+  UnivariatePolynomial operator-() const;
+  bool operator==(const UnivariatePolynomial& p) const
+  {
+    return d_coeffs == p.d_coeffs;
+  }
+
+  /**
+   * Divides this by d, such that this = q * d + r and the degree of r is less
+   * than the degree of d. Requires !d.isZero().
+   */
+  void divide(const UnivariatePolynomial& d,
+              UnivariatePolynomial& q,
+              UnivariatePolynomial& r) const;
+  UnivariatePolynomial derivative() const;
+  /** Returns the monic greatest common divisor of a and b. */
+  static UnivariatePolynomial gcd(const UnivariatePolynomial& a,
+                                  const UnivariatePolynomial& b);
+  /**
+   * Returns the monic polynomial with the same roots as this, each with
+   * multiplicity one. Requires !isZero().
+   */
+  UnivariatePolynomial squareFreePart() const;
+
+  Rational evaluate(const Rational& x) const;
+  /** Returns the sign of the value of this at x. */
+  int signAt(const Rational& x) const { return evaluate(x).sgn(); }
+
+  void print(std::ostream& out) const;
+
+ private:
+  /** Removes leading zero coefficients. */
+  void normalize();
+
+  /** The coefficients, d_coeffs[i] is the coefficient of x^i. */
+  std::vector<Rational> d_coeffs;
+}; /* class UnivariatePolynomial */
+
+std::ostream& operator<<(std::ostream& out, const UnivariatePolynomial& p);
+
+/**
+ * A real root alpha of a square-free polynomial p. Either alpha is a
+ * rational, or it is the only root of p in the open interval (l, u), where
+ * l and u are rationals and not roots of p.
+ */
+class RealRoot
+{
+ public:
+  /** The rational root r of p. */
+  RealRoot(const UnivariatePolynomial& p, const Rational& r);
+  /** The only root of p in (l, u). */
+  RealRoot(const UnivariatePolynomial& p,
+           const Rational& l,
+           const Rational& u);
+
+  bool isRational() const { return d_isRational; }
+  /**
+   * The lower and upper bound of the isolating interval, both equal to the
+   * root if it is rational.
+   */
+  const Rational& getLower() const { return d_lower; }
+  const Rational& getUpper() const { return d_upper; }
+
+  /** Halves the isolating interval, possibly finding the root exactly. */
+  void refine();
+
+  /** Returns the sign of the value of q at this root. */
+  int signOf(const UnivariatePolynomial& q) const;
+
+ private:
+  UnivariatePolynomial d_poly;
+  bool d_isRational;
+  Rational d_lower;
+  Rational d_upper;
+}; /* class RealRoot */
+
+std::ostream& operator<<(std::ostream& out, const RealRoot& r);
+
+/**
+ * Returns the distinct real roots of p in increasing order, with pairwise
+ * disjoint isolating intervals. Requires !p.isZero().
+ */
+std::vector<RealRoot> isolateRealRoots(const UnivariatePolynomial& p);
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace CVC4
+
+#endif /* __CVC4__THEORY__ARITH__UNIVARIATE_POLYNOMIAL_H */
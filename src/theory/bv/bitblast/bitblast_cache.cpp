@@ -0,0 +1,112 @@
+/*********************                                                        */
+/*! \file bitblast_cache.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Liana Hadarean
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Term bit-blasting cache shared between bit-blaster instances.
+ **
+ ** Term bit-blasting cache shared between bit-blaster instances.
+ **/
+
+#include "theory/bv/bitblast/bitblast_cache.h"
+
+#include "smt/smt_statistics_registry.h"
+#include "theory/bv/bitblast/bitblaster.h"
+#include "theory/bv/theory_bv_utils.h"
+
+namespace CVC4 {
+namespace theory {
+namespace bv {
+
+BitblastCache::BitblastCache(unsigned maxWidth)
+    : d_maxWidth(maxWidth), d_termCache(), d_statistics()
+{
+}
+
+BitblastCache::~BitblastCache() {}
+
+void BitblastCache::bbTerm(TNode term,
+                           Bits& bits,
+                           TBitblaster<Node>* bb,
+                           TermBBStrategy strategy)
+{
+  if (hasBits(term))
+  {
+    // the gates were built by another bit-blaster, we only have to register
+    // the leaves of term with this one
+    for (const TNode& child : term)
+    {
+      Bits child_bits;
+      bb->bbTerm(child, child_bits);
+    }
+    bits = getBits(term);
+    return;
+  }
+  strategy(term, bits, bb);
+  if (strategy != DefaultVarBB<Node>)
+  {
+    storeBits(term, bits);
+  }
+}
+
+bool BitblastCache::isCacheable(TNode term) const
+{
+  switch (term.getKind())
+  {
+    // the bits of shifts refer to an atom that is bit-blasted by the strategy
+    case kind::BITVECTOR_SHL:
+    case kind::BITVECTOR_LSHR:
+    case kind::BITVECTOR_ASHR: return false;
+    default: return utils::getSize(term) <= d_maxWidth;
+  }
+}
+
+bool BitblastCache::hasBits(TNode term) const
+{
+  return d_termCache.find(term) != d_termCache.end();
+}
+
+const BitblastCache::Bits& BitblastCache::getBits(TNode term)
+{
+  TermDefMap::const_iterator it = d_termCache.find(term);
+  Assert(it != d_termCache.end());
+  ++d_statistics.d_numSharedTerms;
+  return it->second;
+}
+
+void BitblastCache::storeBits(TNode term, const Bits& bits)
+{
+  if (!isCacheable(term))
+  {
+    return;
+  }
+  Assert(bits.size() == utils::getSize(term));
+  if (d_termCache.insert(std::make_pair(term, bits)).second)
+  {
+    ++d_statistics.d_numStoredTerms;
+  }
+}
+
+BitblastCache::Statistics::Statistics()
+    : d_numStoredTerms("theory::bv::BitblastCache::NumStoredTerms", 0),
+      d_numSharedTerms("theory::bv::BitblastCache::NumSharedTerms", 0)
+{
+  smtStatisticsRegistry()->registerStat(&d_numStoredTerms);
+  smtStatisticsRegistry()->registerStat(&d_numSharedTerms);
+}
+
+BitblastCache::Statistics::~Statistics()
+{
+  smtStatisticsRegistry()->unregisterStat(&d_numStoredTerms);
+  smtStatisticsRegistry()->unregisterStat(&d_numSharedTerms);
+}
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace CVC4
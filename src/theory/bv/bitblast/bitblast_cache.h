@@ -0,0 +1,106 @@
+/*********************                                                        */
+/*! \file bitblast_cache.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Liana Hadarean
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Term bit-blasting cache shared between bit-blaster instances.
+ **
+ ** Term bit-blasting cache shared between bit-blaster instances. The bits of
+ ** a term are Boolean formulas over BITVECTOR_BITOF atoms and are therefore
+ ** independent of the SAT solver a bit-blaster feeds. Each bit-blaster
+ ** still converts the shared gates with its own CnfStream.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__THEORY__BV__BITBLAST__BITBLAST_CACHE_H
+#define __CVC4__THEORY__BV__BITBLAST__BITBLAST_CACHE_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "expr/node.h"
+#include "util/statistics_registry.h"
+
+namespace CVC4 {
+namespace theory {
+namespace bv {
+
+template <class T>
+class TBitblaster;
+
+/**
+ * Maps bit-vector terms to their bit-blasted definitions. Owned jointly (via
+ * std::shared_ptr) by TheoryBV and the Node-based bit-blasters it creates
+ * (TLazyBitblaster, EagerBitblaster, and the one inside BVQuickCheck).
+ *
+ * Only terms of bit-width at most --bv-bb-shared-cache-width are stored, which
+ * bounds the memory taken by definitions nobody else is going to ask for.
+ *
+ * Terms whose strategy bit-blasts an atom of its own (the shifts, whose bits
+ * refer to the atom b < size of the shift amount b) are never stored: a
+ * bit-blaster that reused these bits would see the atom as an unconstrained
+ * variable of its SAT solver.
+ */
+class BitblastCache
+{
+ public:
+  typedef std::vector<Node> Bits;
+  typedef void (*TermBBStrategy)(TNode, Bits&, TBitblaster<Node>*);
+
+  BitblastCache(unsigned maxWidth);
+  ~BitblastCache();
+
+  /**
+   * Bit-blasts term with bb, using the cached bits of term if there are any,
+   * and strategy otherwise. On a hit, the children of term are bit-blasted
+   * with bb, which registers their leaves and atoms with it.
+   */
+  void bbTerm(TNode term,
+              Bits& bits,
+              TBitblaster<Node>* bb,
+              TermBBStrategy strategy);
+  /**
+   * Returns true if term is of a bit-width and kind this cache stores.
+   */
+  bool isCacheable(TNode term) const;
+  /** Returns true if the bits of term are in the cache. */
+  bool hasBits(TNode term) const;
+  /**
+   * Returns the cached bits of term, counting a hit. Only valid if
+   * hasBits(term) holds.
+   */
+  const Bits& getBits(TNode term);
+  /** Stores the bits of term, if term is cacheable. */
+  void storeBits(TNode term, const Bits& bits);
+
+ private:
+  typedef std::unordered_map<Node, Bits, NodeHashFunction> TermDefMap;
+
+  /** The maximal bit-width of a cached term. */
+  unsigned d_maxWidth;
+  /** The cached bit-blasted definitions. */
+  TermDefMap d_termCache;
+
+  class Statistics
+  {
+   public:
+    IntStat d_numStoredTerms;
+    IntStat d_numSharedTerms;
+    Statistics();
+    ~Statistics();
+  };
+  Statistics d_statistics;
+};
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace CVC4
+
+#endif /* __CVC4__THEORY__BV__BITBLAST__BITBLAST_CACHE_H */
@@ -37,6 +37,7 @@ EagerBitblaster::EagerBitblaster(TheoryBV* theory_bv)
       d_bitblastingRegistrar(new BitblastingRegistrar(this)),
       d_cnfStream(),
       d_bv(theory_bv),
+      d_sharedCache(theory_bv->d_bbCache),
       d_bbAtoms(),
       d_variables(),
       d_notify()
@@ -148,7 +149,14 @@ void EagerBitblaster::bbTerm(TNode node, Bits& bits) {
   d_bv->spendResource(options::bitblastStep());
   Debug("bitvector-bitblast") << "Bitblasting node " << node << "\n";
 
-  d_termBBStrategies[node.getKind()](node, bits, this);
+  if (d_sharedCache != nullptr)
+  {
+    d_sharedCache->bbTerm(node, bits, this, d_termBBStrategies[node.getKind()]);
+  }
+  else
+  {
+    d_termBBStrategies[node.getKind()](node, bits, this);
+  }
 
   Assert(bits.size() == utils::getSize(node));
 
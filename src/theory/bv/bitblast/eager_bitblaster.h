@@ -19,12 +19,14 @@
 #ifndef __CVC4__THEORY__BV__BITBLAST__EAGER_BITBLASTER_H
 #define __CVC4__THEORY__BV__BITBLAST__EAGER_BITBLASTER_H
 
+#include <memory>
 #include <unordered_set>
 
 #include "theory/bv/bitblast/bitblaster.h"
 
 #include "prop/cnf_stream.h"
 #include "prop/sat_solver.h"
+#include "theory/bv/bitblast/bitblast_cache.h"
 
 namespace CVC4 {
 namespace theory {
@@ -64,6 +66,8 @@ class EagerBitblaster : public TBitblaster<Node>
   std::unique_ptr<prop::CnfStream> d_cnfStream;
 
   TheoryBV* d_bv;
+  // term bit-blasting cache shared with the other bit-blasters of d_bv
+  std::shared_ptr<BitblastCache> d_sharedCache;
   TNodeSet d_bbAtoms;
   TNodeSet d_variables;
 
@@ -68,6 +68,7 @@ TLazyBitblaster::TLazyBitblaster(context::Context* c,
       d_ctx(c),
       d_nullRegistrar(new prop::NullRegistrar()),
       d_nullContext(new context::Context()),
+      d_sharedCache(bv->d_bbCache),
       d_assertedAtoms(new (true) context::CDList<prop::SatLiteral>(c)),
       d_explanations(new (true) ExplanationMap(c)),
       d_variables(),
@@ -240,7 +241,14 @@ void TLazyBitblaster::bbTerm(TNode node, Bits& bits) {
   Debug("bitvector-bitblast") << "Bitblasting term " << node <<"\n";
   ++d_statistics.d_numTerms;
 
-  d_termBBStrategies[node.getKind()] (node, bits,this);
+  if (d_sharedCache != nullptr)
+  {
+    d_sharedCache->bbTerm(node, bits, this, d_termBBStrategies[node.getKind()]);
+  }
+  else
+  {
+    d_termBBStrategies[node.getKind()](node, bits, this);
+  }
 
   Assert (bits.size() == utils::getSize(node));
 
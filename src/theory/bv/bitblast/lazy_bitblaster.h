@@ -21,12 +21,15 @@
 
 #include "theory/bv/bitblast/bitblaster.h"
 
+#include <memory>
+
 #include "context/cdhashmap.h"
 #include "context/cdlist.h"
 #include "prop/cnf_stream.h"
 #include "prop/registrar.h"
 #include "prop/sat_solver.h"
 #include "theory/bv/abstraction.h"
+#include "theory/bv/bitblast/bitblast_cache.h"
 
 namespace CVC4 {
 namespace theory {
@@ -133,6 +136,8 @@ class TLazyBitblaster : public TBitblaster<Node>
   std::unique_ptr<prop::BVSatSolverInterface> d_satSolver;
   std::unique_ptr<prop::BVSatSolverInterface::Notify> d_satSolverNotify;
   std::unique_ptr<prop::CnfStream> d_cnfStream;
+  // term bit-blasting cache shared with the other bit-blasters of d_bv
+  std::shared_ptr<BitblastCache> d_sharedCache;
 
   AssertionList*
       d_assertedAtoms;            /**< context dependent list storing the atoms
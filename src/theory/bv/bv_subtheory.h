@@ -34,7 +34,8 @@ enum SubTheory {
   SUB_CORE = 1,
   SUB_BITBLAST = 2,
   SUB_INEQUALITY = 3,
-  SUB_ALGEBRAIC = 4
+  SUB_ALGEBRAIC = 4,
+  SUB_FIXED_BITS = 5
 };
 
 inline std::ostream& operator<<(std::ostream& out, SubTheory subtheory) {
@@ -47,6 +48,8 @@ inline std::ostream& operator<<(std::ostream& out, SubTheory subtheory) {
       return out << "BV_INEQUALITY_SUBTHEORY";
     case SUB_ALGEBRAIC:
       return out << "BV_ALGEBRAIC_SUBTHEORY";
+    case SUB_FIXED_BITS:
+      return out << "BV_FIXED_BITS_SUBTHEORY";
     default:
       break;
   }
@@ -0,0 +1,1038 @@
+/*********************                                                        */
+/*! \file bv_subtheory_fixed_bits.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Liana Hadarean
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Word-level fixed-bits propagation solver.
+ **
+ ** Word-level fixed-bits propagation solver.
+ **/
+
+#include "theory/bv/bv_subtheory_fixed_bits.h"
+
+#include <algorithm>
+
+#include "options/smt_options.h"
+#include "smt/smt_statistics_registry.h"
+#include "theory/bv/theory_bv.h"
+#include "theory/bv/theory_bv_utils.h"
+#include "theory/rewriter.h"
+
+using namespace std;
+using namespace CVC4::context;
+
+namespace CVC4 {
+namespace theory {
+namespace bv {
+
+namespace {
+
+/** The value of a single bit of a FixedBits. */
+enum Trit
+{
+  TRIT_ZERO,
+  TRIT_ONE,
+  TRIT_UNKNOWN
+};
+
+Trit getTrit(const FixedBits& bits, unsigned i)
+{
+  if (bits.getLo().isBitSet(i))
+  {
+    return TRIT_ONE;
+  }
+  return bits.getHi().isBitSet(i) ? TRIT_UNKNOWN : TRIT_ZERO;
+}
+
+/**
+ * Builds FixedBits bit by bit. Strings are used to avoid creating a new
+ * Integer for each bit that is set.
+ */
+class FixedBitsBuilder
+{
+ public:
+  FixedBitsBuilder(unsigned width) : d_lo(width, '0'), d_hi(width, '1') {}
+  /** Sets bit i (from the least significant) to value. */
+  void set(unsigned i, Trit value)
+  {
+    unsigned pos = d_lo.size() - 1 - i;
+    d_lo[pos] = value == TRIT_ONE ? '1' : '0';
+    d_hi[pos] = value == TRIT_ZERO ? '0' : '1';
+  }
+  FixedBits get() const { return FixedBits(BitVector(d_lo), BitVector(d_hi)); }
+
+ private:
+  std::string d_lo;
+  std::string d_hi;
+};
+
+/** Returns the FixedBits with the bits outside mask unknown. */
+FixedBits mkRestricted(const BitVector& value, const BitVector& mask)
+{
+  return FixedBits(value & mask, value | ~mask);
+}
+
+/** Returns the number of consecutive bits fixed to 0 starting at bit 0. */
+unsigned getNumTrailingZeros(const FixedBits& bits)
+{
+  unsigned i = 0;
+  while (i < bits.getWidth() && getTrit(bits, i) == TRIT_ZERO)
+  {
+    ++i;
+  }
+  return i;
+}
+
+/** Returns the bits with the k low bits fixed to those of value. */
+FixedBits fixLowBits(const FixedBits& bits, unsigned k, const BitVector& value)
+{
+  Assert(k <= bits.getWidth());
+  FixedBitsBuilder builder(bits.getWidth());
+  for (unsigned i = 0; i < bits.getWidth(); ++i)
+  {
+    builder.set(i,
+                i < k ? (value.isBitSet(i) ? TRIT_ONE : TRIT_ZERO)
+                      : getTrit(bits, i));
+  }
+  return builder.get();
+}
+
+FixedBits mkNot(const FixedBits& a)
+{
+  return FixedBits(~a.getHi(), ~a.getLo());
+}
+
+FixedBits mkAnd(const FixedBits& a, const FixedBits& b)
+{
+  return FixedBits(a.getLo() & b.getLo(), a.getHi() & b.getHi());
+}
+
+FixedBits mkOr(const FixedBits& a, const FixedBits& b)
+{
+  return FixedBits(a.getLo() | b.getLo(), a.getHi() | b.getHi());
+}
+
+FixedBits mkXor(const FixedBits& a, const FixedBits& b)
+{
+  BitVector fixed = ~(a.getLo() ^ a.getHi()) & ~(b.getLo() ^ b.getHi());
+  return mkRestricted(a.getLo() ^ b.getLo(), fixed);
+}
+
+/** Ripple-carry addition over three-valued bits. */
+FixedBits mkPlus(const FixedBits& a, const FixedBits& b, bool carry)
+{
+  if (a.isFixed() && b.isFixed())
+  {
+    BitVector sum = a.getLo() + b.getLo();
+    return FixedBits(carry ? sum + BitVector(sum.getSize(), 1u) : sum);
+  }
+  FixedBitsBuilder builder(a.getWidth());
+  Trit c = carry ? TRIT_ONE : TRIT_ZERO;
+  for (unsigned i = 0; i < a.getWidth(); ++i)
+  {
+    Trit x = getTrit(a, i);
+    Trit y = getTrit(b, i);
+    unsigned ones = (x == TRIT_ONE) + (y == TRIT_ONE) + (c == TRIT_ONE);
+    unsigned zeros = (x == TRIT_ZERO) + (y == TRIT_ZERO) + (c == TRIT_ZERO);
+    if (ones + zeros == 3)
+    {
+      builder.set(i, ones % 2 == 1 ? TRIT_ONE : TRIT_ZERO);
+    }
+    else
+    {
+      builder.set(i, TRIT_UNKNOWN);
+    }
+    c = ones >= 2 ? TRIT_ONE : (zeros >= 2 ? TRIT_ZERO : TRIT_UNKNOWN);
+  }
+  return builder.get();
+}
+
+/**
+ * The k low bits of a product only depend on the k low bits of its factors,
+ * and the product has at least as many trailing zeros as its factors together.
+ */
+FixedBits mkMult(const FixedBits& a, const FixedBits& b)
+{
+  if (a.isFixed() && b.isFixed())
+  {
+    return FixedBits(a.getLo() * b.getLo());
+  }
+  unsigned width = a.getWidth();
+  unsigned k = std::min(a.getNumLowFixed(), b.getNumLowFixed());
+  unsigned zeros =
+      std::min(width, getNumTrailingZeros(a) + getNumTrailingZeros(b));
+  FixedBits res(width);
+  if (k > 0)
+  {
+    res = fixLowBits(res, k, a.getLo() * b.getLo());
+  }
+  if (zeros > k)
+  {
+    res = fixLowBits(res, zeros, BitVector(width));
+  }
+  return res;
+}
+
+/** Returns the k-bit FixedBits with all bits fixed to value. */
+FixedBits mkFixed(unsigned k, bool value)
+{
+  return FixedBits(value ? BitVector::mkOnes(k) : BitVector(k));
+}
+
+/** Returns the FixedBits of the concatenation of a (high) and b (low). */
+FixedBits mkConcat(const FixedBits& a, const FixedBits& b)
+{
+  return FixedBits(a.getLo().concat(b.getLo()), a.getHi().concat(b.getHi()));
+}
+
+FixedBits mkExtract(const FixedBits& a, unsigned high, unsigned low)
+{
+  return FixedBits(a.getLo().extract(high, low), a.getHi().extract(high, low));
+}
+
+/** Returns the bits of a width-bit term that is at most max. */
+FixedBits mkUpperBound(unsigned width, const BitVector& max)
+{
+  unsigned k = width;
+  while (k > 0 && !max.isBitSet(k - 1))
+  {
+    --k;
+  }
+  if (k == width)
+  {
+    return FixedBits(width);
+  }
+  if (k == 0)
+  {
+    return FixedBits(BitVector(width));
+  }
+  return mkConcat(mkFixed(width - k, false), FixedBits(k));
+}
+
+/** Computes the shift of a by a fixed amount. */
+FixedBits mkShift(Kind k, const FixedBits& a, const BitVector& amount)
+{
+  switch (k)
+  {
+    case kind::BITVECTOR_SHL:
+      return FixedBits(a.getLo().leftShift(amount),
+                       a.getHi().leftShift(amount));
+    case kind::BITVECTOR_LSHR:
+      return FixedBits(a.getLo().logicalRightShift(amount),
+                       a.getHi().logicalRightShift(amount));
+    default:
+      Assert(k == kind::BITVECTOR_ASHR);
+      return FixedBits(a.getLo().arithRightShift(amount),
+                       a.getHi().arithRightShift(amount));
+  }
+}
+
+/** Returns the union of the sorted sets a and b. */
+void mergeReasons(std::vector<unsigned>& a, const std::vector<unsigned>& b)
+{
+  if (b.empty())
+  {
+    return;
+  }
+  std::vector<unsigned> res;
+  std::set_union(a.begin(), a.end(), b.begin(), b.end(), back_inserter(res));
+  a.swap(res);
+}
+
+/**
+ * Returns true if term is a leaf of the abstraction: a leaf of the
+ * bit-vector theory, or a term with children that are not bit-vectors.
+ */
+bool isLeaf(TNode term)
+{
+  if (Theory::isLeafOf(term, THEORY_BV))
+  {
+    return true;
+  }
+  for (const TNode& child : term)
+  {
+    if (!child.getType().isBitVector())
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+FixedBits::FixedBits(unsigned width)
+    : d_lo(width), d_hi(BitVector::mkOnes(width))
+{
+}
+
+FixedBits::FixedBits(const BitVector& value) : d_lo(value), d_hi(value) {}
+
+FixedBits::FixedBits(const BitVector& lo, const BitVector& hi)
+    : d_lo(lo), d_hi(hi)
+{
+  Assert(lo.getSize() == hi.getSize());
+}
+
+bool FixedBits::isInconsistent() const
+{
+  return (d_lo & ~d_hi) != BitVector(getWidth());
+}
+
+unsigned FixedBits::getNumLowFixed() const
+{
+  unsigned i = 0;
+  while (i < getWidth() && d_lo.isBitSet(i) == d_hi.isBitSet(i))
+  {
+    ++i;
+  }
+  return i;
+}
+
+FixedBits FixedBits::meet(const FixedBits& other) const
+{
+  Assert(getWidth() == other.getWidth());
+  return FixedBits(d_lo | other.d_lo, d_hi & other.d_hi);
+}
+
+std::ostream& operator<<(std::ostream& out, const FixedBits& bits)
+{
+  for (unsigned i = bits.getWidth(); i > 0; --i)
+  {
+    Trit t = getTrit(bits, i - 1);
+    out << (t == TRIT_ONE ? '1' : (t == TRIT_ZERO ? '0' : 'x'));
+  }
+  return out;
+}
+
+FixedBitsSolver::FixedBitsSolver(context::Context* c, TheoryBV* bv)
+    : SubtheorySolver(c, bv),
+      d_facts(),
+      d_domains(),
+      d_reasons(),
+      d_parents(),
+      d_factUses(),
+      d_queue(),
+      d_inQueue(),
+      d_atoms(),
+      d_atomSet(),
+      d_explanations(c),
+      d_statistics()
+{
+}
+
+FixedBitsSolver::~FixedBitsSolver() {}
+
+void FixedBitsSolver::preRegister(TNode node)
+{
+  Kind k = node.getKind();
+  if ((k == kind::EQUAL && node[0].getType().isBitVector())
+      || k == kind::BITVECTOR_ULT || k == kind::BITVECTOR_ULE)
+  {
+    if (d_atomSet.insert(node).second)
+    {
+      d_atoms.push_back(node);
+    }
+  }
+}
+
+bool FixedBitsSolver::check(Theory::Effort e)
+{
+  Debug("bv-fixed-bits") << "FixedBitsSolver::check(" << e << ")\n";
+  ++(d_statistics.d_numCallsToCheck);
+
+  // the abstraction only changes with new facts
+  if (done())
+  {
+    return true;
+  }
+  TimerStat::CodeTimer solveTimer(d_statistics.d_solveTimer);
+  d_bv->spendResource(options::theoryCheckStep());
+  while (!done())
+  {
+    get();
+  }
+
+  d_facts.clear();
+  d_domains.clear();
+  d_reasons.clear();
+  d_parents.clear();
+  d_factUses.clear();
+  d_queue.clear();
+  d_inQueue.clear();
+
+  for (AssertionQueue::const_iterator it = assertionsBegin(),
+                                      it_end = assertionsEnd();
+       it != it_end;
+       ++it)
+  {
+    if (registerFact(*it, d_facts.size()))
+    {
+      d_facts.push_back(*it);
+    }
+  }
+
+  for (unsigned i = 0; i < d_facts.size(); ++i)
+  {
+    if (!propagateFact(i))
+    {
+      return false;
+    }
+  }
+  while (!d_queue.empty())
+  {
+    Node term = d_queue.front();
+    d_queue.pop_front();
+    d_inQueue.erase(term);
+    if (!propagateTerm(term))
+    {
+      return false;
+    }
+  }
+
+  if (Debug.isOn("bv-fixed-bits"))
+  {
+    for (const std::pair<const Node, FixedBits>& d : d_domains)
+    {
+      Debug("bv-fixed-bits") << "  " << d.first << " : " << d.second << "\n";
+    }
+  }
+  return propagateAtoms();
+}
+
+bool FixedBitsSolver::registerFact(TNode fact, unsigned index)
+{
+  TNode atom = fact.getKind() == kind::NOT ? fact[0] : fact;
+  Kind k = atom.getKind();
+  if (k != kind::EQUAL && k != kind::BITVECTOR_ULT && k != kind::BITVECTOR_ULE)
+  {
+    return false;
+  }
+  if (!atom[0].getType().isBitVector())
+  {
+    return false;
+  }
+  for (unsigned i = 0; i < 2; ++i)
+  {
+    registerTerm(atom[i]);
+    d_factUses[atom[i]].push_back(index);
+  }
+  return true;
+}
+
+void FixedBitsSolver::registerTerm(TNode term)
+{
+  std::vector<TNode> stack;
+  stack.push_back(term);
+  while (!stack.empty())
+  {
+    TNode current = stack.back();
+    if (d_domains.find(current) != d_domains.end())
+    {
+      stack.pop_back();
+      continue;
+    }
+    if (current.isConst())
+    {
+      d_domains.insert(
+          std::make_pair(current, FixedBits(current.getConst<BitVector>())));
+      stack.pop_back();
+      continue;
+    }
+    if (isLeaf(current))
+    {
+      d_domains.insert(
+          std::make_pair(current, FixedBits(utils::getSize(current))));
+      stack.pop_back();
+      continue;
+    }
+
+    bool ready = true;
+    for (const TNode& child : current)
+    {
+      if (d_domains.find(child) == d_domains.end())
+      {
+        stack.push_back(child);
+        ready = false;
+      }
+    }
+    if (!ready)
+    {
+      continue;
+    }
+    stack.pop_back();
+
+    for (const TNode& child : current)
+    {
+      d_parents[child].push_back(current);
+    }
+    Reasons reasons;
+    FixedBits bits = computeUp(current, reasons);
+    d_domains.insert(std::make_pair(current, bits));
+    d_reasons[current] = reasons;
+  }
+}
+
+const FixedBits& FixedBitsSolver::getBits(TNode term) const
+{
+  DomainMap::const_iterator it = d_domains.find(term);
+  Assert(it != d_domains.end());
+  return it->second;
+}
+
+const FixedBitsSolver::Reasons& FixedBitsSolver::getReasons(TNode term) const
+{
+  static const Reasons s_empty;
+  ReasonMap::const_iterator it = d_reasons.find(term);
+  return it == d_reasons.end() ? s_empty : it->second;
+}
+
+FixedBits FixedBitsSolver::computeUp(TNode term, Reasons& reasons)
+{
+  for (const TNode& child : term)
+  {
+    mergeReasons(reasons, getReasons(child));
+  }
+
+  unsigned width = utils::getSize(term);
+  Kind k = term.getKind();
+  switch (k)
+  {
+    case kind::BITVECTOR_NOT: return mkNot(getBits(term[0]));
+    case kind::BITVECTOR_AND:
+    case kind::BITVECTOR_NAND:
+    case kind::BITVECTOR_OR:
+    case kind::BITVECTOR_NOR:
+    case kind::BITVECTOR_XOR:
+    case kind::BITVECTOR_XNOR:
+    {
+      FixedBits res = getBits(term[0]);
+      for (unsigned i = 1; i < term.getNumChildren(); ++i)
+      {
+        const FixedBits& b = getBits(term[i]);
+        if (k == kind::BITVECTOR_AND || k == kind::BITVECTOR_NAND)
+        {
+          res = mkAnd(res, b);
+        }
+        else if (k == kind::BITVECTOR_OR || k == kind::BITVECTOR_NOR)
+        {
+          res = mkOr(res, b);
+        }
+        else
+        {
+          res = mkXor(res, b);
+        }
+      }
+      if (k == kind::BITVECTOR_NAND || k == kind::BITVECTOR_NOR
+          || k == kind::BITVECTOR_XNOR)
+      {
+        res = mkNot(res);
+      }
+      return res;
+    }
+    case kind::BITVECTOR_CONCAT:
+    {
+      FixedBits res = getBits(term[0]);
+      for (unsigned i = 1; i < term.getNumChildren(); ++i)
+      {
+        res = mkConcat(res, getBits(term[i]));
+      }
+      return res;
+    }
+    case kind::BITVECTOR_EXTRACT:
+      return mkExtract(getBits(term[0]),
+                       utils::getExtractHigh(term),
+                       utils::getExtractLow(term));
+    case kind::BITVECTOR_ZERO_EXTEND:
+    {
+      unsigned n = term.getOperator().getConst<BitVectorZeroExtend>();
+      const FixedBits& b = getBits(term[0]);
+      return FixedBits(b.getLo().zeroExtend(n), b.getHi().zeroExtend(n));
+    }
+    case kind::BITVECTOR_SIGN_EXTEND:
+    {
+      unsigned n = term.getOperator().getConst<BitVectorSignExtend>();
+      const FixedBits& b = getBits(term[0]);
+      return FixedBits(b.getLo().signExtend(n), b.getHi().signExtend(n));
+    }
+    case kind::BITVECTOR_PLUS:
+    {
+      FixedBits res = getBits(term[0]);
+      for (unsigned i = 1; i < term.getNumChildren(); ++i)
+      {
+        res = mkPlus(res, getBits(term[i]), false);
+      }
+      return res;
+    }
+    case kind::BITVECTOR_SUB:
+      // a - b = a + ~b + 1
+      return mkPlus(getBits(term[0]), mkNot(getBits(term[1])), true);
+    case kind::BITVECTOR_NEG:
+      return mkPlus(mkNot(getBits(term[0])), mkFixed(width, false), true);
+    case kind::BITVECTOR_MULT:
+    {
+      FixedBits res = getBits(term[0]);
+      for (unsigned i = 1; i < term.getNumChildren(); ++i)
+      {
+        res = mkMult(res, getBits(term[i]));
+      }
+      return res;
+    }
+    case kind::BITVECTOR_SHL:
+    case kind::BITVECTOR_LSHR:
+    case kind::BITVECTOR_ASHR:
+    {
+      const FixedBits& a = getBits(term[0]);
+      const FixedBits& amount = getBits(term[1]);
+      if (amount.isFixed())
+      {
+        return mkShift(k, a, amount.getLo());
+      }
+      if (k == kind::BITVECTOR_ASHR)
+      {
+        return FixedBits(width);
+      }
+      // shifting by at least the lower bound of the amount shifts in zeros
+      unsigned shift = amount.getLo().toInteger() < Integer(width)
+                           ? amount.getLo().toInteger().getUnsignedInt()
+                           : width;
+      if (shift == 0)
+      {
+        return FixedBits(width);
+      }
+      if (shift == width)
+      {
+        return mkFixed(width, false);
+      }
+      return k == kind::BITVECTOR_SHL
+                 ? mkConcat(FixedBits(width - shift), mkFixed(shift, false))
+                 : mkConcat(mkFixed(shift, false), FixedBits(width - shift));
+    }
+    case kind::BITVECTOR_ITE:
+    {
+      const FixedBits& cond = getBits(term[0]);
+      if (cond.isFixed())
+      {
+        return getBits(cond.getLo().isBitSet(0) ? term[1] : term[2]);
+      }
+      const FixedBits& t = getBits(term[1]);
+      const FixedBits& e = getBits(term[2]);
+      return FixedBits(t.getLo() & e.getLo(), t.getHi() | e.getHi());
+    }
+    default: break;
+  }
+
+  // evaluate any other operator on constant arguments
+  NodeBuilder<> nb(k);
+  if (term.getMetaKind() == kind::metakind::PARAMETERIZED)
+  {
+    nb << term.getOperator();
+  }
+  for (const TNode& child : term)
+  {
+    const FixedBits& b = getBits(child);
+    if (!b.isFixed())
+    {
+      return FixedBits(width);
+    }
+    nb << utils::mkConst(b.getLo());
+  }
+  Node value = Rewriter::rewrite(Node(nb));
+  // e.g. division by zero may not evaluate to a constant
+  return value.isConst() ? FixedBits(value.getConst<BitVector>())
+                         : FixedBits(width);
+}
+
+bool FixedBitsSolver::update(TNode term,
+                             const FixedBits& bits,
+                             const Reasons& reasons)
+{
+  DomainMap::iterator it = d_domains.find(term);
+  Assert(it != d_domains.end());
+  FixedBits refined = it->second.meet(bits);
+  if (refined == it->second)
+  {
+    return true;
+  }
+  Debug("bv-fixed-bits") << "  " << term << " : " << it->second << " -> "
+                         << refined << "\n";
+  it->second = refined;
+  Reasons& current = d_reasons[term];
+  mergeReasons(current, reasons);
+  if (refined.isInconsistent())
+  {
+    setConflict(current);
+    return false;
+  }
+  if (refined.isFixed())
+  {
+    ++(d_statistics.d_numFixedTerms);
+  }
+  if (d_inQueue.insert(term).second)
+  {
+    d_queue.push_back(term);
+  }
+  return true;
+}
+
+bool FixedBitsSolver::propagateTerm(TNode term)
+{
+  d_bv->spendResource(1);
+  UseMap::const_iterator pit = d_parents.find(term);
+  if (pit != d_parents.end())
+  {
+    for (const Node& parent : pit->second)
+    {
+      Reasons reasons;
+      FixedBits bits = computeUp(parent, reasons);
+      if (!update(parent, bits, reasons))
+      {
+        return false;
+      }
+    }
+  }
+  if (!propagateDown(term))
+  {
+    return false;
+  }
+  auto fit = d_factUses.find(term);
+  if (fit != d_factUses.end())
+  {
+    for (unsigned index : fit->second)
+    {
+      if (!propagateFact(index))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool FixedBitsSolver::propagateFact(unsigned index)
+{
+  TNode fact = d_facts[index];
+  bool polarity = fact.getKind() != kind::NOT;
+  TNode atom = polarity ? fact : fact[0];
+  unsigned width = utils::getSize(atom[0]);
+
+  Reasons reasonsA = getReasons(atom[0]);
+  Reasons reasonsB = getReasons(atom[1]);
+  Reasons fixed(1, index);
+  mergeReasons(reasonsA, fixed);
+  mergeReasons(reasonsB, fixed);
+  FixedBits a = getBits(atom[0]);
+  FixedBits b = getBits(atom[1]);
+
+  if (atom.getKind() == kind::EQUAL)
+  {
+    if (polarity)
+    {
+      return update(atom[0], b, reasonsB) && update(atom[1], a, reasonsA);
+    }
+    if (a.isFixed() && b.isFixed() && a == b)
+    {
+      mergeReasons(reasonsA, reasonsB);
+      setConflict(reasonsA);
+      return false;
+    }
+    return true;
+  }
+
+  // normalize to small <= large (strict if lt)
+  bool lt = (atom.getKind() == kind::BITVECTOR_ULT) == polarity;
+  TNode small = polarity ? atom[0] : atom[1];
+  TNode large = polarity ? atom[1] : atom[0];
+  const FixedBits& s = polarity ? a : b;
+  const FixedBits& l = polarity ? b : a;
+  const Reasons& reasonsS = polarity ? reasonsA : reasonsB;
+  const Reasons& reasonsL = polarity ? reasonsB : reasonsA;
+
+  bool conflict = lt ? !s.getLo().unsignedLessThan(l.getHi())
+                     : !s.getLo().unsignedLessThanEq(l.getHi());
+  if (conflict)
+  {
+    Reasons reasons = reasonsS;
+    mergeReasons(reasons, reasonsL);
+    setConflict(reasons);
+    return false;
+  }
+  BitVector max = lt ? l.getHi() - BitVector(width, 1u) : l.getHi();
+  return update(small, mkUpperBound(width, max), reasonsL);
+}
+
+bool FixedBitsSolver::propagateDown(TNode term)
+{
+  if (isLeaf(term))
+  {
+    return true;
+  }
+  const FixedBits bits = getBits(term);
+  const Reasons reasons = getReasons(term);
+  unsigned width = bits.getWidth();
+  Kind k = term.getKind();
+
+  switch (k)
+  {
+    case kind::BITVECTOR_NOT: return update(term[0], mkNot(bits), reasons);
+    case kind::BITVECTOR_CONCAT:
+    {
+      unsigned offset = 0;
+      for (unsigned i = term.getNumChildren(); i > 0; --i)
+      {
+        TNode child = term[i - 1];
+        unsigned w = utils::getSize(child);
+        if (!update(child, mkExtract(bits, offset + w - 1, offset), reasons))
+        {
+          return false;
+        }
+        offset += w;
+      }
+      return true;
+    }
+    case kind::BITVECTOR_EXTRACT:
+    {
+      unsigned high = utils::getExtractHigh(term);
+      unsigned low = utils::getExtractLow(term);
+      unsigned w = utils::getSize(term[0]);
+      FixedBits res = bits;
+      if (low > 0)
+      {
+        res = mkConcat(res, FixedBits(low));
+      }
+      if (high + 1 < w)
+      {
+        res = mkConcat(FixedBits(w - high - 1), res);
+      }
+      return update(term[0], res, reasons);
+    }
+    case kind::BITVECTOR_ZERO_EXTEND:
+    case kind::BITVECTOR_SIGN_EXTEND:
+      return update(
+          term[0], mkExtract(bits, utils::getSize(term[0]) - 1, 0), reasons);
+    case kind::BITVECTOR_AND:
+    case kind::BITVECTOR_OR:
+    case kind::BITVECTOR_XOR:
+    case kind::BITVECTOR_PLUS:
+    {
+      for (unsigned i = 0; i < term.getNumChildren(); ++i)
+      {
+        // combine all the other children
+        Reasons childReasons = reasons;
+        bool first = true;
+        FixedBits others(width);
+        for (unsigned j = 0; j < term.getNumChildren(); ++j)
+        {
+          if (i == j)
+          {
+            continue;
+          }
+          const FixedBits& b = getBits(term[j]);
+          mergeReasons(childReasons, getReasons(term[j]));
+          if (first)
+          {
+            others = b;
+            first = false;
+          }
+          else if (k == kind::BITVECTOR_AND)
+          {
+            others = mkAnd(others, b);
+          }
+          else if (k == kind::BITVECTOR_OR)
+          {
+            others = mkOr(others, b);
+          }
+          else if (k == kind::BITVECTOR_XOR)
+          {
+            others = mkXor(others, b);
+          }
+          else
+          {
+            others = mkPlus(others, b, false);
+          }
+        }
+        FixedBits res(width);
+        if (k == kind::BITVECTOR_AND)
+        {
+          // 1 in the result forces 1, 0 in the result and 1 in the others
+          // forces 0
+          res = FixedBits(bits.getLo(), bits.getHi() | ~others.getLo());
+        }
+        else if (k == kind::BITVECTOR_OR)
+        {
+          res = FixedBits(bits.getLo() & ~others.getHi(), bits.getHi());
+        }
+        else if (k == kind::BITVECTOR_XOR)
+        {
+          res = mkXor(bits, others);
+        }
+        else
+        {
+          unsigned low =
+              std::min(bits.getNumLowFixed(), others.getNumLowFixed());
+          if (low > 0)
+          {
+            res = fixLowBits(res, low, bits.getLo() - others.getLo());
+          }
+        }
+        if (!update(term[i], res, childReasons))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+    case kind::BITVECTOR_SHL:
+    case kind::BITVECTOR_LSHR:
+    {
+      const FixedBits& amount = getBits(term[1]);
+      if (!amount.isFixed() || amount.getLo().toInteger() >= Integer(width))
+      {
+        return true;
+      }
+      unsigned shift = amount.getLo().toInteger().getUnsignedInt();
+      Reasons childReasons = reasons;
+      mergeReasons(childReasons, getReasons(term[1]));
+      if (shift == 0)
+      {
+        return update(term[0], bits, childReasons);
+      }
+      // the bits shifted out of term[0] are unknown
+      FixedBits res =
+          k == kind::BITVECTOR_SHL
+              ? mkConcat(FixedBits(shift), mkExtract(bits, width - 1, shift))
+              : mkConcat(mkExtract(bits, width - shift - 1, 0),
+                         FixedBits(shift));
+      return update(term[0], res, childReasons);
+    }
+    default: break;
+  }
+  return true;
+}
+
+bool FixedBitsSolver::propagateAtoms()
+{
+  Valuation& valuation = d_bv->getValuation();
+  for (const Node& atom : d_atoms)
+  {
+    bool value;
+    if (!valuation.isSatLiteral(atom) || valuation.hasSatValue(atom, value)
+        || d_explanations.find(atom) != d_explanations.end()
+        || d_explanations.find(atom.notNode()) != d_explanations.end())
+    {
+      continue;
+    }
+    registerTerm(atom[0]);
+    registerTerm(atom[1]);
+    const FixedBits& a = getBits(atom[0]);
+    const FixedBits& b = getBits(atom[1]);
+
+    bool holds = false;
+    bool fails = false;
+    switch (atom.getKind())
+    {
+      case kind::EQUAL:
+        holds = a.isFixed() && b.isFixed() && a == b;
+        fails = a.meet(b).isInconsistent();
+        break;
+      case kind::BITVECTOR_ULT:
+        holds = a.getHi().unsignedLessThan(b.getLo());
+        fails = !a.getLo().unsignedLessThan(b.getHi());
+        break;
+      default:
+        Assert(atom.getKind() == kind::BITVECTOR_ULE);
+        holds = a.getHi().unsignedLessThanEq(b.getLo());
+        fails = !a.getLo().unsignedLessThanEq(b.getHi());
+        break;
+    }
+    if (!holds && !fails)
+    {
+      continue;
+    }
+    Node literal = holds ? atom : atom.notNode();
+    Reasons reasons = getReasons(atom[0]);
+    mergeReasons(reasons, getReasons(atom[1]));
+    d_explanations.insert(literal, mkExplanation(reasons));
+    Debug("bv-fixed-bits") << "FixedBitsSolver::propagate " << literal
+                           << "\n";
+    ++(d_statistics.d_numPropagations);
+    if (!d_bv->storePropagation(literal, SUB_FIXED_BITS))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+Node FixedBitsSolver::mkExplanation(const Reasons& reasons)
+{
+  if (reasons.empty())
+  {
+    return utils::mkTrue();
+  }
+  std::vector<TNode> facts;
+  for (unsigned index : reasons)
+  {
+    facts.push_back(d_facts[index]);
+  }
+  return utils::mkAnd(facts);
+}
+
+void FixedBitsSolver::setConflict(const Reasons& reasons)
+{
+  Assert(!reasons.empty());
+  Node conflict = mkExplanation(reasons);
+  Debug("bv-fixed-bits") << "FixedBitsSolver::conflict " << conflict << "\n";
+  ++(d_statistics.d_numConflicts);
+  d_bv->setConflict(conflict);
+}
+
+void FixedBitsSolver::explain(TNode literal, std::vector<TNode>& assumptions)
+{
+  context::CDHashMap<Node, Node, NodeHashFunction>::const_iterator it =
+      d_explanations.find(literal);
+  Assert(it != d_explanations.end());
+  TNode explanation = (*it).second;
+  if (explanation.getKind() == kind::AND)
+  {
+    assumptions.insert(
+        assumptions.end(), explanation.begin(), explanation.end());
+  }
+  else if (!explanation.isConst())
+  {
+    assumptions.push_back(explanation);
+  }
+}
+
+FixedBitsSolver::Statistics::Statistics()
+    : d_numCallsToCheck("theory::bv::FixedBitsSolver::NumCallsToCheck", 0),
+      d_numConflicts("theory::bv::FixedBitsSolver::NumConflicts", 0),
+      d_numPropagations("theory::bv::FixedBitsSolver::NumPropagations", 0),
+      d_numFixedTerms("theory::bv::FixedBitsSolver::NumFixedTerms", 0),
+      d_solveTimer("theory::bv::FixedBitsSolver::SolveTimer")
+{
+  smtStatisticsRegistry()->registerStat(&d_numCallsToCheck);
+  smtStatisticsRegistry()->registerStat(&d_numConflicts);
+  smtStatisticsRegistry()->registerStat(&d_numPropagations);
+  smtStatisticsRegistry()->registerStat(&d_numFixedTerms);
+  smtStatisticsRegistry()->registerStat(&d_solveTimer);
+}
+
+FixedBitsSolver::Statistics::~Statistics()
+{
+  smtStatisticsRegistry()->unregisterStat(&d_numCallsToCheck);
+  smtStatisticsRegistry()->unregisterStat(&d_numConflicts);
+  smtStatisticsRegistry()->unregisterStat(&d_numPropagations);
+  smtStatisticsRegistry()->unregisterStat(&d_numFixedTerms);
+  smtStatisticsRegistry()->unregisterStat(&d_solveTimer);
+}
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace CVC4
@@ -0,0 +1,178 @@
+/*********************                                                        */
+/*! \file bv_subtheory_fixed_bits.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Liana Hadarean
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Word-level fixed-bits propagation solver.
+ **
+ ** Word-level fixed-bits propagation solver.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__THEORY__BV__BV_SUBTHEORY__FIXED_BITS_H
+#define __CVC4__THEORY__BV__BV_SUBTHEORY__FIXED_BITS_H
+
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "context/cdhashmap.h"
+#include "theory/bv/bv_subtheory.h"
+#include "util/bitvector.h"
+
+namespace CVC4 {
+namespace theory {
+namespace bv {
+
+/**
+ * Three-valued abstraction of a bit-vector term. Bit i is fixed to 1 if it is
+ * set in d_lo, fixed to 0 if it is not set in d_hi, and unknown otherwise.
+ * Read as unsigned numbers, d_lo and d_hi are also a lower and an upper bound
+ * on the value of the term.
+ */
+class FixedBits
+{
+ public:
+  /** All bits unknown. */
+  FixedBits(unsigned width);
+  /** All bits fixed to the bits of value. */
+  FixedBits(const BitVector& value);
+  FixedBits(const BitVector& lo, const BitVector& hi);
+
+  unsigned getWidth() const { return d_lo.getSize(); }
+  const BitVector& getLo() const { return d_lo; }
+  const BitVector& getHi() const { return d_hi; }
+  /** Returns true if all bits are fixed. */
+  bool isFixed() const { return d_lo == d_hi; }
+  /** Returns true if some bit is fixed to both 0 and 1. */
+  bool isInconsistent() const;
+  /** Returns the number of consecutive fixed bits starting at bit 0. */
+  unsigned getNumLowFixed() const;
+  /** Returns the abstraction of the terms that fit both this and other. */
+  FixedBits meet(const FixedBits& other) const;
+
+  bool operator==(const FixedBits& other) const
+  {
+    return d_lo == other.d_lo && d_hi == other.d_hi;
+  }
+  bool operator!=(const FixedBits& other) const { return !(*this == other); }
+
+ private:
+  BitVector d_lo;
+  BitVector d_hi;
+}; /* class FixedBits */
+
+std::ostream& operator<<(std::ostream& out, const FixedBits& bits);
+
+/**
+ * Propagates fixed bits through the bit-vector terms of the asserted facts at
+ * the word level, e.g. through +, *, shifts, extract and concat, and refines
+ * them with the asserted equalities and unsigned inequalities. It reports
+ * conflicts and propagates registered atoms whose truth value is decided by
+ * the fixed bits, before the bit-blaster sees them.
+ *
+ * The abstraction is recomputed from the asserted facts on every check that
+ * has new facts. Each abstraction carries the set of facts it was derived
+ * from, which explains conflicts and propagations.
+ */
+class FixedBitsSolver : public SubtheorySolver
+{
+ public:
+  FixedBitsSolver(context::Context* c, TheoryBV* bv);
+  ~FixedBitsSolver();
+
+  bool check(Theory::Effort e) override;
+  void explain(TNode literal, std::vector<TNode>& assumptions) override;
+  void preRegister(TNode node) override;
+  bool collectModelInfo(TheoryModel* m, bool fullModel) override
+  {
+    return true;
+  }
+  Node getModelValue(TNode var) override { return Node::null(); }
+  bool isComplete() override { return false; }
+  EqualityStatus getEqualityStatus(TNode a, TNode b) override
+  {
+    return EQUALITY_UNKNOWN;
+  }
+
+ private:
+  /** Sorted indices into d_facts. */
+  typedef std::vector<unsigned> Reasons;
+  typedef std::unordered_map<Node, FixedBits, NodeHashFunction> DomainMap;
+  typedef std::unordered_map<Node, Reasons, NodeHashFunction> ReasonMap;
+  typedef std::unordered_map<Node, std::vector<Node>, NodeHashFunction>
+      UseMap;
+
+  /** Registers term and its subterms, computing their abstraction. */
+  void registerTerm(TNode term);
+  /** Registers a bit-vector fact, returns false if it is not one. */
+  bool registerFact(TNode fact, unsigned index);
+  /**
+   * Refines the abstraction of term with bits derived from reasons. Returns
+   * false on a conflict.
+   */
+  bool update(TNode term, const FixedBits& bits, const Reasons& reasons);
+  /** Propagates the change in the abstraction of term. */
+  bool propagateTerm(TNode term);
+  /** Applies the asserted fact to the abstraction of its terms. */
+  bool propagateFact(unsigned index);
+  /** Propagates the abstraction of term down to its children. */
+  bool propagateDown(TNode term);
+  /** Propagates registered atoms decided by the abstraction. */
+  bool propagateAtoms();
+
+  /** Computes the abstraction of term from the ones of its children. */
+  FixedBits computeUp(TNode term, Reasons& reasons);
+
+  const FixedBits& getBits(TNode term) const;
+  const Reasons& getReasons(TNode term) const;
+  void setConflict(const Reasons& reasons);
+  Node mkExplanation(const Reasons& reasons);
+
+  /** The bit-vector facts of the current check. */
+  std::vector<TNode> d_facts;
+  /** Abstraction of the terms of d_facts. */
+  DomainMap d_domains;
+  /** Facts each abstraction in d_domains was derived from. */
+  ReasonMap d_reasons;
+  /** Maps terms to the registered terms they are a child of. */
+  UseMap d_parents;
+  /** Maps terms to the indices of facts they appear in at the top. */
+  std::unordered_map<Node, std::vector<unsigned>, NodeHashFunction> d_factUses;
+  /** Terms whose abstraction changed, and still need to be propagated. */
+  std::deque<Node> d_queue;
+  std::unordered_set<Node, NodeHashFunction> d_inQueue;
+
+  /** Registered atoms over bit-vector terms. */
+  std::vector<Node> d_atoms;
+  std::unordered_set<Node, NodeHashFunction> d_atomSet;
+  /** Explanations of the literals propagated by this solver. */
+  context::CDHashMap<Node, Node, NodeHashFunction> d_explanations;
+
+  class Statistics
+  {
+   public:
+    IntStat d_numCallsToCheck;
+    IntStat d_numConflicts;
+    IntStat d_numPropagations;
+    IntStat d_numFixedTerms;
+    TimerStat d_solveTimer;
+    Statistics();
+    ~Statistics();
+  };
+  Statistics d_statistics;
+}; /* class FixedBitsSolver */
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace CVC4
+
+#endif /* __CVC4__THEORY__BV__BV_SUBTHEORY__FIXED_BITS_H */
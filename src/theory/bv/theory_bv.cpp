@@ -19,10 +19,12 @@
 #include "options/smt_options.h"
 #include "smt/smt_statistics_registry.h"
 #include "theory/bv/abstraction.h"
+#include "theory/bv/bitblast/bitblast_cache.h"
 #include "theory/bv/bv_eager_solver.h"
 #include "theory/bv/bv_subtheory_algebraic.h"
 #include "theory/bv/bv_subtheory_bitblast.h"
 #include "theory/bv/bv_subtheory_core.h"
+#include "theory/bv/bv_subtheory_fixed_bits.h"
 #include "theory/bv/bv_subtheory_inequality.h"
 #include "theory/bv/slicer.h"
 #include "theory/bv/theory_bv_rewrite_rules_normalization.h"
@@ -61,6 +63,7 @@ TheoryBV::TheoryBV(context::Context* c, context::UserContext* u,
     d_literalsToPropagate(c),
     d_literalsToPropagateIndex(c, 0),
     d_propagatedBy(c),
+    d_bbCache(),
     d_eagerSolver(NULL),
     d_abstractionModule(new AbstractionModule(getStatsPrefix(THEORY_BV))),
     d_isCoreTheory(false),
@@ -72,6 +75,12 @@ TheoryBV::TheoryBV(context::Context* c, context::UserContext* u,
   setupExtTheory();
   getExtTheory()->addFunctionKind(kind::BITVECTOR_TO_NAT);
   getExtTheory()->addFunctionKind(kind::INT_TO_BITVECTOR);
+  // the proof of a bit-blasted term is logged by the bit-blaster that built
+  // it, so the definitions cannot be shared when producing proofs
+  if (options::bitblastSharedCacheWidth() > 0 && !options::proof())
+  {
+    d_bbCache.reset(new BitblastCache(options::bitblastSharedCacheWidth()));
+  }
   if (options::bitblastMode() == theory::bv::BITBLAST_MODE_EAGER) {
     d_eagerSolver = new EagerBitblastSolver(this);
     return;
@@ -91,6 +100,13 @@ TheoryBV::TheoryBV(context::Context* c, context::UserContext* u,
     d_subtheoryMap[SUB_INEQUALITY] = ineq_solver;
   }
 
+  if (options::bitvectorFixedBitsSolver() && !options::proof())
+  {
+    SubtheorySolver* fixed_bits_solver = new FixedBitsSolver(c, this);
+    d_subtheories.push_back(fixed_bits_solver);
+    d_subtheoryMap[SUB_FIXED_BITS] = fixed_bits_solver;
+  }
+
   if (options::bitvectorAlgebraicSolver() && !options::proof())
   {
     SubtheorySolver* alg_solver = new AlgebraicSolver(c, this);
@@ -19,6 +19,7 @@
 #ifndef __CVC4__THEORY__BV__THEORY_BV_H
 #define __CVC4__THEORY__BV__THEORY_BV_H
 
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -39,8 +40,10 @@ class CoreSolver;
 class InequalitySolver;
 class AlgebraicSolver;
 class BitblastSolver;
+class FixedBitsSolver;
 
 class EagerBitblastSolver;
+class BitblastCache;
 
 class AbstractionModule;
 
@@ -170,6 +173,11 @@ private:
   typedef context::CDHashMap<Node, SubTheory, NodeHashFunction> PropagatedMap;
   PropagatedMap d_propagatedBy;
 
+  /**
+   * Term bit-blasting cache shared by all the bit-blasters of this theory, or
+   * null if sharing is disabled.
+   */
+  std::shared_ptr<BitblastCache> d_bbCache;
   EagerBitblastSolver* d_eagerSolver;
   AbstractionModule* d_abstractionModule;
   bool d_isCoreTheory;
@@ -234,6 +242,7 @@ private:
   friend class CoreSolver;
   friend class InequalitySolver;
   friend class AlgebraicSolver;
+  friend class FixedBitsSolver;
   friend class EagerBitblastSolver;
 };/* class TheoryBV */
 
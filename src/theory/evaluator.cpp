@@ -0,0 +1,699 @@
+/*********************                                                        */
+/*! \file evaluator.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Andres Noetzli
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief The Evaluator class
+ **
+ ** The Evaluator class.
+ **/
+
+#include "theory/evaluator.h"
+
+#include "expr/datatype.h"
+#include "expr/node_builder.h"
+#include "theory/bv/theory_bv_utils.h"
+
+namespace CVC4 {
+namespace theory {
+
+EvalResult::EvalResult(const EvalResult& other)
+{
+  d_tag = other.d_tag;
+  switch (d_tag)
+  {
+    case BOOL: d_bool = other.d_bool; break;
+    case BITVECTOR:
+      new (&d_bv) BitVector;
+      d_bv = other.d_bv;
+      break;
+    case RATIONAL:
+      new (&d_rat) Rational;
+      d_rat = other.d_rat;
+      break;
+    case STRING:
+      new (&d_str) String;
+      d_str = other.d_str;
+      break;
+    case DATATYPE:
+      new (&d_node) Node;
+      d_node = other.d_node;
+      break;
+    case INVALID: break;
+  }
+}
+
+EvalResult& EvalResult::operator=(const EvalResult& other)
+{
+  if (this != &other)
+  {
+    clear();
+    d_tag = other.d_tag;
+    switch (d_tag)
+    {
+      case BOOL: d_bool = other.d_bool; break;
+      case BITVECTOR:
+        new (&d_bv) BitVector;
+        d_bv = other.d_bv;
+        break;
+      case RATIONAL:
+        new (&d_rat) Rational;
+        d_rat = other.d_rat;
+        break;
+      case STRING:
+        new (&d_str) String;
+        d_str = other.d_str;
+        break;
+      case DATATYPE:
+        new (&d_node) Node;
+        d_node = other.d_node;
+        break;
+      case INVALID: break;
+    }
+  }
+  return *this;
+}
+
+EvalResult::~EvalResult() { clear(); }
+
+void EvalResult::clear()
+{
+  switch (d_tag)
+  {
+    case BITVECTOR: d_bv.~BitVector(); break;
+    case RATIONAL: d_rat.~Rational(); break;
+    case STRING: d_str.~String(); break;
+    case DATATYPE: d_node.~Node(); break;
+    default: break;
+  }
+  d_tag = INVALID;
+}
+
+bool EvalResult::operator==(const EvalResult& other) const
+{
+  Assert(isValid() && other.isValid());
+  if (d_tag != other.d_tag)
+  {
+    return false;
+  }
+  switch (d_tag)
+  {
+    case BOOL: return d_bool == other.d_bool;
+    case BITVECTOR: return d_bv == other.d_bv;
+    case RATIONAL: return d_rat == other.d_rat;
+    case STRING: return d_str == other.d_str;
+    case DATATYPE: return d_node == other.d_node;
+    default: return false;
+  }
+}
+
+Node EvalResult::toNode() const
+{
+  NodeManager* nm = NodeManager::currentNM();
+  switch (d_tag)
+  {
+    case EvalResult::BOOL: return nm->mkConst(d_bool);
+    case EvalResult::BITVECTOR: return nm->mkConst(d_bv);
+    case EvalResult::RATIONAL: return nm->mkConst(d_rat);
+    case EvalResult::STRING: return nm->mkConst(d_str);
+    case EvalResult::DATATYPE: return d_node;
+    default:
+    {
+      Trace("evaluator") << "Missing conversion from " << d_tag << " to node"
+                         << std::endl;
+      return Node();
+    }
+  }
+}
+
+Node Evaluator::eval(TNode n,
+                     const std::vector<Node>& args,
+                     const std::vector<Node>& vals)
+{
+  Trace("evaluator") << "Evaluating " << n << " under substitution " << args
+                     << " " << vals << std::endl;
+  return evalInternal(n, args, vals).toNode();
+}
+
+EvalResult Evaluator::toEvalResult(TNode n)
+{
+  switch (n.getKind())
+  {
+    case kind::CONST_BOOLEAN: return EvalResult(n.getConst<bool>());
+    case kind::CONST_BITVECTOR: return EvalResult(n.getConst<BitVector>());
+    case kind::CONST_RATIONAL: return EvalResult(n.getConst<Rational>());
+    case kind::CONST_STRING: return EvalResult(n.getConst<String>());
+    case kind::APPLY_CONSTRUCTOR:
+      if (n.isConst() && !n.getType().isCodatatype())
+      {
+        return EvalResult(Node(n));
+      }
+      return EvalResult();
+    default: return EvalResult();
+  }
+}
+
+EvalResult Evaluator::evalInternal(TNode n,
+                                   const std::vector<Node>& args,
+                                   const std::vector<Node>& vals)
+{
+  Assert(args.size() == vals.size());
+  std::unordered_map<TNode, unsigned, TNodeHashFunction> argIndex;
+  for (unsigned i = 0, size = args.size(); i < size; i++)
+  {
+    argIndex[args[i]] = i;
+  }
+  std::unordered_map<TNode, EvalResult, TNodeHashFunction> results;
+  std::vector<TNode> queue;
+  queue.emplace_back(n);
+
+  while (!queue.empty())
+  {
+    TNode currNode = queue.back();
+
+    if (results.find(currNode) != results.end())
+    {
+      queue.pop_back();
+      continue;
+    }
+
+    std::unordered_map<TNode, unsigned, TNodeHashFunction>::iterator ita =
+        argIndex.find(currNode);
+    if (ita != argIndex.end())
+    {
+      results[currNode] = toEvalResult(vals[ita->second]);
+      queue.pop_back();
+      continue;
+    }
+    if (currNode.isConst() || currNode.getNumChildren() == 0)
+    {
+      // leaves that are not constants are not given a value
+      results[currNode] = toEvalResult(currNode);
+      queue.pop_back();
+      continue;
+    }
+
+    bool doEval = true;
+    for (const Node& currNodeChild : currNode)
+    {
+      if (results.find(currNodeChild) == results.end())
+      {
+        queue.emplace_back(currNodeChild);
+        doEval = false;
+      }
+    }
+    if (!doEval)
+    {
+      continue;
+    }
+    queue.pop_back();
+
+    // the value of the term is invalid if the value of any child is
+    bool childrenValid = true;
+    for (const Node& currNodeChild : currNode)
+    {
+      if (!results[currNodeChild].isValid())
+      {
+        childrenValid = false;
+        break;
+      }
+    }
+    if (!childrenValid)
+    {
+      results[currNode] = EvalResult();
+      continue;
+    }
+
+    Trace("evaluator") << "Evaluate " << currNode << std::endl;
+    EvalResult& res = results[currNode];
+    switch (currNode.getKind())
+    {
+      case kind::NOT:
+      {
+        res = EvalResult(!(results[currNode[0]].d_bool));
+        break;
+      }
+
+      case kind::AND:
+      {
+        bool b = true;
+        for (const Node& c : currNode)
+        {
+          b = b && results[c].d_bool;
+        }
+        res = EvalResult(b);
+        break;
+      }
+
+      case kind::OR:
+      {
+        bool b = false;
+        for (const Node& c : currNode)
+        {
+          b = b || results[c].d_bool;
+        }
+        res = EvalResult(b);
+        break;
+      }
+
+      case kind::IMPLIES:
+      {
+        res = EvalResult(!results[currNode[0]].d_bool
+                         || results[currNode[1]].d_bool);
+        break;
+      }
+
+      case kind::XOR:
+      {
+        res = EvalResult(results[currNode[0]].d_bool
+                         != results[currNode[1]].d_bool);
+        break;
+      }
+
+      case kind::ITE:
+      {
+        res = results[currNode[0]].d_bool ? results[currNode[1]]
+                                          : results[currNode[2]];
+        break;
+      }
+
+      case kind::EQUAL:
+      {
+        res = EvalResult(results[currNode[0]] == results[currNode[1]]);
+        break;
+      }
+
+      case kind::APPLY_UF:
+      {
+        // the value of the operator must be a lambda given by the arguments
+        ita = argIndex.find(currNode.getOperator());
+        if (ita == argIndex.end() || vals[ita->second].getKind() != kind::LAMBDA)
+        {
+          break;
+        }
+        TNode lambda = vals[ita->second];
+        std::vector<Node> lambdaArgs(lambda[0].begin(), lambda[0].end());
+        std::vector<Node> lambdaVals;
+        for (const Node& c : currNode)
+        {
+          lambdaVals.push_back(results[c].toNode());
+        }
+        res = evalInternal(lambda[1], lambdaArgs, lambdaVals);
+        break;
+      }
+
+      case kind::PLUS:
+      {
+        Rational r = results[currNode[0]].d_rat;
+        for (size_t i = 1, nchild = currNode.getNumChildren(); i < nchild; i++)
+        {
+          r = r + results[currNode[i]].d_rat;
+        }
+        res = EvalResult(r);
+        break;
+      }
+
+      case kind::MINUS:
+      {
+        res = EvalResult(results[currNode[0]].d_rat
+                         - results[currNode[1]].d_rat);
+        break;
+      }
+
+      case kind::UMINUS:
+      {
+        res = EvalResult(-results[currNode[0]].d_rat);
+        break;
+      }
+
+      case kind::MULT:
+      case kind::NONLINEAR_MULT:
+      {
+        Rational r = results[currNode[0]].d_rat;
+        for (size_t i = 1, nchild = currNode.getNumChildren(); i < nchild; i++)
+        {
+          r = r * results[currNode[i]].d_rat;
+        }
+        res = EvalResult(r);
+        break;
+      }
+
+      case kind::DIVISION_TOTAL:
+      {
+        // division by zero is zero, as in the arithmetic rewriter
+        const Rational& d = results[currNode[1]].d_rat;
+        res = EvalResult(d.isZero() ? Rational(0)
+                                    : results[currNode[0]].d_rat / d);
+        break;
+      }
+
+      case kind::INTS_DIVISION_TOTAL:
+      case kind::INTS_MODULUS_TOTAL:
+      {
+        const Rational& nr = results[currNode[0]].d_rat;
+        const Rational& dr = results[currNode[1]].d_rat;
+        if (!nr.isIntegral() || !dr.isIntegral())
+        {
+          break;
+        }
+        if (dr.isZero())
+        {
+          res = EvalResult(Rational(0));
+          break;
+        }
+        Integer ni = nr.getNumerator();
+        Integer di = dr.getNumerator();
+        res = EvalResult(Rational(currNode.getKind() == kind::INTS_DIVISION_TOTAL
+                                      ? ni.euclidianDivideQuotient(di)
+                                      : ni.euclidianDivideRemainder(di)));
+        break;
+      }
+
+      case kind::ABS:
+      {
+        res = EvalResult(results[currNode[0]].d_rat.abs());
+        break;
+      }
+
+      case kind::TO_REAL:
+      {
+        res = results[currNode[0]];
+        break;
+      }
+
+      case kind::TO_INTEGER:
+      {
+        res = EvalResult(Rational(results[currNode[0]].d_rat.floor()));
+        break;
+      }
+
+      case kind::IS_INTEGER:
+      {
+        res = EvalResult(results[currNode[0]].d_rat.isIntegral());
+        break;
+      }
+
+      case kind::LT:
+      {
+        res = EvalResult(results[currNode[0]].d_rat
+                         < results[currNode[1]].d_rat);
+        break;
+      }
+
+      case kind::LEQ:
+      {
+        res = EvalResult(results[currNode[0]].d_rat
+                         <= results[currNode[1]].d_rat);
+        break;
+      }
+
+      case kind::GT:
+      {
+        res = EvalResult(results[currNode[0]].d_rat
+                         > results[currNode[1]].d_rat);
+        break;
+      }
+
+      case kind::GEQ:
+      {
+        res = EvalResult(results[currNode[0]].d_rat
+                         >= results[currNode[1]].d_rat);
+        break;
+      }
+
+      case kind::STRING_CONCAT:
+      {
+        String r = results[currNode[0]].d_str;
+        for (size_t i = 1, nchild = currNode.getNumChildren(); i < nchild; i++)
+        {
+          r = r.concat(results[currNode[i]].d_str);
+        }
+        res = EvalResult(r);
+        break;
+      }
+
+      case kind::STRING_LENGTH:
+      {
+        const String& s = results[currNode[0]].d_str;
+        res = EvalResult(Rational(Integer(s.size())));
+        break;
+      }
+
+      case kind::STRING_SUBSTR:
+      {
+        // out of bounds arguments give the empty string, as in the strings
+        // rewriter
+        const String& s = results[currNode[0]].d_str;
+        const Rational& i = results[currNode[1]].d_rat;
+        const Rational& j = results[currNode[2]].d_rat;
+        Rational size(Integer(s.size()));
+        if (i.sgn() < 0 || i >= size || j.sgn() <= 0)
+        {
+          res = EvalResult(String(""));
+          break;
+        }
+        size_t start = i.getNumerator().toUnsignedInt();
+        if (j >= size - i)
+        {
+          res = EvalResult(s.suffix(s.size() - start));
+        }
+        else
+        {
+          res = EvalResult(s.substr(start, j.getNumerator().toUnsignedInt()));
+        }
+        break;
+      }
+
+      case kind::STRING_STRCTN:
+      {
+        const String& s = results[currNode[0]].d_str;
+        const String& t = results[currNode[1]].d_str;
+        res = EvalResult(s.find(t) != std::string::npos);
+        break;
+      }
+
+      case kind::STRING_PREFIX:
+      case kind::STRING_SUFFIX:
+      {
+        const String& t = results[currNode[0]].d_str;
+        const String& s = results[currNode[1]].d_str;
+        bool b = false;
+        if (s.size() >= t.size())
+        {
+          b = currNode.getKind() == kind::STRING_PREFIX
+                  ? t == s.prefix(t.size())
+                  : t == s.suffix(t.size());
+        }
+        res = EvalResult(b);
+        break;
+      }
+
+      case kind::STRING_STRREPL:
+      {
+        const String& s = results[currNode[0]].d_str;
+        const String& t = results[currNode[1]].d_str;
+        const String& u = results[currNode[2]].d_str;
+        res = EvalResult(s.replace(t, u));
+        break;
+      }
+
+      case kind::BITVECTOR_NOT:
+      {
+        res = EvalResult(~results[currNode[0]].d_bv);
+        break;
+      }
+
+      case kind::BITVECTOR_NEG:
+      {
+        res = EvalResult(-results[currNode[0]].d_bv);
+        break;
+      }
+
+      case kind::BITVECTOR_AND:
+      case kind::BITVECTOR_OR:
+      case kind::BITVECTOR_XOR:
+      case kind::BITVECTOR_PLUS:
+      case kind::BITVECTOR_MULT:
+      case kind::BITVECTOR_CONCAT:
+      {
+        Kind k = currNode.getKind();
+        BitVector r = results[currNode[0]].d_bv;
+        for (size_t i = 1, nchild = currNode.getNumChildren(); i < nchild; i++)
+        {
+          const BitVector& c = results[currNode[i]].d_bv;
+          switch (k)
+          {
+            case kind::BITVECTOR_AND: r = r & c; break;
+            case kind::BITVECTOR_OR: r = r | c; break;
+            case kind::BITVECTOR_XOR: r = r ^ c; break;
+            case kind::BITVECTOR_PLUS: r = r + c; break;
+            case kind::BITVECTOR_MULT: r = r * c; break;
+            default: r = r.concat(c); break;
+          }
+        }
+        res = EvalResult(r);
+        break;
+      }
+
+      case kind::BITVECTOR_SUB:
+      {
+        res = EvalResult(results[currNode[0]].d_bv - results[currNode[1]].d_bv);
+        break;
+      }
+
+      case kind::BITVECTOR_EXTRACT:
+      {
+        res = EvalResult(results[currNode[0]].d_bv.extract(
+            bv::utils::getExtractHigh(currNode),
+            bv::utils::getExtractLow(currNode)));
+        break;
+      }
+
+      case kind::BITVECTOR_ZERO_EXTEND:
+      {
+        unsigned amount =
+            currNode.getOperator().getConst<BitVectorZeroExtend>();
+        res = EvalResult(results[currNode[0]].d_bv.zeroExtend(amount));
+        break;
+      }
+
+      case kind::BITVECTOR_SIGN_EXTEND:
+      {
+        unsigned amount =
+            currNode.getOperator().getConst<BitVectorSignExtend>();
+        res = EvalResult(results[currNode[0]].d_bv.signExtend(amount));
+        break;
+      }
+
+      case kind::BITVECTOR_UDIV_TOTAL:
+      {
+        res = EvalResult(results[currNode[0]].d_bv.unsignedDivTotal(
+            results[currNode[1]].d_bv));
+        break;
+      }
+
+      case kind::BITVECTOR_UREM_TOTAL:
+      {
+        res = EvalResult(results[currNode[0]].d_bv.unsignedRemTotal(
+            results[currNode[1]].d_bv));
+        break;
+      }
+
+      case kind::BITVECTOR_SHL:
+      {
+        res = EvalResult(
+            results[currNode[0]].d_bv.leftShift(results[currNode[1]].d_bv));
+        break;
+      }
+
+      case kind::BITVECTOR_LSHR:
+      {
+        res = EvalResult(results[currNode[0]].d_bv.logicalRightShift(
+            results[currNode[1]].d_bv));
+        break;
+      }
+
+      case kind::BITVECTOR_ASHR:
+      {
+        res = EvalResult(results[currNode[0]].d_bv.arithRightShift(
+            results[currNode[1]].d_bv));
+        break;
+      }
+
+      case kind::BITVECTOR_ULT:
+      case kind::BITVECTOR_ULE:
+      case kind::BITVECTOR_UGT:
+      case kind::BITVECTOR_UGE:
+      case kind::BITVECTOR_SLT:
+      case kind::BITVECTOR_SLE:
+      case kind::BITVECTOR_SGT:
+      case kind::BITVECTOR_SGE:
+      {
+        const BitVector& a = results[currNode[0]].d_bv;
+        const BitVector& b = results[currNode[1]].d_bv;
+        bool r;
+        switch (currNode.getKind())
+        {
+          case kind::BITVECTOR_ULT: r = a.unsignedLessThan(b); break;
+          case kind::BITVECTOR_ULE: r = a.unsignedLessThanEq(b); break;
+          case kind::BITVECTOR_UGT: r = b.unsignedLessThan(a); break;
+          case kind::BITVECTOR_UGE: r = b.unsignedLessThanEq(a); break;
+          case kind::BITVECTOR_SLT: r = a.signedLessThan(b); break;
+          case kind::BITVECTOR_SLE: r = a.signedLessThanEq(b); break;
+          case kind::BITVECTOR_SGT: r = b.signedLessThan(a); break;
+          default: r = b.signedLessThanEq(a); break;
+        }
+        res = EvalResult(r);
+        break;
+      }
+
+      case kind::APPLY_CONSTRUCTOR:
+      {
+        if (currNode.getType().isCodatatype())
+        {
+          break;
+        }
+        NodeBuilder<> nb(kind::APPLY_CONSTRUCTOR);
+        nb << currNode.getOperator();
+        for (const Node& c : currNode)
+        {
+          nb << results[c].toNode();
+        }
+        res = EvalResult(Node(nb));
+        break;
+      }
+
+      case kind::APPLY_SELECTOR_TOTAL:
+      {
+        const EvalResult& arg = results[currNode[0]];
+        if (arg.d_tag != EvalResult::DATATYPE)
+        {
+          break;
+        }
+        // a selector of another constructor is left to the rewriter, which
+        // chooses a ground term for it
+        Expr sel = currNode.getOperator().toExpr();
+        const Datatype& dt = Datatype::datatypeOf(sel);
+        const DatatypeConstructor& c =
+            dt[Datatype::indexOf(arg.d_node.getOperator().toExpr())];
+        int index = c.getSelectorIndexInternal(sel);
+        if (index >= 0)
+        {
+          res = toEvalResult(arg.d_node[index]);
+        }
+        break;
+      }
+
+      case kind::APPLY_TESTER:
+      {
+        const EvalResult& arg = results[currNode[0]];
+        if (arg.d_tag != EvalResult::DATATYPE)
+        {
+          break;
+        }
+        res = EvalResult(
+            Datatype::indexOf(currNode.getOperator().toExpr())
+            == Datatype::indexOf(arg.d_node.getOperator().toExpr()));
+        break;
+      }
+
+      default:
+      {
+        Trace("evaluator") << "Kind " << currNode.getKind()
+                           << " not supported" << std::endl;
+        break;
+      }
+    }
+  }
+
+  return results[n];
+}
+
+}  // namespace theory
+}  // namespace CVC4
@@ -0,0 +1,130 @@
+/*********************                                                        */
+/*! \file evaluator.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Andres Noetzli
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief The Evaluator class
+ **
+ ** The Evaluator class can be used to evaluate terms with constant leaves
+ ** quickly, without going through the rewriter.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__THEORY__EVALUATOR_H
+#define __CVC4__THEORY__EVALUATOR_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "base/output.h"
+#include "expr/node.h"
+#include "util/bitvector.h"
+#include "util/rational.h"
+#include "util/regexp.h"
+
+namespace CVC4 {
+namespace theory {
+
+/**
+ * Struct that holds the result of an evaluation. The actual value is stored in
+ * a union to avoid the overhead of constructing and destructing values of the
+ * types that are not used.
+ */
+struct EvalResult
+{
+  /* Type tag */
+  enum
+  {
+    BOOL,
+    BITVECTOR,
+    RATIONAL,
+    STRING,
+    DATATYPE,
+    INVALID
+  } d_tag;
+
+  /* Stores the actual result */
+  union
+  {
+    bool d_bool;
+    BitVector d_bv;
+    Rational d_rat;
+    String d_str;
+    /* A constant term of datatype type, i.e. a constructor application */
+    Node d_node;
+  };
+
+  EvalResult(const EvalResult& other);
+  EvalResult() : d_tag(INVALID) {}
+  EvalResult(bool b) : d_tag(BOOL), d_bool(b) {}
+  EvalResult(const BitVector& bv) : d_tag(BITVECTOR), d_bv(bv) {}
+  EvalResult(const Rational& i) : d_tag(RATIONAL), d_rat(i) {}
+  EvalResult(const String& str) : d_tag(STRING), d_str(str) {}
+  EvalResult(const Node& n) : d_tag(DATATYPE), d_node(n) {}
+
+  EvalResult& operator=(const EvalResult& other);
+
+  ~EvalResult();
+
+  /** Is this a valid result? */
+  bool isValid() const { return d_tag != INVALID; }
+  /** Are this and other the same value? Both must be valid. */
+  bool operator==(const EvalResult& other) const;
+  /** Converts the result to a Node. If the result is not valid, this returns
+   * the null node. */
+  Node toNode() const;
+
+ private:
+  /** Destroys the value of the union member that is in use */
+  void clear();
+};
+
+/**
+ * The class that performs the actual evaluation of terms. Terms are evaluated
+ * bottom-up on values of type EvalResult, where the value of each subterm is
+ * memoized, so that no Node is constructed except for the final result.
+ *
+ * The evaluator handles the Boolean connectives, equality, the arithmetic
+ * operators on constant rationals, the operators on bit-vectors, the basic
+ * operators on strings, constructors, total selectors and testers of
+ * (non-co-)datatypes, and applications of uninterpreted functions whose
+ * value is a lambda. Terms that contain other operators, or leaves that are
+ * neither constants nor given a value, cannot be evaluated.
+ */
+class Evaluator
+{
+ public:
+  /**
+   * Evaluates node `n` under the substitution described by the variable names
+   * `args` and the corresponding values `vals`. The values must be constants,
+   * or lambdas for the function symbols in args. Returns the null node if n
+   * cannot be evaluated.
+   */
+  Node eval(TNode n,
+            const std::vector<Node>& args,
+            const std::vector<Node>& vals);
+
+ private:
+  /**
+   * Evaluates node `n` under the substitution described by the variable names
+   * `args` and the corresponding values `vals`. The internal version returns
+   * an EvalResult which has slightly less overhead for recursive calls.
+   */
+  EvalResult evalInternal(TNode n,
+                          const std::vector<Node>& args,
+                          const std::vector<Node>& vals);
+  /** Converts the constant n to an EvalResult */
+  static EvalResult toEvalResult(TNode n);
+};
+
+}  // namespace theory
+}  // namespace CVC4
+
+#endif /* __CVC4__THEORY__EVALUATOR_H */
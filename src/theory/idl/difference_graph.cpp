@@ -0,0 +1,258 @@
+/*********************                                                        */
+/*! \file difference_graph.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Dejan Jovanovic, Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief The constraint graph of the difference logic solver.
+ **
+ ** The constraint graph of the difference logic solver.
+ **/
+
+#include "theory/idl/difference_graph.h"
+
+#include <functional>
+#include <queue>
+
+#include "base/cvc4_assert.h"
+#include "base/output.h"
+#include "smt/smt_statistics_registry.h"
+
+namespace CVC4 {
+namespace theory {
+namespace idl {
+
+namespace {
+typedef std::pair<DeltaRational, DifferenceGraph::NodeId> QueueEntry;
+}  // namespace
+
+const DifferenceGraph::EdgeId DifferenceGraph::s_nullEdge;
+
+DifferenceGraph::Statistics::Statistics() :
+  d_edges("theory::idl::edges",0),
+  d_relaxed("theory::idl::relaxed",0),
+  d_cycles("theory::idl::negativeCycles",0)
+{
+  smtStatisticsRegistry()->registerStat(&d_edges);
+  smtStatisticsRegistry()->registerStat(&d_relaxed);
+  smtStatisticsRegistry()->registerStat(&d_cycles);
+}
+
+DifferenceGraph::Statistics::~Statistics(){
+  smtStatisticsRegistry()->unregisterStat(&d_edges);
+  smtStatisticsRegistry()->unregisterStat(&d_relaxed);
+  smtStatisticsRegistry()->unregisterStat(&d_cycles);
+}
+
+DifferenceGraph::DifferenceGraph(context::Context* c)
+    : d_numEdges(c, 0), d_currentStamp(0)
+{
+  // Node 0 stands for zero
+  getNode(TNode::null());
+}
+
+DifferenceGraph::NodeId DifferenceGraph::getNode(TNode x)
+{
+  std::unordered_map<Node, NodeId, NodeHashFunction>::const_iterator it =
+      d_nodes.find(x);
+  if (it != d_nodes.end())
+  {
+    return it->second;
+  }
+  NodeId n = d_terms.size();
+  d_nodes[x] = n;
+  d_terms.push_back(x);
+  d_out.push_back(std::vector<EdgeId>());
+  d_in.push_back(std::vector<EdgeId>());
+  d_potential.push_back(DeltaRational());
+  d_gamma.push_back(DeltaRational());
+  d_parent.push_back(s_nullEdge);
+  d_stamp.push_back(0);
+  return n;
+}
+
+void DifferenceGraph::backtrack()
+{
+  while (d_edges.size() > d_numEdges)
+  {
+    const Edge& e = d_edges.back();
+    Assert(d_out[e.d_from].back() == d_edges.size() - 1);
+    Assert(d_in[e.d_to].back() == d_edges.size() - 1);
+    d_out[e.d_from].pop_back();
+    d_in[e.d_to].pop_back();
+    d_edges.pop_back();
+  }
+}
+
+DeltaRational DifferenceGraph::getReducedWeight(EdgeId e) const
+{
+  const Edge& edge = d_edges[e];
+  return d_potential[edge.d_from] + edge.d_weight - d_potential[edge.d_to];
+}
+
+DifferenceGraph::EdgeId DifferenceGraph::addEdge(NodeId from,
+                                                 NodeId to,
+                                                 const DeltaRational& w,
+                                                 TNode reason,
+                                                 std::vector<TNode>& conflict)
+{
+  backtrack();
+  Debug("theory::idl::graph") << "addEdge(" << d_terms[from] << " -> "
+                              << d_terms[to] << ", " << w << ")" << std::endl;
+
+  DeltaRational gamma = d_potential[to] - (d_potential[from] + w);
+  if (gamma.sgn() > 0 && from == to)
+  {
+    ++(d_statistics.d_cycles);
+    conflict.push_back(reason);
+    return s_nullEdge;
+  }
+  if (gamma.sgn() > 0)
+  {
+    // The potential of to, and of the nodes reachable from it, must decrease.
+    // The nodes are settled in the order of the decrease, so each is settled
+    // at most once.
+    ++d_currentStamp;
+    std::vector<std::pair<NodeId, DeltaRational> > old;
+    std::priority_queue<QueueEntry> queue;
+    d_gamma[to] = gamma;
+    d_parent[to] = s_nullEdge;
+    d_stamp[to] = d_currentStamp;
+    queue.push(QueueEntry(gamma, to));
+    while (!queue.empty())
+    {
+      NodeId s = queue.top().second;
+      bool stale = d_gamma[s] != queue.top().first;
+      queue.pop();
+      if (stale)
+      {
+        continue;
+      }
+      old.push_back(std::make_pair(s, d_potential[s]));
+      d_potential[s] = d_potential[s] - d_gamma[s];
+      d_gamma[s] = DeltaRational();
+      for (EdgeId e : d_out[s])
+      {
+        NodeId t = d_edges[e].d_to;
+        DeltaRational g =
+            d_potential[t] - (d_potential[s] + d_edges[e].d_weight);
+        if (g.sgn() <= 0
+            || (d_stamp[t] == d_currentStamp && g <= d_gamma[t]))
+        {
+          continue;
+        }
+        d_gamma[t] = g;
+        d_parent[t] = e;
+        d_stamp[t] = d_currentStamp;
+        if (t == from)
+        {
+          // The potential of from must decrease as well, so the path from
+          // to to from closes a negative cycle with the new edge
+          ++(d_statistics.d_cycles);
+          conflict.push_back(reason);
+          for (NodeId n = from; d_parent[n] != s_nullEdge;
+               n = d_edges[d_parent[n]].d_from)
+          {
+            conflict.push_back(d_edges[d_parent[n]].d_reason);
+          }
+          for (const std::pair<NodeId, DeltaRational>& p : old)
+          {
+            d_potential[p.first] = p.second;
+          }
+          return s_nullEdge;
+        }
+        queue.push(QueueEntry(g, t));
+      }
+    }
+    d_statistics.d_relaxed += old.size();
+  }
+
+  ++(d_statistics.d_edges);
+  EdgeId id = d_edges.size();
+  Edge edge = {from, to, w, reason};
+  d_edges.push_back(edge);
+  d_out[from].push_back(id);
+  d_in[to].push_back(id);
+  d_numEdges = d_edges.size();
+  return id;
+}
+
+void DifferenceGraph::shortestPaths(NodeId src,
+                                    bool forward,
+                                    unsigned limit,
+                                    Distances& d)
+{
+  backtrack();
+  // Dijkstra's algorithm over the reduced weights, which are non-negative
+  d.clear();
+  d[src] = std::make_pair(DeltaRational(), s_nullEdge);
+  std::priority_queue<QueueEntry,
+                      std::vector<QueueEntry>,
+                      std::greater<QueueEntry> >
+      queue;
+  queue.push(QueueEntry(DeltaRational(), src));
+  unsigned settled = 0;
+  while (!queue.empty() && settled < limit)
+  {
+    NodeId n = queue.top().second;
+    bool stale = d[n].first != queue.top().first;
+    DeltaRational dist = queue.top().first;
+    queue.pop();
+    if (stale)
+    {
+      continue;
+    }
+    ++settled;
+    const std::vector<EdgeId>& edges = forward ? d_out[n] : d_in[n];
+    for (EdgeId e : edges)
+    {
+      NodeId m = forward ? d_edges[e].d_to : d_edges[e].d_from;
+      DeltaRational md = dist + getReducedWeight(e);
+      Distances::iterator it = d.find(m);
+      if (it == d.end() || md < it->second.first)
+      {
+        d[m] = std::make_pair(md, e);
+        queue.push(QueueEntry(md, m));
+      }
+    }
+  }
+  // Every node reached is the end of a path, although the paths to the nodes
+  // that were not settled may not be the shortest ones. Convert the reduced
+  // lengths into lengths.
+  for (Distances::iterator it = d.begin(); it != d.end(); ++it)
+  {
+    NodeId n = it->first;
+    if (forward)
+    {
+      it->second.first = it->second.first + d_potential[n] - d_potential[src];
+    }
+    else
+    {
+      it->second.first = it->second.first + d_potential[src] - d_potential[n];
+    }
+  }
+}
+
+void DifferenceGraph::explainPath(const Distances& d,
+                                  NodeId n,
+                                  bool forward,
+                                  std::vector<TNode>& reasons) const
+{
+  for (Distances::const_iterator it = d.find(n);
+       it->second.second != s_nullEdge;
+       it = d.find(n))
+  {
+    const Edge& e = d_edges[it->second.second];
+    reasons.push_back(e.d_reason);
+    n = forward ? e.d_from : e.d_to;
+  }
+}
+
+}  // namespace idl
+}  // namespace theory
+}  // namespace CVC4
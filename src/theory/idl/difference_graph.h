@@ -0,0 +1,188 @@
+/*********************                                                        */
+/*! \file difference_graph.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Dejan Jovanovic, Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief The constraint graph of the difference logic solver.
+ **
+ ** The constraint graph of the difference logic solver.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__THEORY__IDL__DIFFERENCE_GRAPH_H
+#define __CVC4__THEORY__IDL__DIFFERENCE_GRAPH_H
+
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "context/cdo.h"
+#include "context/context.h"
+#include "expr/node.h"
+#include "theory/arith/delta_rational.h"
+#include "util/statistics_registry.h"
+
+namespace CVC4 {
+namespace theory {
+namespace idl {
+
+/**
+ * The constraint graph of a set of difference constraints. Each term is a
+ * node, and node 0 stands for zero. The constraint (x - y <= w) is the edge
+ * y -> x of weight w. The weights are delta-rationals so that the strict
+ * constraints of real difference logic, (x - y < c), can be represented by
+ * the weight c - delta.
+ *
+ * The constraints are satisfiable iff the graph has no negative cycle. The
+ * graph keeps a potential p such that p(y) + w >= p(x) for each edge y -> x,
+ * so the potential of x minus the potential of node 0 is a value of x in a
+ * model. Edges are added following Cotton and Maler, "Fast and Flexible
+ * Difference Constraint Propagation for DPLL(T)", SAT 2006: only the nodes
+ * whose potential must decrease are visited, in the order of the decrease,
+ * and reaching the source of the new edge reveals a negative cycle.
+ *
+ * The edges are removed when the SAT context pops. Potentials are not
+ * restored, since a potential that satisfies a set of edges satisfies all of
+ * its subsets.
+ */
+class DifferenceGraph
+{
+ public:
+  typedef unsigned NodeId;
+  typedef size_t EdgeId;
+
+  /** The null edge. */
+  static const EdgeId s_nullEdge = std::numeric_limits<EdgeId>::max();
+
+  /**
+   * The shortest paths from (or to) a node, found by a bounded search. Maps
+   * each node that was reached to its distance and to the last edge of the
+   * shortest path.
+   */
+  typedef std::unordered_map<NodeId, std::pair<DeltaRational, EdgeId> >
+      Distances;
+
+  DifferenceGraph(context::Context* c);
+
+  /** Returns the node of the term x, or node 0 if x is null. */
+  NodeId getNode(TNode x);
+  /** Returns the number of nodes. */
+  size_t getNumNodes() const { return d_terms.size(); }
+  /** Returns the term of node n, null for node 0. */
+  TNode getTerm(NodeId n) const { return d_terms[n]; }
+
+  /**
+   * Adds the edge from -> to of weight w, whose reason is the literal reason.
+   * Returns the new edge, or the null edge if it closes a negative cycle, in
+   * which case the reasons of the edges of the cycle are added to conflict
+   * and the edge is not added.
+   */
+  EdgeId addEdge(NodeId from,
+                 NodeId to,
+                 const DeltaRational& w,
+                 TNode reason,
+                 std::vector<TNode>& conflict);
+
+  /** Returns the number of edges in the current context. */
+  size_t getNumEdges()
+  {
+    backtrack();
+    return d_edges.size();
+  }
+  /** Returns the source of e. */
+  NodeId getFrom(EdgeId e) const { return d_edges[e].d_from; }
+  /** Returns the target of e. */
+  NodeId getTo(EdgeId e) const { return d_edges[e].d_to; }
+  /** Returns the weight of e. */
+  const DeltaRational& getWeight(EdgeId e) const { return d_edges[e].d_weight; }
+  /** Returns the reason of e. */
+  TNode getReason(EdgeId e) const { return d_edges[e].d_reason; }
+
+  /**
+   * Computes the shortest paths from src over the current edges, or the
+   * shortest paths to src if forward is false. The search stops once limit
+   * nodes have been settled.
+   */
+  void shortestPaths(NodeId src, bool forward, unsigned limit, Distances& d);
+
+  /**
+   * Adds to reasons the reasons of the edges of the shortest path in d from
+   * (or to) n.
+   */
+  void explainPath(const Distances& d,
+                   NodeId n,
+                   bool forward,
+                   std::vector<TNode>& reasons) const;
+
+  /** Returns the value of node n: its potential minus the one of node 0. */
+  DeltaRational getValue(NodeId n) const
+  {
+    return d_potential[n] - d_potential[0];
+  }
+
+ private:
+  /** An edge, the constraint to - from <= weight. */
+  struct Edge
+  {
+    NodeId d_from;
+    NodeId d_to;
+    DeltaRational d_weight;
+    Node d_reason;
+  };
+
+  /** Removes the edges that were added in popped contexts. */
+  void backtrack();
+
+  /** Returns the reduced weight of e, non-negative in a consistent graph. */
+  DeltaRational getReducedWeight(EdgeId e) const;
+
+  /** The edges, the ones in popped contexts are removed lazily. */
+  std::vector<Edge> d_edges;
+  /** The number of edges in the current context. */
+  context::CDO<size_t> d_numEdges;
+
+  /** The outgoing and incoming edges of each node. */
+  std::vector<std::vector<EdgeId> > d_out;
+  std::vector<std::vector<EdgeId> > d_in;
+
+  /** The terms of the nodes and the nodes of the terms. */
+  std::vector<Node> d_terms;
+  std::unordered_map<Node, NodeId, NodeHashFunction> d_nodes;
+
+  /** The potential of each node. */
+  std::vector<DeltaRational> d_potential;
+
+  /**
+   * Scratch space of addEdge: the decrease of the potential of each node, the
+   * edge that caused it, and the stamp of the search that set them.
+   */
+  std::vector<DeltaRational> d_gamma;
+  std::vector<EdgeId> d_parent;
+  std::vector<unsigned> d_stamp;
+  unsigned d_currentStamp;
+
+  class Statistics {
+  public:
+    IntStat d_edges;
+    IntStat d_relaxed;
+    IntStat d_cycles;
+
+    Statistics();
+    ~Statistics();
+  };
+
+  Statistics d_statistics;
+}; /* class DifferenceGraph */
+
+}  // namespace idl
+}  // namespace theory
+}  // namespace CVC4
+
+#endif /* __CVC4__THEORY__IDL__DIFFERENCE_GRAPH_H */
@@ -17,6 +17,8 @@
 
 #include "theory/idl/idl_assertion.h"
 
+#include "base/cvc4_assert.h"
+
 using namespace CVC4;
 using namespace theory;
 using namespace idl;
@@ -42,11 +44,6 @@ IDLAssertion::IDLAssertion(TNode node) {
       d_c = -d_c;
       d_op = kind::LEQ;
     }
-    if (d_op == kind::LT) {
-      // Turn strict into non-strict x - y < c is the same as x - y <= c-1
-      d_c = d_c - 1;
-      d_op = kind::LEQ;
-    }
   }
   d_original = node;
 }
@@ -59,21 +56,6 @@ IDLAssertion::IDLAssertion(const IDLAssertion& other)
 , d_original(other.d_original)
 {}
 
-bool IDLAssertion::propagate(IDLModel& model) const {
-  Debug("theory::idl::model") << model << std::endl;
-  Assert(ok());
-  // Should be d_x - d_y <= d_c, or d_x - d_c <= d_y
-  Integer x_value = model.getValue(d_x);
-  Integer y_value = model.getValue(d_y);
-  if (x_value - y_value > d_c) {
-    model.setValue(d_y, x_value - d_c, IDLReason(d_x, d_original));
-    Debug("theory::idl::model") << model << std::endl;
-    return true;
-  } else {
-    return false;
-  }
-}
-
 void IDLAssertion::toStream(std::ostream& out) const {
   out << "IDL[" << d_x << " - " << d_y << " " << d_op << " " << d_c << "]";
 }
@@ -145,11 +127,7 @@ bool IDLAssertion::parse(TNode node, int c, bool negated) {
   case kind::CONST_RATIONAL: {
     // Constants
     Rational m = node.getConst<Rational>();
-    if (m.isIntegral()) {
-      d_c +=  m.getNumerator() * (-c);
-    } else {
-      ok = false;
-    }
+    d_c += m * (-c);
     break;
   }
   case kind::MULT: {
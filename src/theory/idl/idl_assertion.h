@@ -17,16 +17,19 @@
 
 #pragma once
 
-#include "theory/idl/idl_model.h"
+#include "expr/node.h"
+#include "util/rational.h"
 
 namespace CVC4 {
 namespace theory {
 namespace idl {
 
 /**
- * An internal representation of the IDL assertions. Each IDL assertions is
- * of the form (x - y op c) where op is one of (<=, =, !=). IDL assertion
- * can be constructed from an expression.
+ * An internal representation of the difference logic assertions. Each
+ * assertion is of the form (x - y op c) where op is one of (<, <=, =, !=) and
+ * one of x and y may be null, standing for zero. The constant c is rational
+ * so that real difference logic assertions can be represented as well.
+ * Assertions can be constructed from an expression.
  */
 class IDLAssertion {
 
@@ -37,7 +40,7 @@ class IDLAssertion {
   /** The relation */
   Kind d_op;
   /** The RHS constant */
-  Integer d_c;
+  Rational d_c;
 
   /** Original assertion we got this one from */
   TNode d_original;
@@ -57,20 +60,7 @@ public:
   TNode getX() const { return d_x; }
   TNode getY() const { return d_y; }
   Kind getOp() const { return d_op;}
-  Integer getC() const { return d_c; }
-
-  /**
-   * Propagate the constraint using the model. For example, if the constraint
-   * is of the form x - y <= -1, and the value of x in the model is 0, then
-   *
-   *   (x - y <= -1) and (x = 0) implies y >= x + 1 = 1
-   *
-   * If the value of y is less then 1, is is set to 1 and true is returned. If
-   * the value of y is 1 or more, than false is return.
-   *
-   * @return true if value of y was updated
-   */
-  bool propagate(IDLModel& model) const;
+  const Rational& getC() const { return d_c; }
 
   /** Is this constraint proper */
   bool ok() const {
@@ -9,19 +9,19 @@
  ** All rights reserved.  See the file COPYING in the top-level source
  ** directory for licensing information.\endverbatim
  **
- ** \brief [[ Add one-line brief description here ]]
+ ** \brief A solver for integer and real difference logic.
  **
- ** [[ Add lengthier description here ]]
- ** \todo document this file
+ ** A solver for integer and real difference logic.
  **/
 
 #include "theory/idl/theory_idl.h"
 
-#include <set>
-#include <queue>
+#include <algorithm>
 
 #include "options/idl_options.h"
+#include "smt/smt_statistics_registry.h"
 #include "theory/rewriter.h"
+#include "theory/theory_model.h"
 
 
 using namespace std;
@@ -30,12 +30,31 @@ namespace CVC4 {
 namespace theory {
 namespace idl {
 
+TheoryIdl::Statistics::Statistics() :
+  d_conflicts("theory::idl::conflicts",0),
+  d_propagations("theory::idl::propagations",0),
+  d_splits("theory::idl::disequalitySplits",0)
+{
+  smtStatisticsRegistry()->registerStat(&d_conflicts);
+  smtStatisticsRegistry()->registerStat(&d_propagations);
+  smtStatisticsRegistry()->registerStat(&d_splits);
+}
+
+TheoryIdl::Statistics::~Statistics(){
+  smtStatisticsRegistry()->unregisterStat(&d_conflicts);
+  smtStatisticsRegistry()->unregisterStat(&d_propagations);
+  smtStatisticsRegistry()->unregisterStat(&d_splits);
+}
+
 TheoryIdl::TheoryIdl(context::Context* c, context::UserContext* u,
                      OutputChannel& out, Valuation valuation,
                      const LogicInfo& logicInfo)
     : Theory(THEORY_ARITH, c, u, out, valuation, logicInfo)
-    , d_model(c)
-    , d_assertionsDB(c)
+    , d_graph(c)
+    , d_assigned(c)
+    , d_explanations(c)
+    , d_disequalities(c)
+    , d_splits(u)
 {}
 
 Node TheoryIdl::ppRewrite(TNode atom) {
@@ -51,6 +70,70 @@ Node TheoryIdl::ppRewrite(TNode atom) {
   }
 }
 
+DeltaRational TheoryIdl::getWeight(const IDLAssertion& assertion,
+                                   bool reversed) {
+  TNode x = assertion.getX();
+  TNode y = assertion.getY();
+  bool integer = (x.isNull() || x.getType().isInteger())
+                 && (y.isNull() || y.getType().isInteger());
+  Rational c = reversed ? -assertion.getC() : assertion.getC();
+  if (assertion.getOp() == kind::LT) {
+    // x - y < c is x - y <= ceiling(c) - 1 over the integers, and
+    // x - y <= c - delta over the reals
+    if (integer) {
+      return DeltaRational(Rational(c.ceiling() - 1));
+    }
+    return DeltaRational(c, Rational(-1));
+  }
+  return integer ? DeltaRational(Rational(c.floor())) : DeltaRational(c);
+}
+
+Node TheoryIdl::mkExplanation(std::vector<TNode>& reasons) {
+  std::sort(reasons.begin(), reasons.end());
+  reasons.erase(std::unique(reasons.begin(), reasons.end()), reasons.end());
+  if (reasons.size() == 1) {
+    return reasons[0];
+  }
+  return NodeManager::currentNM()->mkNode(kind::AND, reasons);
+}
+
+void TheoryIdl::preRegisterTerm(TNode node) {
+  switch (node.getKind()) {
+  case kind::EQUAL:
+  case kind::LT:
+  case kind::LEQ:
+  case kind::GT:
+  case kind::GEQ:
+    break;
+  default:
+    return;
+  }
+  if (!d_registered.insert(node).second) {
+    return;
+  }
+  // Both the atom and its negation can be propagated, except for the
+  // disequalities
+  Node literals[2] = { node, node.notNode() };
+  for (unsigned i = 0; i < 2; ++i) {
+    IDLAssertion assertion(literals[i]);
+    if (!assertion.ok()) {
+      return;
+    }
+    NodeId x = d_graph.getNode(assertion.getX());
+    NodeId y = d_graph.getNode(assertion.getY());
+    if (assertion.getOp() != kind::LT && assertion.getOp() != kind::LEQ) {
+      continue;
+    }
+    if (d_literalEdges.size() <= x) {
+      d_literalEdges.resize(x + 1);
+    }
+    LiteralEdge edge = { y, getWeight(assertion), literals[i] };
+    d_literalEdges[x].push_back(edge);
+    Debug("theory::idl") << "TheoryIdl::preRegisterTerm(): " << assertion
+                         << std::endl;
+  }
+}
+
 void TheoryIdl::check(Effort level) {
   if (done() && !fullEffort(level)) {
     return;
@@ -69,12 +152,14 @@ void TheoryIdl::check(Effort level) {
     Debug("theory::idl") << "TheoryIdl::check(): got " << idlAssertion << std::endl;
 
     if (idlAssertion.ok()) {
+      TNode literal = assertion.assertion;
+      d_assigned.insert(literal.getKind() == kind::NOT ? literal[0] : literal);
       if (idlAssertion.getOp() == kind::DISTINCT) {
-        // We don't handle dis-equalities
-        d_out->setIncomplete();
+        // Dis-equalities are split on at full effort
+        d_disequalities.push_back(literal);
       } else {
         // Process the convex assertions immediately
-        bool ok = processAssertion(idlAssertion);
+        bool ok = processAssertion(idlAssertion, literal);
         if (!ok) {
           // In conflict, we're done
           return;
@@ -86,67 +171,176 @@ void TheoryIdl::check(Effort level) {
     }
   }
 
+  if (fullEffort(level)) {
+    splitDisequalities();
+  }
 }
 
-bool TheoryIdl::processAssertion(const IDLAssertion& assertion) {
+bool TheoryIdl::processAssertion(const IDLAssertion& assertion, TNode literal) {
 
   Debug("theory::idl") << "TheoryIdl::processAssertion(" << assertion << ")" << std::endl;
 
-  // Add the constraint (x - y op c) to the list assertions of x
-  d_assertionsDB.add(assertion, assertion.getX());
-
-  // Update the model, if forced by the assertion
-  bool y_updated = assertion.propagate(d_model);
-
-  // If the value of y was updated, we might need to update further
-  if (y_updated) {
-
-    std::queue<TNode> queue; // Queue of variables to consider
-    std::set<TNode> inQueue; // Current elements of the queue
-
-    // Add the first updated variable to the queue
-    queue.push(assertion.getY());
-    inQueue.insert(assertion.getY());
-
-    while (!queue.empty()) {
-      // Pop a new variable x off the queue
-      TNode x = queue.front();
-      queue.pop();
-      inQueue.erase(x);
-
-      // Go through the constraint (x - y op c), and update values of y
-      IDLAssertionDB::iterator it(d_assertionsDB, x);
-      while (!it.done()) {
-        // Get the assertion and update y
-        IDLAssertion x_y_assertion = it.get();
-        y_updated = x_y_assertion.propagate(d_model);
-        // If updated add to the queue
-        if (y_updated) {
-          // If the variable that we updated is the same as the first
-          // variable that we updated, it's a cycle of updates => conflict
-          if (x_y_assertion.getY() == assertion.getX()) {
-            std::vector<TNode> reasons;
-            d_model.getReasonCycle(x_y_assertion.getY(), reasons);
-            // Construct the reason of the conflict
-            Node conflict = NodeManager::currentNM()->mkNode(kind::AND, reasons);
-            d_out->conflict(conflict);
-            return false;
-          } else {
-            // No cycle, just a model update, so we add to the queue
-            TNode y = x_y_assertion.getY();
-            if (inQueue.count(y) == 0) {
-              queue.push(y);
-              inQueue.insert(x_y_assertion.getY());
-            }
-          }
-        }
-        // Go to the next constraint
-        it.next();
+  // The constraint (x - y op c) is the edge y -> x
+  NodeId x = d_graph.getNode(assertion.getX());
+  NodeId y = d_graph.getNode(assertion.getY());
+  if (!addEdge(y, x, getWeight(assertion), literal)) {
+    return false;
+  }
+  if (assertion.getOp() == kind::EQUAL) {
+    // x - y = c also gives y - x <= -c
+    return addEdge(x, y, getWeight(assertion, true), literal);
+  }
+  return true;
+}
+
+bool TheoryIdl::addEdge(NodeId from, NodeId to, const DeltaRational& w,
+                        TNode literal) {
+  std::vector<TNode> reasons;
+  DifferenceGraph::EdgeId e = d_graph.addEdge(from, to, w, literal, reasons);
+  if (e == DifferenceGraph::s_nullEdge) {
+    ++(d_statistics.d_conflicts);
+    Node conflict = mkExplanation(reasons);
+    Debug("theory::idl") << "TheoryIdl::addEdge(): conflict " << conflict << std::endl;
+    d_out->conflict(conflict);
+    return false;
+  }
+  propagateEdge(e);
+  return true;
+}
+
+void TheoryIdl::propagateEdge(DifferenceGraph::EdgeId e) {
+  unsigned limit = options::idlPropagationLimit();
+  if (limit == 0) {
+    return;
+  }
+
+  // A literal with the edge s -> t of weight c is implied if there is a path
+  // s -> from -> to -> t of weight at most c. Only the paths through the new
+  // edge can imply new literals.
+  NodeId from = d_graph.getFrom(e);
+  NodeId to = d_graph.getTo(e);
+  DeltaRational w = d_graph.getWeight(e);
+  DifferenceGraph::Distances forward, backward;
+  d_graph.shortestPaths(to, true, limit, forward);
+  d_graph.shortestPaths(from, false, limit, backward);
+
+  for (const DifferenceGraph::Distances::value_type& t : forward) {
+    if (t.first >= d_literalEdges.size()) {
+      continue;
+    }
+    for (const LiteralEdge& edge : d_literalEdges[t.first]) {
+      TNode literal = edge.d_literal;
+      TNode atom = literal.getKind() == kind::NOT ? literal[0] : literal;
+      if (d_assigned.contains(atom)) {
+        continue;
+      }
+      DifferenceGraph::Distances::const_iterator s = backward.find(edge.d_from);
+      if (s == backward.end()
+          || s->second.first + w + t.second.first > edge.d_weight) {
+        continue;
+      }
+      std::vector<TNode> reasons;
+      d_graph.explainPath(backward, edge.d_from, false, reasons);
+      reasons.push_back(d_graph.getReason(e));
+      d_graph.explainPath(forward, t.first, true, reasons);
+      d_assigned.insert(atom);
+      d_explanations.insert(literal, mkExplanation(reasons));
+      ++(d_statistics.d_propagations);
+      Debug("theory::idl") << "TheoryIdl::propagateEdge(): " << literal << std::endl;
+      if (!d_out->propagate(literal)) {
+        return;
       }
     }
   }
+}
+
+Node TheoryIdl::explain(TNode literal) {
+  context::CDHashMap<Node, Node, NodeHashFunction>::const_iterator it =
+      d_explanations.find(literal);
+  Assert(it != d_explanations.end());
+  return (*it).second;
+}
+
+void TheoryIdl::splitDisequalities() {
+  NodeManager* nm = NodeManager::currentNM();
+  for (context::CDList<Node>::const_iterator it = d_disequalities.begin();
+       it != d_disequalities.end(); ++it) {
+    TNode eq = (*it)[0];
+    if (d_splits.contains(eq)) {
+      continue;
+    }
+    IDLAssertion assertion(eq);
+    DeltaRational diff = d_graph.getValue(d_graph.getNode(assertion.getX()))
+                         - d_graph.getValue(d_graph.getNode(assertion.getY()));
+    if (diff != DeltaRational(assertion.getC())) {
+      continue;
+    }
+    // The model violates x != y, so x < y or x > y
+    Node lt = Rewriter::rewrite(nm->mkNode(kind::LT, eq[0], eq[1]));
+    Node gt = Rewriter::rewrite(nm->mkNode(kind::GT, eq[0], eq[1]));
+    Node lemma = nm->mkNode(kind::OR, eq, lt, gt);
+    Debug("theory::idl") << "TheoryIdl::splitDisequalities(): " << lemma << std::endl;
+    ++(d_statistics.d_splits);
+    d_splits.insert(eq);
+    d_out->lemma(lemma);
+  }
+}
+
+namespace {
+
+/**
+ * Tightens delta so that a + b*delta <= 0, where (a, b) is the delta-rational
+ * diff, which is at most zero.
+ */
+void boundDelta(const DeltaRational& diff, Rational& delta) {
+  if (diff.infinitesimalSgn() > 0) {
+    Rational bound = -diff.getNoninfinitesimalPart() / diff.getInfinitesimalPart();
+    if (bound < delta) {
+      delta = bound;
+    }
+  }
+}
 
-  // Everything fine, no conflict
+}/* anonymous namespace */
+
+bool TheoryIdl::collectModelInfo(TheoryModel* m) {
+  // Find a value of delta that satisfies all edges, and that does not make
+  // the two sides of a disequality equal
+  Rational delta(1);
+  for (size_t e = 0, N = d_graph.getNumEdges(); e < N; ++e) {
+    boundDelta(d_graph.getValue(d_graph.getTo(e))
+                   - d_graph.getValue(d_graph.getFrom(e))
+                   - d_graph.getWeight(e),
+               delta);
+  }
+  Rational minRoot = delta;
+  for (context::CDList<Node>::const_iterator it = d_disequalities.begin();
+       it != d_disequalities.end(); ++it) {
+    IDLAssertion assertion((*it)[0]);
+    DeltaRational diff = d_graph.getValue(d_graph.getNode(assertion.getX()))
+                         - d_graph.getValue(d_graph.getNode(assertion.getY()))
+                         - DeltaRational(assertion.getC());
+    if (diff.infinitesimalIsZero()) {
+      continue;
+    }
+    Rational root = -diff.getNoninfinitesimalPart() / diff.getInfinitesimalPart();
+    if (root.sgn() > 0 && root < minRoot) {
+      minRoot = root;
+    }
+  }
+  if (minRoot <= delta) {
+    delta = minRoot / 2;
+  }
+
+  NodeManager* nm = NodeManager::currentNM();
+  for (NodeId n = 1; n < d_graph.getNumNodes(); ++n) {
+    DeltaRational value = d_graph.getValue(n);
+    Rational r = value.getNoninfinitesimalPart()
+                 + value.getInfinitesimalPart() * delta;
+    if (!m->assertEquality(d_graph.getTerm(n), nm->mkConst(r), true)) {
+      return false;
+    }
+  }
   return true;
 }
 
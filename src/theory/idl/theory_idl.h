@@ -9,37 +9,105 @@
  ** All rights reserved.  See the file COPYING in the top-level source
  ** directory for licensing information.\endverbatim
  **
- ** \brief [[ Add one-line brief description here ]]
+ ** \brief A solver for integer and real difference logic.
  **
- ** [[ Add lengthier description here ]]
- ** \todo document this file
+ ** A solver for integer and real difference logic, the alternative
+ ** implementation of the theory of arithmetic selected by --use-theory=idl.
  **/
 
 #pragma once
 
 #include "cvc4_private.h"
 
+#include <unordered_set>
+#include <vector>
+
+#include "context/cdhashmap.h"
+#include "context/cdhashset.h"
+#include "context/cdlist.h"
 #include "theory/theory.h"
-#include "theory/idl/idl_model.h"
-#include "theory/idl/idl_assertion_db.h"
+#include "theory/idl/difference_graph.h"
+#include "theory/idl/idl_assertion.h"
 
 namespace CVC4 {
 namespace theory {
 namespace idl {
 
 /**
- * Handles integer difference logic (IDL) constraints.
+ * Handles integer and real difference logic constraints, (x - y op c).
+ *
+ * The asserted constraints are the edges of a DifferenceGraph, which detects
+ * the conflicts incrementally. After each new edge, the registered atoms that
+ * it implies are propagated: an atom (x - y <= c) holds if the graph has a
+ * path from y to x of weight at most c, and the path is its explanation. The
+ * search for these paths is bounded by --idl-prop-limit. Disequalities that
+ * are violated by the model at full effort are split on.
  */
 class TheoryIdl : public Theory {
 
-  /** The current model */
-  IDLModel d_model;
+  typedef DifferenceGraph::NodeId NodeId;
+
+  /** The graph of the asserted constraints */
+  DifferenceGraph d_graph;
+
+  /** The edge of a literal, that holds if to - from <= weight */
+  struct LiteralEdge {
+    NodeId d_from;
+    DeltaRational d_weight;
+    Node d_literal;
+  };
+
+  /** For each node, the edges of the registered literals into it */
+  std::vector<std::vector<LiteralEdge> > d_literalEdges;
+
+  /** The atoms that have been registered */
+  std::unordered_set<Node, NodeHashFunction> d_registered;
+
+  /** The atoms that have been asserted or propagated */
+  context::CDHashSet<Node, NodeHashFunction> d_assigned;
+
+  /** The explanations of the propagated literals */
+  context::CDHashMap<Node, Node, NodeHashFunction> d_explanations;
+
+  /** The asserted disequalities */
+  context::CDList<Node> d_disequalities;
+
+  /** The equalities whose disequality has been split on */
+  context::CDHashSet<Node, NodeHashFunction> d_splits;
+
+  /**
+   * Returns the weight of the edge of the constraint (x - y op c), or of the
+   * constraint (y - x op -c) if reversed is true.
+   */
+  static DeltaRational getWeight(const IDLAssertion& assertion,
+                                 bool reversed = false);
 
-  /** The asserted constraints, organized by variable */
-  IDLAssertionDB d_assertionsDB;
+  /** Returns the conjunction of reasons */
+  static Node mkExplanation(std::vector<TNode>& reasons);
 
   /** Process a new assertion, returns false if in conflict */
-  bool processAssertion(const IDLAssertion& assertion);
+  bool processAssertion(const IDLAssertion& assertion, TNode literal);
+
+  /** Adds an edge to the graph, returns false if in conflict */
+  bool addEdge(NodeId from, NodeId to, const DeltaRational& w, TNode literal);
+
+  /** Propagates the registered literals implied by the new edge e */
+  void propagateEdge(DifferenceGraph::EdgeId e);
+
+  /** Splits on the disequalities violated by the model */
+  void splitDisequalities();
+
+  class Statistics {
+  public:
+    IntStat d_conflicts;
+    IntStat d_propagations;
+    IntStat d_splits;
+
+    Statistics();
+    ~Statistics();
+  };
+
+  Statistics d_statistics;
 
 public:
 
@@ -50,9 +118,18 @@ public:
   /** Pre-processing of input atoms */
   Node ppRewrite(TNode atom) override;
 
+  /** Registers the atoms for propagation */
+  void preRegisterTerm(TNode node) override;
+
   /** Check the assertions for satisfiability */
   void check(Effort effort) override;
 
+  /** Explain a propagated literal */
+  Node explain(TNode literal) override;
+
+  /** Assigns the values of the graph to the terms */
+  bool collectModelInfo(TheoryModel* m) override;
+
   /** Identity string */
   std::string identify() const override { return "THEORY_IDL"; }
 
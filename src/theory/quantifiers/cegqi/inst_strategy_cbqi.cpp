@@ -21,6 +21,7 @@
 #include "theory/quantifiers/first_order_model.h"
 #include "theory/quantifiers/instantiate.h"
 #include "theory/quantifiers/quant_epr.h"
+#include "theory/quantifiers/quant_profile.h"
 #include "theory/quantifiers/quantifiers_attributes.h"
 #include "theory/quantifiers/quantifiers_rewriter.h"
 #include "theory/quantifiers/term_database.h"
@@ -249,6 +250,7 @@ void InstStrategyCbqi::check(Theory::Effort e, QEffort quant_e)
       Trace("cbqi-engine") << "---Cbqi Engine Round, effort = " << e << "---" << std::endl;
     }
     unsigned lastWaiting = d_quantEngine->getNumLemmasWaiting();
+    QuantProfile* profile = d_quantEngine->getQuantProfile();
     for( int ee=0; ee<=1; ee++ ){
       //for( unsigned i=0; i<d_quantEngine->getModel()->getNumAssertedQuantifiers(); i++ ){
       //  Node q = d_quantEngine->getModel()->getAssertedQuantifier( i );
@@ -257,7 +259,10 @@ void InstStrategyCbqi::check(Theory::Effort e, QEffort quant_e)
         Node q = it->first;
         Trace("cbqi") << "CBQI : Process quantifier " << q[0] << " at effort " << ee << std::endl;
         if( d_nested_qe.find( q )==d_nested_qe.end() ){
-          process( q, e, ee );
+          {
+            QuantProfile::Timer timer(profile, q, "Cbqi");
+            process(q, e, ee);
+          }
           if( d_quantEngine->inConflict() ){
             break;
           }
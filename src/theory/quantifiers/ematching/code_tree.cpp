@@ -0,0 +1,255 @@
+/*********************                                                        */
+/*! \file code_tree.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Andrew Reynolds
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Implementation of code tree for matching simple triggers
+ **/
+
+#include "theory/quantifiers/ematching/code_tree.h"
+
+#include <algorithm>
+
+#include "options/quantifiers_options.h"
+#include "smt/smt_statistics_registry.h"
+#include "theory/quantifiers/ematching/inst_match_generator.h"
+#include "theory/quantifiers/term_database.h"
+#include "theory/quantifiers_engine.h"
+
+namespace CVC4 {
+namespace theory {
+namespace inst {
+
+CodeTree::CodeTreeNode* CodeTree::CodeTreeNode::getChild(const Instruction& i)
+{
+  switch (i.d_kind)
+  {
+    case Instruction::BIND:
+      if (d_bind == nullptr)
+      {
+        d_bind.reset(new CodeTreeNode);
+      }
+      return d_bind.get();
+    case Instruction::COMPARE: return &d_compare[i.d_index];
+    default: return &d_check[i.d_ground];
+  }
+}
+
+CodeTree::CodeTree(QuantifiersEngine* qe)
+    : d_qe(qe), d_numMatches(0), d_workers(), d_statistics()
+{
+}
+
+bool CodeTree::reset(Theory::Effort e)
+{
+  d_stamp.clear();
+  d_reps.clear();
+  return true;
+}
+
+void CodeTree::addGenerator(Node op,
+                            const std::vector<Instruction>& code,
+                            InstMatchGeneratorSimple* g)
+{
+  CodeTreeNode* ctn = &d_roots[op];
+  for (const Instruction& i : code)
+  {
+    ctn = ctn->getChild(i);
+  }
+  Trace("code-tree") << "Add generator for " << op << " at depth "
+                     << code.size() << ", shared with "
+                     << ctn->d_generators.size() << " others" << std::endl;
+  ctn->d_generators.push_back(g);
+  d_leaf[g] = ctn;
+  // if op was already matched in this round, it must be matched again for g
+  d_stamp.erase(op);
+}
+
+void CodeTree::removeGenerator(InstMatchGeneratorSimple* g)
+{
+  std::map<InstMatchGeneratorSimple*, CodeTreeNode*>::iterator it =
+      d_leaf.find(g);
+  if (it == d_leaf.end())
+  {
+    return;
+  }
+  std::vector<InstMatchGeneratorSimple*>& gens = it->second->d_generators;
+  gens.erase(std::remove(gens.begin(), gens.end(), g), gens.end());
+  d_leaf.erase(it);
+}
+
+unsigned CodeTree::getStamp(Node op) const
+{
+  std::unordered_map<Node, unsigned, NodeHashFunction>::const_iterator it =
+      d_stamp.find(op);
+  return it == d_stamp.end() ? 0 : it->second;
+}
+
+bool CodeTree::prepareMatch(Node op, CodeTreeNode* root, MatchJob& job)
+{
+  d_numMatches++;
+  d_stamp[op] = d_numMatches;
+  job.d_root = root;
+  job.d_stamp = d_numMatches;
+  job.d_tat = d_qe->getTermDatabase()->getTermArgTrie(op);
+  if (job.d_tat == nullptr)
+  {
+    return false;
+  }
+  computeRepresentatives(root);
+  return true;
+}
+
+void CodeTree::computeRepresentatives(CodeTreeNode* ctn)
+{
+  for (std::pair<const Node, CodeTreeNode>& c : ctn->d_check)
+  {
+    if (d_reps.find(c.first) == d_reps.end())
+    {
+      d_reps[c.first] = d_qe->getEqualityQuery()->getRepresentative(c.first);
+    }
+    computeRepresentatives(&c.second);
+  }
+  for (std::pair<const unsigned, CodeTreeNode>& c : ctn->d_compare)
+  {
+    computeRepresentatives(&c.second);
+  }
+  if (ctn->d_bind != nullptr)
+  {
+    computeRepresentatives(ctn->d_bind.get());
+  }
+}
+
+void CodeTree::match(Node op)
+{
+  if (d_stamp.find(op) != d_stamp.end())
+  {
+    return;
+  }
+  std::map<Node, CodeTreeNode>::iterator it = d_roots.find(op);
+  if (it == d_roots.end())
+  {
+    return;
+  }
+  MatchJob job;
+  if (prepareMatch(op, &it->second, job))
+  {
+    Trace("code-tree") << "Match code tree for " << op << std::endl;
+    std::vector<TNode> reps;
+    match(job.d_root, job.d_tat, reps, job.d_stamp);
+  }
+}
+
+void CodeTree::matchAll()
+{
+  std::vector<MatchJob> jobs;
+  for (std::pair<const Node, CodeTreeNode>& r : d_roots)
+  {
+    if (d_stamp.find(r.first) == d_stamp.end())
+    {
+      MatchJob job;
+      if (prepareMatch(r.first, &r.second, job))
+      {
+        jobs.push_back(job);
+      }
+    }
+  }
+  size_t threads = std::min<size_t>(options::quantMatchThreads(), jobs.size());
+  Trace("code-tree") << "Match " << jobs.size() << " code trees with "
+                     << threads << " threads" << std::endl;
+  std::atomic<size_t> next(0);
+  if (threads <= 1)
+  {
+    runJobs(&jobs, &next);
+    return;
+  }
+  ++(d_statistics.d_parallelRounds);
+  if (d_workers == nullptr)
+  {
+    d_workers.reset(new WorkerPool(options::quantMatchThreads() - 1));
+  }
+  d_workers->run(threads, [&](size_t t) { runJobs(&jobs, &next); });
+}
+
+void CodeTree::runJobs(const std::vector<MatchJob>* jobs,
+                       std::atomic<size_t>* next)
+{
+  std::vector<TNode> reps;
+  for (size_t i = (*next)++; i < jobs->size(); i = (*next)++)
+  {
+    const MatchJob& job = (*jobs)[i];
+    match(job.d_root, job.d_tat, reps, job.d_stamp);
+  }
+}
+
+void CodeTree::match(CodeTreeNode* ctn,
+                     quantifiers::TermArgTrie* tat,
+                     std::vector<TNode>& reps,
+                     unsigned stamp)
+{
+  if (!ctn->d_generators.empty())
+  {
+    Assert(tat->hasNodeData());
+    TNode t = tat->getNodeData();
+    for (InstMatchGeneratorSimple* g : ctn->d_generators)
+    {
+      g->addCodeTreeMatch(t, stamp);
+    }
+  }
+  std::map<TNode, quantifiers::TermArgTrie>::iterator itt;
+  for (std::pair<const Node, CodeTreeNode>& c : ctn->d_check)
+  {
+    std::map<Node, Node>::const_iterator itr = d_reps.find(c.first);
+    Assert(itr != d_reps.end());
+    TNode r = itr->second;
+    itt = tat->d_data.find(r);
+    if (itt != tat->d_data.end())
+    {
+      reps.push_back(r);
+      match(&c.second, &itt->second, reps, stamp);
+      reps.pop_back();
+    }
+  }
+  for (std::pair<const unsigned, CodeTreeNode>& c : ctn->d_compare)
+  {
+    Assert(c.first < reps.size());
+    TNode r = reps[c.first];
+    itt = tat->d_data.find(r);
+    if (itt != tat->d_data.end())
+    {
+      reps.push_back(r);
+      match(&c.second, &itt->second, reps, stamp);
+      reps.pop_back();
+    }
+  }
+  if (ctn->d_bind != nullptr)
+  {
+    for (itt = tat->d_data.begin(); itt != tat->d_data.end(); ++itt)
+    {
+      reps.push_back(itt->first);
+      match(ctn->d_bind.get(), &itt->second, reps, stamp);
+      reps.pop_back();
+    }
+  }
+}
+
+CodeTree::Statistics::Statistics()
+    : d_parallelRounds("CodeTree::Parallel_Rounds", 0)
+{
+  smtStatisticsRegistry()->registerStat(&d_parallelRounds);
+}
+
+CodeTree::Statistics::~Statistics()
+{
+  smtStatisticsRegistry()->unregisterStat(&d_parallelRounds);
+}
+
+}/* CVC4::theory::inst namespace */
+}/* CVC4::theory namespace */
+}/* CVC4 namespace */
@@ -0,0 +1,195 @@
+/*********************                                                        */
+/*! \file code_tree.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Andrew Reynolds
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief code tree for matching simple triggers
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__THEORY__QUANTIFIERS__CODE_TREE_H
+#define __CVC4__THEORY__QUANTIFIERS__CODE_TREE_H
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "expr/node.h"
+#include "theory/quantifiers/quant_util.h"
+#include "util/statistics_registry.h"
+#include "util/worker_pool.h"
+
+namespace CVC4 {
+namespace theory {
+
+class QuantifiersEngine;
+
+namespace quantifiers {
+class TermArgTrie;
+}
+
+namespace inst {
+
+class InstMatchGeneratorSimple;
+
+/** Code tree
+ *
+ * This class matches the simple triggers (see Trigger::isSimpleTrigger) of
+ * all quantified formulas at once. Each simple trigger f( t_1, ..., t_n ) is
+ * compiled into a sequence of n instructions, one per argument:
+ * (1) bind, if t_i is a variable that does not occur in t_1 ... t_{i-1},
+ * (2) compare with j, if t_i is the variable t_j for some j < i,
+ * (3) check g, if t_i is the ground term g.
+ * The sequences of the triggers with the same match operator are stored in a
+ * tree, so that triggers with a common prefix, such as f( x, y ) and
+ * f( z, z ) from two different quantified formulas, share its instructions.
+ * The triggers are matched in one traversal of the term index of f (see
+ * TermDb::getTermArgTrie) per instantiation round, that executes the
+ * instructions of the tree in parallel with the term index.
+ *
+ * The matches of each trigger are buffered in its generator, which adds the
+ * instantiations when its trigger is processed, as if it had matched the
+ * trigger on its own.
+ *
+ * Since matching only reads the term indices and the representatives of the
+ * ground terms of the tree, which are computed beforehand, the trees of
+ * different match operators can be matched concurrently (see matchAll).
+ */
+class CodeTree : public QuantifiersUtil
+{
+ public:
+  CodeTree(QuantifiersEngine* qe);
+  ~CodeTree() {}
+  /** reset, starts a new round */
+  bool reset(Theory::Effort e) override;
+  /** register quantified formula */
+  void registerQuantifier(Node q) override {}
+  /** identify */
+  std::string identify() const override { return "CodeTree"; }
+
+  /** An instruction of the code tree. */
+  struct Instruction
+  {
+    enum Kind
+    {
+      BIND,
+      COMPARE,
+      CHECK
+    };
+    Kind d_kind;
+    /** the index to compare with, for COMPARE */
+    unsigned d_index;
+    /** the ground term, for CHECK */
+    Node d_ground;
+  };
+
+  /**
+   * Add the generator g of a simple trigger with match operator op, compiled
+   * into the instructions code. Since triggers are generated lazily, g may be
+   * added after op was matched in this round, in which case op is matched
+   * again on its next call to match.
+   */
+  void addGenerator(Node op,
+                    const std::vector<Instruction>& code,
+                    InstMatchGeneratorSimple* g);
+  /** Remove the generator g. */
+  void removeGenerator(InstMatchGeneratorSimple* g);
+  /**
+   * Match the triggers with match operator op against the ground terms of op,
+   * unless this was done in this round. The matches are given to the
+   * generators via InstMatchGeneratorSimple::addCodeTreeMatch.
+   */
+  void match(Node op);
+  /**
+   * Match the triggers of all match operators that were not matched in this
+   * round, using up to --quant-match-threads threads.
+   */
+  void matchAll();
+  /**
+   * Get the stamp of the last match of op in this round, or 0 if op was not
+   * matched in this round.
+   */
+  unsigned getStamp(Node op) const;
+
+ private:
+  /** A node of the code tree. */
+  class CodeTreeNode
+  {
+   public:
+    /** the child for BIND */
+    std::unique_ptr<CodeTreeNode> d_bind;
+    /** the children for COMPARE, indexed by the index to compare with */
+    std::map<unsigned, CodeTreeNode> d_compare;
+    /** the children for CHECK, indexed by the ground term */
+    std::map<Node, CodeTreeNode> d_check;
+    /** the generators whose code ends at this node */
+    std::vector<InstMatchGeneratorSimple*> d_generators;
+    /** get the child for instruction i, creating it if necessary */
+    CodeTreeNode* getChild(const Instruction& i);
+  };
+  /** A code tree to be matched against a term index. */
+  struct MatchJob
+  {
+    CodeTreeNode* d_root;
+    quantifiers::TermArgTrie* d_tat;
+    unsigned d_stamp;
+  };
+  /**
+   * Prepare matching the code tree of op: computes its term index and the
+   * representatives of its ground terms. Returns false if op has no terms.
+   */
+  bool prepareMatch(Node op, CodeTreeNode* root, MatchJob& job);
+  /** Compute the representatives of the ground terms in ctn. */
+  void computeRepresentatives(CodeTreeNode* ctn);
+  /**
+   * Execute the instructions of ctn on the term index tat, where reps are the
+   * representatives of the previous arguments. This only reads the state of
+   * this class and of the term database, and may run concurrently for
+   * different match operators.
+   */
+  void match(CodeTreeNode* ctn,
+             quantifiers::TermArgTrie* tat,
+             std::vector<TNode>& reps,
+             unsigned stamp);
+  /** Run the jobs (*jobs)[i] for the indices i taken from next. */
+  void runJobs(const std::vector<MatchJob>* jobs, std::atomic<size_t>* next);
+  /** pointer to the quantifiers engine */
+  QuantifiersEngine* d_qe;
+  /** the root of the code tree of each match operator */
+  std::map<Node, CodeTreeNode> d_roots;
+  /** the leaf of each generator */
+  std::map<InstMatchGeneratorSimple*, CodeTreeNode*> d_leaf;
+  /** the number of matches of code trees so far */
+  unsigned d_numMatches;
+  /** the stamps of the match operators that were matched in this round */
+  std::unordered_map<Node, unsigned, NodeHashFunction> d_stamp;
+  /** the representatives of the ground terms of the code trees */
+  std::map<Node, Node> d_reps;
+  /** the worker threads of matchAll, started on first use */
+  std::unique_ptr<WorkerPool> d_workers;
+  /** statistics */
+  class Statistics
+  {
+   public:
+    /** number of rounds that matched code trees with several threads */
+    IntStat d_parallelRounds;
+    Statistics();
+    ~Statistics();
+  };
+  Statistics d_statistics;
+};
+
+}/* CVC4::theory::inst namespace */
+}/* CVC4::theory namespace */
+}/* CVC4 namespace */
+
+#endif /* __CVC4__THEORY__QUANTIFIERS__CODE_TREE_H */
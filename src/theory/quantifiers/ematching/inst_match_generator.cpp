@@ -18,6 +18,7 @@
 #include "options/datatypes_options.h"
 #include "options/quantifiers_options.h"
 #include "theory/quantifiers/ematching/candidate_generator.h"
+#include "theory/quantifiers/ematching/code_tree.h"
 #include "theory/quantifiers/ematching/trigger.h"
 #include "theory/quantifiers/instantiate.h"
 #include "theory/quantifiers/term_database.h"
@@ -970,7 +971,10 @@ void InstMatchGeneratorMulti::processNewInstantiations(QuantifiersEngine* qe,
 InstMatchGeneratorSimple::InstMatchGeneratorSimple(Node q,
                                                    Node pat,
                                                    QuantifiersEngine* qe)
-    : d_quant(q), d_match_pattern(pat)
+    : d_quant(q),
+      d_match_pattern(pat),
+      d_code_tree(nullptr),
+      d_code_tree_stamp(0)
 {
   if( d_match_pattern.getKind()==NOT ){
     d_match_pattern = d_match_pattern[0];
@@ -995,6 +999,59 @@ InstMatchGeneratorSimple::InstMatchGeneratorSimple(Node q,
     d_match_pattern_arg_types.push_back( d_match_pattern[i].getType() );
   }
   d_op = qe->getTermDatabase()->getMatchOperator( d_match_pattern );
+  if (options::eMatchingCodeTree() && d_eqc.isNull())
+  {
+    // compile the trigger into the shared code tree of d_op
+    std::vector<CodeTree::Instruction> code;
+    std::map<int, unsigned> var_index;
+    for (unsigned i = 0, nchild = d_match_pattern.getNumChildren(); i < nchild;
+         i++)
+    {
+      CodeTree::Instruction ins;
+      ins.d_index = 0;
+      std::map<unsigned, int>::iterator itv = d_var_num.find(i);
+      if (itv != d_var_num.end() && itv->second >= 0)
+      {
+        std::map<int, unsigned>::iterator itvi = var_index.find(itv->second);
+        if (itvi == var_index.end())
+        {
+          ins.d_kind = CodeTree::Instruction::BIND;
+          var_index[itv->second] = i;
+        }
+        else
+        {
+          ins.d_kind = CodeTree::Instruction::COMPARE;
+          ins.d_index = itvi->second;
+        }
+      }
+      else
+      {
+        ins.d_kind = CodeTree::Instruction::CHECK;
+        ins.d_ground = d_match_pattern[i];
+      }
+      code.push_back(ins);
+    }
+    d_code_tree = qe->getCodeTree();
+    d_code_tree->addGenerator(d_op, code, this);
+  }
+}
+
+InstMatchGeneratorSimple::~InstMatchGeneratorSimple()
+{
+  if (d_code_tree != nullptr)
+  {
+    d_code_tree->removeGenerator(this);
+  }
+}
+
+void InstMatchGeneratorSimple::addCodeTreeMatch(TNode t, unsigned stamp)
+{
+  if (stamp != d_code_tree_stamp)
+  {
+    d_code_tree_matches.clear();
+    d_code_tree_stamp = stamp;
+  }
+  d_code_tree_matches.push_back(t);
 }
 
 void InstMatchGeneratorSimple::resetInstantiationRound( QuantifiersEngine* qe ) {
@@ -1005,6 +1062,24 @@ int InstMatchGeneratorSimple::addInstantiations(Node q,
                                                 Trigger* tparent)
 {
   int addedLemmas = 0;
+  if (d_code_tree != nullptr)
+  {
+    // the matches are computed once per round for all triggers of d_op
+    d_code_tree->match(d_op);
+    if (d_code_tree_stamp == d_code_tree->getStamp(d_op))
+    {
+      InstMatch m(q);
+      for (TNode t : d_code_tree_matches)
+      {
+        addInstantiation(m, qe, addedLemmas, t);
+        if (qe->inConflict())
+        {
+          break;
+        }
+      }
+    }
+    return addedLemmas;
+  }
   quantifiers::TermArgTrie* tat;
   if( d_eqc.isNull() ){
     tat = qe->getTermDatabase()->getTermArgTrie( d_op );
@@ -1047,26 +1122,7 @@ void InstMatchGeneratorSimple::addInstantiations(InstMatch& m,
   if (argIndex == d_match_pattern.getNumChildren())
   {
     Assert( !tat->d_data.empty() );
-    TNode t = tat->getNodeData();
-    Debug("simple-trigger") << "Actual term is " << t << std::endl;
-    //convert to actual used terms
-    for (std::map<unsigned, int>::iterator it = d_var_num.begin();
-         it != d_var_num.end();
-         ++it)
-    {
-      if( it->second>=0 ){
-        Assert(it->first < t.getNumChildren());
-        Debug("simple-trigger") << "...set " << it->second << " " << t[it->first] << std::endl;
-        m.setValue( it->second, t[it->first] );
-      }
-    }
-    // we do not need the trigger parent for simple triggers (no post-processing
-    // required)
-    if (qe->getInstantiate()->addInstantiation(d_quant, m))
-    {
-      addedLemmas++;
-      Debug("simple-trigger") << "-> Produced instantiation " << m << std::endl;
-    }
+    addInstantiation(m, qe, addedLemmas, tat->getNodeData());
   }else{
     if( d_match_pattern[argIndex].getKind()==INST_CONSTANT ){
       int v = d_var_num[argIndex];
@@ -1097,6 +1153,32 @@ void InstMatchGeneratorSimple::addInstantiations(InstMatch& m,
   }
 }
 
+void InstMatchGeneratorSimple::addInstantiation(InstMatch& m,
+                                                QuantifiersEngine* qe,
+                                                int& addedLemmas,
+                                                TNode t)
+{
+  Debug("simple-trigger") << "Actual term is " << t << std::endl;
+  //convert to actual used terms
+  for (std::map<unsigned, int>::iterator it = d_var_num.begin();
+       it != d_var_num.end();
+       ++it)
+  {
+    if( it->second>=0 ){
+      Assert(it->first < t.getNumChildren());
+      Debug("simple-trigger") << "...set " << it->second << " " << t[it->first] << std::endl;
+      m.setValue( it->second, t[it->first] );
+    }
+  }
+  // we do not need the trigger parent for simple triggers (no post-processing
+  // required)
+  if (qe->getInstantiate()->addInstantiation(d_quant, m))
+  {
+    addedLemmas++;
+    Debug("simple-trigger") << "-> Produced instantiation " << m << std::endl;
+  }
+}
+
 int InstMatchGeneratorSimple::getActiveScore( QuantifiersEngine * qe ) {
   Node f = qe->getTermDatabase()->getMatchOperator( d_match_pattern );
   unsigned ngt = qe->getTermDatabase()->getNumGroundTerms( f );
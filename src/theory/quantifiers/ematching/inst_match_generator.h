@@ -30,6 +30,7 @@ namespace quantifiers{
 
 namespace inst {
 
+class CodeTree;
 class Trigger;
 
 /** IMGenerator class
@@ -607,11 +608,16 @@ class InstMatchGeneratorMulti : public IMGenerator {
 * In contrast to other instantiation generators, it does not call
 * IMGenerator::sendInstantiation and for performance reasons instead calls
 * qe->getInstantiate()->addInstantiation(...) directly.
+*
+* If --e-matching-code-tree is enabled, triggers without polarity are matched
+* by the CodeTree of the quantifiers engine, which shares the traversal of the
+* term index of d_op with the triggers of other quantified formulas.
 */
 class InstMatchGeneratorSimple : public IMGenerator {
  public:
   /** constructors */
   InstMatchGeneratorSimple(Node q, Node pat, QuantifiersEngine* qe);
+  ~InstMatchGeneratorSimple();
 
   /** Reset instantiation round. */
   void resetInstantiationRound(QuantifiersEngine* qe) override;
@@ -621,6 +627,12 @@ class InstMatchGeneratorSimple : public IMGenerator {
                         Trigger* tparent) override;
   /** Get active score. */
   int getActiveScore(QuantifiersEngine* qe) override;
+  /**
+   * Add the match t of this trigger, found by the code tree in its match with
+   * the given stamp (see CodeTree::getStamp). This may be called concurrently
+   * for generators with different match operators.
+   */
+  void addCodeTreeMatch(TNode t, unsigned stamp);
 
  private:
   /** quantified formula for the trigger term */
@@ -663,6 +675,24 @@ class InstMatchGeneratorSimple : public IMGenerator {
                          int& addedLemmas,
                          unsigned argIndex,
                          quantifiers::TermArgTrie* tat);
+  /**
+   * Add the instantiation for the match t of d_match_pattern, where m and
+   * addedLemmas are as above.
+   */
+  void addInstantiation(InstMatch& m,
+                        QuantifiersEngine* qe,
+                        int& addedLemmas,
+                        TNode t);
+  /** the code tree matching this trigger, or null if none */
+  CodeTree* d_code_tree;
+  /**
+   * The matches found by the code tree in its match with stamp
+   * d_code_tree_stamp. These are terms of the term database, which are kept
+   * alive for the duration of the round.
+   */
+  std::vector<TNode> d_code_tree_matches;
+  /** the stamp of d_code_tree_matches */
+  unsigned d_code_tree_stamp;
 };/* class InstMatchGeneratorSimple */
 }
 }
@@ -15,7 +15,9 @@
 #include "theory/quantifiers/ematching/instantiation_engine.h"
 
 #include "options/quantifiers_options.h"
+#include "theory/quantifiers/ematching/code_tree.h"
 #include "theory/quantifiers/first_order_model.h"
+#include "theory/quantifiers/quant_profile.h"
 #include "theory/quantifiers/ematching/inst_strategy_e_matching.h"
 #include "theory/quantifiers/term_database.h"
 #include "theory/quantifiers/term_util.h"
@@ -60,6 +62,13 @@ void InstantiationEngine::presolve() {
 
 void InstantiationEngine::doInstantiationRound( Theory::Effort effort ){
   unsigned lastWaiting = d_quantEngine->getNumLemmasWaiting();
+  if (options::eMatchingCodeTree() && options::quantMatchThreads() > 1)
+  {
+    // compute the matches of the simple triggers of all quantified formulas
+    // concurrently, they are added as instantiations serially below
+    d_quantEngine->getCodeTree()->matchAll();
+  }
+  QuantProfile* profile = d_quantEngine->getQuantProfile();
   //iterate over an internal effort level e
   int e = 0;
   int eLimit = effort==Theory::EFFORT_LAST_CALL ? 10 : 2;
@@ -80,7 +89,17 @@ void InstantiationEngine::doInstantiationRound( Theory::Effort effort ){
         for( unsigned j=0; j<d_instStrategies.size(); j++ ){
           InstStrategy* is = d_instStrategies[j];
           Trace("inst-engine-debug") << "Do " << is->identify() << " " << e_use << std::endl;
-          int quantStatus = is->process( q, effort, e_use );
+          int quantStatus;
+          if (profile != nullptr)
+          {
+            std::string module = is->identify();
+            QuantProfile::Timer timer(profile, q, module.c_str());
+            quantStatus = is->process(q, effort, e_use);
+          }
+          else
+          {
+            quantStatus = is->process(q, effort, e_use);
+          }
           Trace("inst-engine-debug") << " -> status is " << quantStatus << ", conflict=" << d_quantEngine->inConflict() << std::endl;
           if( d_quantEngine->inConflict() ){
             return;
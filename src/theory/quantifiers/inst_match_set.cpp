@@ -0,0 +1,304 @@
+/*********************                                                        */
+/*! \file inst_match_set.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Andrew Reynolds
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Implementation of hashed sets of instantiations
+ **/
+
+#include "theory/quantifiers/inst_match_set.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "theory/quantifiers/instantiate.h"
+#include "theory/quantifiers/quant_util.h"
+#include "theory/quantifiers_engine.h"
+#include "theory/uf/equality_engine.h"
+
+namespace CVC4 {
+namespace theory {
+namespace inst {
+
+const size_t InstMatchSet::s_probe = std::numeric_limits<size_t>::max();
+const size_t InstMatchSet::s_none = std::numeric_limits<size_t>::max() - 1;
+
+size_t InstMatchSet::EntryHashFunction::operator()(size_t i) const
+{
+  const Node* e = d_set->getEntry(i);
+  size_t h = 0;
+  for (size_t k = 0; k < d_set->d_arity; k++)
+  {
+    h = h * 31 + e[k].getId();
+  }
+  return h;
+}
+
+bool InstMatchSet::EntryEqual::operator()(size_t i, size_t j) const
+{
+  return std::equal(d_set->getEntry(i),
+                    d_set->getEntry(i) + d_set->d_arity,
+                    d_set->getEntry(j));
+}
+
+InstMatchSet::InstMatchSet()
+    : d_arity(0),
+      d_probe(nullptr),
+      d_index(0, EntryHashFunction(this), EntryEqual(this))
+{
+}
+
+const Node* InstMatchSet::getEntry(size_t i) const
+{
+  if (i == s_probe)
+  {
+    return d_probe;
+  }
+  return &d_terms[i * d_arity];
+}
+
+size_t InstMatchSet::find(const std::vector<Node>& m)
+{
+  if (d_lemmas.empty())
+  {
+    d_arity = m.size();
+    return s_none;
+  }
+  Assert(m.size() == d_arity);
+  d_probe = m.data();
+  std::unordered_set<size_t, EntryHashFunction, EntryEqual>::iterator it =
+      d_index.find(s_probe);
+  d_probe = nullptr;
+  return it == d_index.end() ? s_none : *it;
+}
+
+bool InstMatchSet::existsModEq(QuantifiersEngine* qe,
+                               const std::vector<Node>& m) const
+{
+  eq::EqualityEngine* ee = qe->getEqualityQuery()->getEngine();
+  for (size_t i = 0, nentries = getNumEntries(); i < nentries; i++)
+  {
+    if (!isActive(i))
+    {
+      continue;
+    }
+    const Node* e = getEntry(i);
+    bool success = true;
+    for (size_t k = 0; k < d_arity && success; k++)
+    {
+      success = e[k] == m[k]
+                || (!m[k].isNull() && !e[k].isNull() && ee->hasTerm(m[k])
+                    && ee->hasTerm(e[k]) && ee->areEqual(m[k], e[k]));
+    }
+    if (success)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool InstMatchSet::existsInstMatch(QuantifiersEngine* qe,
+                                   Node q,
+                                   std::vector<Node>& m,
+                                   bool modEq)
+{
+  Assert(m.size() == q[0].getNumChildren());
+  backtrack();
+  size_t i = find(m);
+  if (i != s_none && isActive(i))
+  {
+    return true;
+  }
+  return modEq && existsModEq(qe, m);
+}
+
+bool InstMatchSet::addInstMatch(QuantifiersEngine* qe,
+                                Node q,
+                                std::vector<Node>& m,
+                                bool modEq)
+{
+  Assert(m.size() == q[0].getNumChildren());
+  backtrack();
+  size_t i = find(m);
+  if (i != s_none && isActive(i))
+  {
+    return false;
+  }
+  if (modEq && existsModEq(qe, m))
+  {
+    return false;
+  }
+  if (i != s_none)
+  {
+    // the entry was removed, reactivate it
+    d_lemmas[i] = Node::null();
+    setActive(i, true);
+    return true;
+  }
+  i = d_lemmas.size();
+  d_terms.insert(d_terms.end(), m.begin(), m.end());
+  d_lemmas.push_back(Node::null());
+  d_active.push_back(true);
+  d_index.insert(i);
+  notifyAddEntry(i);
+  return true;
+}
+
+bool InstMatchSet::removeInstMatch(Node q, std::vector<Node>& m)
+{
+  Assert(m.size() == q[0].getNumChildren());
+  backtrack();
+  size_t i = find(m);
+  if (i == s_none || !isActive(i))
+  {
+    return false;
+  }
+  setActive(i, false);
+  return true;
+}
+
+bool InstMatchSet::recordInstLemma(Node q, std::vector<Node>& m, Node lem)
+{
+  Assert(m.size() == q[0].getNumChildren());
+  backtrack();
+  size_t i = find(m);
+  if (i == s_none || !isActive(i))
+  {
+    return false;
+  }
+  d_lemmas[i] = lem;
+  return true;
+}
+
+void InstMatchSet::shrink(size_t n)
+{
+  while (d_lemmas.size() > n)
+  {
+    // erase from the index while the terms of the entry are still stored
+    d_index.erase(d_lemmas.size() - 1);
+    d_terms.resize(d_terms.size() - d_arity);
+    d_lemmas.pop_back();
+    d_active.pop_back();
+  }
+}
+
+void InstMatchSet::getInstantiations(std::vector<Node>& insts,
+                                     Node q,
+                                     QuantifiersEngine* qe,
+                                     bool useActive,
+                                     std::vector<Node>& active)
+{
+  backtrack();
+  for (size_t i = 0, nentries = getNumEntries(); i < nentries; i++)
+  {
+    if (!isActive(i))
+    {
+      continue;
+    }
+    Node lem = d_lemmas[i];
+    if (useActive)
+    {
+      if (!lem.isNull()
+          && std::find(active.begin(), active.end(), lem) != active.end())
+      {
+        insts.push_back(lem);
+      }
+    }
+    else if (!lem.isNull())
+    {
+      insts.push_back(lem);
+    }
+    else
+    {
+      std::vector<Node> terms(getEntry(i), getEntry(i) + d_arity);
+      insts.push_back(qe->getInstantiate()->getInstantiation(q, terms, true));
+    }
+  }
+}
+
+void InstMatchSet::getExplanationForInstLemmas(
+    Node q,
+    const std::vector<Node>& lems,
+    std::map<Node, Node>& quant,
+    std::map<Node, std::vector<Node> >& tvec)
+{
+  backtrack();
+  for (size_t i = 0, nentries = getNumEntries(); i < nentries; i++)
+  {
+    Node lem = d_lemmas[i];
+    if (isActive(i) && !lem.isNull()
+        && std::find(lems.begin(), lems.end(), lem) != lems.end())
+    {
+      quant[lem] = q;
+      tvec[lem].assign(getEntry(i), getEntry(i) + d_arity);
+    }
+  }
+}
+
+void InstMatchSet::print(std::ostream& out,
+                         Node q,
+                         bool& firstTime,
+                         bool useActive,
+                         std::vector<Node>& active)
+{
+  backtrack();
+  for (size_t i = 0, nentries = getNumEntries(); i < nentries; i++)
+  {
+    if (!isActive(i))
+    {
+      continue;
+    }
+    if (useActive
+        && (d_lemmas[i].isNull()
+            || std::find(active.begin(), active.end(), d_lemmas[i])
+                   == active.end()))
+    {
+      continue;
+    }
+    if (firstTime)
+    {
+      out << "(instantiation " << q << std::endl;
+      firstTime = false;
+    }
+    const Node* e = getEntry(i);
+    out << "  ( ";
+    for (size_t k = 0; k < d_arity; k++)
+    {
+      if (k > 0)
+      {
+        out << ", ";
+      }
+      out << e[k];
+    }
+    out << " )" << std::endl;
+  }
+}
+
+CDInstMatchSet::CDInstMatchSet(context::Context* c)
+    : d_numEntries(c, 0), d_status(c)
+{
+}
+
+bool CDInstMatchSet::isActive(size_t i) const
+{
+  context::CDHashMap<size_t, bool, std::hash<size_t> >::const_iterator it =
+      d_status.find(i);
+  return it == d_status.end() || (*it).second;
+}
+
+void CDInstMatchSet::setActive(size_t i, bool val) { d_status[i] = val; }
+
+void CDInstMatchSet::notifyAddEntry(size_t i) { d_numEntries = i + 1; }
+
+void CDInstMatchSet::backtrack() { shrink(d_numEntries.get()); }
+
+} /* CVC4::theory::inst namespace */
+} /* CVC4::theory namespace */
+} /* CVC4 namespace */
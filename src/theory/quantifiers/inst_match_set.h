@@ -0,0 +1,208 @@
+/*********************                                                        */
+/*! \file inst_match_set.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Andrew Reynolds
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief hashed sets of instantiations
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__THEORY__QUANTIFIERS__INST_MATCH_SET_H
+#define __CVC4__THEORY__QUANTIFIERS__INST_MATCH_SET_H
+
+#include <iosfwd>
+#include <map>
+#include <unordered_set>
+#include <vector>
+
+#include "context/cdhashmap.h"
+#include "context/cdo.h"
+#include "expr/node.h"
+
+namespace CVC4 {
+namespace theory {
+
+class QuantifiersEngine;
+
+namespace inst {
+
+/** set of instantiations
+ *
+ * This class stores the instantiations of a quantified formula q, that is,
+ * vectors of terms of length n, the number of bound variables of q. In
+ * contrast to InstMatchTrie, which stores each entry as a path of n nodes of
+ * std::maps, the entries are stored consecutively in a single vector of
+ * terms and indexed by a hash set of entry indices. This uses a fraction of
+ * the memory of the trie when there are many instantiations.
+ *
+ * Entries are never erased from the storage of this class. Instead, removed
+ * entries are marked as inactive, and are reactivated if they are added again.
+ */
+class InstMatchSet
+{
+ public:
+  InstMatchSet();
+  virtual ~InstMatchSet() {}
+  /** exists inst match
+   *
+   * Returns true if the entry m for quantified formula q exists in this set.
+   * If modEq is true, we check for duplication modulo the current equalities
+   * in the active equality engine of qe. Notice that this requires a linear
+   * scan of the entries of this set.
+   */
+  bool existsInstMatch(QuantifiersEngine* qe,
+                       Node q,
+                       std::vector<Node>& m,
+                       bool modEq = false);
+  /** add inst match
+   *
+   * This method adds m to this set, and returns true if and only if m did not
+   * already occur in this set, where modEq is as above.
+   */
+  bool addInstMatch(QuantifiersEngine* qe,
+                    Node q,
+                    std::vector<Node>& m,
+                    bool modEq = false);
+  /** remove inst match
+   *
+   * This removes m from this set. It returns true if and only if this entry
+   * existed in this set.
+   */
+  bool removeInstMatch(Node q, std::vector<Node>& m);
+  /** record instantiation lemma
+   *
+   * This records that the instantiation lemma lem corresponds to the entry m.
+   */
+  bool recordInstLemma(Node q, std::vector<Node>& m, Node lem);
+  /** get instantiations
+   *
+   * This gets the set of instantiation lemmas for the entries of this set.
+   * If useActive is true, we only add instantiations that were recorded via
+   * calls to recordInstLemma and that occur in active.
+   */
+  void getInstantiations(std::vector<Node>& insts,
+                         Node q,
+                         QuantifiersEngine* qe,
+                         bool useActive,
+                         std::vector<Node>& active);
+  /** get explanation for inst lemmas
+   *
+   * For each instantiation lemma lem in lems recorded in this set via calls to
+   * recordInstLemma, we map lem to q in map quant, and lem to its
+   * corresponding vector of terms in tvec.
+   */
+  void getExplanationForInstLemmas(Node q,
+                                   const std::vector<Node>& lems,
+                                   std::map<Node, Node>& quant,
+                                   std::map<Node, std::vector<Node> >& tvec);
+  /** print this class */
+  void print(std::ostream& out,
+             Node q,
+             bool& firstTime,
+             bool useActive,
+             std::vector<Node>& active);
+
+ protected:
+  /** Is entry i active? */
+  virtual bool isActive(size_t i) const { return d_active[i]; }
+  /** Set whether entry i is active. */
+  virtual void setActive(size_t i, bool val) { d_active[i] = val; }
+  /** Notify that the entry i has been added to the storage of this class. */
+  virtual void notifyAddEntry(size_t i) {}
+  /** Update the storage of this class before it is accessed. */
+  virtual void backtrack() {}
+  /** Get the number of entries of this set. */
+  size_t getNumEntries() const { return d_lemmas.size(); }
+  /** Remove the entries i such that i >= n from the storage of this class. */
+  void shrink(size_t n);
+
+ private:
+  /** Hash function for the entry indices of d_index */
+  class EntryHashFunction
+  {
+   public:
+    EntryHashFunction(const InstMatchSet* s) : d_set(s) {}
+    size_t operator()(size_t i) const;
+
+   private:
+    const InstMatchSet* d_set;
+  };
+  /** Equality of the entry indices of d_index */
+  class EntryEqual
+  {
+   public:
+    EntryEqual(const InstMatchSet* s) : d_set(s) {}
+    bool operator()(size_t i, size_t j) const;
+
+   private:
+    const InstMatchSet* d_set;
+  };
+  /** Index standing for the entry d_probe in d_index */
+  static const size_t s_probe;
+  /** Index returned by find if there is no such entry */
+  static const size_t s_none;
+  /** Get the terms of the entry i, or d_probe if i is s_probe */
+  const Node* getEntry(size_t i) const;
+  /** Get the index of the entry m, or s_none if it does not exist */
+  size_t find(const std::vector<Node>& m);
+  /**
+   * Does an active entry exist that is equal to m modulo the current
+   * equalities in the equality engine of qe?
+   */
+  bool existsModEq(QuantifiersEngine* qe, const std::vector<Node>& m) const;
+  /** The number of terms of each entry */
+  size_t d_arity;
+  /** The terms of the entries, entry i is stored at i * d_arity */
+  std::vector<Node> d_terms;
+  /** The instantiation lemma of each entry, if recorded */
+  std::vector<Node> d_lemmas;
+  /** Whether each entry is active */
+  std::vector<bool> d_active;
+  /** The entry being looked up in d_index */
+  const Node* d_probe;
+  /** The indices of the entries in the storage of this class */
+  std::unordered_set<size_t, EntryHashFunction, EntryEqual> d_index;
+  // the hash functions of d_index refer to this object
+  InstMatchSet(const InstMatchSet&) = delete;
+  InstMatchSet& operator=(const InstMatchSet&) = delete;
+};
+
+/** set of instantiations
+ *
+ * This is a context-dependent version of the above class. Entries added in
+ * a context are removed from the storage of this class when that context is
+ * popped, and the status of an entry is restored when a context in which it
+ * was removed is popped.
+ */
+class CDInstMatchSet : public InstMatchSet
+{
+ public:
+  CDInstMatchSet(context::Context* c);
+  ~CDInstMatchSet() {}
+
+ protected:
+  bool isActive(size_t i) const override;
+  void setActive(size_t i, bool val) override;
+  void notifyAddEntry(size_t i) override;
+  /** Removes the entries of the popped contexts from the storage */
+  void backtrack() override;
+
+ private:
+  /** The number of entries that are valid in the current context */
+  context::CDO<size_t> d_numEntries;
+  /** The entries whose status was changed after they were added */
+  context::CDHashMap<size_t, bool, std::hash<size_t> > d_status;
+};
+
+} /* CVC4::theory::inst namespace */
+} /* CVC4::theory namespace */
+} /* CVC4 namespace */
+
+#endif /* __CVC4__THEORY__QUANTIFIERS__INST_MATCH_SET_H */
@@ -17,6 +17,7 @@
 #include "options/quantifiers_options.h"
 #include "smt/smt_statistics_registry.h"
 #include "theory/quantifiers/first_order_model.h"
+#include "theory/quantifiers/quant_profile.h"
 #include "theory/quantifiers/cegqi/inst_strategy_cbqi.h"
 #include "theory/quantifiers/quantifiers_attributes.h"
 #include "theory/quantifiers/quantifiers_rewriter.h"
@@ -36,17 +37,17 @@ Instantiate::Instantiate(QuantifiersEngine* qe, context::UserContext* u)
       d_term_db(nullptr),
       d_term_util(nullptr),
       d_total_inst_count_debug(0),
-      d_c_inst_match_trie_dom(u)
+      d_c_inst_match_set_dom(u)
 {
 }
 
 Instantiate::~Instantiate()
 {
-  for (std::pair<const Node, inst::CDInstMatchTrie*>& t : d_c_inst_match_trie)
+  for (std::pair<const Node, inst::CDInstMatchSet*>& t : d_c_inst_match_set)
   {
     delete t.second;
   }
-  d_c_inst_match_trie.clear();
+  d_c_inst_match_set.clear();
 }
 
 bool Instantiate::reset(Theory::Effort e)
@@ -108,6 +109,11 @@ bool Instantiate::addInstantiation(
   Assert(terms.size() == q[0].getNumChildren());
   Assert(d_term_db != nullptr);
   Assert(d_term_util != nullptr);
+  QuantProfile* profile = d_qe->getQuantProfile();
+  if (profile != nullptr)
+  {
+    profile->notifyMatch(q);
+  }
   Trace("inst-add-debug") << "For quantified formula " << q
                           << ", add instantiation: " << std::endl;
   for (unsigned i = 0, size = terms.size(); i < size; i++)
@@ -136,6 +142,10 @@ bool Instantiate::addInstantiation(
       Trace("inst-add-debug")
           << " --> Failed to make term vector, due to term/type restrictions."
           << std::endl;
+      if (profile != nullptr)
+      {
+        profile->notifyRejected(q);
+      }
       return false;
     }
 #ifdef CVC4_ASSERTIONS
@@ -191,12 +201,8 @@ bool Instantiate::addInstantiation(
   // included automatically with recordInstantiationInternal, hence we prefer
   // two checks instead of three. In experiments, it is 1% slower or so to call
   // existsInstantiation here.
-  // Alternatively, we could return an (index, trie node) in the call to
-  // existsInstantiation here, where this would return the node in the trie
-  // where we determined that there is definitely no duplication, and then
-  // continue from that point in recordInstantiation below. However, for
-  // simplicity, we do not pursue this option (as it would likely only
-  // lead to very small gains).
+  // Since instantiations are stored in hash sets (see inst_match_set.h), the
+  // duplication check is a single lookup.
 
   // check for positive entailment
   if (options::instNoEntail())
@@ -212,6 +218,10 @@ bool Instantiate::addInstantiation(
     {
       Trace("inst-add-debug") << " --> Currently entailed." << std::endl;
       ++(d_statistics.d_inst_duplicate_ent);
+      if (profile != nullptr)
+      {
+        profile->notifyRejected(q);
+      }
       return false;
     }
   }
@@ -223,6 +233,10 @@ bool Instantiate::addInstantiation(
     {
       if (!d_term_db->isTermEligibleForInstantiation(t, q, true))
       {
+        if (profile != nullptr)
+        {
+          profile->notifyRejected(q);
+        }
         return false;
       }
     }
@@ -234,6 +248,10 @@ bool Instantiate::addInstantiation(
   {
     Trace("inst-add-debug") << " --> Already exists (no record)." << std::endl;
     ++(d_statistics.d_inst_duplicate_eq);
+    if (profile != nullptr)
+    {
+      profile->notifyDuplicate(q);
+    }
     return false;
   }
 
@@ -264,6 +282,10 @@ bool Instantiate::addInstantiation(
     {
       Trace("inst-add-debug") << " --> True in model." << std::endl;
       ++(d_statistics.d_inst_duplicate_model_true);
+      if (profile != nullptr)
+      {
+        profile->notifyRejected(q);
+      }
       return false;
     }
   }
@@ -276,6 +298,10 @@ bool Instantiate::addInstantiation(
   {
     Trace("inst-add-debug") << " --> Lemma already exists." << std::endl;
     ++(d_statistics.d_inst_duplicate);
+    if (profile != nullptr)
+    {
+      profile->notifyDuplicate(q);
+    }
     return false;
   }
 
@@ -323,6 +349,7 @@ bool Instantiate::addInstantiation(
     }
   }
   QuantifiersModule::QEffort elevel = d_qe->getCurrentQEffort();
+  bool notifyConflict = false;
   if (elevel > QuantifiersModule::QEFFORT_CONFLICT
       && elevel < QuantifiersModule::QEFFORT_NONE
       && !d_inst_notify.empty())
@@ -335,20 +362,32 @@ bool Instantiate::addInstantiation(
         Trace("inst-add-debug") << "...we are in conflict." << std::endl;
         d_qe->setConflict();
         Assert(d_qe->getNumLemmasWaiting() > 0);
+        notifyConflict = true;
         break;
       }
     }
   }
+  if (profile != nullptr)
+  {
+    profile->notifyInstantiation(q);
+    // conflicting instances of conflict-based instantiation are counted by
+    // QuantConflictFind, which knows whether they are conflicting or only
+    // propagating
+    if (notifyConflict)
+    {
+      profile->notifyConflict(q);
+    }
+  }
   if (options::trackInstLemmas())
   {
     bool recorded;
     if (options::incrementalSolving())
     {
-      recorded = d_c_inst_match_trie[q]->recordInstLemma(q, terms, lem);
+      recorded = d_c_inst_match_set[q]->recordInstLemma(q, terms, lem);
     }
     else
     {
-      recorded = d_inst_match_trie[q].recordInstLemma(q, terms, lem);
+      recorded = d_inst_match_set[q].recordInstLemma(q, terms, lem);
     }
     Trace("inst-add-debug") << "...was recorded : " << recorded << std::endl;
     Assert(recorded);
@@ -384,19 +423,18 @@ bool Instantiate::existsInstantiation(Node q,
 {
   if (options::incrementalSolving())
   {
-    std::map<Node, inst::CDInstMatchTrie*>::iterator it =
-        d_c_inst_match_trie.find(q);
-    if (it != d_c_inst_match_trie.end())
+    std::map<Node, inst::CDInstMatchSet*>::iterator it =
+        d_c_inst_match_set.find(q);
+    if (it != d_c_inst_match_set.end())
     {
-      return it->second->existsInstMatch(
-          d_qe, q, terms, d_qe->getUserContext(), modEq);
+      return it->second->existsInstMatch(d_qe, q, terms, modEq);
     }
   }
   else
   {
-    std::map<Node, inst::InstMatchTrie>::iterator it =
-        d_inst_match_trie.find(q);
-    if (it != d_inst_match_trie.end())
+    std::map<Node, inst::InstMatchSet>::iterator it =
+        d_inst_match_set.find(q);
+    if (it != d_inst_match_set.end())
     {
       return it->second.existsInstMatch(d_qe, q, terms, modEq);
     }
@@ -453,40 +491,40 @@ bool Instantiate::recordInstantiationInternal(Node q,
   if (options::incrementalSolving())
   {
     Trace("inst-add-debug")
-        << "Adding into context-dependent inst trie, modEq = " << modEq
+        << "Adding into context-dependent inst set, modEq = " << modEq
         << std::endl;
-    inst::CDInstMatchTrie* imt;
-    std::map<Node, inst::CDInstMatchTrie*>::iterator it =
-        d_c_inst_match_trie.find(q);
-    if (it != d_c_inst_match_trie.end())
+    inst::CDInstMatchSet* imt;
+    std::map<Node, inst::CDInstMatchSet*>::iterator it =
+        d_c_inst_match_set.find(q);
+    if (it != d_c_inst_match_set.end())
     {
       imt = it->second;
     }
     else
     {
-      imt = new inst::CDInstMatchTrie(d_qe->getUserContext());
-      d_c_inst_match_trie[q] = imt;
+      imt = new inst::CDInstMatchSet(d_qe->getUserContext());
+      d_c_inst_match_set[q] = imt;
     }
-    d_c_inst_match_trie_dom.insert(q);
-    return imt->addInstMatch(d_qe, q, terms, d_qe->getUserContext(), modEq);
+    d_c_inst_match_set_dom.insert(q);
+    return imt->addInstMatch(d_qe, q, terms, modEq);
   }
-  Trace("inst-add-debug") << "Adding into inst trie" << std::endl;
-  return d_inst_match_trie[q].addInstMatch(d_qe, q, terms, modEq);
+  Trace("inst-add-debug") << "Adding into inst set" << std::endl;
+  return d_inst_match_set[q].addInstMatch(d_qe, q, terms, modEq);
 }
 
 bool Instantiate::removeInstantiationInternal(Node q, std::vector<Node>& terms)
 {
   if (options::incrementalSolving())
   {
-    std::map<Node, inst::CDInstMatchTrie*>::iterator it =
-        d_c_inst_match_trie.find(q);
-    if (it != d_c_inst_match_trie.end())
+    std::map<Node, inst::CDInstMatchSet*>::iterator it =
+        d_c_inst_match_set.find(q);
+    if (it != d_c_inst_match_set.end())
     {
       return it->second->removeInstMatch(q, terms);
     }
     return false;
   }
-  return d_inst_match_trie[q].removeInstMatch(q, terms);
+  return d_inst_match_set[q].removeInstMatch(q, terms);
 }
 
 Node Instantiate::getTermForType(TypeNode tn)
@@ -509,7 +547,7 @@ bool Instantiate::printInstantiations(std::ostream& out)
   bool printed = false;
   if (options::incrementalSolving())
   {
-    for (std::pair<const Node, inst::CDInstMatchTrie*>& t : d_c_inst_match_trie)
+    for (std::pair<const Node, inst::CDInstMatchSet*>& t : d_c_inst_match_set)
     {
       bool firstTime = true;
       t.second->print(out, t.first, firstTime, useUnsatCore, active_lemmas);
@@ -522,7 +560,7 @@ bool Instantiate::printInstantiations(std::ostream& out)
   }
   else
   {
-    for (std::pair<const Node, inst::InstMatchTrie>& t : d_inst_match_trie)
+    for (std::pair<const Node, inst::InstMatchSet>& t : d_inst_match_set)
     {
       bool firstTime = true;
       t.second.print(out, t.first, firstTime, useUnsatCore, active_lemmas);
@@ -541,8 +579,8 @@ void Instantiate::getInstantiatedQuantifiedFormulas(std::vector<Node>& qs)
   if (options::incrementalSolving())
   {
     for (context::CDHashSet<Node, NodeHashFunction>::const_iterator it =
-             d_c_inst_match_trie_dom.begin();
-         it != d_c_inst_match_trie_dom.end();
+             d_c_inst_match_set_dom.begin();
+         it != d_c_inst_match_set_dom.end();
          ++it)
     {
       qs.push_back(*it);
@@ -550,7 +588,7 @@ void Instantiate::getInstantiatedQuantifiedFormulas(std::vector<Node>& qs)
   }
   else
   {
-    for (std::pair<const Node, inst::InstMatchTrie>& t : d_inst_match_trie)
+    for (std::pair<const Node, inst::InstMatchSet>& t : d_inst_match_set)
     {
       qs.push_back(t.first);
     }
@@ -625,14 +663,14 @@ void Instantiate::getInstantiationTermVectors(
 {
   if (options::incrementalSolving())
   {
-    for (std::pair<const Node, inst::CDInstMatchTrie*>& t : d_c_inst_match_trie)
+    for (std::pair<const Node, inst::CDInstMatchSet*>& t : d_c_inst_match_set)
     {
       getInstantiationTermVectors(t.first, insts[t.first]);
     }
   }
   else
   {
-    for (std::pair<const Node, inst::InstMatchTrie>& t : d_inst_match_trie)
+    for (std::pair<const Node, inst::InstMatchSet>& t : d_inst_match_set)
     {
       getInstantiationTermVectors(t.first, insts[t.first]);
     }
@@ -648,15 +686,15 @@ void Instantiate::getExplanationForInstLemmas(
   {
     if (options::incrementalSolving())
     {
-      for (std::pair<const Node, inst::CDInstMatchTrie*>& t :
-           d_c_inst_match_trie)
+      for (std::pair<const Node, inst::CDInstMatchSet*>& t :
+           d_c_inst_match_set)
       {
         t.second->getExplanationForInstLemmas(t.first, lems, quant, tvec);
       }
     }
     else
     {
-      for (std::pair<const Node, inst::InstMatchTrie>& t : d_inst_match_trie)
+      for (std::pair<const Node, inst::InstMatchSet>& t : d_inst_match_set)
       {
         t.second.getExplanationForInstLemmas(t.first, lems, quant, tvec);
       }
@@ -683,7 +721,7 @@ void Instantiate::getInstantiations(std::map<Node, std::vector<Node> >& insts)
 
   if (options::incrementalSolving())
   {
-    for (std::pair<const Node, inst::CDInstMatchTrie*>& t : d_c_inst_match_trie)
+    for (std::pair<const Node, inst::CDInstMatchSet*>& t : d_c_inst_match_set)
     {
       t.second->getInstantiations(
           insts[t.first], t.first, d_qe, useUnsatCore, active_lemmas);
@@ -691,7 +729,7 @@ void Instantiate::getInstantiations(std::map<Node, std::vector<Node> >& insts)
   }
   else
   {
-    for (std::pair<const Node, inst::InstMatchTrie>& t : d_inst_match_trie)
+    for (std::pair<const Node, inst::InstMatchSet>& t : d_inst_match_set)
     {
       t.second.getInstantiations(
           insts[t.first], t.first, d_qe, useUnsatCore, active_lemmas);
@@ -703,9 +741,9 @@ void Instantiate::getInstantiations(Node q, std::vector<Node>& insts)
 {
   if (options::incrementalSolving())
   {
-    std::map<Node, inst::CDInstMatchTrie*>::iterator it =
-        d_c_inst_match_trie.find(q);
-    if (it != d_c_inst_match_trie.end())
+    std::map<Node, inst::CDInstMatchSet*>::iterator it =
+        d_c_inst_match_set.find(q);
+    if (it != d_c_inst_match_set.end())
     {
       std::vector<Node> active_lemmas;
       it->second->getInstantiations(
@@ -714,9 +752,9 @@ void Instantiate::getInstantiations(Node q, std::vector<Node>& insts)
   }
   else
   {
-    std::map<Node, inst::InstMatchTrie>::iterator it =
-        d_inst_match_trie.find(q);
-    if (it != d_inst_match_trie.end())
+    std::map<Node, inst::InstMatchSet>::iterator it =
+        d_inst_match_set.find(q);
+    if (it != d_inst_match_set.end())
     {
       std::vector<Node> active_lemmas;
       it->second.getInstantiations(
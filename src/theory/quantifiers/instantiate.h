@@ -20,7 +20,7 @@
 #include <map>
 
 #include "expr/node.h"
-#include "theory/quantifiers/inst_match_trie.h"
+#include "theory/quantifiers/inst_match_set.h"
 #include "theory/quantifiers/quant_util.h"
 #include "theory/quantifiers_engine.h"
 #include "util/statistics_registry.h"
@@ -69,10 +69,10 @@ class InstantiationNotify
 
 /** Instantiate
  *
- * This class is used for generating instantiation lemmas.  It maintains an
- * instantiation trie, which is represented by a different data structure
- * depending on whether incremental solving is enabled (see d_inst_match_trie
- * and d_c_inst_match_trie).
+ * This class is used for generating instantiation lemmas.  It maintains a
+ * set of instantiations for each quantified formula, which is represented by
+ * a different data structure depending on whether incremental solving is
+ * enabled (see d_inst_match_set and d_c_inst_match_set).
  *
  * Below, we say an instantiation lemma for q = forall x. F under substitution
  * { x -> t } is the formula:
@@ -126,7 +126,7 @@ class Instantiate : public QuantifiersUtil
    *   mkRep : whether to take the representatives of the terms in the range of
    *           the substitution m,
    *   modEq : whether to check for duplication modulo equality in instantiation
-   *           tries (for performance),
+   *           sets (for performance),
    *   doVts : whether we must apply virtual term substitution to the
    *           instantiation lemma.
    *
@@ -159,7 +159,7 @@ class Instantiate : public QuantifiersUtil
                         bool doVts = false);
   /** remove pending instantiation
    *
-   * Removes the instantiation lemma lem from the instantiation trie.
+   * Removes the instantiation lemma lem from the instantiation set.
    */
   bool removeInstantiation(Node q, Node lem, std::vector<Node>& terms);
   /** record instantiation
@@ -323,7 +323,7 @@ class Instantiate : public QuantifiersUtil
    * addedLem : whether an instantiation lemma was added for the vector we are
    *            recording. If this is false, we bookkeep the vector.
    * modEq : whether to check for duplication modulo equality in instantiation
-   *         tries (for performance),
+   *         sets (for performance),
    */
   bool recordInstantiationInternal(Node q,
                                    std::vector<Node>& terms,
@@ -351,15 +351,15 @@ class Instantiate : public QuantifiersUtil
   /** list of all instantiations produced for each quantifier
    *
    * We store context (dependent, independent) versions. If incremental solving
-   * is disabled, we use d_inst_match_trie for performance reasons.
+   * is disabled, we use d_inst_match_set for performance reasons.
    */
-  std::map<Node, inst::InstMatchTrie> d_inst_match_trie;
-  std::map<Node, inst::CDInstMatchTrie*> d_c_inst_match_trie;
+  std::map<Node, inst::InstMatchSet> d_inst_match_set;
+  std::map<Node, inst::CDInstMatchSet*> d_c_inst_match_set;
   /**
-   * The list of quantified formulas for which the domain of d_c_inst_match_trie
+   * The list of quantified formulas for which the domain of d_c_inst_match_set
    * is valid.
    */
-  context::CDHashSet<Node, NodeHashFunction> d_c_inst_match_trie_dom;
+  context::CDHashSet<Node, NodeHashFunction> d_c_inst_match_set_dom;
 
   /** explicitly recorded instantiations
    *
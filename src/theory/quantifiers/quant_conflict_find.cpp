@@ -21,6 +21,7 @@
 #include "smt/smt_statistics_registry.h"
 #include "theory/quantifiers/first_order_model.h"
 #include "theory/quantifiers/instantiate.h"
+#include "theory/quantifiers/quant_profile.h"
 #include "theory/quantifiers/quant_util.h"
 #include "theory/quantifiers/term_database.h"
 #include "theory/quantifiers/term_util.h"
@@ -2077,6 +2078,7 @@ void QuantConflictFind::check(Theory::Effort level, QEffort quant_e)
         Trace("qcf-debug") << std::endl;
       }
       bool isConflict = false;
+      QuantProfile* profile = d_quantEngine->getQuantProfile();
       for (unsigned e = QcfEffortStart(), end = QcfEffortEnd(); e <= end; ++e) {
         d_effort = static_cast<Effort>(e);
         Trace("qcf-check") << "Checking quantified formulas at effort " << e << "..." << std::endl;
@@ -2084,6 +2086,7 @@ void QuantConflictFind::check(Theory::Effort level, QEffort quant_e)
           Node q = d_quantEngine->getModel()->getAssertedQuantifier( i, true );
           if( d_quantEngine->hasOwnership( q, this ) && d_irr_quant.find( q )==d_irr_quant.end() ){
             QuantInfo * qi = &d_qinfo[q];
+            QuantProfile::Timer timer(profile, q, "QuantConflictFind");
 
             Assert( d_qinfo.find( q )!=d_qinfo.end() );
             if( qi->matchGeneratorIsValid() ){
@@ -2131,6 +2134,10 @@ void QuantConflictFind::check(Theory::Effort level, QEffort quant_e)
                             if (e == EFFORT_CONFLICT) {
                               d_quantEngine->markRelevant( q );
                               ++(d_quantEngine->d_statistics.d_instantiations_qcf);
+                              if (profile != nullptr)
+                              {
+                                profile->notifyConflict(q);
+                              }
                               if( options::qcfAllConflict() ){
                                 isConflict = true;
                               }else{
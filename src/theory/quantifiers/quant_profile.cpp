@@ -0,0 +1,157 @@
+/*********************                                                        */
+/*! \file quant_profile.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Andrew Reynolds
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Implementation of per quantified formula instantiation profile
+ **/
+
+#include "theory/quantifiers/quant_profile.h"
+
+#include <sstream>
+
+#include "smt/smt_statistics_registry.h"
+#include "theory/quantifiers/quantifiers_attributes.h"
+#include "theory/quantifiers_engine.h"
+
+namespace CVC4 {
+namespace theory {
+namespace quantifiers {
+
+QuantProfile::QuantProfile(QuantifiersEngine* qe) : d_qe(qe) {}
+
+QuantProfile::Entry& QuantProfile::getEntry(Node q)
+{
+  std::map<Node, Entry>::iterator it = d_entries.find(q);
+  if (it != d_entries.end())
+  {
+    return it->second;
+  }
+  Entry& e = d_entries[q];
+  Node name = d_qe->getQuantAttributes()->getQuantName(q);
+  if (!name.isNull())
+  {
+    e.d_name = name.toString();
+  }
+  else
+  {
+    std::stringstream ss;
+    ss << "q" << d_quants.size();
+    e.d_name = ss.str();
+  }
+  d_quants.push_back(q);
+  return e;
+}
+
+void QuantProfile::notifyMatch(Node q)
+{
+  Entry& e = getEntry(q);
+  e.d_matches++;
+  d_statistics.d_matches << e.d_name;
+}
+
+void QuantProfile::notifyDuplicate(Node q)
+{
+  Entry& e = getEntry(q);
+  e.d_duplicates++;
+  d_statistics.d_duplicates << e.d_name;
+}
+
+void QuantProfile::notifyRejected(Node q)
+{
+  Entry& e = getEntry(q);
+  e.d_rejected++;
+  d_statistics.d_rejected << e.d_name;
+}
+
+void QuantProfile::notifyInstantiation(Node q)
+{
+  Entry& e = getEntry(q);
+  e.d_instantiations++;
+  d_statistics.d_instantiations << e.d_name;
+}
+
+void QuantProfile::notifyConflict(Node q)
+{
+  Entry& e = getEntry(q);
+  e.d_conflicts++;
+  d_statistics.d_conflicts << e.d_name;
+}
+
+void QuantProfile::addTime(Node q, const char* module, double t)
+{
+  getEntry(q).d_time[module] += t;
+}
+
+void QuantProfile::print(std::ostream& out)
+{
+  out << "(quantifier-profile" << std::endl;
+  for (const Node& q : d_quants)
+  {
+    const Entry& e = d_entries[q];
+    out << "  (" << e.d_name << " " << q << " :matches " << e.d_matches
+        << " :instantiations " << e.d_instantiations << " :duplicates "
+        << e.d_duplicates << " :rejected " << e.d_rejected << " :conflicts "
+        << e.d_conflicts << " :time (";
+    bool first = true;
+    for (const std::pair<const std::string, double>& t : e.d_time)
+    {
+      out << (first ? "" : " ") << "(" << t.first << " " << t.second << ")";
+      first = false;
+    }
+    out << "))" << std::endl;
+  }
+  out << ")" << std::endl;
+}
+
+QuantProfile::Timer::Timer(QuantProfile* p, TNode q, const char* module)
+    : d_profile(p), d_quant(q), d_module(module)
+{
+  if (d_profile != nullptr)
+  {
+    d_start = std::chrono::steady_clock::now();
+  }
+}
+
+QuantProfile::Timer::~Timer()
+{
+  if (d_profile != nullptr)
+  {
+    std::chrono::duration<double> t =
+        std::chrono::steady_clock::now() - d_start;
+    d_profile->addTime(d_quant, d_module, t.count());
+  }
+}
+
+QuantProfile::Statistics::Statistics()
+    : d_matches("QuantProfile::Matches"),
+      d_instantiations("QuantProfile::Instantiations"),
+      d_duplicates("QuantProfile::Duplicates"),
+      d_rejected("QuantProfile::Rejected"),
+      d_conflicts("QuantProfile::Conflicts")
+{
+  smtStatisticsRegistry()->registerStat(&d_matches);
+  smtStatisticsRegistry()->registerStat(&d_instantiations);
+  smtStatisticsRegistry()->registerStat(&d_duplicates);
+  smtStatisticsRegistry()->registerStat(&d_rejected);
+  smtStatisticsRegistry()->registerStat(&d_conflicts);
+}
+
+QuantProfile::Statistics::~Statistics()
+{
+  smtStatisticsRegistry()->unregisterStat(&d_matches);
+  smtStatisticsRegistry()->unregisterStat(&d_instantiations);
+  smtStatisticsRegistry()->unregisterStat(&d_duplicates);
+  smtStatisticsRegistry()->unregisterStat(&d_rejected);
+  smtStatisticsRegistry()->unregisterStat(&d_conflicts);
+}
+
+} /* CVC4::theory::quantifiers namespace */
+} /* CVC4::theory namespace */
+} /* CVC4 namespace */
@@ -0,0 +1,145 @@
+/*********************                                                        */
+/*! \file quant_profile.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Andrew Reynolds
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief per quantified formula instantiation profile
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__THEORY__QUANTIFIERS__QUANT_PROFILE_H
+#define __CVC4__THEORY__QUANTIFIERS__QUANT_PROFILE_H
+
+#include <chrono>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "expr/node.h"
+#include "util/statistics_registry.h"
+
+namespace CVC4 {
+namespace theory {
+
+class QuantifiersEngine;
+
+namespace quantifiers {
+
+/** Quantifier profile
+ *
+ * This class records, for each quantified formula, the cost of its
+ * instantiation, enabled by --quant-profile:
+ * - the number of matches, that is, calls to Instantiate::addInstantiation,
+ * - the number of instantiation lemmas that were added,
+ * - the number of matches rejected as duplicates,
+ * - the number of matches rejected for other reasons, for instance because
+ *   their instantiation is entailed or true in the model,
+ * - the number of instantiations that led to a conflict, that is, that were
+ *   found false in the current context by conflict-based instantiation, or
+ *   to be in conflict by an instantiation notify class,
+ * - the time spent on the quantified formula by each module that processes
+ *   quantified formulas one at a time (see Timer).
+ *
+ * The counts are exposed as histograms keyed by quantified formula in the
+ * statistics, and the full profile is printed after each satisfiability
+ * check (see print).
+ */
+class QuantProfile
+{
+ public:
+  QuantProfile(QuantifiersEngine* qe);
+  ~QuantProfile() {}
+  /** notify that q was matched */
+  void notifyMatch(Node q);
+  /** notify that a match of q was rejected as a duplicate */
+  void notifyDuplicate(Node q);
+  /** notify that a match of q was rejected, but not as a duplicate */
+  void notifyRejected(Node q);
+  /** notify that an instantiation lemma of q was added */
+  void notifyInstantiation(Node q);
+  /** notify that an instantiation of q led to a conflict */
+  void notifyConflict(Node q);
+  /** add time t in seconds spent on q by the module with the given name */
+  void addTime(Node q, const char* module, double t);
+  /**
+   * Print the profile on out, as an s-expression with one entry per
+   * quantified formula, in the order in which they were first recorded.
+   */
+  void print(std::ostream& out);
+
+  /**
+   * Times the lifetime of this object, and adds it to the profile of q for
+   * the given module, if p is non-null. If p is null, this does nothing. The
+   * quantified formula q and the string module must outlive this object.
+   */
+  class Timer
+  {
+   public:
+    Timer(QuantProfile* p, TNode q, const char* module);
+    ~Timer();
+
+   private:
+    QuantProfile* d_profile;
+    TNode d_quant;
+    const char* d_module;
+    std::chrono::steady_clock::time_point d_start;
+  };
+
+ private:
+  /** The profile of a quantified formula */
+  struct Entry
+  {
+    Entry()
+        : d_matches(0),
+          d_instantiations(0),
+          d_duplicates(0),
+          d_rejected(0),
+          d_conflicts(0)
+    {
+    }
+    /** the name of the quantified formula */
+    std::string d_name;
+    unsigned d_matches;
+    unsigned d_instantiations;
+    unsigned d_duplicates;
+    unsigned d_rejected;
+    unsigned d_conflicts;
+    /** the time spent by each module */
+    std::map<std::string, double> d_time;
+  };
+  /** Get the entry of q, creating it if necessary */
+  Entry& getEntry(Node q);
+  /** Pointer to the quantifiers engine */
+  QuantifiersEngine* d_qe;
+  /** The entries of the quantified formulas */
+  std::map<Node, Entry> d_entries;
+  /** The quantified formulas in the order their entry was created */
+  std::vector<Node> d_quants;
+  /** statistics */
+  class Statistics
+  {
+   public:
+    HistogramStat<std::string> d_matches;
+    HistogramStat<std::string> d_instantiations;
+    HistogramStat<std::string> d_duplicates;
+    HistogramStat<std::string> d_rejected;
+    HistogramStat<std::string> d_conflicts;
+    Statistics();
+    ~Statistics();
+  };
+  Statistics d_statistics;
+};
+
+} /* CVC4::theory::quantifiers namespace */
+} /* CVC4::theory namespace */
+} /* CVC4 namespace */
+
+#endif /* __CVC4__THEORY__QUANTIFIERS__QUANT_PROFILE_H */
@@ -419,6 +419,16 @@ Node QuantAttributes::getQuantIdNumNode( Node q ) {
   }
 }
 
+Node QuantAttributes::getQuantName(Node q)
+{
+  std::map<Node, QAttributes>::iterator it = d_qattr.find(q);
+  if (it == d_qattr.end())
+  {
+    return Node::null();
+  }
+  return it->second.d_name;
+}
+
 void QuantAttributes::setInstantiationLevelAttr(Node n, Node qn, uint64_t level)
 {
   Trace("inst-level-debug2") << "IL : " << n << " " << qn << " " << level
@@ -206,6 +206,8 @@ public:
   int getQuantIdNum( Node q );
   /** get quant id num */
   Node getQuantIdNumNode( Node q );
+  /** get quant name, the quant-name attribute of q, if any */
+  Node getQuantName(Node q);
 
   /** set instantiation level attr */
   static void setInstantiationLevelAttr(Node n, uint64_t level);
@@ -78,7 +78,10 @@ void TermArgTrie::debugPrint( const char * c, Node n, unsigned depth ) {
 TermDb::TermDb(context::Context* c, context::UserContext* u,
                QuantifiersEngine* qe)
     : d_quantEngine(qe),
-      d_inactive_map(c) {
+      d_inactive_map(c),
+      d_incremental_index(false),
+      d_index_version_counter(0),
+      d_op_version(c) {
   d_consistent_ee = true;
   d_true = NodeManager::currentNM()->mkConst(true);
   d_false = NodeManager::currentNM()->mkConst(false);
@@ -316,9 +319,21 @@ void TermDb::computeUfEqcTerms( TNode f ) {
         computeArgReps(n);
         TNode r = ee->hasTerm(n) ? ee->getRepresentative(n) : n;
         d_func_map_eqc_trie[f].d_data[r].addTerm(n, d_arg_reps[n]);
+        if (d_incremental_index)
+        {
+          d_rep_ops[r].insert(f);
+          for (const TNode& ar : d_arg_reps[n])
+          {
+            d_rep_ops[ar].insert(f);
+          }
+        }
       }
     }
   }
+  if (d_incremental_index)
+  {
+    d_func_map_eqc_trie_version[f] = getIndexVersion(f);
+  }
 }
 
 void TermDb::computeUfTerms( TNode f ) {
@@ -386,6 +401,14 @@ void TermDb::computeUfTerms( TNode f ) {
       Assert(ee->hasTerm(n));
       Trace("term-db-debug") << "  and value : " << ee->getRepresentative(n)
                              << std::endl;
+      if (d_incremental_index)
+      {
+        d_rep_ops[ee->getRepresentative(n)].insert(f);
+        for (const TNode& ar : d_arg_reps[n])
+        {
+          d_rep_ops[ar].insert(f);
+        }
+      }
       Node at = d_func_map_trie[f].addOrGetTerm(n, d_arg_reps[n]);
       Assert(ee->hasTerm(at));
       Trace("term-db-debug2") << "...add term returned " << at << std::endl;
@@ -465,6 +488,11 @@ void TermDb::computeUfTerms( TNode f ) {
       Trace("tdb") << relevantCount << " / " << it->second.size() << std::endl;
     }
   }
+  if (d_incremental_index)
+  {
+    // setTermInactive above may have changed the version of f
+    d_func_map_trie_version[f] = getIndexVersion(f);
+  }
 }
 
 void TermDb::addTermHo(Node n,
@@ -800,6 +828,7 @@ bool TermDb::isTermActive( Node n ) {
 
 void TermDb::setTermInactive( Node n ) {
   d_inactive_map[n] = true;
+  notifyTermChanged(n);
   //Trace("term-db-debug2") << "set no match attribute" << std::endl;
   //NoMatchAttribute nma;
   //n.setAttribute(nma,true);
@@ -903,14 +932,18 @@ void TermDb::presolve() {
     d_processed.clear();
     d_iclosure_processed.clear();
   }
-}
-
-bool TermDb::reset( Theory::Effort effort ){
+  // the term indices are not kept across calls to check-sat
   d_op_nonred_count.clear();
-  d_arg_reps.clear();
   d_func_map_trie.clear();
   d_func_map_eqc_trie.clear();
   d_func_map_rel_dom.clear();
+  d_func_map_trie_version.clear();
+  d_func_map_eqc_trie_version.clear();
+  d_rep_ops.clear();
+}
+
+bool TermDb::reset( Theory::Effort effort ){
+  d_arg_reps.clear();
   d_consistent_ee = true;
 
   eq::EqualityEngine* ee = d_quantEngine->getActiveEqualityEngine();
@@ -1044,6 +1077,10 @@ bool TermDb::reset( Theory::Effort effort ){
     Trace("quant-ho") << "...finished compute equal functions." << std::endl;
   }
 
+  // remove the term indices that are out of date, this is done last since
+  // the above may modify the equality engine
+  resetTermIndices(ee);
+
 /*
   //rebuild d_func/pred_map_trie for each operation, this will calculate all congruent terms
   for( std::map< Node, std::vector< Node > >::iterator it = d_op_map.begin(); it != d_op_map.end(); ++it ){
@@ -1056,6 +1093,167 @@ bool TermDb::reset( Theory::Effort effort ){
   return true;
 }
 
+TermDb::IndexVersion TermDb::getIndexVersion(TNode f)
+{
+  IndexVersion v;
+  NodeIntMap::const_iterator it = d_op_version.find(f);
+  if (it != d_op_version.end())
+  {
+    v.d_version = (*it).second;
+  }
+  std::map<Node, std::vector<Node> >::const_iterator ito = d_op_map.find(f);
+  if (ito != d_op_map.end())
+  {
+    v.d_numTerms = ito->second.size();
+  }
+  return v;
+}
+
+void TermDb::notifyOpChanged(TNode f)
+{
+  d_op_version[f] = ++d_index_version_counter;
+}
+
+void TermDb::notifyRepChanged(TNode r)
+{
+  std::unordered_map<Node,
+                     std::unordered_set<Node, NodeHashFunction>,
+                     NodeHashFunction>::const_iterator it = d_rep_ops.find(r);
+  if (it != d_rep_ops.end())
+  {
+    for (const Node& f : it->second)
+    {
+      notifyOpChanged(f);
+    }
+  }
+}
+
+void TermDb::notifyTermChanged(TNode n)
+{
+  // only consider the terms that were added to d_op_map
+  if (options::termDbIncremental()
+      && d_processed.find(n) != d_processed.end()
+      && !TermUtil::hasInstConstAttr(n) && inst::Trigger::isAtomicTrigger(n))
+  {
+    Node f = getMatchOperator(n);
+    if (d_op_map.find(f) != d_op_map.end())
+    {
+      notifyOpChanged(f);
+    }
+  }
+}
+
+void TermDb::eqNotifyNewClass(TNode t) { notifyTermChanged(t); }
+
+void TermDb::eqNotifyMerge(TNode t1, TNode t2)
+{
+  notifyRepChanged(t1);
+  notifyRepChanged(t2);
+}
+
+void TermDb::eqNotifyDisequal(TNode t1, TNode t2)
+{
+  notifyRepChanged(t1);
+  notifyRepChanged(t2);
+}
+
+void TermDb::resetTermIndices(eq::EqualityEngine* ee)
+{
+  d_incremental_index = options::termDbIncremental()
+                        && ee == d_quantEngine->getMasterEqualityEngine()
+                        && options::termDbMode() == TERM_DB_ALL
+                        && !options::ufHo()
+                        && !options::lteRestrictInstClosure();
+  if (!d_incremental_index)
+  {
+    d_op_nonred_count.clear();
+    d_func_map_trie.clear();
+    d_func_map_eqc_trie.clear();
+    d_func_map_rel_dom.clear();
+    d_func_map_trie_version.clear();
+    d_func_map_eqc_trie_version.clear();
+    d_rep_ops.clear();
+    return;
+  }
+  unsigned kept = 0;
+  unsigned removed = 0;
+  std::map<Node, int>::iterator it = d_op_nonred_count.begin();
+  while (it != d_op_nonred_count.end())
+  {
+    Node f = it->first;
+    std::map<Node, IndexVersion>::iterator itv =
+        d_func_map_trie_version.find(f);
+    if (itv != d_func_map_trie_version.end() && itv->second == getIndexVersion(f))
+    {
+      kept++;
+      ++it;
+      continue;
+    }
+    removed++;
+    d_func_map_trie.erase(f);
+    d_func_map_rel_dom.erase(f);
+    if (itv != d_func_map_trie_version.end())
+    {
+      d_func_map_trie_version.erase(itv);
+    }
+    it = d_op_nonred_count.erase(it);
+  }
+  std::map<Node, TermArgTrie>::iterator ite = d_func_map_eqc_trie.begin();
+  while (ite != d_func_map_eqc_trie.end())
+  {
+    Node f = ite->first;
+    std::map<Node, IndexVersion>::iterator itv =
+        d_func_map_eqc_trie_version.find(f);
+    if (itv != d_func_map_eqc_trie_version.end()
+        && itv->second == getIndexVersion(f))
+    {
+      ++ite;
+      continue;
+    }
+    if (itv != d_func_map_eqc_trie_version.end())
+    {
+      d_func_map_eqc_trie_version.erase(itv);
+    }
+    ite = d_func_map_eqc_trie.erase(ite);
+  }
+  // The kept indices are valid in the current context, hence only mention
+  // current representatives. Prune the other representatives and the
+  // operators whose indices were removed, so that d_rep_ops only grows with
+  // the indices that are alive.
+  std::unordered_map<Node,
+                     std::unordered_set<Node, NodeHashFunction>,
+                     NodeHashFunction>::iterator itr = d_rep_ops.begin();
+  while (itr != d_rep_ops.end())
+  {
+    TNode r = itr->first;
+    if (ee->hasTerm(r) && ee->getRepresentative(r) == r)
+    {
+      std::unordered_set<Node, NodeHashFunction>& ops = itr->second;
+      std::unordered_set<Node, NodeHashFunction>::iterator ito = ops.begin();
+      while (ito != ops.end())
+      {
+        if (d_func_map_trie.find(*ito) == d_func_map_trie.end()
+            && d_func_map_eqc_trie.find(*ito) == d_func_map_eqc_trie.end())
+        {
+          ito = ops.erase(ito);
+        }
+        else
+        {
+          ++ito;
+        }
+      }
+      if (!ops.empty())
+      {
+        ++itr;
+        continue;
+      }
+    }
+    itr = d_rep_ops.erase(itr);
+  }
+  Trace("term-db-index") << "TermDb::reset : kept " << kept << " / "
+                         << (kept + removed) << " term indices" << std::endl;
+}
+
 TermArgTrie * TermDb::getTermArgTrie( Node f ) {
   if( options::ufHo() ){
     f = getOperatorRepresentative( f );
@@ -18,6 +18,7 @@
 #define __CVC4__THEORY__QUANTIFIERS__TERM_DATABASE_H
 
 #include <map>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "expr/attribute.h"
@@ -140,7 +141,14 @@ class TermDb : public QuantifiersUtil {
   ~TermDb();
   /** presolve (called once per user check-sat) */
   void presolve();
-  /** reset (calculate which terms are active) */
+  /** reset (calculate which terms are active)
+   *
+   * The term indices of the previous round (see getTermArgTrie) are kept if
+   * the ground terms of their operator, and the equivalence classes of their
+   * arguments, have not changed since they were computed. This is the case if
+   * --term-db-incremental is enabled, the active equality engine is the master
+   * equality engine, and all ground terms are considered for instantiation.
+   */
   bool reset(Theory::Effort effort) override;
   /** register quantified formula */
   void registerQuantifier(Node q) override;
@@ -308,6 +316,12 @@ class TermDb : public QuantifiersUtil {
   bool isTermActive(Node n);
   /** set that term n is inactive in this context. */
   void setTermInactive(Node n);
+  /** notification when the master equality engine creates the class of t */
+  void eqNotifyNewClass(TNode t);
+  /** notification when the master equality engine merges the classes t1, t2 */
+  void eqNotifyMerge(TNode t1, TNode t2);
+  /** notification when the classes t1 and t2 become disequal */
+  void eqNotifyDisequal(TNode t1, TNode t2);
   /** has term current
    *
   * This function is used in cases where we restrict which terms appear in the
@@ -360,6 +374,56 @@ class TermDb : public QuantifiersUtil {
   std::map< Node, TermArgTrie > d_func_map_eqc_trie;
   /** mapping from operators to their representative relevant domains */
   std::map< Node, std::map< unsigned, std::vector< Node > > > d_func_map_rel_dom;
+  //------------------------------incremental term indexing
+  /** The version of the ground terms of an operator, see d_op_version */
+  struct IndexVersion
+  {
+    IndexVersion() : d_version(0), d_numTerms(0) {}
+    int d_version;
+    size_t d_numTerms;
+    bool operator==(const IndexVersion& other) const
+    {
+      return d_version == other.d_version && d_numTerms == other.d_numTerms;
+    }
+  };
+  /** whether the term indices are kept across rounds, see reset */
+  bool d_incremental_index;
+  /** the last version given to an operator */
+  int d_index_version_counter;
+  /**
+   * Map from operators to their current version. An operator gets a fresh
+   * version whenever its term indices may change in the current SAT context,
+   * due to a merge or a disequality involving the class of one of its terms
+   * or their arguments, or to one of its terms becoming (in)active. Since the
+   * versions are never reused, an index computed at some version is still
+   * valid if the operator has this version after backtracking.
+   */
+  NodeIntMap d_op_version;
+  /** the versions at which the term indices were computed */
+  std::map<Node, IndexVersion> d_func_map_trie_version;
+  std::map<Node, IndexVersion> d_func_map_eqc_trie_version;
+  /**
+   * Map from representatives to the operators whose indices mention them.
+   * This is pruned to the indices kept by resetTermIndices.
+   */
+  std::unordered_map<Node,
+                     std::unordered_set<Node, NodeHashFunction>,
+                     NodeHashFunction>
+      d_rep_ops;
+  /** get the current version of the ground terms of f */
+  IndexVersion getIndexVersion(TNode f);
+  /** give f a fresh version */
+  void notifyOpChanged(TNode f);
+  /** give a fresh version to the operator of n, if n is in d_op_map */
+  void notifyTermChanged(TNode n);
+  /** give a fresh version to the operators whose indices mention r */
+  void notifyRepChanged(TNode r);
+  /**
+   * Remove the term indices that are out of date, or all of them if the
+   * indices are not kept across rounds.
+   */
+  void resetTermIndices(eq::EqualityEngine* ee);
+  //------------------------------end incremental term indexing
   /** has map */
   std::map< Node, bool > d_has_map;
   /** map from reps to a term in eqc in d_has_map */
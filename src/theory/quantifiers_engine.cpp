@@ -26,6 +26,7 @@
 #include "theory/quantifiers/sygus/ce_guided_instantiation.h"
 #include "theory/quantifiers/cegqi/ceg_t_instantiator.h"
 #include "theory/quantifiers/conjecture_generator.h"
+#include "theory/quantifiers/ematching/code_tree.h"
 #include "theory/quantifiers/equality_infer.h"
 #include "theory/quantifiers/equality_query.h"
 #include "theory/quantifiers/first_order_model.h"
@@ -40,6 +41,7 @@
 #include "theory/quantifiers/fmf/model_engine.h"
 #include "theory/quantifiers/quant_conflict_find.h"
 #include "theory/quantifiers/quant_epr.h"
+#include "theory/quantifiers/quant_profile.h"
 #include "theory/quantifiers/quant_relevance.h"
 #include "theory/quantifiers/quant_split.h"
 #include "theory/quantifiers/quantifiers_attributes.h"
@@ -73,6 +75,8 @@ QuantifiersEngine::QuantifiersEngine(context::Context* c,
       d_instantiate(new quantifiers::Instantiate(this, u)),
       d_skolemize(new quantifiers::Skolemize(this, u)),
       d_term_enum(new quantifiers::TermEnumeration),
+      d_profile(options::quantProfile() ? new quantifiers::QuantProfile(this)
+                                        : nullptr),
       d_conflict_c(c, false),
       // d_quants(u),
       d_quants_red(u),
@@ -97,6 +101,9 @@ QuantifiersEngine::QuantifiersEngine(context::Context* c,
 
   d_term_db = new quantifiers::TermDb( c, u, this );
   d_util.push_back( d_term_db );
+
+  d_code_tree = new inst::CodeTree(this);
+  d_util.push_back(d_code_tree);
   
   if (options::ceGuidedInst()) {
     d_sygus_tdb = new quantifiers::TermDbSygus(c, this);
@@ -279,6 +286,8 @@ QuantifiersEngine::~QuantifiersEngine()
   delete d_bv_invert;
   delete d_model;
   delete d_tr_trie;
+  // must be deleted after the triggers, which unregister from it
+  delete d_code_tree;
   delete d_term_db;
   delete d_sygus_tdb;
   delete d_term_util;
@@ -867,12 +876,14 @@ void QuantifiersEngine::addTermToDatabase( Node n, bool withinQuant, bool within
 
 void QuantifiersEngine::eqNotifyNewClass(TNode t) {
   addTermToDatabase( t );
+  d_term_db->eqNotifyNewClass(t);
   if( d_eq_inference ){
     d_eq_inference->eqNotifyNewClass( t );
   }
 }
 
 void QuantifiersEngine::eqNotifyPreMerge(TNode t1, TNode t2) {
+  d_term_db->eqNotifyMerge(t1, t2);
   if( d_eq_inference ){
     d_eq_inference->eqNotifyMerge( t1, t2 );
   }
@@ -883,6 +894,7 @@ void QuantifiersEngine::eqNotifyPostMerge(TNode t1, TNode t2) {
 }
 
 void QuantifiersEngine::eqNotifyDisequal(TNode t1, TNode t2, TNode reason) {
+  d_term_db->eqNotifyDisequal(t1, t2);
   //if( d_qcf ){
   //  d_qcf->assertDisequal( t1, t2 );
   //}
@@ -1069,6 +1081,14 @@ void QuantifiersEngine::printInstantiations( std::ostream& out ) {
   }
 }
 
+void QuantifiersEngine::printQuantProfile(std::ostream& out)
+{
+  if (d_profile != nullptr)
+  {
+    d_profile->print(out);
+  }
+}
+
 void QuantifiersEngine::printSynthSolution( std::ostream& out ) {
   if( d_ceg_inst ){
     d_ceg_inst->printSynthSolution( out );
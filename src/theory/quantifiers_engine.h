@@ -48,6 +48,7 @@ namespace quantifiers {
   class TermDbSygus;
   class TermUtil;
   class Instantiate;
+  class QuantProfile;
   class Skolemize;
   class TermEnumeration;
   class FirstOrderModel;
@@ -79,6 +80,7 @@ namespace quantifiers {
 }/* CVC4::theory::quantifiers */
 
 namespace inst {
+  class CodeTree;
   class TriggerTrie;
 }/* CVC4::theory::inst */
 
@@ -133,6 +135,8 @@ private:
   std::unique_ptr<quantifiers::Skolemize> d_skolemize;
   /** term enumeration utility */
   std::unique_ptr<quantifiers::TermEnumeration> d_term_enum;
+  /** instantiation profile, if --quant-profile is enabled */
+  std::unique_ptr<quantifiers::QuantProfile> d_profile;
   /** instantiation engine */
   quantifiers::InstantiationEngine* d_inst_engine;
   /** model engine */
@@ -185,6 +189,8 @@ private:
   std::map< Node, bool > d_phase_req_waiting;
   /** all triggers will be stored in this trie */
   inst::TriggerTrie* d_tr_trie;
+  /** the code tree for matching simple triggers */
+  inst::CodeTree* d_code_tree;
   /** extended model object */
   quantifiers::FirstOrderModel* d_model;
   /** inst round counters TODO: make context-dependent? */
@@ -336,6 +342,8 @@ public:
   quantifiers::Instantiate* getInstantiate() { return d_instantiate.get(); }
   /** get skolemize utility */
   quantifiers::Skolemize* getSkolemize() { return d_skolemize.get(); }
+  /** get instantiation profile, or null if --quant-profile is disabled */
+  quantifiers::QuantProfile* getQuantProfile() { return d_profile.get(); }
   /** get term enumeration utility */
   quantifiers::TermEnumeration* getTermEnumeration()
   {
@@ -343,6 +351,8 @@ public:
   }
   /** get trigger database */
   inst::TriggerTrie* getTriggerDatabase() { return d_tr_trie; }
+  /** get code tree */
+  inst::CodeTree* getCodeTree() { return d_code_tree; }
   /** add term to database */
   void addTermToDatabase( Node n, bool withinQuant = false, bool withinInstClosure = false );
   /** notification when master equality engine is updated */
@@ -365,6 +375,8 @@ public:
   //----------user interface for instantiations (see quantifiers/instantiate.h)
   /** print instantiations */
   void printInstantiations(std::ostream& out);
+  /** print the instantiation profile (see quantifiers/quant_profile.h) */
+  void printQuantProfile(std::ostream& out);
   /** print solution for synthesis conjectures */
   void printSynthSolution(std::ostream& out);
   /** get list of quantified formulas that were instantiated */
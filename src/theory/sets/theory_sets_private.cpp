@@ -713,12 +713,14 @@ void TheorySetsPrivate::fullEffortCheck(){
               if( !hasProcessed() ){
                 //introduce splitting on venn regions (absolute last resort)
                 if( d_card_enabled && !hasProcessed() && !intro_sets.empty() ){
-                  Assert( intro_sets.size()==1 );
-                  Trace("sets-intro") << "Introduce term : " << intro_sets[0] << std::endl;
-                  Trace("sets-intro") << "  Actual Intro : ";
-                  debugPrintSet( intro_sets[0], "sets-nf" );
-                  Trace("sets-nf") << std::endl;
-                  Node k = getProxy( intro_sets[0] );
+                  Assert( intro_sets.size()==1 || options::setsCardIntroBatch() );
+                  for( const Node& intro : intro_sets ){
+                    Trace("sets-intro") << "Introduce term : " << intro << std::endl;
+                    Trace("sets-intro") << "  Actual Intro : ";
+                    debugPrintSet( intro, "sets-nf" );
+                    Trace("sets-nf") << std::endl;
+                    Node k = getProxy( intro );
+                  }
                   d_sentLemma = true;
                 }
               }
@@ -1432,6 +1434,10 @@ void TheorySetsPrivate::checkNormalForm( Node eqc, std::vector< Node >& intro_se
               }
             }
           }
+          //introduce the intersections of the unique venn regions, either all at
+          //once, so that the regions of eqc are refined in a single round, or one
+          //at a time
+          bool introduced = false;
           for( unsigned l=0; l<only[0].size(); l++ ){
             for( unsigned m=0; m<only[1].size(); m++ ){
               bool disjoint = false;
@@ -1458,16 +1464,26 @@ void TheorySetsPrivate::checkNormalForm( Node eqc, std::vector< Node >& intro_se
                 Node kcb = getProxy( only[1][m] );
                 Node intro = Rewriter::rewrite( NodeManager::currentNM()->mkNode( kind::INTERSECTION, kca, kcb ) );
                 Trace("sets-nf") << "   Intro split : " << only[0][l] << " against " << only[1][m] << ", term is " << intro << std::endl;
-                intro_sets.push_back( intro );
                 Assert( !d_equalityEngine.hasTerm( intro ) );
-                return;
+                if( std::find( intro_sets.begin(), intro_sets.end(), intro )==intro_sets.end() ){
+                  intro_sets.push_back( intro );
+                }
+                if( !options::setsCardIntroBatch() ){
+                  return;
+                }
+                introduced = true;
               }
             }
           }
-          //should never get here
-          success = false;
+          if( !introduced ){
+            //should never get here
+            success = false;
+          }
         }
       }
+      if( !intro_sets.empty() ){
+        return;
+      }
       if( success ){
         //normal form is flat form of base
         d_nf[eqc].insert( d_nf[eqc].end(), d_ff[eqc][base].begin(), d_ff[eqc][base].end() );
@@ -15,6 +15,9 @@
  **/
 
 #include "theory/sets/theory_sets_rels.h"
+
+#include <algorithm>
+
 #include "expr/datatype.h"
 #include "theory/sets/theory_sets_private.h"
 #include "theory/sets/theory_sets.h"
@@ -46,14 +49,14 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
   }
 
   void TheorySetsRels::check() {
-    MEM_IT m_it = d_rReps_memberReps_cache.begin();
+    MEM_IT m_it = d_rReps_memberReps_exp_cache.begin();
 
-    while(m_it != d_rReps_memberReps_cache.end()) {
+    while(m_it != d_rReps_memberReps_exp_cache.end()) {
       Node rel_rep = m_it->first;
 
       for(unsigned int i = 0; i < m_it->second.size(); i++) {
-        Node    mem     = d_rReps_memberReps_cache[rel_rep][i];
-        Node    exp     = d_rReps_memberReps_exp_cache[rel_rep][i];
+        Node    exp     = m_it->second[i];
+        Node    mem     = getRepresentative( exp[0] );
         std::map<kind::Kind_t, std::vector<Node> >    kind_terms      = d_terms_cache[rel_rep];
 
         if( kind_terms.find(kind::TRANSPOSE) != kind_terms.end() ) {
@@ -99,7 +102,7 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
 
     TERM_IT t_it = d_terms_cache.begin();
     while( t_it != d_terms_cache.end() ) {
-      if( d_rReps_memberReps_cache.find(t_it->first) == d_rReps_memberReps_cache.end() ) {
+      if( d_rReps_memberReps_exp_cache.find(t_it->first) == d_rReps_memberReps_exp_cache.end() ) {
         Trace("rels-debug") << "[sets-rels] A term does not have membership constraints: " << t_it->first << std::endl;
         KIND_TERM_IT k_t_it = t_it->second.begin();
 
@@ -177,7 +180,9 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
             Node reason        = is_true_eq ? eqc_node : eqc_node.negate();
 
             if( is_true_eq ) {
-              if( safelyAddToMap(d_rReps_memberReps_cache, rel_rep, tup_rep) ) {
+              // the member representatives of rel_rep are hashed, so that a
+              // member is added in constant time
+              if( d_rReps_memberIndex[rel_rep].d_members.insert(tup_rep).second ) {
                 addToMap(d_rReps_memberReps_exp_cache, rel_rep, reason);
                 computeTupleReps(tup_rep);
                 d_membership_trie[rel_rep].addTerm(tup_rep, d_tuple_reps[tup_rep]);
@@ -233,25 +238,21 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
 
   void TheorySetsRels::computeMembersForJoinImageTerm( Node join_image_term ) {
     Trace("rels-debug") << "\n[Theory::Rels] *********** Compute members for JoinImage Term = " << join_image_term << std::endl;
-    MEM_IT rel_mem_it = d_rReps_memberReps_cache.find( getRepresentative( join_image_term[0] ) );
+    MEM_IT rel_mem_exp_it = d_rReps_memberReps_exp_cache.find( getRepresentative( join_image_term[0] ) );
 
-    if( rel_mem_it == d_rReps_memberReps_cache.end() ) {
+    if( rel_mem_exp_it == d_rReps_memberReps_exp_cache.end() ) {
       return;
     }
 
     Node join_image_rel = join_image_term[0];
     std::unordered_set< Node, NodeHashFunction > hasChecked;
-    Node join_image_rel_rep = getRepresentative( join_image_rel );
-    std::vector< Node >::iterator mem_rep_it = (*rel_mem_it).second.begin();
-    MEM_IT rel_mem_exp_it = d_rReps_memberReps_exp_cache.find( join_image_rel_rep );
     std::vector< Node >::iterator mem_rep_exp_it = (*rel_mem_exp_it).second.begin();
     unsigned int min_card = join_image_term[1].getConst<Rational>().getNumerator().getUnsignedInt();
 
-    while( mem_rep_it != (*rel_mem_it).second.end() ) {
-      Node fst_mem_rep = RelsUtils::nthElementOfTuple( *mem_rep_it, 0 );
+    while( mem_rep_exp_it != (*rel_mem_exp_it).second.end() ) {
+      Node fst_mem_rep = RelsUtils::nthElementOfTuple( getRepresentative( (*mem_rep_exp_it)[0] ), 0 );
 
       if( hasChecked.find( fst_mem_rep ) != hasChecked.end() ) {
-        ++mem_rep_it;
         ++mem_rep_exp_it;
         continue;
       }
@@ -263,7 +264,6 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
                                                                                                Node::fromExpr(dt[0].getConstructor()), fst_mem_rep ),
                                                              join_image_term);
       if( holds( new_membership ) ) {
-        ++mem_rep_it;
         ++mem_rep_exp_it;
         continue;
       }
@@ -309,7 +309,6 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
         }
         ++mem_rep_exp_it_snd;
       }
-      ++mem_rep_it;
       ++mem_rep_exp_it;
     }
     Trace("rels-debug") << "\n[Theory::Rels] *********** Done with computing members for JoinImage Term" << join_image_term << "*********** " << std::endl;
@@ -331,10 +330,10 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
 
     Node join_image_rel = join_image_term[0];
     Node join_image_rel_rep = getRepresentative( join_image_rel );
-    MEM_IT rel_mem_it = d_rReps_memberReps_cache.find( join_image_rel_rep );
+    MEM_IT rel_mem_it = d_rReps_memberReps_exp_cache.find( join_image_rel_rep );
     unsigned int min_card = join_image_term[1].getConst<Rational>().getNumerator().getUnsignedInt();
 
-    if( rel_mem_it != d_rReps_memberReps_cache.end() ) {
+    if( rel_mem_it != d_rReps_memberReps_exp_cache.end() ) {
       if( d_membership_trie.find( join_image_rel_rep ) != d_membership_trie.end() ) {
         computeTupleReps( mem_rep );
         if( d_membership_trie[join_image_rel_rep].findSuccessors(d_tuple_reps[mem_rep]).size() >= min_card ) {
@@ -402,7 +401,7 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
     Node iden_term_rel = iden_term[0];
     Node iden_term_rel_rep = getRepresentative( iden_term_rel );
 
-    if( d_rReps_memberReps_cache.find( iden_term_rel_rep ) == d_rReps_memberReps_cache.end() ) {
+    if( d_rReps_memberReps_exp_cache.find( iden_term_rel_rep ) == d_rReps_memberReps_exp_cache.end() ) {
       return;
     }
 
@@ -446,9 +445,9 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
     Trace("rels-debug") << "[Theory::Rels] *********** Applying TCLOSURE rule on a tc term = " << tc_rel
                             << ", its representative = " << tc_rel_rep
                             << " with member rep = " << mem_rep << " and explanation = " << exp << std::endl;
-    MEM_IT mem_it = d_rReps_memberReps_cache.find( tc_rel[0] );
+    MEM_IT mem_it = d_rReps_memberReps_exp_cache.find( tc_rel[0] );
 
-    if( mem_it != d_rReps_memberReps_cache.end() && d_rel_nodes.find( tc_rel ) == d_rel_nodes.end()
+    if( mem_it != d_rReps_memberReps_exp_cache.end() && d_rel_nodes.find( tc_rel ) == d_rel_nodes.end()
         && d_rRep_tcGraph.find( getRepresentative( tc_rel[0] ) ) ==  d_rRep_tcGraph.end() ) {
       buildTCGraphForRel( tc_rel );
       d_rel_nodes.insert( tc_rel );
@@ -520,9 +519,9 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
   }
 
   bool TheorySetsRels::isTCReachable( Node mem_rep, Node tc_rel ) {
-    MEM_IT mem_it = d_rReps_memberReps_cache.find( getRepresentative( tc_rel[0] ) );
+    std::map< Node, MemberIndex >::iterator mem_it = d_rReps_memberIndex.find( getRepresentative( tc_rel[0] ) );
 
-    if( mem_it != d_rReps_memberReps_cache.end() && std::find( (mem_it->second).begin(), (mem_it->second).end(), mem_rep) != (mem_it->second).end() ) {
+    if( mem_it != d_rReps_memberIndex.end() && mem_it->second.d_members.find( mem_rep ) != mem_it->second.d_members.end() ) {
       return true;
     }
 
@@ -569,12 +568,12 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
 
     Node rel_rep = getRepresentative( tc_rel[0] );
     Node tc_rel_rep = getRepresentative( tc_rel );
-    std::vector< Node > members = d_rReps_memberReps_cache[rel_rep];
-    std::vector< Node > exps = d_rReps_memberReps_exp_cache[rel_rep];
+    const std::vector< Node >& exps = d_rReps_memberReps_exp_cache[rel_rep];
 
-    for( unsigned int i = 0; i < members.size(); i++ ) {
-      Node fst_element_rep = getRepresentative( RelsUtils::nthElementOfTuple( members[i], 0 ));
-      Node snd_element_rep = getRepresentative( RelsUtils::nthElementOfTuple( members[i], 1 ));
+    for( unsigned int i = 0; i < exps.size(); i++ ) {
+      Node mem_rep = getRepresentative( exps[i][0] );
+      Node fst_element_rep = getRepresentative( RelsUtils::nthElementOfTuple( mem_rep, 0 ));
+      Node snd_element_rep = getRepresentative( RelsUtils::nthElementOfTuple( mem_rep, 1 ));
       Node tuple_rep = RelsUtils::constructPair( rel_rep, fst_element_rep, snd_element_rep );
       std::map< Node, std::unordered_set<Node, NodeHashFunction> >::iterator rel_tc_graph_it = rel_tc_graph.find( fst_element_rep );
 
@@ -589,34 +588,53 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
       }
     }
 
-    if( members.size() > 0 ) {
+    if( exps.size() > 0 ) {
       d_rRep_tcGraph[rel_rep] = rel_tc_graph;
       d_tcr_tcGraph_exps[tc_rel] = rel_tc_graph_exps;
       d_tcr_tcGraph[tc_rel] = rel_tc_graph;
     }
   }
 
-  void TheorySetsRels::doTCInference( std::map< Node, std::unordered_set<Node, NodeHashFunction> > rel_tc_graph, std::map< Node, Node > rel_tc_graph_exps, Node tc_rel ) {
+  void TheorySetsRels::doTCInference( std::map< Node, std::unordered_set<Node, NodeHashFunction> >& rel_tc_graph, std::map< Node, Node >& rel_tc_graph_exps, Node tc_rel ) {
     Trace("rels-debug") << "[Theory::Rels] ****** doTCInference !" << std::endl;
     for( TC_GRAPH_IT tc_graph_it = rel_tc_graph.begin(); tc_graph_it != rel_tc_graph.end(); tc_graph_it++ ) {
-      for( std::unordered_set< Node, NodeHashFunction >::iterator snd_elements_it = tc_graph_it->second.begin();
-           snd_elements_it != tc_graph_it->second.end(); snd_elements_it++ ) {
-        std::vector< Node > reasons;
-        std::unordered_set<Node, NodeHashFunction> seen;
-        Node tuple = RelsUtils::constructPair( tc_rel, getRepresentative( tc_graph_it->first ), getRepresentative( *snd_elements_it) );
-        Assert( rel_tc_graph_exps.find( tuple ) != rel_tc_graph_exps.end() );
-        Node exp   = rel_tc_graph_exps.find( tuple )->second;
-
-        reasons.push_back( exp );
-        seen.insert( tc_graph_it->first );
-        doTCInference( tc_rel, reasons, rel_tc_graph, rel_tc_graph_exps, tc_graph_it->first, *snd_elements_it, seen);
+      Node start = tc_graph_it->first;
+      // the node from which each node reachable from start was first reached
+      std::unordered_map< Node, Node, NodeHashFunction > parent;
+      std::vector< Node > frontier;
+      frontier.push_back( start );
+      for( unsigned int i = 0; i < frontier.size(); i++ ) {
+        TC_GRAPH_IT cur_set = rel_tc_graph.find( frontier[i] );
+        if( cur_set == rel_tc_graph.end() ) {
+          continue;
+        }
+        for( const Node& next : cur_set->second ) {
+          if( parent.find( next ) != parent.end() ) {
+            continue;
+          }
+          parent[next] = frontier[i];
+          // collect the explanations of the edges of the path from start to next
+          std::vector< Node > reasons;
+          Node cur = next;
+          do {
+            Node prev = parent[cur];
+            std::map< Node, Node >::iterator exp_it = rel_tc_graph_exps.find( RelsUtils::constructPair( tc_rel, prev, cur ) );
+            Assert( exp_it != rel_tc_graph_exps.end() );
+            reasons.push_back( exp_it->second );
+            cur = prev;
+          } while( cur != start );
+          std::reverse( reasons.begin(), reasons.end() );
+          sendTCInference( tc_rel, reasons );
+          if( next != start ) {
+            frontier.push_back( next );
+          }
+        }
       }
     }
     Trace("rels-debug") << "[Theory::Rels] ****** Done with doTCInference !" << std::endl;
   }
 
-  void TheorySetsRels::doTCInference(Node tc_rel, std::vector< Node > reasons, std::map< Node, std::unordered_set< Node, NodeHashFunction > >& tc_graph,
-                                       std::map< Node, Node >& rel_tc_graph_exps, Node start_node_rep, Node cur_node_rep, std::unordered_set< Node, NodeHashFunction >& seen ) {
+  void TheorySetsRels::sendTCInference( Node tc_rel, const std::vector< Node >& reasons ) {
     Node tc_mem = RelsUtils::constructPair( tc_rel, RelsUtils::nthElementOfTuple((reasons.front())[0], 0), RelsUtils::nthElementOfTuple((reasons.back())[0], 1) );
     std::vector< Node > all_reasons( reasons );
 
@@ -638,22 +656,6 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
     } else {
       sendInfer( NodeManager::currentNM()->mkNode(kind::MEMBER, tc_mem, tc_rel), all_reasons.front(), "TCLOSURE-Forward");
     }
-
-    // check if cur_node has been traversed or not
-    if( seen.find( cur_node_rep ) != seen.end() ) {
-      return;
-    }
-    seen.insert( cur_node_rep );
-    TC_GRAPH_IT  cur_set = tc_graph.find( cur_node_rep );
-    if( cur_set != tc_graph.end() ) {
-      for( std::unordered_set< Node, NodeHashFunction >::iterator set_it = cur_set->second.begin();
-           set_it != cur_set->second.end(); set_it++ ) {
-        Node new_pair = RelsUtils::constructPair( tc_rel, cur_node_rep, *set_it );
-        std::vector< Node > new_reasons( reasons );
-        new_reasons.push_back( rel_tc_graph_exps.find( new_pair )->second );
-        doTCInference( tc_rel, new_reasons, tc_graph, rel_tc_graph_exps, start_node_rep, *set_it, seen );
-      }
-    }
   }
 
  /*  product-split rule:  (a, b) IS_IN (X PRODUCT Y)
@@ -839,6 +841,10 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
   // Bottom-up fashion to compute relations with more than 1 arity
   void TheorySetsRels::computeMembersForBinOpRel(Node rel) {
     Trace("rels-debug") << "\n[Theory::Rels] computeMembersForBinOpRel for relation  " << rel << std::endl;
+    // the members of rel and of its subterms are composed at most once per check
+    if( !d_composed_rels.insert( rel ).second ) {
+      return;
+    }
 
     switch(rel[0].getKind()) {
       case kind::TRANSPOSE:
@@ -867,8 +873,8 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
       default:
         break;
     }
-    if(d_rReps_memberReps_cache.find(getRepresentative(rel[0])) == d_rReps_memberReps_cache.end() ||
-       d_rReps_memberReps_cache.find(getRepresentative(rel[1])) == d_rReps_memberReps_cache.end()) {
+    if(d_rReps_memberReps_exp_cache.find(getRepresentative(rel[0])) == d_rReps_memberReps_exp_cache.end() ||
+       d_rReps_memberReps_exp_cache.find(getRepresentative(rel[1])) == d_rReps_memberReps_exp_cache.end()) {
       return;
     }
     composeMembersForRels(rel);
@@ -892,15 +898,12 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
     }
 
     Node rel0_rep  = getRepresentative(rel[0]);
-    if(d_rReps_memberReps_cache.find( rel0_rep ) == d_rReps_memberReps_cache.end())
+    if(d_rReps_memberReps_exp_cache.find( rel0_rep ) == d_rReps_memberReps_exp_cache.end())
       return;
 
-    std::vector<Node>   members = d_rReps_memberReps_cache[rel0_rep];
     std::vector<Node>   exps    = d_rReps_memberReps_exp_cache[rel0_rep];
 
-    Assert( members.size() == exps.size() );
-
-    for(unsigned int i = 0; i < members.size(); i++) {
+    for(unsigned int i = 0; i < exps.size(); i++) {
       Node reason = exps[i];
       if( rel.getKind() == kind::TRANSPOSE) {
         if( rel[0] != exps[i][1] ) {
@@ -923,61 +926,90 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
     Node r1_rep = getRepresentative( r1 );
     Node r2_rep = getRepresentative( r2 );
 
-    if(d_rReps_memberReps_cache.find( r1_rep ) == d_rReps_memberReps_cache.end() ||
-       d_rReps_memberReps_cache.find( r2_rep ) == d_rReps_memberReps_cache.end() ) {
+    if(d_rReps_memberReps_exp_cache.find( r1_rep ) == d_rReps_memberReps_exp_cache.end() ||
+       d_rReps_memberReps_exp_cache.find( r2_rep ) == d_rReps_memberReps_exp_cache.end() ) {
       return;
     }
 
-    std::vector<Node> r1_rep_exps = d_rReps_memberReps_exp_cache[r1_rep];
-    std::vector<Node> r2_rep_exps = d_rReps_memberReps_exp_cache[r2_rep];
+    const std::vector<Node>& r1_rep_exps = d_rReps_memberReps_exp_cache[r1_rep];
+    const std::vector<Node>& r2_rep_exps = d_rReps_memberReps_exp_cache[r2_rep];
     unsigned int r1_tuple_len = r1.getType().getSetElementType().getTupleLength();
     unsigned int r2_tuple_len = r2.getType().getSetElementType().getTupleLength();
 
-    for( unsigned int i = 0; i < r1_rep_exps.size(); i++ ) {
+    bool isProduct = rel.getKind() == kind::PRODUCT;
+    std::vector< unsigned > all_r2;
+    std::unordered_map< Node, std::vector< unsigned >, NodeHashFunction >* r2_fst = nullptr;
+    if( isProduct ) {
       for( unsigned int j = 0; j < r2_rep_exps.size(); j++ ) {
+        all_r2.push_back( j );
+      }
+    } else {
+      // index the members of r2 by the representative of their first element,
+      // so that the members of r1 are joined only with the matching members of r2
+      r2_fst = &d_rReps_memberIndex[r2_rep].d_fst;
+      if( r2_fst->empty() ) {
+        for( unsigned int j = 0; j < r2_rep_exps.size(); j++ ) {
+          Node r2_lmost = RelsUtils::nthElementOfTuple( r2_rep_exps[j][0], 0 );
+          if( !hasTerm( r2_lmost ) ) {
+            makeSharedTerm( r2_lmost );
+          }
+          (*r2_fst)[getRepresentative( r2_lmost )].push_back( j );
+        }
+      }
+    }
+
+    for( unsigned int i = 0; i < r1_rep_exps.size(); i++ ) {
+      Node r1_rmost = RelsUtils::nthElementOfTuple( r1_rep_exps[i][0], r1_tuple_len-1 );
+      std::vector< unsigned >* r2_matches = &all_r2;
+      if( !isProduct ) {
+        if( !hasTerm( r1_rmost ) ) {
+          makeSharedTerm( r1_rmost );
+        }
+        std::unordered_map< Node, std::vector< unsigned >, NodeHashFunction >::iterator fst_it = r2_fst->find( getRepresentative( r1_rmost ) );
+        if( fst_it == r2_fst->end() ) {
+          continue;
+        }
+        r2_matches = &fst_it->second;
+      }
+      for( unsigned j : *r2_matches ) {
         std::vector<Node> tuple_elements;
         TypeNode tn = rel.getType().getSetElementType();
-        Node r1_rmost = RelsUtils::nthElementOfTuple( r1_rep_exps[i][0], r1_tuple_len-1 );
         Node r2_lmost = RelsUtils::nthElementOfTuple( r2_rep_exps[j][0], 0 );
         tuple_elements.push_back( Node::fromExpr(tn.getDatatype()[0].getConstructor()) );
 
-        if( (areEqual(r1_rmost, r2_lmost) && rel.getKind() == kind::JOIN) ||
-            rel.getKind() == kind::PRODUCT ) {
-          bool isProduct = rel.getKind() == kind::PRODUCT;
-          unsigned int k = 0;
-          unsigned int l = 1;
+        unsigned int k = 0;
+        unsigned int l = 1;
 
-          for( ; k < r1_tuple_len - 1; ++k ) {
-            tuple_elements.push_back( RelsUtils::nthElementOfTuple( r1_rep_exps[i][0], k ) );
-          }
-          if(isProduct) {
-            tuple_elements.push_back( RelsUtils::nthElementOfTuple( r1_rep_exps[i][0], k ) );
-            tuple_elements.push_back( RelsUtils::nthElementOfTuple( r2_rep_exps[j][0], 0 ) );
-          }
-          for( ; l < r2_tuple_len; ++l ) {
-            tuple_elements.push_back( RelsUtils::nthElementOfTuple( r2_rep_exps[j][0], l ) );
-          }
+        for( ; k < r1_tuple_len - 1; ++k ) {
+          tuple_elements.push_back( RelsUtils::nthElementOfTuple( r1_rep_exps[i][0], k ) );
+        }
+        if(isProduct) {
+          tuple_elements.push_back( RelsUtils::nthElementOfTuple( r1_rep_exps[i][0], k ) );
+          tuple_elements.push_back( RelsUtils::nthElementOfTuple( r2_rep_exps[j][0], 0 ) );
+        }
+        for( ; l < r2_tuple_len; ++l ) {
+          tuple_elements.push_back( RelsUtils::nthElementOfTuple( r2_rep_exps[j][0], l ) );
+        }
 
-          Node composed_tuple = NodeManager::currentNM()->mkNode(kind::APPLY_CONSTRUCTOR, tuple_elements);
-          Node fact = NodeManager::currentNM()->mkNode(kind::MEMBER, composed_tuple, rel);
-          std::vector<Node> reasons;
-          reasons.push_back( r1_rep_exps[i] );
-          reasons.push_back( r2_rep_exps[j] );
+        Node composed_tuple = NodeManager::currentNM()->mkNode(kind::APPLY_CONSTRUCTOR, tuple_elements);
+        Node fact = NodeManager::currentNM()->mkNode(kind::MEMBER, composed_tuple, rel);
+        std::vector<Node> reasons;
+        reasons.push_back( r1_rep_exps[i] );
+        reasons.push_back( r2_rep_exps[j] );
 
-          if( r1 != r1_rep_exps[i][1] ) {
-            reasons.push_back( NodeManager::currentNM()->mkNode(kind::EQUAL, r1, r1_rep_exps[i][1]) );
-          }
-          if( r2 != r2_rep_exps[j][1] ) {
-            reasons.push_back( NodeManager::currentNM()->mkNode(kind::EQUAL, r2, r2_rep_exps[j][1]) );
-          }
-          if( isProduct ) {
-            sendInfer( fact, NodeManager::currentNM()->mkNode(kind::AND, reasons), "PRODUCT-Compose" );
-          } else {
-            if( r1_rmost != r2_lmost ) {
-              reasons.push_back( NodeManager::currentNM()->mkNode(kind::EQUAL, r1_rmost, r2_lmost) );
-            }
-            sendInfer( fact, NodeManager::currentNM()->mkNode(kind::AND, reasons), "JOIN-Compose" );
+        if( r1 != r1_rep_exps[i][1] ) {
+          reasons.push_back( NodeManager::currentNM()->mkNode(kind::EQUAL, r1, r1_rep_exps[i][1]) );
+        }
+        if( r2 != r2_rep_exps[j][1] ) {
+          reasons.push_back( NodeManager::currentNM()->mkNode(kind::EQUAL, r2, r2_rep_exps[j][1]) );
+        }
+        if( isProduct ) {
+          sendInfer( fact, NodeManager::currentNM()->mkNode(kind::AND, reasons), "PRODUCT-Compose" );
+        } else {
+          if( r1_rmost != r2_lmost ) {
+            reasons.push_back( NodeManager::currentNM()->mkNode(kind::EQUAL, r1_rmost, r2_lmost) );
           }
+          sendInfer( fact, NodeManager::currentNM()->mkNode(kind::AND, reasons), "JOIN-Compose" );
         }
       }
     }
@@ -1025,7 +1057,8 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
     d_membership_trie.clear();
     d_rel_nodes.clear();
     d_pending_facts.clear();
-    d_rReps_memberReps_cache.clear();
+    d_rReps_memberIndex.clear();
+    d_composed_rels.clear();
     d_rRep_tcGraph.clear();
     d_tcr_tcGraph_exps.clear();
     d_tcr_tcGraph.clear();
@@ -1114,30 +1147,6 @@ typedef std::map< Node, std::map< Node, std::unordered_set< Node, NodeHashFuncti
     return false;
   }
 
-  /*
-   * Make sure duplicate members are not added in map
-   */
-  bool TheorySetsRels::safelyAddToMap(std::map< Node, std::vector<Node> >& map, Node rel_rep, Node member) {
-    std::map< Node, std::vector< Node > >::iterator mem_it = map.find(rel_rep);
-    if(mem_it == map.end()) {
-      std::vector<Node> members;
-      members.push_back(member);
-      map[rel_rep] = members;
-      return true;
-    } else {
-      std::vector<Node>::iterator mems = mem_it->second.begin();
-      while(mems != mem_it->second.end()) {
-        if(areEqual(*mems, member)) {
-          return false;
-        }
-        mems++;
-      }
-      map[rel_rep].push_back(member);
-      return true;
-    }
-    return false;
-  }
-
   void TheorySetsRels::addToMap(std::map< Node, std::vector<Node> >& map, Node rel_rep, Node member) {
     if(map.find(rel_rep) == map.end()) {
       std::vector<Node> members;
@@ -17,6 +17,7 @@
 #ifndef SRC_THEORY_SETS_THEORY_SETS_RELS_H_
 #define SRC_THEORY_SETS_THEORY_SETS_RELS_H_
 
+#include <unordered_map>
 #include <unordered_set>
 
 #include "context/cdhashset.h"
@@ -111,12 +112,30 @@ private:
   /** Symbolic tuple variables that has been reduced to concrete ones */
   std::unordered_set< Node, NodeHashFunction >       d_symbolic_tuples;
 
-  /** Mapping between relation and its member representatives */
-  std::map< Node, std::vector< Node > >           d_rReps_memberReps_cache;
-
-  /** Mapping between relation and its member representatives explanation */
+  /** Mapping between relation representative and the explanations of its
+   * members, one (x IS_IN R) per member representative. The member
+   * representative of an explanation is the representative of x, since the
+   * equality engine does not change during a check.
+   */
   std::map< Node, std::vector< Node > >           d_rReps_memberReps_exp_cache;
 
+  /** Hash indices over the members of a relation representative
+   * d_members is the set of the member representatives of the relation,
+   * d_fst maps the representative of the first element of each member to the
+   * positions of that member in d_rReps_memberReps_exp_cache, and is computed
+   * on demand when the relation is the right argument of a join.
+   */
+  class MemberIndex
+  {
+  public:
+    std::unordered_set< Node, NodeHashFunction > d_members;
+    std::unordered_map< Node, std::vector< unsigned >, NodeHashFunction > d_fst;
+  };
+  std::map< Node, MemberIndex >                   d_rReps_memberIndex;
+
+  /** The JOIN and PRODUCT terms whose members have been composed in this check */
+  std::unordered_set< Node, NodeHashFunction >       d_composed_rels;
+
   /** Mapping between a relation representative and its equivalent relations involving relational operators */
   std::map< Node, std::map<kind::Kind_t, std::vector<Node> > >                  d_terms_cache;
 
@@ -155,9 +174,15 @@ private:
   void applyTCRule( Node mem, Node rel, Node rel_rep, Node exp);
   void buildTCGraphForRel( Node tc_rel );
   void doTCInference();
-  void doTCInference( std::map< Node, std::unordered_set<Node, NodeHashFunction> > rel_tc_graph, std::map< Node, Node > rel_tc_graph_exps, Node tc_rel );
-  void doTCInference(Node tc_rel, std::vector< Node > reasons, std::map< Node, std::unordered_set< Node, NodeHashFunction > >& tc_graph,
-                       std::map< Node, Node >& rel_tc_graph_exps, Node start_node_rep, Node cur_node_rep, std::unordered_set< Node, NodeHashFunction >& seen );
+  /** Infer the members of tc_rel given by the paths of graph rel_tc_graph
+   *
+   * This computes the nodes reachable from each node of the graph by a
+   * breadth-first search, so that each pair of nodes is inferred once, with
+   * the explanation of a shortest path between them.
+   */
+  void doTCInference( std::map< Node, std::unordered_set<Node, NodeHashFunction> >& rel_tc_graph, std::map< Node, Node >& rel_tc_graph_exps, Node tc_rel );
+  /** Infer that the pair of the ends of the path explained by reasons is in tc_rel */
+  void sendTCInference( Node tc_rel, const std::vector< Node >& reasons );
 
   void composeMembersForRels( Node );
   void computeMembersForBinOpRel( Node );
@@ -190,7 +215,6 @@ private:
   void printNodeMap(char* fst, char* snd, NodeMap map);
   inline Node constructPair(Node tc_rep, Node a, Node b);
   void addToMap( std::map< Node, std::vector<Node> >&, Node, Node );
-  bool safelyAddToMap( std::map< Node, std::vector<Node> >&, Node, Node );
   bool isRel( Node n ) {return n.getType().isSet() && n.getType().getSetElementType().isTuple();}
 };
 
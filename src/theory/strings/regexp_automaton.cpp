@@ -0,0 +1,586 @@
+/*********************                                                        */
+/*! \file regexp_automaton.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Andrew Reynolds
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Implementation of automata for constant regular expressions
+ **/
+
+#include "theory/strings/regexp_automaton.h"
+
+#include <algorithm>
+#include <limits>
+#include <set>
+
+#include "expr/attribute.h"
+
+using namespace CVC4::kind;
+
+namespace CVC4 {
+namespace theory {
+namespace strings {
+
+/** Attribute storing the automaton of a constant regular expression */
+struct RegExpAutomatonAttributeId
+{
+};
+typedef expr::ManagedAttribute<RegExpAutomatonAttributeId, RegExpAutomaton*>
+    RegExpAutomatonAttribute;
+
+const unsigned RegExpAutomaton::s_unknown =
+    std::numeric_limits<unsigned>::max();
+const unsigned RegExpAutomaton::s_maxStates = 1 << 16;
+const unsigned RegExpAutomaton::s_maxDetStates = 1 << 12;
+const unsigned RegExpAutomaton::s_maxProductStates = 1 << 14;
+
+RegExpAutomaton::RegExpAutomaton(Node r)
+    : d_valid(false), d_numClasses(0), d_detStart(0), d_detDead(0)
+{
+  computeClasses(r);
+  d_valid = compile(r, d_root);
+  if (d_valid)
+  {
+    resetDetStates();
+  }
+  else
+  {
+    d_states.clear();
+  }
+  Trace("regexp-automaton") << "Automaton for " << r << " : valid=" << d_valid
+                            << ", states=" << d_states.size()
+                            << ", classes=" << d_numClasses << std::endl;
+}
+
+RegExpAutomaton* RegExpAutomaton::get(Node r)
+{
+  RegExpAutomaton* a = nullptr;
+  if (!r.getAttribute(RegExpAutomatonAttribute(), a))
+  {
+    a = new RegExpAutomaton(r);
+    r.setAttribute(RegExpAutomatonAttribute(), a);
+  }
+  return a;
+}
+
+void RegExpAutomaton::computeClasses(Node r)
+{
+  unsigned nchars = String::num_codes();
+  // bounds[c] is true if a class starts at character c
+  std::vector<bool> bounds(nchars + 1, false);
+  bounds[0] = true;
+  collectBoundaries(r, bounds);
+  d_class.resize(nchars);
+  d_numClasses = 0;
+  for (unsigned c = 0; c < nchars; c++)
+  {
+    if (bounds[c])
+    {
+      d_numClasses++;
+    }
+    d_class[c] = d_numClasses - 1;
+  }
+}
+
+void RegExpAutomaton::collectBoundaries(Node r, std::vector<bool>& bounds)
+{
+  Kind k = r.getKind();
+  if (k == STRING_TO_REGEXP)
+  {
+    if (r[0].getKind() == CONST_STRING)
+    {
+      const String& s = r[0].getConst<String>();
+      for (size_t i = 0, size = s.size(); i < size; i++)
+      {
+        unsigned char c = String::convertUnsignedIntToChar(s[i]);
+        bounds[c] = true;
+        bounds[c + 1] = true;
+      }
+    }
+  }
+  else if (k == REGEXP_RANGE)
+  {
+    unsigned char a = r[0].getConst<String>().getFirstChar();
+    unsigned char b = r[1].getConst<String>().getFirstChar();
+    if (a <= b)
+    {
+      bounds[a] = true;
+      bounds[b + 1] = true;
+    }
+  }
+  else if (r.getType().isRegExp())
+  {
+    for (const Node& rc : r)
+    {
+      collectBoundaries(rc, bounds);
+    }
+  }
+}
+
+bool RegExpAutomaton::mkState(unsigned& s)
+{
+  if (d_states.size() >= s_maxStates)
+  {
+    return false;
+  }
+  s = d_states.size();
+  d_states.push_back(State());
+  return true;
+}
+
+bool RegExpAutomaton::compile(Node r, Fragment& f)
+{
+  Kind k = r.getKind();
+  if (k == REGEXP_INTER)
+  {
+    if (!compile(r[0], f))
+    {
+      return false;
+    }
+    for (unsigned i = 1, nchild = r.getNumChildren(); i < nchild; i++)
+    {
+      Fragment fc, fp;
+      if (!compile(r[i], fc) || !compileProduct(f, fc, fp))
+      {
+        return false;
+      }
+      f = fp;
+    }
+    return true;
+  }
+  if (!mkState(f.first) || !mkState(f.second))
+  {
+    return false;
+  }
+  switch (k)
+  {
+    case STRING_TO_REGEXP:
+    {
+      if (r[0].getKind() != CONST_STRING)
+      {
+        return false;
+      }
+      unsigned curr = f.first;
+      const String& s = r[0].getConst<String>();
+      for (size_t i = 0, size = s.size(); i < size; i++)
+      {
+        unsigned c = d_class[String::convertUnsignedIntToChar(s[i])];
+        unsigned next;
+        if (!mkState(next))
+        {
+          return false;
+        }
+        d_states[curr].d_edges.push_back(Edge(c, c, next));
+        curr = next;
+      }
+      d_states[curr].d_eps.push_back(f.second);
+      return true;
+    }
+    case REGEXP_CONCAT:
+    {
+      unsigned curr = f.first;
+      for (const Node& rc : r)
+      {
+        Fragment fc;
+        if (!compile(rc, fc))
+        {
+          return false;
+        }
+        d_states[curr].d_eps.push_back(fc.first);
+        curr = fc.second;
+      }
+      d_states[curr].d_eps.push_back(f.second);
+      return true;
+    }
+    case REGEXP_UNION:
+    {
+      for (const Node& rc : r)
+      {
+        Fragment fc;
+        if (!compile(rc, fc))
+        {
+          return false;
+        }
+        d_states[f.first].d_eps.push_back(fc.first);
+        d_states[fc.second].d_eps.push_back(f.second);
+      }
+      return true;
+    }
+    case REGEXP_STAR:
+    case REGEXP_PLUS:
+    case REGEXP_OPT:
+    {
+      Fragment fc;
+      if (!compile(r[0], fc))
+      {
+        return false;
+      }
+      d_states[f.first].d_eps.push_back(fc.first);
+      d_states[fc.second].d_eps.push_back(f.second);
+      if (k != REGEXP_PLUS)
+      {
+        d_states[f.first].d_eps.push_back(f.second);
+      }
+      if (k != REGEXP_OPT)
+      {
+        d_states[fc.second].d_eps.push_back(fc.first);
+      }
+      return true;
+    }
+    case REGEXP_EMPTY: return true;
+    case REGEXP_SIGMA:
+    {
+      d_states[f.first].d_edges.push_back(
+          Edge(0, d_numClasses - 1, f.second));
+      return true;
+    }
+    case REGEXP_RANGE:
+    {
+      unsigned char a = r[0].getConst<String>().getFirstChar();
+      unsigned char b = r[1].getConst<String>().getFirstChar();
+      if (a <= b)
+      {
+        d_states[f.first].d_edges.push_back(
+            Edge(d_class[a], d_class[b], f.second));
+      }
+      return true;
+    }
+    case REGEXP_LOOP:
+    {
+      // r{l,u} is compiled as l copies of r followed by u-l optional copies
+      // of r, and r{l} is compiled as l copies of r followed by r*
+      const Rational& rl = r[1].getConst<Rational>();
+      if (rl.sgn() < 0 || rl > Rational(s_maxStates))
+      {
+        return false;
+      }
+      unsigned l = rl.getNumerator().toUnsignedInt();
+      unsigned u = l;
+      if (r.getNumChildren() == 3)
+      {
+        const Rational& ru = r[2].getConst<Rational>();
+        if (ru < rl || ru > Rational(s_maxStates))
+        {
+          return false;
+        }
+        u = ru.getNumerator().toUnsignedInt();
+      }
+      unsigned curr = f.first;
+      for (unsigned i = 0; i < u || (i == u && r.getNumChildren() == 2); i++)
+      {
+        Fragment fc;
+        if (!compile(r[0], fc))
+        {
+          return false;
+        }
+        d_states[curr].d_eps.push_back(fc.first);
+        if (i >= l)
+        {
+          // optional copy, or the star of the unbounded loop
+          d_states[curr].d_eps.push_back(f.second);
+          if (r.getNumChildren() == 2)
+          {
+            d_states[fc.second].d_eps.push_back(fc.first);
+          }
+        }
+        curr = fc.second;
+      }
+      d_states[curr].d_eps.push_back(f.second);
+      return true;
+    }
+    default:
+      Trace("regexp-automaton") << "Unsupported kind " << k << std::endl;
+      return false;
+  }
+}
+
+bool RegExpAutomaton::compileProduct(const Fragment& f1,
+                                     const Fragment& f2,
+                                     Fragment& f)
+{
+  std::map<std::pair<unsigned, unsigned>, unsigned> ids;
+  std::vector<std::pair<unsigned, unsigned> > toProcess;
+  // the state for pair p, which is added to toProcess if it is new
+  auto getId = [&](const std::pair<unsigned, unsigned>& p, unsigned& s) {
+    std::map<std::pair<unsigned, unsigned>, unsigned>::iterator it =
+        ids.find(p);
+    if (it != ids.end())
+    {
+      s = it->second;
+      return true;
+    }
+    if (!mkState(s))
+    {
+      return false;
+    }
+    ids[p] = s;
+    toProcess.push_back(p);
+    return true;
+  };
+  if (!getId(std::make_pair(f1.first, f2.first), f.first)
+      || !getId(std::make_pair(f1.second, f2.second), f.second))
+  {
+    return false;
+  }
+  while (!toProcess.empty())
+  {
+    std::pair<unsigned, unsigned> p = toProcess.back();
+    toProcess.pop_back();
+    unsigned s = ids[p];
+    // copy the states, since d_states may be resized below
+    State s1 = d_states[p.first];
+    State s2 = d_states[p.second];
+    unsigned t;
+    for (unsigned e : s1.d_eps)
+    {
+      if (!getId(std::make_pair(e, p.second), t))
+      {
+        return false;
+      }
+      d_states[s].d_eps.push_back(t);
+    }
+    for (unsigned e : s2.d_eps)
+    {
+      if (!getId(std::make_pair(p.first, e), t))
+      {
+        return false;
+      }
+      d_states[s].d_eps.push_back(t);
+    }
+    for (const Edge& e1 : s1.d_edges)
+    {
+      for (const Edge& e2 : s2.d_edges)
+      {
+        unsigned lo = std::max(e1.d_lo, e2.d_lo);
+        unsigned hi = std::min(e1.d_hi, e2.d_hi);
+        if (lo <= hi)
+        {
+          if (!getId(std::make_pair(e1.d_target, e2.d_target), t))
+          {
+            return false;
+          }
+          d_states[s].d_edges.push_back(Edge(lo, hi, t));
+        }
+      }
+    }
+  }
+  return true;
+}
+
+void RegExpAutomaton::closure(std::vector<unsigned>& ss) const
+{
+  std::vector<bool> visited(d_states.size(), false);
+  std::vector<unsigned> toVisit = ss;
+  ss.clear();
+  while (!toVisit.empty())
+  {
+    unsigned s = toVisit.back();
+    toVisit.pop_back();
+    if (!visited[s])
+    {
+      visited[s] = true;
+      ss.push_back(s);
+      toVisit.insert(toVisit.end(),
+                     d_states[s].d_eps.begin(),
+                     d_states[s].d_eps.end());
+    }
+  }
+  std::sort(ss.begin(), ss.end());
+}
+
+void RegExpAutomaton::resetDetStates()
+{
+  d_detStates.clear();
+  d_detFinal.clear();
+  d_detIds.clear();
+  d_detSucc.clear();
+  std::vector<unsigned> ss;
+  d_detDead = getDetState(ss);
+  ss.push_back(d_root.first);
+  closure(ss);
+  d_detStart = getDetState(ss);
+}
+
+unsigned RegExpAutomaton::getDetState(std::vector<unsigned>& ss)
+{
+  std::map<std::vector<unsigned>, unsigned>::iterator it = d_detIds.find(ss);
+  if (it != d_detIds.end())
+  {
+    return it->second;
+  }
+  unsigned ds = d_detStates.size();
+  d_detIds[ss] = ds;
+  d_detFinal.push_back(std::binary_search(ss.begin(), ss.end(), d_root.second));
+  d_detStates.push_back(ss);
+  d_detSucc.resize(d_detSucc.size() + d_numClasses, s_unknown);
+  return ds;
+}
+
+unsigned RegExpAutomaton::getDetSuccessor(unsigned ds, unsigned c)
+{
+  unsigned index = ds * d_numClasses + c;
+  if (d_detSucc[index] != s_unknown)
+  {
+    return d_detSucc[index];
+  }
+  std::vector<unsigned> ss;
+  for (unsigned s : d_detStates[ds])
+  {
+    for (const Edge& e : d_states[s].d_edges)
+    {
+      if (e.d_lo <= c && c <= e.d_hi)
+      {
+        ss.push_back(e.d_target);
+      }
+    }
+  }
+  closure(ss);
+  // d_detSucc may be resized by getDetState
+  unsigned ret = getDetState(ss);
+  d_detSucc[index] = ret;
+  return ret;
+}
+
+bool RegExpAutomaton::accepts(const String& s)
+{
+  Assert(d_valid);
+  unsigned ds = d_detStart;
+  for (size_t i = 0, size = s.size(); i < size; i++)
+  {
+    if (ds == d_detDead)
+    {
+      return false;
+    }
+    if (d_detStates.size() >= s_maxDetStates)
+    {
+      std::vector<unsigned> ss = d_detStates[ds];
+      resetDetStates();
+      ds = getDetState(ss);
+    }
+    ds = getDetSuccessor(ds, d_class[String::convertUnsignedIntToChar(s[i])]);
+  }
+  return d_detFinal[ds];
+}
+
+bool RegExpAutomaton::isEmpty() const
+{
+  Assert(d_valid);
+  // every class is non-empty, so the language is empty if and only if the
+  // final state is unreachable
+  std::vector<bool> visited(d_states.size(), false);
+  std::vector<unsigned> toVisit;
+  toVisit.push_back(d_root.first);
+  while (!toVisit.empty())
+  {
+    unsigned s = toVisit.back();
+    toVisit.pop_back();
+    if (s == d_root.second)
+    {
+      return false;
+    }
+    if (!visited[s])
+    {
+      visited[s] = true;
+      toVisit.insert(toVisit.end(),
+                     d_states[s].d_eps.begin(),
+                     d_states[s].d_eps.end());
+      for (const Edge& e : d_states[s].d_edges)
+      {
+        toVisit.push_back(e.d_target);
+      }
+    }
+  }
+  return true;
+}
+
+int RegExpAutomaton::isEmptyIntersection(
+    const std::vector<RegExpAutomaton*>& pos,
+    const std::vector<RegExpAutomaton*>& neg,
+    unsigned char lastChar)
+{
+  std::vector<RegExpAutomaton*> autos(pos.begin(), pos.end());
+  autos.insert(autos.end(), neg.begin(), neg.end());
+  size_t npos = pos.size();
+  // one representative character for each combination of classes
+  std::vector<unsigned> reps;
+  std::set<std::vector<unsigned> > combs;
+  for (unsigned c = 0; c <= lastChar; c++)
+  {
+    std::vector<unsigned> comb;
+    for (RegExpAutomaton* a : autos)
+    {
+      Assert(a->isValid());
+      comb.push_back(a->d_class[c]);
+    }
+    if (combs.insert(comb).second)
+    {
+      reps.push_back(c);
+    }
+  }
+  std::vector<unsigned> start;
+  for (RegExpAutomaton* a : autos)
+  {
+    start.push_back(a->d_detStart);
+  }
+  std::set<std::vector<unsigned> > visited;
+  std::vector<std::vector<unsigned> > toVisit;
+  toVisit.push_back(start);
+  while (!toVisit.empty())
+  {
+    std::vector<unsigned> t = toVisit.back();
+    toVisit.pop_back();
+    if (!visited.insert(t).second)
+    {
+      continue;
+    }
+    if (visited.size() > s_maxProductStates)
+    {
+      return -1;
+    }
+    bool isFinal = true;
+    for (size_t i = 0, nautos = autos.size(); i < nautos && isFinal; i++)
+    {
+      isFinal = autos[i]->d_detFinal[t[i]] == (i < npos);
+    }
+    if (isFinal)
+    {
+      Trace("regexp-automaton") << "...product is non-empty, visited "
+                                << visited.size() << " states" << std::endl;
+      return 0;
+    }
+    for (unsigned c : reps)
+    {
+      std::vector<unsigned> succ;
+      bool isDead = false;
+      for (size_t i = 0, nautos = autos.size(); i < nautos && !isDead; i++)
+      {
+        RegExpAutomaton* a = autos[i];
+        // the deterministic states may not be flushed during the exploration
+        if (a->d_detStates.size() >= s_maxDetStates)
+        {
+          return -1;
+        }
+        unsigned ds = a->getDetSuccessor(t[i], a->d_class[c]);
+        // no word is accepted from a dead state of a positive automaton
+        isDead = i < npos && ds == a->d_detDead;
+        succ.push_back(ds);
+      }
+      if (!isDead)
+      {
+        toVisit.push_back(succ);
+      }
+    }
+  }
+  Trace("regexp-automaton") << "...product is empty, visited "
+                            << visited.size() << " states" << std::endl;
+  return 1;
+}
+
+}/* CVC4::theory::strings namespace */
+}/* CVC4::theory namespace */
+}/* CVC4 namespace */
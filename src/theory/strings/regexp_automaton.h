@@ -0,0 +1,173 @@
+/*********************                                                        */
+/*! \file regexp_automaton.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Andrew Reynolds
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Automata for constant regular expressions
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__THEORY__STRINGS__REGEXP_AUTOMATON_H
+#define __CVC4__THEORY__STRINGS__REGEXP_AUTOMATON_H
+
+#include <map>
+#include <vector>
+
+#include "expr/node.h"
+#include "util/regexp.h"
+
+namespace CVC4 {
+namespace theory {
+namespace strings {
+
+/** Automaton for a constant regular expression
+ *
+ * This class compiles a constant regular expression r, that is, one for which
+ * TheoryStringsRewriter::isConstRegExp holds, into a non-deterministic
+ * automaton with epsilon transitions (a Thompson construction), where
+ * intersections are compiled as products of the automata of their children
+ * and loops are unrolled.
+ *
+ * The characters are grouped into classes, where two characters are in the
+ * same class if no character range or literal character of r distinguishes
+ * them. The transitions of the automaton are labelled by intervals of classes.
+ *
+ * The automaton is determinized lazily by the subset construction: a
+ * deterministic state, that is, a set of states of the above automaton, and
+ * its successor for a class are computed the first time they are needed when
+ * testing membership, and are cached for subsequent tests.
+ *
+ * Automata are owned by their regular expression, see get below, so that a
+ * regular expression is compiled at most once.
+ */
+class RegExpAutomaton
+{
+ public:
+  RegExpAutomaton(Node r);
+  ~RegExpAutomaton() {}
+  /**
+   * Get the automaton for constant regular expression r, which is constructed
+   * on the first call for r, and deleted when r is.
+   */
+  static RegExpAutomaton* get(Node r);
+  /**
+   * Was the construction of this automaton successful? This is false if r
+   * contains a kind not handled by this class, or if the automaton for r
+   * exceeds the maximum number of states.
+   */
+  bool isValid() const { return d_valid; }
+  /** Is s in the language of r? This automaton must be valid. */
+  bool accepts(const String& s);
+  /** Is the language of r empty? This automaton must be valid. */
+  bool isEmpty() const;
+  /** Get the number of classes of characters */
+  unsigned getNumClasses() const { return d_numClasses; }
+  /** is empty intersection
+   *
+   * Returns 1 if the intersection of the languages of the automata in pos and
+   * of the complements of the languages of the automata in neg is empty, 0 if
+   * it is non-empty, and -1 if this could not be determined. The automata
+   * must be valid, and the alphabet is restricted to the characters whose
+   * code is at most lastChar.
+   *
+   * This explores the product of the deterministic automata of pos and neg
+   * on the fly from the tuple of their start states, where the successors of
+   * the states of each automaton are memoized as for accepts. The product is
+   * non-empty if a tuple is reachable whose states are final for all automata
+   * in pos and for no automaton in neg. The result is unknown if the
+   * number of tuples or of deterministic states of an automaton exceeds its
+   * limit.
+   */
+  static int isEmptyIntersection(const std::vector<RegExpAutomaton*>& pos,
+                                 const std::vector<RegExpAutomaton*>& neg,
+                                 unsigned char lastChar);
+
+ private:
+  /** A transition on the classes of characters in [d_lo, d_hi] */
+  struct Edge
+  {
+    Edge(unsigned lo, unsigned hi, unsigned target)
+        : d_lo(lo), d_hi(hi), d_target(target)
+    {
+    }
+    unsigned d_lo;
+    unsigned d_hi;
+    unsigned d_target;
+  };
+  /** A state of the non-deterministic automaton */
+  struct State
+  {
+    std::vector<Edge> d_edges;
+    std::vector<unsigned> d_eps;
+  };
+  /** The start and final state of the automaton of a subterm of r */
+  typedef std::pair<unsigned, unsigned> Fragment;
+  /** Compute the classes of characters of r */
+  void computeClasses(Node r);
+  /** Collect the boundaries of the classes of characters for r */
+  void collectBoundaries(Node r, std::vector<bool>& bounds);
+  /** Make a new state, returns false if the maximum number was exceeded */
+  bool mkState(unsigned& s);
+  /** Compile r, returns false if this failed */
+  bool compile(Node r, Fragment& f);
+  /** Compile the intersection of the automata of f1 and f2 into f */
+  bool compileProduct(const Fragment& f1, const Fragment& f2, Fragment& f);
+  /** Add the epsilon closure of the states in ss to ss, and sort it */
+  void closure(std::vector<unsigned>& ss) const;
+  /** Clear the deterministic states, except the start and dead states */
+  void resetDetStates();
+  /** Get the deterministic state for the closed set of states ss */
+  unsigned getDetState(std::vector<unsigned>& ss);
+  /** Get the successor of deterministic state ds for class c */
+  unsigned getDetSuccessor(unsigned ds, unsigned c);
+  /** Whether the construction was successful */
+  bool d_valid;
+  /** The class of each character */
+  std::vector<unsigned> d_class;
+  /** The number of classes of characters */
+  unsigned d_numClasses;
+  /** The states of the non-deterministic automaton */
+  std::vector<State> d_states;
+  /** The automaton for r */
+  Fragment d_root;
+  /** The deterministic states, as closed sets of states */
+  std::vector<std::vector<unsigned> > d_detStates;
+  /** Whether each deterministic state contains the final state */
+  std::vector<bool> d_detFinal;
+  /** The deterministic state for each closed set of states */
+  std::map<std::vector<unsigned>, unsigned> d_detIds;
+  /**
+   * The successors of the deterministic states, where the successor of ds
+   * for class c is stored at ds * d_numClasses + c, or is s_unknown if it has
+   * not been computed.
+   */
+  std::vector<unsigned> d_detSucc;
+  /** The deterministic state for the closure of the start state */
+  unsigned d_detStart;
+  /** The deterministic state for the empty set of states */
+  unsigned d_detDead;
+  /** Marks a successor that has not been computed */
+  static const unsigned s_unknown;
+  /** The maximum number of states of the non-deterministic automaton */
+  static const unsigned s_maxStates;
+  /**
+   * The maximum number of deterministic states, after which the cache of
+   * deterministic states is flushed.
+   */
+  static const unsigned s_maxDetStates;
+  /** The maximum number of tuples explored by isEmptyIntersection */
+  static const unsigned s_maxProductStates;
+};
+
+}/* CVC4::theory::strings namespace */
+}/* CVC4::theory namespace */
+}/* CVC4 namespace */
+
+#endif /* __CVC4__THEORY__STRINGS__REGEXP_AUTOMATON_H */
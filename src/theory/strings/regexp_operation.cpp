@@ -18,6 +18,7 @@
 
 #include "expr/kind.h"
 #include "options/strings_options.h"
+#include "theory/strings/regexp_automaton.h"
 
 namespace CVC4 {
 namespace theory {
@@ -1328,14 +1329,20 @@ void RegExpOpr::getCharSet( Node r, std::set<unsigned char> &pcset, SetNodes &pv
         Node st = Rewriter::rewrite(r[0]);
         if(st.isConst()) {
           CVC4::String s = st.getConst< CVC4::String >();
-          cset.insert(s.getVec().begin(), s.getVec().end());
+          for (unsigned k = 0, size = s.size(); k < size; k++)
+          {
+            cset.insert(s[k]);
+          }
         } else if(st.getKind() == kind::VARIABLE) {
           vset.insert( st );
         } else {
           for(unsigned i=0; i<st.getNumChildren(); i++) {
             if(st[i].isConst()) {
               CVC4::String s = st[i].getConst< CVC4::String >();
-              cset.insert(s.getVec().begin(), s.getVec().end());
+              for (unsigned k = 0, size = s.size(); k < size; k++)
+              {
+                cset.insert(s[k]);
+              }
             } else {
               vset.insert( st[i] );
             }
@@ -1734,6 +1741,54 @@ Node RegExpOpr::intersect(Node r1, Node r2, bool &spflag) {
   }
 }
 
+int RegExpOpr::checkEmptyIntersection(const std::vector<Node>& pos,
+                                      const std::vector<Node>& neg)
+{
+  std::pair<std::vector<Node>, std::vector<Node> > key(pos, neg);
+  std::map<std::pair<std::vector<Node>, std::vector<Node> >, int>::iterator it =
+      d_empty_inter_cache.find(key);
+  if (it != d_empty_inter_cache.end())
+  {
+    return it->second;
+  }
+  int ret = -1;
+  std::vector<RegExpAutomaton*> apos;
+  std::vector<RegExpAutomaton*> aneg;
+  bool success = true;
+  for (unsigned p = 0; p < 2 && success; p++)
+  {
+    const std::vector<Node>& rs = p == 0 ? pos : neg;
+    for (unsigned i = 0, size = rs.size(); i < size && success; i++)
+    {
+      Assert(checkConstRegExp(rs[i]));
+      RegExpAutomaton* a = RegExpAutomaton::get(rs[i]);
+      success = a->isValid();
+      (p == 0 ? apos : aneg).push_back(a);
+    }
+  }
+  if (success)
+  {
+    // a positive regular expression with an empty language makes the
+    // intersection empty, without exploring the product
+    for (RegExpAutomaton* a : apos)
+    {
+      if (a->isEmpty())
+      {
+        Trace("regexp-intersect") << "...positive regular expression is empty"
+                                  << std::endl;
+        d_empty_inter_cache[key] = 1;
+        return 1;
+      }
+    }
+    Trace("regexp-intersect") << "Check empty intersection of " << pos.size()
+                              << " positive and " << neg.size()
+                              << " negative regular expressions" << std::endl;
+    ret = RegExpAutomaton::isEmptyIntersection(apos, aneg, d_lastchar);
+  }
+  d_empty_inter_cache[key] = ret;
+  return ret;
+}
+
 Node RegExpOpr::complement(Node r, int &ret) {
   Node rNode;
   ret = 1;
@@ -67,6 +67,7 @@ private:
   std::map< Node, Node > d_rm_inter_cache;
   std::map< Node, bool > d_norv_cache;
   std::map< Node, std::vector< PairNodes > > d_split_cache;
+  std::map< std::pair< std::vector< Node >, std::vector< Node > >, int > d_empty_inter_cache;
   //bool checkStarPlus( Node t );
   void simplifyPRegExp( Node s, Node r, std::vector< Node > &new_nodes );
   void simplifyNRegExp( Node s, Node r, std::vector< Node > &new_nodes );
@@ -108,6 +109,17 @@ public:
   Node derivativeSingle( Node r, CVC4::String c );
   bool guessLength( Node r, int &co );
   Node intersect(Node r1, Node r2, bool &spflag);
+  /** check empty intersection
+   *
+   * Returns 1 if the intersection of the constant regular expressions in pos
+   * and of the complements of the constant regular expressions in neg is
+   * empty, 0 if it is non-empty and -1 if this is unknown. This is decided on
+   * the product of the automata of the regular expressions, see
+   * RegExpAutomaton::isEmptyIntersection, without unfolding them. The product
+   * is not explored if the language of a regular expression in pos is empty.
+   */
+  int checkEmptyIntersection(const std::vector<Node>& pos,
+                             const std::vector<Node>& neg);
   Node complement(Node r, int &ret);
   void splitRegExp(Node r, std::vector< PairNodes > &pset);
   void flattenRegExp(Node r, std::vector< std::pair< CVC4::String, unsigned > > &fvec);
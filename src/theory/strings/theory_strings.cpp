@@ -17,6 +17,7 @@
 #include "theory/strings/theory_strings.h"
 
 #include <cmath>
+#include <memory>
 
 #include "expr/kind.h"
 #include "options/strings_options.h"
@@ -86,6 +87,8 @@ TheoryStrings::TheoryStrings(context::Context* c,
       d_conflict(c, false),
       d_infer(c),
       d_infer_exp(c),
+      d_nf_cache(c),
+      d_nf_cache_id(0),
       d_nf_pairs(c),
       d_pregistered_terms_cache(u),
       d_registered_terms_cache(u),
@@ -126,12 +129,15 @@ TheoryStrings::TheoryStrings(context::Context* c,
   getExtTheory()->addFunctionKind(kind::STRING_IN_REGEXP);
   getExtTheory()->addFunctionKind(kind::STRING_LEQ);
   getExtTheory()->addFunctionKind(kind::STRING_CODE);
+  getExtTheory()->addFunctionKind(kind::SEQ_UPDATE);
 
   // The kinds we are treating as function application in congruence
   d_equalityEngine.addFunctionKind(kind::STRING_LENGTH);
   d_equalityEngine.addFunctionKind(kind::STRING_CONCAT);
   d_equalityEngine.addFunctionKind(kind::STRING_IN_REGEXP);
   d_equalityEngine.addFunctionKind(kind::STRING_CODE);
+  d_equalityEngine.addFunctionKind(kind::SEQ_UNIT);
+  d_equalityEngine.addFunctionKind(kind::SEQ_NTH);
   if( options::stringLazyPreproc() ){
     d_equalityEngine.addFunctionKind(kind::STRING_STRCTN);
     d_equalityEngine.addFunctionKind(kind::STRING_LEQ);
@@ -172,6 +178,25 @@ Node TheoryStrings::getRepresentative( Node t ) {
   }
 }
 
+Node TheoryStrings::getEmptyWord(TypeNode tn)
+{
+  if (tn.isString())
+  {
+    return d_emptyString;
+  }
+  return TheoryStringsRewriter::mkEmptyWord(tn);
+}
+
+bool TheoryStrings::isEmptyWordRep(Node r)
+{
+  TypeNode tn = r.getType();
+  if (tn.isString())
+  {
+    return r == d_emptyString_r;
+  }
+  return r == getRepresentative(getEmptyWord(tn));
+}
+
 bool TheoryStrings::hasTerm( Node a ){
   return d_equalityEngine.hasTerm( a );
 }
@@ -352,7 +377,7 @@ bool TheoryStrings::getCurrentSubstitution( int effort, std::vector< Node >& var
         if( !d_eqc_to_const_base[nr].isNull() ){
           addToExplanation( n, d_eqc_to_const_base[nr], exp[n] );
         }
-      }else if( effort>=1 && effort<3 && n.getType().isString() ){
+      }else if( effort>=1 && effort<3 && n.getType().isStringLike() ){
         //normal forms
         Node ns = getNormalString( d_normal_forms_base[nr], exp[n] );
         subs.push_back( ns );
@@ -440,7 +465,8 @@ int TheoryStrings::getReduction( int effort, Node n, Node& nr ) {
                  || k == STRING_ITOS
                  || k == STRING_STOI
                  || k == STRING_STRREPL
-                 || k == STRING_LEQ);
+                 || k == STRING_LEQ
+                 || k == SEQ_UPDATE);
           std::vector< Node > new_nodes;
           Node res = d_preproc.simplify( n, new_nodes );
           Assert( res!=n );
@@ -493,10 +519,31 @@ bool TheoryStrings::collectModelInfo(TheoryModel* m)
     return false;
   }
 
+  // Generate model, separately for each string-like type
+  std::vector< Node > eqcs;
+  getEquivalenceClasses( eqcs );
+  std::map<TypeNode, std::vector<Node> > eqcsByType;
+  for (const Node& eqc : eqcs)
+  {
+    eqcsByType[eqc.getType()].push_back(eqc);
+  }
+  for (std::pair<const TypeNode, std::vector<Node> >& et : eqcsByType)
+  {
+    if (!collectModelInfoType(et.first, et.second, m))
+    {
+      return false;
+    }
+  }
+  Trace("strings-model") << "String Model : Finished." << std::endl;
+  return true;
+}
+
+bool TheoryStrings::collectModelInfoType(TypeNode tn,
+                                         std::vector<Node>& nodes,
+                                         TheoryModel* m)
+{
   NodeManager* nm = NodeManager::currentNM();
-  // Generate model
-  std::vector< Node > nodes;
-  getEquivalenceClasses( nodes );
+  bool isSeq = tn.isSequence();
   std::map< Node, Node > processed;
   std::vector< std::vector< Node > > col;
   std::vector< Node > lts;
@@ -549,11 +596,11 @@ bool TheoryStrings::collectModelInfo(TheoryModel* m)
       if (!eqc.isConst())
       {
         Assert(d_normal_forms.find(eqc) != d_normal_forms.end());
-        if (d_normal_forms[eqc].size() == 1)
+        if (d_normal_forms[eqc].size() == 1 && !(isSeq && !getSeqUnit(eqc).isNull()))
         {
           // does it have a code and the length of these equivalence classes are
           // one?
-          if (d_has_str_code && lts_values[i] == d_one)
+          if (d_has_str_code && !isSeq && lts_values[i] == d_one)
           {
             EqcInfo* eip = getOrMakeEqcInfo(eqc, false);
             if (eip && !eip->d_code_term.get().isNull())
@@ -601,22 +648,50 @@ bool TheoryStrings::collectModelInfo(TheoryModel* m)
 
       //use type enumerator
       Assert(lts_values[i].getConst<Rational>() <= RMAXINT, "Exceeded LONG_MAX in string model");
-      StringEnumeratorLength sel(lts_values[i].getConst<Rational>().getNumerator().toUnsignedInt());
+      unsigned lvalue =
+          lts_values[i].getConst<Rational>().getNumerator().toUnsignedInt();
+      StringEnumeratorLength sel(lvalue);
+      std::unique_ptr<SequenceEnumeratorLength> seqel;
+      if (isSeq)
+      {
+        seqel.reset(new SequenceEnumeratorLength(tn, lvalue));
+      }
       for (const Node& eqc : pure_eq)
       {
         Node c;
         std::map<Node, Node>::iterator itp = pure_eq_assign.find(eqc);
         if (itp == pure_eq_assign.end())
         {
-          Assert( !sel.isFinished() );
-          c = *sel;
-          while (m->hasTerm(c))
+          if (isSeq)
           {
-            ++sel;
-            Assert(!sel.isFinished());
+            // sequence values are built from the values of the element
+            // type, which may be exhausted if it is finite
+            while (!seqel->isFinished() && m->hasTerm(**seqel))
+            {
+              ++(*seqel);
+            }
+            if (seqel->isFinished())
+            {
+              Trace("strings-model")
+                  << "*** No more values of length " << lvalue << " for "
+                  << eqc << std::endl;
+              continue;
+            }
+            c = **seqel;
+            ++(*seqel);
+          }
+          else
+          {
+            Assert( !sel.isFinished() );
             c = *sel;
+            while (m->hasTerm(c))
+            {
+              ++sel;
+              Assert(!sel.isFinished());
+              c = *sel;
+            }
+            ++sel;
           }
-          ++sel;
         }
         else
         {
@@ -650,11 +725,21 @@ bool TheoryStrings::collectModelInfo(TheoryModel* m)
       std::vector< Node > nc;
       for( unsigned j=0; j<d_normal_forms[nodes[i]].size(); j++ ) {
         Node r = getRepresentative( d_normal_forms[nodes[i]][j] );
+        if (isSeq && !r.isConst() && processed.find(r) == processed.end())
+        {
+          // a component whose value depends on its elements, such as a unit
+          // sequence, its value is computed by the model builder
+          break;
+        }
         Assert( r.isConst() || processed.find( r )!=processed.end() );
         nc.push_back(r.isConst() ? r : processed[r]);
       }
-      Node cc = mkConcat( nc );
-      Assert( cc.getKind()==kind::CONST_STRING );
+      if (nc.size() < d_normal_forms[nodes[i]].size())
+      {
+        continue;
+      }
+      Node cc = mkConcat( nc, tn );
+      Assert( cc.isConst() );
       Trace("strings-model") << "*** Determined constant " << cc << " for " << nodes[i] << std::endl;
       processed[nodes[i]] = cc;
       if (!m->assertEquality(nodes[i], cc, true))
@@ -663,11 +748,23 @@ bool TheoryStrings::collectModelInfo(TheoryModel* m)
       }
     }
   }
-  //Trace("strings-model") << "String Model : Assigned." << std::endl;
-  Trace("strings-model") << "String Model : Finished." << std::endl;
   return true;
 }
 
+Node TheoryStrings::getSeqUnit(Node eqc)
+{
+  eq::EqClassIterator eqc_i = eq::EqClassIterator(eqc, &d_equalityEngine);
+  while (!eqc_i.isFinished())
+  {
+    if ((*eqc_i).getKind() == kind::SEQ_UNIT)
+    {
+      return *eqc_i;
+    }
+    ++eqc_i;
+  }
+  return Node::null();
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // MAIN SOLVER
 /////////////////////////////////////////////////////////////////////////////
@@ -707,18 +804,23 @@ void TheoryStrings::preRegisterTerm(TNode n) {
       default: {
         registerTerm(n, 0);
         TypeNode tn = n.getType();
-        if( tn.isString() ) {
+        if( tn.isStringLike() ) {
           // if finite model finding is enabled,
           // then we minimize the length of this term if it is a variable
           // but not an internally generated Skolem, or a term that does
           // not belong to this theory.
-          if (options::stringFMF()
+          if (options::stringFMF() && tn.isString()
               && (n.isVar() ? d_all_skolems.find(n) == d_all_skolems.end()
                             : kindToTheoryId(k) != THEORY_STRINGS))
           {
             d_input_vars.insert(n);
           }
           d_equalityEngine.addTerm(n);
+          if (tn.isSequence())
+          {
+            // the empty sequence of this type is needed by the solver
+            preRegisterTerm(getEmptyWord(tn));
+          }
         } else if (tn.isBoolean()) {
           // Get triggered for both equal and dis-equal
           d_equalityEngine.addTriggerPredicate(n);
@@ -787,7 +889,7 @@ void TheoryStrings::check(Effort e) {
         Trace("strings-eqc") << (t==0 ? "STRINGS:" : "OTHER:") << std::endl;
         while( !eqcs2_i.isFinished() ){
           Node eqc = (*eqcs2_i);
-          bool print = (t==0 && eqc.getType().isString() ) || (t==1 && !eqc.getType().isString() );
+          bool print = (t==0 && eqc.getType().isStringLike() ) || (t==1 && !eqc.getType().isStringLike() );
           if (print) {
             eq::EqClassIterator eqc2_i = eq::EqClassIterator( eqc, &d_equalityEngine );
             Trace("strings-eqc") << "Eqc( " << eqc << " ) : { ";
@@ -990,7 +1092,7 @@ void TheoryStrings::eqNotifyPostMerge(TNode t1, TNode t2) {
 
 /** called when two equivalance classes are disequal */
 void TheoryStrings::eqNotifyDisequal(TNode t1, TNode t2, TNode reason) {
-  if( t1.getType().isString() ){
+  if( t1.getType().isStringLike() ){
     //store disequalities between strings, may need to check if their lengths are equal/disequal
     d_ee_disequalities.push_back( t1.eqNode( t2 ) );
   }
@@ -1063,13 +1165,16 @@ void TheoryStrings::addCarePairs( quantifiers::TermArgTrie * t1, quantifiers::Te
 void TheoryStrings::computeCareGraph(){
   //computing the care graph here is probably still necessary, due to operators that take non-string arguments  TODO: verify
   Trace("strings-cg") << "TheoryStrings::computeCareGraph(): Build term indices..." << std::endl;
-  std::map< Node, quantifiers::TermArgTrie > index;
-  std::map< Node, unsigned > arity;
+  // terms are indexed by their operator and the type of their first argument,
+  // since operators such as SEQ_NTH apply to sequences of any type
+  typedef std::pair<Node, TypeNode> OpType;
+  std::map< OpType, quantifiers::TermArgTrie > index;
+  std::map< OpType, unsigned > arity;
   unsigned functionTerms = d_functionsTerms.size();
   for (unsigned i = 0; i < functionTerms; ++ i) {
     TNode f1 = d_functionsTerms[i];
     Trace("strings-cg") << "...build for " << f1 << std::endl;
-    Node op = f1.getOperator();
+    OpType op(f1.getOperator(), f1[0].getType());
     std::vector< TNode > reps;
     bool has_trigger_arg = false;
     for( unsigned j=0; j<f1.getNumChildren(); j++ ){
@@ -1084,8 +1189,8 @@ void TheoryStrings::computeCareGraph(){
     }
   }
   //for each index
-  for( std::map< Node, quantifiers::TermArgTrie >::iterator itii = index.begin(); itii != index.end(); ++itii ){
-    Trace("strings-cg") << "TheoryStrings::computeCareGraph(): Process index " << itii->first << "..." << std::endl;
+  for( std::map< OpType, quantifiers::TermArgTrie >::iterator itii = index.begin(); itii != index.end(); ++itii ){
+    Trace("strings-cg") << "TheoryStrings::computeCareGraph(): Process index " << itii->first.first << "..." << std::endl;
     addCarePairs( &itii->second, NULL, arity[ itii->first ], 0 );
   }
 }
@@ -1096,7 +1201,7 @@ void TheoryStrings::assertPendingFact(Node atom, bool polarity, Node exp) {
   if( atom.getKind()==kind::EQUAL ){
     Trace("strings-pending-debug") << "  Register term" << std::endl;
     for( unsigned j=0; j<2; j++ ) {
-      if( !d_equalityEngine.hasTerm( atom[j] ) && atom[j].getType().isString() ) {
+      if( !d_equalityEngine.hasTerm( atom[j] ) && atom[j].getType().isStringLike() ) {
         registerTerm( atom[j], 0 );
       }
     }
@@ -1189,6 +1294,7 @@ void TheoryStrings::checkInit() {
   d_eqc_to_const_exp.clear();
   d_eqc_to_len_term.clear();
   d_term_index.clear();
+  d_seq_concat_index.clear();
   d_strings_eqc.clear();
 
   std::map< Kind, unsigned > ncongruent;
@@ -1199,14 +1305,30 @@ void TheoryStrings::checkInit() {
     Node eqc = (*eqcs_i);
     TypeNode tn = eqc.getType();
     if( !tn.isRegExp() ){
-      if( tn.isString() ){
+      if( tn.isStringLike() ){
         d_strings_eqc.push_back( eqc );
       }
       Node var;
+      Node unit;
       eq::EqClassIterator eqc_i = eq::EqClassIterator( eqc, &d_equalityEngine );
       while( !eqc_i.isFinished() ) {
         Node n = *eqc_i;
-        if( n.isConst() ){
+        if (n.getKind() == kind::SEQ_UNIT)
+        {
+          // unit sequences are injective
+          if (unit.isNull())
+          {
+            unit = n;
+          }
+          else if (!areEqual(unit[0], n[0]))
+          {
+            std::vector<Node> exp;
+            exp.push_back(unit.eqNode(n));
+            sendInference(exp, unit[0].eqNode(n[0]), "I_SeqUnit");
+          }
+        }
+        // constant sequences are handled as terms
+        if( n.isConst() && !tn.isSequence() ){
           d_eqc_to_const[eqc] = n;
           d_eqc_to_const_base[eqc] = n;
           d_eqc_to_const_exp[eqc] = Node::null();
@@ -1220,7 +1342,21 @@ void TheoryStrings::checkInit() {
           if( k!=kind::EQUAL ){
             if( d_congruent.find( n )==d_congruent.end() ){
               std::vector< Node > c;
-              Node nc = d_term_index[k].add( n, 0, this, d_emptyString_r, c );
+              Node emp = d_emptyString;
+              Node nc;
+              if (k == kind::STRING_CONCAT && tn.isSequence())
+              {
+                // concatenations of sequences are indexed per type, since
+                // those whose components are all empty have no children in
+                // the index
+                emp = getEmptyWord(tn);
+                nc = d_seq_concat_index[tn].add(
+                    n, 0, this, getRepresentative(emp), c);
+              }
+              else
+              {
+                nc = d_term_index[k].add(n, 0, this, d_emptyString_r, c);
+              }
               if( nc!=n ){
                 //check if we have inferred a new equality by removal of empty components
                 if( n.getKind()==kind::STRING_CONCAT && !areEqual( nc, n ) ){
@@ -1231,9 +1367,9 @@ void TheoryStrings::checkInit() {
                     for( unsigned t=0; t<2; t++ ){
                       Node nn = t==0 ? nc : n;
                       while( count[t]<nn.getNumChildren() &&
-                            ( nn[count[t]]==d_emptyString || areEqual( nn[count[t]], d_emptyString ) ) ){
-                        if( nn[count[t]]!=d_emptyString ){
-                          exp.push_back( nn[count[t]].eqNode( d_emptyString ) );
+                            ( nn[count[t]]==emp || areEqual( nn[count[t]], emp ) ) ){
+                        if( nn[count[t]]!=emp ){
+                          exp.push_back( nn[count[t]].eqNode( emp ) );
                         }
                         count[t]++;
                       }
@@ -1266,9 +1402,9 @@ void TheoryStrings::checkInit() {
                   //explain empty components
                   bool foundNEmpty = false;
                   for( unsigned i=0; i<n.getNumChildren(); i++ ){
-                    if( areEqual( n[i], d_emptyString ) ){
-                      if( n[i]!=d_emptyString ){
-                        exp.push_back( n[i].eqNode( d_emptyString ) );
+                    if( areEqual( n[i], emp ) ){
+                      if( n[i]!=emp ){
+                        exp.push_back( n[i].eqNode( emp ) );
                       }
                     }else{
                       Assert( !foundNEmpty );
@@ -1835,6 +1971,7 @@ void TheoryStrings::checkFlatForms() {
     //(2) scan lists, unification to infer conflicts and equalities
     for( unsigned k=0; k<d_strings_eqc.size(); k++ ){
       Node eqc = d_strings_eqc[k];
+      Node emp = getEmptyWord(eqc.getType());
       std::map< Node, std::vector< Node > >::iterator it = d_eqc.find( eqc );
       if( it!=d_eqc.end() && it->second.size()>1 ){
         //iterate over start index
@@ -1860,7 +1997,7 @@ void TheoryStrings::checkFlatForms() {
                       //endpoint
                       std::vector< Node > conc_c;
                       for( unsigned j=count; j<d_flat_form[b].size(); j++ ){
-                        conc_c.push_back( b[d_flat_form_index[b][j]].eqNode( d_emptyString ) );
+                        conc_c.push_back( b[d_flat_form_index[b][j]].eqNode( emp ) );
                       }
                       Assert( !conc_c.empty() );
                       conc = mkAnd( conc_c );
@@ -1888,7 +2025,7 @@ void TheoryStrings::checkFlatForms() {
                       //endpoint
                       std::vector< Node > conc_c;
                       for( unsigned j=count; j<d_flat_form[a].size(); j++ ){
-                        conc_c.push_back( a[d_flat_form_index[a][j]].eqNode( d_emptyString ) );
+                        conc_c.push_back( a[d_flat_form_index[a][j]].eqNode( emp ) );
                       }
                       Assert( !conc_c.empty() );
                       conc = mkAnd( conc_c );
@@ -1964,14 +2101,14 @@ void TheoryStrings::checkFlatForms() {
                   }
                   if( r==0 ){
                     for( int j=0; j<jj; j++ ){
-                      if( areEqual( c[j], d_emptyString ) ){
-                        addToExplanation( c[j], d_emptyString, exp );
+                      if( areEqual( c[j], emp ) ){
+                        addToExplanation( c[j], emp, exp );
                       }
                     }
                   }else{
                     for( int j=(c.getNumChildren()-1); j>jj; --j ){
-                      if( areEqual( c[j], d_emptyString ) ){
-                        addToExplanation( c[j], d_emptyString, exp );
+                      if( areEqual( c[j], emp ) ){
+                        addToExplanation( c[j], emp, exp );
                       }
                     }
                   }
@@ -2011,6 +2148,8 @@ Node TheoryStrings::checkCycles( Node eqc, std::vector< Node >& curr, std::vecto
     return eqc;
   }else if( std::find( d_strings_eqc.begin(), d_strings_eqc.end(), eqc )==d_strings_eqc.end() ){
     curr.push_back( eqc );
+    Node emp = getEmptyWord(eqc.getType());
+    bool isEmp = isEmptyWordRep(eqc);
     //look at all terms in this equivalence class
     eq::EqClassIterator eqc_i = eq::EqClassIterator( eqc, &d_equalityEngine );
     while( !eqc_i.isFinished() ) {
@@ -2018,21 +2157,21 @@ Node TheoryStrings::checkCycles( Node eqc, std::vector< Node >& curr, std::vecto
       if( d_congruent.find( n )==d_congruent.end() ){
         if( n.getKind() == kind::STRING_CONCAT ){
           Trace("strings-cycle") << eqc << " check term : " << n << " in " << eqc << std::endl;
-          if( eqc!=d_emptyString_r ){
+          if( !isEmp ){
             d_eqc[eqc].push_back( n );
           }
           for( unsigned i=0; i<n.getNumChildren(); i++ ){
             Node nr = getRepresentative( n[i] );
-            if( eqc==d_emptyString_r ){
+            if( isEmp ){
               //for empty eqc, ensure all components are empty
-              if( nr!=d_emptyString_r ){
+              if( !isEmptyWordRep(nr) ){
                 std::vector< Node > exp;
-                exp.push_back( n.eqNode( d_emptyString ) );
-                sendInference( exp, n[i].eqNode( d_emptyString ), "I_CYCLE_E" );
+                exp.push_back( n.eqNode( emp ) );
+                sendInference( exp, n[i].eqNode( emp ), "I_CYCLE_E" );
                 return Node::null();
               }
             }else{
-              if( nr!=d_emptyString_r ){
+              if( !isEmptyWordRep(nr) ){
                 d_flat_form[n].push_back( nr );
                 d_flat_form_index[n].push_back( i );
               }
@@ -2046,8 +2185,8 @@ Node TheoryStrings::checkCycles( Node eqc, std::vector< Node >& curr, std::vecto
                   //can infer all other components must be empty
                   for( unsigned j=0; j<n.getNumChildren(); j++ ){
                     //take first non-empty
-                    if( j!=i && !areEqual( n[j], d_emptyString ) ){
-                      sendInference( exp, n[j].eqNode( d_emptyString ), "I_CYCLE" );
+                    if( j!=i && !areEqual( n[j], emp ) ){
+                      sendInference( exp, n[j].eqNode( emp ), "I_CYCLE" );
                       return Node::null();
                     }
                   }
@@ -2114,7 +2253,7 @@ void TheoryStrings::checkNormalForms(){
     {
       return;
     }
-    Node nf_term = mkConcat(d_normal_forms[eqc]);
+    Node nf_term = mkConcat(d_normal_forms[eqc], eqc.getType());
     std::map<Node, Node>::iterator itn = nf_to_eqc.find(nf_term);
     if (itn != nf_to_eqc.end())
     {
@@ -2191,7 +2330,8 @@ void TheoryStrings::checkNormalForms(){
     std::vector<Node> const_codes;
     for (const Node& eqc : d_strings_eqc)
     {
-      if (d_normal_forms[eqc].size() == 1 && d_normal_forms[eqc][0].isConst())
+      if (d_normal_forms[eqc].size() == 1
+          && d_normal_forms[eqc][0].getKind() == kind::CONST_STRING)
       {
         Node c = d_normal_forms[eqc][0];
         Trace("strings-code-debug") << "Get proxy variable for " << c
@@ -2254,21 +2394,75 @@ void TheoryStrings::checkNormalForms(){
                          << ", conflict = " << d_conflict << std::endl;
 }
 
+void TheoryStrings::getNormalFormSignature(Node eqc,
+                                           std::vector<Node>& sig,
+                                           std::vector<unsigned>& deps)
+{
+  sig.push_back(isEmptyWordRep(eqc) ? d_true : d_false);
+  sig.push_back(getConstantEqc(eqc));
+  eq::EqClassIterator eqc_i = eq::EqClassIterator(eqc, &d_equalityEngine);
+  while (!eqc_i.isFinished())
+  {
+    Node n = (*eqc_i);
+    if (d_congruent.find(n) == d_congruent.end())
+    {
+      sig.push_back(n);
+      if (n.getKind() == kind::STRING_CONCAT)
+      {
+        for (const Node& nc : n)
+        {
+          Node nr = d_equalityEngine.getRepresentative(nc);
+          sig.push_back(nr);
+          NormalFormCacheMap::const_iterator it = d_nf_cache.find(nr);
+          deps.push_back(it == d_nf_cache.end() ? 0 : (*it).second->d_id);
+        }
+      }
+    }
+    ++eqc_i;
+  }
+}
+
 //compute d_normal_forms_(base,exp,exp_depend)[eqc]
 void TheoryStrings::normalizeEquivalenceClass( Node eqc ) {
   Trace("strings-process-debug") << "Process equivalence class " << eqc << std::endl;
-  if( areEqual( eqc, d_emptyString ) ) {
+  std::vector<Node> sig;
+  std::vector<unsigned> deps;
+  if (options::stringNfCache())
+  {
+    // reuse the last normal form of eqc if it was computed from the same terms
+    // and the same normal forms of their arguments
+    getNormalFormSignature(eqc, sig, deps);
+    NormalFormCacheMap::const_iterator it = d_nf_cache.find(eqc);
+    if (it != d_nf_cache.end())
+    {
+      const NormalFormCacheEntry& e = *(*it).second;
+      if (e.d_sig == sig && e.d_deps == deps)
+      {
+        Trace("strings-process-debug")
+            << "Return process equivalence class " << eqc << " : cached."
+            << std::endl;
+        d_normal_forms_base[eqc] = e.d_base;
+        d_normal_forms[eqc] = e.d_nf;
+        d_normal_forms_exp[eqc] = e.d_exp;
+        d_normal_forms_exp_depend[eqc] = e.d_exp_depend;
+        ++(d_statistics.d_nf_cache_hits);
+        return;
+      }
+    }
+  }
+  if( isEmptyWordRep( eqc ) ) {
+    Node emp = getEmptyWord(eqc.getType());
 #ifdef CVC4_ASSERTIONS
     for( unsigned j=0; j<d_eqc[eqc].size(); j++ ){
       Node n = d_eqc[eqc][j];
       for( unsigned i=0; i<n.getNumChildren(); i++ ){
-        Assert( areEqual( n[i], d_emptyString ) );
+        Assert( areEqual( n[i], emp ) );
       }
     }
 #endif
     //do nothing
     Trace("strings-process-debug") << "Return process equivalence class " << eqc << " : empty." << std::endl;
-    d_normal_forms_base[eqc] = d_emptyString;
+    d_normal_forms_base[eqc] = emp;
     d_normal_forms[eqc].clear();
     d_normal_forms_exp[eqc].clear();
   } else {
@@ -2320,6 +2514,19 @@ void TheoryStrings::normalizeEquivalenceClass( Node eqc ) {
     }
     Trace("strings-process-debug") << "Return process equivalence class " << eqc << " : returned, size = " << d_normal_forms[eqc].size() << std::endl;
   }
+  if (options::stringNfCache())
+  {
+    std::shared_ptr<NormalFormCacheEntry> e =
+        std::make_shared<NormalFormCacheEntry>();
+    e->d_sig.swap(sig);
+    e->d_deps.swap(deps);
+    e->d_id = ++d_nf_cache_id;
+    e->d_nf = d_normal_forms[eqc];
+    e->d_base = d_normal_forms_base[eqc];
+    e->d_exp = d_normal_forms_exp[eqc];
+    e->d_exp_depend = d_normal_forms_exp_depend[eqc];
+    d_nf_cache[eqc] = e;
+  }
 }
 
 void trackNfExpDependency( std::vector< Node >& nf_exp_n, std::map< Node, std::map< bool, int > >& nf_exp_depend_n, Node exp, int new_val, int new_rev_val ){
@@ -2424,7 +2631,7 @@ void TheoryStrings::getNormalForms( Node &eqc, std::vector< std::vector< Node >
           normal_forms_exp_depend.push_back(nf_exp_depend_n);
         }else{
           //this was redundant: combination of self + empty string(s)
-          Node nn = nf_n.size()==0 ? d_emptyString : nf_n[0];
+          Node nn = nf_n.size()==0 ? getEmptyWord(eqc.getType()) : nf_n[0];
           Assert( areEqual( nn, eqc ) );
         }
       }else{
@@ -2636,6 +2843,7 @@ void TheoryStrings::processSimpleNEq( std::vector< std::vector< Node > > &normal
                                       std::vector< std::vector< Node > > &normal_forms_exp, std::vector< std::map< Node, std::map< bool, int > > >& normal_forms_exp_depend,
                                       unsigned i, unsigned j, unsigned& index, bool isRev, unsigned rproc, std::vector< InferInfo >& pinfer ) {
   Assert( rproc<=normal_forms[i].size() && rproc<=normal_forms[j].size() );
+  Node emp = getEmptyWord(normal_form_src[i].getType());
   bool success;
   do {
     success = false;
@@ -2652,9 +2860,9 @@ void TheoryStrings::processSimpleNEq( std::vector< std::vector< Node > > &normal
         getExplanationVectorForPrefixEq( normal_forms, normal_form_src, normal_forms_exp, normal_forms_exp_depend, i, j, -1, -1, isRev, curr_exp );
         while( !d_conflict && index_k<(normal_forms[k].size()-rproc) ){
           //can infer that this string must be empty
-          Node eq = normal_forms[k][index_k].eqNode( d_emptyString );
+          Node eq = normal_forms[k][index_k].eqNode( emp );
           //Trace("strings-lemma") << "Strings: Infer " << eq << " from " << eq_exp << std::endl;
-          Assert( !areEqual( d_emptyString, normal_forms[k][index_k] ) );
+          Assert( !areEqual( emp, normal_forms[k][index_k] ) );
           sendInference( curr_exp, eq, "N_EndpointEmp" );
           index_k++;
         }
@@ -2699,7 +2907,7 @@ void TheoryStrings::processSimpleNEq( std::vector< std::vector< Node > > &normal
                 eqnc.push_back( normal_forms[k][index_l] );
               }
             }
-            eqn.push_back( mkConcat( eqnc ) );
+            eqn.push_back( mkConcat( eqnc, emp.getType() ) );
           }
           if( !areEqual( eqn[0], eqn[1] ) ){
             sendInference( antec, eqn[0].eqNode( eqn[1] ), "N_EndpointEq", true );
@@ -2708,7 +2916,7 @@ void TheoryStrings::processSimpleNEq( std::vector< std::vector< Node > > &normal
             Assert( normal_forms[i].size()==normal_forms[j].size() );
             index = normal_forms[i].size()-rproc;
           }
-        }else if( normal_forms[i][index].isConst() && normal_forms[j][index].isConst() ){
+        }else if( normal_forms[i][index].getKind()==kind::CONST_STRING && normal_forms[j][index].getKind()==kind::CONST_STRING ){
           Node const_str = normal_forms[i][index];
           Node other_str = normal_forms[j][index];
           Trace("strings-solve-debug") << "Simple Case 3 : Const Split : " << const_str << " vs " << other_str << " at index " << index << ", isRev = " << isRev << std::endl;
@@ -2796,15 +3004,15 @@ void TheoryStrings::processSimpleNEq( std::vector< std::vector< Node > > &normal
                 Node other_str = normal_forms[nconst_k][index];
                 Assert( other_str.getKind()!=kind::CONST_STRING, "Other string is not constant." );
                 Assert( other_str.getKind()!=kind::STRING_CONCAT, "Other string is not CONCAT." );
-                if( !d_equalityEngine.areDisequal( other_str, d_emptyString, true ) ){
-                  Node eq = other_str.eqNode( d_emptyString );
+                if( !d_equalityEngine.areDisequal( other_str, emp, true ) ){
+                  Node eq = other_str.eqNode( emp );
                   //set info
                   info.d_conc = NodeManager::currentNM()->mkNode( kind::OR, eq, eq.negate() );
                   info.d_id = INFER_LEN_SPLIT_EMP;
                   info_valid = true;
                 }else{
                   if( !isRev ){  //FIXME
-                  Node xnz = other_str.eqNode( d_emptyString ).negate();  
+                  Node xnz = other_str.eqNode( emp ).negate();  
                   unsigned index_nc_k = index+1;
                   //Node next_const_str = TheoryStringsRewriter::collectConstantStringAt( normal_forms[nconst_k], index_nc_k, false );
                   unsigned start_index_nc_k = index+1;
@@ -2872,7 +3080,7 @@ void TheoryStrings::processSimpleNEq( std::vector< std::vector< Node > > &normal
                       Trace("strings-csp") << "Const Split: " << c_firstHalf << " is removed from " << const_str << " (binary) " << std::endl;
                       info.d_conc = NodeManager::currentNM()->mkNode( kind::OR, other_str.eqNode( isRev ? mkConcat( sk, c_firstHalf ) : mkConcat( c_firstHalf, sk ) ),
                                                                          NodeManager::currentNM()->mkNode( kind::AND,
-                                                                           sk.eqNode( d_emptyString ).negate(),
+                                                                           sk.eqNode( emp ).negate(),
                                                                            c_firstHalf.eqNode( isRev ? mkConcat( sk, other_str ) : mkConcat( other_str, sk ) ) ) );
                       info.d_new_skolem[0].push_back( sk );
                       info.d_id = INFER_SSPLIT_CST_BINARY;
@@ -2918,8 +3126,8 @@ void TheoryStrings::processSimpleNEq( std::vector< std::vector< Node > > &normal
                 //x!=e /\ y!=e
                 for(unsigned xory=0; xory<2; xory++) {
                   Node x = xory==0 ? normal_forms[i][index] : normal_forms[j][index];
-                  Node xgtz = x.eqNode( d_emptyString ).negate();
-                  if( d_equalityEngine.areDisequal( x, d_emptyString, true ) ) {
+                  Node xgtz = x.eqNode( emp ).negate();
+                  if( d_equalityEngine.areDisequal( x, emp, true ) ) {
                     info.d_ant.push_back( xgtz );
                   } else {
                     info.d_antn.push_back( xgtz );
@@ -2996,6 +3204,8 @@ bool TheoryStrings::processLoop( std::vector< std::vector< Node > > &normal_form
     throw LogicException(ss.str());
   }
   NodeManager* nm = NodeManager::currentNM();
+  TypeNode stype = normal_form_src[i].getType();
+  Node emp = getEmptyWord(stype);
   Node conc;
   Trace("strings-loop") << "Detected possible loop for "
                         << normal_forms[loop_n_index][loop_index] << std::endl;
@@ -3005,19 +3215,20 @@ bool TheoryStrings::processLoop( std::vector< std::vector< Node > > &normal_form
   Trace("strings-loop") << " ... T(Y.Z)= ";
   std::vector<Node>& veci = normal_forms[loop_n_index];
   std::vector<Node> vec_t(veci.begin() + index, veci.begin() + loop_index);
-  Node t_yz = mkConcat(vec_t);
+  Node t_yz = mkConcat(vec_t, stype);
   Trace("strings-loop") << " (" << t_yz << ")" << std::endl;
   Trace("strings-loop") << " ... S(Z.Y)= ";
   std::vector<Node>& vecoi = normal_forms[other_n_index];
   std::vector<Node> vec_s(vecoi.begin() + index + 1, vecoi.end());
-  Node s_zy = mkConcat(vec_s);
+  Node s_zy = mkConcat(vec_s, stype);
   Trace("strings-loop") << s_zy << std::endl;
   Trace("strings-loop") << " ... R= ";
   std::vector<Node> vec_r(veci.begin() + loop_index + 1, veci.end());
-  Node r = mkConcat(vec_r);
+  Node r = mkConcat(vec_r, stype);
   Trace("strings-loop") << r << std::endl;
 
-  if (s_zy.isConst() && r.isConst() && r != d_emptyString)
+  if (s_zy.getKind() == kind::CONST_STRING && r.getKind() == kind::CONST_STRING
+      && r != d_emptyString)
   {
     int c;
     bool flag = true;
@@ -3046,12 +3257,12 @@ bool TheoryStrings::processLoop( std::vector< std::vector< Node > > &normal_form
   for (unsigned r = 0; r < 2; r++)
   {
     Node t = r == 0 ? normal_forms[loop_n_index][loop_index] : t_yz;
-    split_eq = t.eqNode(d_emptyString);
+    split_eq = t.eqNode(emp);
     Node split_eqr = Rewriter::rewrite(split_eq);
     // the equality could rewrite to false
     if (!split_eqr.isConst())
     {
-      if (!areDisequal(t, d_emptyString))
+      if (!areDisequal(t, emp))
       {
         // try to make t equal to empty to avoid loop
         info.d_conc = nm->mkNode(kind::OR, split_eq, split_eq.negate());
@@ -3069,6 +3280,16 @@ bool TheoryStrings::processLoop( std::vector< std::vector< Node > > &normal_form
     }
   }
 
+  if (stype.isSequence())
+  {
+    // the loop is broken by a regular expression membership, which is only
+    // available for strings
+    Trace("strings-loop") << "Strings::Loop: cannot break loop for sequences."
+                          << std::endl;
+    d_out->setIncomplete();
+    return false;
+  }
+
   Node ant = mkExplain(info.d_ant);
   info.d_ant.clear();
   info.d_antn.push_back(ant);
@@ -3362,7 +3583,7 @@ int TheoryStrings::processSimpleDeq( std::vector< Node >& nfi, std::vector< Node
       std::vector< Node > cc;
       std::vector< Node >& nfk = index>=nfi.size() ? nfj : nfi;
       for( unsigned index_k=index; index_k<nfk.size(); index_k++ ){
-        cc.push_back( nfk[index_k].eqNode( d_emptyString ) );
+        cc.push_back( nfk[index_k].eqNode( getEmptyWord( ni.getType() ) ) );
       }
       Node conc = cc.size()==1 ? cc[0] : NodeManager::currentNM()->mkNode( kind::AND, cc );
       conc = Rewriter::rewrite( conc );
@@ -3461,7 +3682,7 @@ bool TheoryStrings::isNormalFormPair2( Node n1, Node n2 ) {
 void TheoryStrings::registerTerm( Node n, int effort ) {
   TypeNode tn = n.getType();
   bool do_register = true;
-  if (!tn.isString())
+  if (!tn.isStringLike())
   {
     if (options::stringEagerLen())
     {
@@ -3476,7 +3697,7 @@ void TheoryStrings::registerTerm( Node n, int effort ) {
     if(d_registered_terms_cache.find(n) == d_registered_terms_cache.end()) {
       d_registered_terms_cache.insert(n);
       Debug("strings-register") << "TheoryStrings::registerTerm() " << n << ", effort = " << effort << std::endl;
-      if (tn.isString())
+      if (tn.isStringLike())
       {
         //register length information:
         //  for variables, split on empty vs positive length
@@ -3497,7 +3718,7 @@ void TheoryStrings::registerTerm( Node n, int effort ) {
           }
         }
         if( !processed ){
-          Node sk = mkSkolemS( "lsym", -1 );
+          Node sk = mkSkolemS( "lsym", -1, tn );
           StringsProxyVarAttribute spva;
           sk.setAttribute(spva,true);
           Node eq = Rewriter::rewrite( sk.eqNode(n) );
@@ -3548,6 +3769,27 @@ void TheoryStrings::registerTerm( Node n, int effort ) {
         Trace("strings-assert") << "(assert " << lem << ")" << std::endl;
         d_out->lemma(lem);
       }
+      else if (n.getKind() == kind::SEQ_NTH)
+      {
+        NodeManager* nm = NodeManager::currentNM();
+        // 0 <= i < len(s) => ( s = x ++ unit(nth(s,i)) ++ y ^ len(x) = i )
+        Node s = n[0];
+        Node i = n[1];
+        Node x = mkSkolemCached(s, i, sk_id_nth_pre, "nth_pre");
+        Node y = mkSkolemCached(s, i, sk_id_nth_post, "nth_post");
+        Node inRange = nm->mkNode(kind::AND,
+                                  nm->mkNode(kind::GEQ, i, d_zero),
+                                  nm->mkNode(kind::LT, i, mkLength(s)));
+        Node decomp = nm->mkNode(
+            kind::AND,
+            s.eqNode(nm->mkNode(
+                kind::STRING_CONCAT, x, nm->mkNode(kind::SEQ_UNIT, n), y)),
+            mkLength(x).eqNode(i));
+        Node lem = nm->mkNode(kind::IMPLIES, inRange, decomp);
+        Trace("strings-lemma") << "Strings::Lemma NTH : " << lem << std::endl;
+        Trace("strings-assert") << "(assert " << lem << ")" << std::endl;
+        d_out->lemma(lem);
+      }
     }
   }
 }
@@ -3672,7 +3914,7 @@ void TheoryStrings::sendLengthLemma( Node n ){
   Node n_len = NodeManager::currentNM()->mkNode( kind::STRING_LENGTH, n);
   if( options::stringSplitEmp() || !options::stringLenGeqZ() ){
     Node n_len_eq_z = n_len.eqNode( d_zero );
-    Node n_len_eq_z_2 = n.eqNode( d_emptyString );
+    Node n_len_eq_z_2 = n.eqNode( getEmptyWord( n.getType() ) );
     n_len_eq_z = Rewriter::rewrite( n_len_eq_z );
     n_len_eq_z_2 = Rewriter::rewrite( n_len_eq_z_2 );
     Node n_len_geq_zero = NodeManager::currentNM()->mkNode( kind::OR, NodeManager::currentNM()->mkNode( kind::AND, n_len_eq_z, n_len_eq_z_2 ),
@@ -3751,8 +3993,12 @@ Node TheoryStrings::mkConcat( Node n1, Node n2, Node n3 ) {
   return Rewriter::rewrite( NodeManager::currentNM()->mkNode( kind::STRING_CONCAT, n1, n2, n3 ) );
 }
 
-Node TheoryStrings::mkConcat( const std::vector< Node >& c ) {
-  return Rewriter::rewrite( c.size()>1 ? NodeManager::currentNM()->mkNode( kind::STRING_CONCAT, c ) : ( c.size()==1 ? c[0] : d_emptyString ) );
+Node TheoryStrings::mkConcat( const std::vector< Node >& c, TypeNode tn ) {
+  if (c.empty())
+  {
+    return tn.isNull() ? d_emptyString : getEmptyWord(tn);
+  }
+  return Rewriter::rewrite( c.size()>1 ? NodeManager::currentNM()->mkNode( kind::STRING_CONCAT, c ) : c[0] );
 }
 
 Node TheoryStrings::mkLength( Node t ) {
@@ -3763,7 +4009,7 @@ Node TheoryStrings::mkSkolemCached( Node a, Node b, int id, const char * c, int
   //return mkSkolemS( c, isLenSplit );
   std::map< int, Node >::iterator it = d_skolem_cache[a][b].find( id );
   if( it==d_skolem_cache[a][b].end() ){
-    Node sk = mkSkolemS( c, isLenSplit );
+    Node sk = mkSkolemS(c, isLenSplit, a.getType());
     d_skolem_cache[a][b][id] = sk;
     return sk;
   }else{
@@ -3772,8 +4018,12 @@ Node TheoryStrings::mkSkolemCached( Node a, Node b, int id, const char * c, int
 }
 
 //isLenSplit: -1-ignore, 0-no restriction, 1-greater than one, 2-one
-Node TheoryStrings::mkSkolemS( const char *c, int isLenSplit ) {
-  Node n = NodeManager::currentNM()->mkSkolem( c, NodeManager::currentNM()->stringType(), "string sko" );
+Node TheoryStrings::mkSkolemS( const char *c, int isLenSplit, TypeNode tn ) {
+  if (tn.isNull())
+  {
+    tn = NodeManager::currentNM()->stringType();
+  }
+  Node n = NodeManager::currentNM()->mkSkolem( c, tn, "string sko" );
   d_all_skolems.insert(n);
   d_length_lemma_terms_cache.insert( n );
   ++(d_statistics.d_new_skolems);
@@ -3793,7 +4043,8 @@ Node TheoryStrings::mkSkolemS( const char *c, int isLenSplit ) {
 void TheoryStrings::registerNonEmptySkolem( Node n ) {
   if( d_skolem_ne_reg_cache.find( n )==d_skolem_ne_reg_cache.end() ){
     d_skolem_ne_reg_cache.insert( n );
-    d_equalityEngine.assertEquality(n.eqNode(d_emptyString), false, d_true);
+    d_equalityEngine.assertEquality(
+        n.eqNode(getEmptyWord(n.getType())), false, d_true);
     Node len_n_gt_z = NodeManager::currentNM()->mkNode(kind::GT,
                         NodeManager::currentNM()->mkNode(kind::STRING_LENGTH, n), d_zero);
     Trace("strings-lemma") << "Strings::Lemma SK-NON-ZERO : " << len_n_gt_z << std::endl;
@@ -3879,7 +4130,7 @@ Node TheoryStrings::mkAnd( std::vector< Node >& a ) {
 void TheoryStrings::getConcatVec( Node n, std::vector< Node >& c ) {
   if( n.getKind()==kind::STRING_CONCAT ) {
     for( unsigned i=0; i<n.getNumChildren(); i++ ) {
-      if( !areEqual( n[i], d_emptyString ) ) {
+      if( !areEqual( n[i], getEmptyWord( n.getType() ) ) ) {
         c.push_back( n[i] );
       }
     }
@@ -3914,6 +4165,21 @@ void TheoryStrings::checkDeqNF() {
       if( !areEqual( lt[0], lt[1] ) && !areDisequal( lt[0], lt[1] ) ){
         sendSplit( lt[0], lt[1], "DEQ-LENGTH-SP" );
       }
+      else if (n[0].getType().isSequence())
+      {
+        // disequal unit sequences have disequal elements
+        Node u[2];
+        for (unsigned i = 0; i < 2; i++)
+        {
+          u[i] = getSeqUnit(n[i]);
+        }
+        if (!u[0].isNull() && !u[1].isNull() && !areDisequal(u[0][0], u[1][0]))
+        {
+          Node conc = NodeManager::currentNM()->mkNode(
+              kind::OR, u[0].eqNode(u[1]), u[0][0].eqNode(u[1][0]).negate());
+          sendInference(d_empty_vec, conc, "DEQ-SEQ-UNIT");
+        }
+      }
     }
   }
   
@@ -3959,7 +4225,7 @@ void TheoryStrings::checkLengthsEqc() {
         Node llt = NodeManager::currentNM()->mkNode( kind::STRING_LENGTH, lt );
         //now, check if length normalization has occurred
         if( ei->d_normalized_length.get().isNull() ) {
-          Node nf = mkConcat( d_normal_forms[d_strings_eqc[i]] );
+          Node nf = mkConcat( d_normal_forms[d_strings_eqc[i]], d_strings_eqc[i].getType() );
           if( Trace.isOn("strings-process-debug") ){
             Trace("strings-process-debug") << "  normal form is " << nf << " from base " << d_normal_forms_base[d_strings_eqc[i]] << std::endl;
             Trace("strings-process-debug") << "  normal form exp is: " << std::endl;
@@ -3984,7 +4250,7 @@ void TheoryStrings::checkLengthsEqc() {
       }else{
         Trace("strings-process-debug") << "No length term for eqc " << d_strings_eqc[i] << " " << d_eqc_to_len_term[d_strings_eqc[i]] << std::endl;
         if( !options::stringEagerLen() ){
-          Node c = mkConcat( d_normal_forms[d_strings_eqc[i]] );
+          Node c = mkConcat( d_normal_forms[d_strings_eqc[i]], d_strings_eqc[i].getType() );
           registerTerm( c, 3 );
           /*
           if( !c.isConst() ){
@@ -4021,7 +4287,7 @@ void TheoryStrings::checkCardinality() {
   for( unsigned i = 0; i<cols.size(); ++i ) {
     Node lr = lts[i];
     Trace("strings-card") << "Number of strings with length equal to " << lr << " is " << cols[i].size() << std::endl;
-    if( cols[i].size() > 1 ) {
+    if( cols[i].size() > 1 && cols[i][0].getType().isString() ) {
       // size > c^k
       unsigned card_need = 1;
       double curr = (double)cols[i].size();
@@ -4105,7 +4371,7 @@ void TheoryStrings::getEquivalenceClasses( std::vector< Node >& eqcs ) {
   while( !eqcs_i.isFinished() ) {
     Node eqc = (*eqcs_i);
     //if eqc.getType is string
-    if (eqc.getType().isString()) {
+    if (eqc.getType().isStringLike()) {
       eqcs.push_back( eqc );
     }
     ++eqcs_i;
@@ -4116,7 +4382,8 @@ void TheoryStrings::separateByLength(std::vector< Node >& n,
   std::vector< std::vector< Node > >& cols,
   std::vector< Node >& lts ) {
   unsigned leqc_counter = 0;
-  std::map< Node, unsigned > eqc_to_leqc;
+  // equivalence classes are grouped by type and length
+  std::map< std::pair< TypeNode, Node >, unsigned > eqc_to_leqc;
   std::map< unsigned, Node > leqc_to_eqc;
   std::map< unsigned, std::vector< Node > > eqc_to_strings;
   for( unsigned i=0; i<n.size(); i++ ) {
@@ -4127,12 +4394,13 @@ void TheoryStrings::separateByLength(std::vector< Node >& n,
     if( !lt.isNull() ){
       lt = NodeManager::currentNM()->mkNode( kind::STRING_LENGTH, lt );
       Node r = d_equalityEngine.getRepresentative( lt );
-      if( eqc_to_leqc.find( r )==eqc_to_leqc.end() ){
-        eqc_to_leqc[r] = leqc_counter;
+      std::pair< TypeNode, Node > tr( eqc.getType(), r );
+      if( eqc_to_leqc.find( tr )==eqc_to_leqc.end() ){
+        eqc_to_leqc[tr] = leqc_counter;
         leqc_to_eqc[leqc_counter] = r;
         leqc_counter++;
       }
-      eqc_to_strings[ eqc_to_leqc[r] ].push_back( eqc );
+      eqc_to_strings[ eqc_to_leqc[tr] ].push_back( eqc );
     }else{
       eqc_to_strings[leqc_counter].push_back( eqc );
       leqc_counter++;
@@ -4240,13 +4508,17 @@ TheoryStrings::Statistics::Statistics():
   d_eq_splits("theory::strings::NumOfEqSplits", 0),
   d_deq_splits("theory::strings::NumOfDiseqSplits", 0),
   d_loop_lemmas("theory::strings::NumOfLoops", 0),
-  d_new_skolems("theory::strings::NumOfNewSkolems", 0)
+  d_new_skolems("theory::strings::NumOfNewSkolems", 0),
+  d_re_inter_conflicts("theory::strings::NumOfRegExpInterConflicts", 0),
+  d_nf_cache_hits("theory::strings::NumOfNormalFormCacheHits", 0)
 {
   smtStatisticsRegistry()->registerStat(&d_splits);
   smtStatisticsRegistry()->registerStat(&d_eq_splits);
   smtStatisticsRegistry()->registerStat(&d_deq_splits);
   smtStatisticsRegistry()->registerStat(&d_loop_lemmas);
   smtStatisticsRegistry()->registerStat(&d_new_skolems);
+  smtStatisticsRegistry()->registerStat(&d_re_inter_conflicts);
+  smtStatisticsRegistry()->registerStat(&d_nf_cache_hits);
 }
 
 TheoryStrings::Statistics::~Statistics(){
@@ -4255,6 +4527,8 @@ TheoryStrings::Statistics::~Statistics(){
   smtStatisticsRegistry()->unregisterStat(&d_deq_splits);
   smtStatisticsRegistry()->unregisterStat(&d_loop_lemmas);
   smtStatisticsRegistry()->unregisterStat(&d_new_skolems);
+  smtStatisticsRegistry()->unregisterStat(&d_re_inter_conflicts);
+  smtStatisticsRegistry()->unregisterStat(&d_nf_cache_hits);
 }
 
 
@@ -4379,11 +4653,22 @@ void TheoryStrings::checkMemberships() {
   std::vector< Node > cprocessed;
 
   Trace("regexp-debug") << "Checking Memberships ... " << std::endl;
+  std::unordered_set<Node, NodeHashFunction> nonEmpty;
+  if (options::stringRegExpAutomaton())
+  {
+    addedLemma = checkMembershipsAutomata(nonEmpty);
+  }
   //if(options::stringEIT()) {
     //TODO: Opt for normal forms
     for( NodeIntMap::const_iterator itr_xr = d_pos_memberships.begin(); itr_xr != d_pos_memberships.end(); ++itr_xr ){
       bool spflag = false;
       Node x = (*itr_xr).first;
+      if (d_conflict || nonEmpty.find(x) != nonEmpty.end())
+      {
+        // in conflict, or the intersection is known to be non-empty by the
+        // automata
+        continue;
+      }
       Trace("regexp-debug") << "Checking Memberships for " << x << std::endl;
       if(d_inter_index.find(x) == d_inter_index.end()) {
         d_inter_index[x] = 0;
@@ -4595,6 +4880,64 @@ void TheoryStrings::checkMemberships() {
   }
 }
 
+bool TheoryStrings::checkMembershipsAutomata(
+    std::unordered_set<Node, NodeHashFunction>& nonEmpty)
+{
+  std::unordered_set<Node, NodeHashFunction> terms;
+  for (const std::pair<const Node, int>& p : d_pos_memberships)
+  {
+    terms.insert(p.first);
+  }
+  for (const std::pair<const Node, int>& p : d_neg_memberships)
+  {
+    terms.insert(p.first);
+  }
+  NodeManager* nm = NodeManager::currentNM();
+  for (const Node& x : terms)
+  {
+    std::vector<Node> rs[2];
+    std::vector<Node> exp;
+    bool allConst = true;
+    for (unsigned p = 0; p < 2; p++)
+    {
+      bool pol = p == 0;
+      for (unsigned i = 0, n = getNumMemberships(x, pol); i < n; i++)
+      {
+        Node r = getMembership(x, pol, i);
+        if (d_regexp_opr.checkConstRegExp(r))
+        {
+          rs[p].push_back(r);
+          Node mem = nm->mkNode(kind::STRING_IN_REGEXP, x, r);
+          exp.push_back(pol ? mem : mem.negate());
+        }
+        else if (pol)
+        {
+          allConst = false;
+        }
+      }
+    }
+    if (rs[0].size() + rs[1].size() < 2)
+    {
+      continue;
+    }
+    int ret = d_regexp_opr.checkEmptyIntersection(rs[0], rs[1]);
+    Trace("regexp-debug") << "Automata intersection for " << x << " : " << ret
+                          << std::endl;
+    if (ret == 1)
+    {
+      Node conc;
+      sendInference(exp, conc, "INTERSECT CONFLICT AUTOMATA", true);
+      ++(d_statistics.d_re_inter_conflicts);
+      return true;
+    }
+    else if (ret == 0 && allConst)
+    {
+      nonEmpty.insert(x);
+    }
+  }
+  return false;
+}
+
 bool TheoryStrings::checkPDerivative( Node x, Node r, Node atom, bool &addedLemma, std::vector< Node > &nf_exp ) {
   
   Node antnf = mkExplain(nf_exp);
@@ -4793,7 +5136,7 @@ Node TheoryStrings::getNormalString( Node x, std::vector< Node >& nf_exp ){
   if( !x.isConst() ){
     Node xr = getRepresentative( x );
     if( d_normal_forms.find( xr ) != d_normal_forms.end() ){
-      Node ret = mkConcat( d_normal_forms[xr] );
+      Node ret = mkConcat( d_normal_forms[xr], x.getType() );
       nf_exp.insert( nf_exp.end(), d_normal_forms_exp[xr].begin(), d_normal_forms_exp[xr].end() );
       addToExplanation( x, d_normal_forms_base[xr], nf_exp );
       Trace("strings-debug") << "Term: " << x << " has a normal form " << ret << std::endl;
@@ -4805,7 +5148,7 @@ Node TheoryStrings::getNormalString( Node x, std::vector< Node >& nf_exp ){
           Node nc = getNormalString( x[i], nf_exp );
           vec_nodes.push_back( nc );
         }
-        return mkConcat( vec_nodes );
+        return mkConcat( vec_nodes, x.getType() );
       }
     }
   }
@@ -29,6 +29,7 @@
 
 #include <climits>
 #include <deque>
+#include <memory>
 
 namespace CVC4 {
 namespace theory {
@@ -208,6 +209,13 @@ private:
   // t is representative, te = t, add lt = te to explanation exp
   Node getLengthExp( Node t, std::vector< Node >& exp, Node te );
   Node getLength( Node t, std::vector< Node >& exp );
+  /**
+   * Get the empty word of string-like type tn, that is, the empty string if
+   * tn is the string type and the empty sequence of type tn otherwise.
+   */
+  Node getEmptyWord(TypeNode tn);
+  /** is r the representative of the empty word of its type? */
+  bool isEmptyWordRep(Node r);
 
 private:
   /** The notify class */
@@ -229,6 +237,33 @@ private:
   std::map< Node, std::vector< Node > > d_normal_forms;
   std::map< Node, std::vector< Node > > d_normal_forms_exp;
   std::map< Node, std::map< Node, std::map< bool, int > > > d_normal_forms_exp_depend;
+  /** A normal form of an equivalence class, and the inputs it was computed from */
+  struct NormalFormCacheEntry
+  {
+    /** The signature of the equivalence class, see getNormalFormSignature */
+    std::vector<Node> d_sig;
+    /** The identifiers of the normal forms of the subterms of d_sig */
+    std::vector<unsigned> d_deps;
+    /** The identifier of this normal form */
+    unsigned d_id;
+    /** The normal form, its base and explanation */
+    std::vector<Node> d_nf;
+    Node d_base;
+    std::vector<Node> d_exp;
+    std::map<Node, std::map<bool, int> > d_exp_depend;
+  };
+  typedef context::CDHashMap<Node,
+                             std::shared_ptr<NormalFormCacheEntry>,
+                             NodeHashFunction>
+      NormalFormCacheMap;
+  /**
+   * The last normal form computed for each equivalence class. An entry is
+   * reused by normalizeEquivalenceClass as long as the signature of the
+   * equivalence class and the normal forms of its subterms have not changed.
+   */
+  NormalFormCacheMap d_nf_cache;
+  /** The number of normal forms that were stored in d_nf_cache */
+  unsigned d_nf_cache_id;
   //map of pairs of terms that have the same normal form
   NodeIntMap d_nf_pairs;
   std::map< Node, std::vector< Node > > d_nf_pairs_data;
@@ -267,6 +302,8 @@ private:
     void clear(){ d_children.clear(); }
   };
   std::map< Kind, TermIndex > d_term_index;
+  /** the term index for concatenations of each sequence type */
+  std::map<TypeNode, TermIndex> d_seq_concat_index;
   //list of non-congruent concat terms in each eqc
   std::map< Node, std::vector< Node > > d_eqc;
   std::map< Node, std::vector< Node > > d_flat_form;
@@ -280,6 +317,17 @@ private:
  public:
   bool collectModelInfo(TheoryModel* m) override;
 
+ private:
+  /**
+   * Assign values in m to the equivalence classes nodes of string-like type
+   * tn, returns false if m is inconsistent.
+   */
+  bool collectModelInfoType(TypeNode tn,
+                            std::vector<Node>& nodes,
+                            TheoryModel* m);
+  /** get a unit sequence in equivalence class eqc, if one exists */
+  Node getSeqUnit(Node eqc);
+
   /////////////////////////////////////////////////////////////////////////////
   // NOTIFICATIONS
   /////////////////////////////////////////////////////////////////////////////
@@ -387,6 +435,17 @@ private:
   //normal forms check
   void checkNormalForms();
   void normalizeEquivalenceClass( Node n );
+  /** get normal form signature
+   *
+   * Adds to sig the terms that determine the normal form of equivalence class
+   * eqc: whether it is equal to the empty string, its constant, its
+   * non-congruent terms and the representatives of the arguments of its
+   * concatenation terms. Adds to deps the identifiers of the normal forms of
+   * these representatives in d_nf_cache, or 0 if there is none.
+   */
+  void getNormalFormSignature(Node eqc,
+                              std::vector<Node>& sig,
+                              std::vector<unsigned>& deps);
   void getNormalForms( Node &eqc, std::vector< std::vector< Node > > &normal_forms, std::vector< Node > &normal_form_src,
                        std::vector< std::vector< Node > > &normal_forms_exp, std::vector< std::map< Node, std::map< bool, int > > >& normal_forms_exp_depend );
   bool detectLoop( std::vector< std::vector< Node > > &normal_forms, int i, int j, int index, int &loop_in_i, int &loop_in_j, unsigned rproc );
@@ -418,6 +477,18 @@ private:
   Node applyRSplit( Node s1, Node s2, Node r );
   bool applyRLen( std::map< Node, std::vector< Node > > &XinR_with_exps );
   void checkMemberships();
+  /** check memberships automata
+   *
+   * For each term x with asserted memberships in constant regular
+   * expressions, this checks whether the intersection of the regular
+   * expressions of its positive memberships and of the complements of those
+   * of its negative memberships is empty, using RegExpOpr's automata, in
+   * which case a conflict is sent. The terms whose positive memberships are
+   * all constant and for which this intersection is non-empty are added to
+   * nonEmpty. Returns true if a conflict was sent.
+   */
+  bool checkMembershipsAutomata(
+      std::unordered_set<Node, NodeHashFunction>& nonEmpty);
   bool checkPDerivative( Node x, Node r, Node atom, bool &addedLemma, std::vector< Node > &nf_exp);
   //check contains
   void checkPosContains( std::vector< Node >& posContains );
@@ -500,7 +571,11 @@ private:
   /** mkConcat **/
   inline Node mkConcat(Node n1, Node n2);
   inline Node mkConcat(Node n1, Node n2, Node n3);
-  inline Node mkConcat(const std::vector<Node>& c);
+  /**
+   * Make the concatenation of c, which is the empty word of type tn if c is
+   * empty, where a null tn stands for the string type.
+   */
+  inline Node mkConcat(const std::vector<Node>& c, TypeNode tn = TypeNode());
   inline Node mkLength(Node n);
   // mkSkolem
   enum
@@ -520,13 +595,21 @@ private:
     sk_id_deq_x,
     sk_id_deq_y,
     sk_id_deq_z,
+    sk_id_nth_pre,
+    sk_id_nth_post,
   };
   std::map<Node, std::map<Node, std::map<int, Node> > > d_skolem_cache;
   /** the set of all skolems we have generated */
   std::unordered_set<Node, NodeHashFunction> d_all_skolems;
   Node mkSkolemCached(
       Node a, Node b, int id, const char* c, int isLenSplit = 0);
-  inline Node mkSkolemS(const char* c, int isLenSplit = 0);
+  /**
+   * Make a skolem of string-like type tn, where a null tn stands for the
+   * string type.
+   */
+  inline Node mkSkolemS(const char* c,
+                        int isLenSplit = 0,
+                        TypeNode tn = TypeNode());
   void registerNonEmptySkolem(Node sk);
   // inline Node mkSkolemI(const char * c);
   /** mkExplain **/
@@ -608,6 +691,8 @@ private:
     IntStat d_deq_splits;
     IntStat d_loop_lemmas;
     IntStat d_new_skolems;
+    IntStat d_re_inter_conflicts;
+    IntStat d_nf_cache_hits;
     Statistics();
     ~Statistics();
   };/* class TheoryStrings::Statistics */
@@ -22,6 +22,7 @@
 #include "options/strings_options.h"
 #include "proof/proof_manager.h"
 #include "smt/logic_exception.h"
+#include "theory/strings/theory_strings_rewriter.h"
 
 using namespace CVC4;
 using namespace CVC4::kind;
@@ -78,11 +79,14 @@ Node StringsPreprocess::simplify( Node t, std::vector< Node > &new_nodes ) {
   NodeManager *nm = NodeManager::currentNM();
 
   if( t.getKind() == kind::STRING_SUBSTR ) {
+    // the type of t, which is the string type or a sequence type
+    TypeNode tn = t.getType();
     Node skt;
-    if( options::stringUfReduct() ){
+    if (options::stringUfReduct() && tn.isString())
+    {
       skt = getUfAppForNode( kind::STRING_SUBSTR, t );
     }else{
-      skt = NodeManager::currentNM()->mkSkolem( "sst", NodeManager::currentNM()->stringType(), "created for substr" );
+      skt = nm->mkSkolem("sst", tn, "created for substr");
     }
     Node t12 = NodeManager::currentNM()->mkNode( kind::PLUS, t[1], t[2] );
     Node lt0 = NodeManager::currentNM()->mkNode( kind::STRING_LENGTH, t[0] );
@@ -94,8 +98,8 @@ Node StringsPreprocess::simplify( Node t, std::vector< Node > &new_nodes ) {
     Node c3 = NodeManager::currentNM()->mkNode( kind::GT, t[2], d_zero );
     Node cond = NodeManager::currentNM()->mkNode( kind::AND, c1, c2, c3 );
   
-    Node sk1 = NodeManager::currentNM()->mkSkolem( "ss1", NodeManager::currentNM()->stringType(), "created for substr" );
-    Node sk2 = NodeManager::currentNM()->mkSkolem( "ss2", NodeManager::currentNM()->stringType(), "created for substr" );
+    Node sk1 = nm->mkSkolem("ss1", tn, "created for substr");
+    Node sk2 = nm->mkSkolem("ss2", tn, "created for substr");
     Node b11 = t[0].eqNode( NodeManager::currentNM()->mkNode( kind::STRING_CONCAT, sk1, skt, sk2 ) );
     //length of first skolem is second argument
     Node b12 = NodeManager::currentNM()->mkNode( kind::STRING_LENGTH, sk1 ).eqNode( t[1] );
@@ -105,11 +109,49 @@ Node StringsPreprocess::simplify( Node t, std::vector< Node > &new_nodes ) {
                     NodeManager::currentNM()->mkNode( kind::MINUS, lt0, t12 ), d_zero ) );
 
     Node b1 = NodeManager::currentNM()->mkNode( kind::AND, b11, b12, b13 );
-    Node b2 = skt.eqNode( NodeManager::currentNM()->mkConst( ::CVC4::String("") ) );
+    Node b2 = skt.eqNode(TheoryStringsRewriter::mkEmptyWord(tn));
     Node lemma = NodeManager::currentNM()->mkNode( kind::ITE, cond, b1, b2 );
     new_nodes.push_back( lemma );
     retNode = skt;
   }
+  else if (t.getKind() == kind::SEQ_UPDATE)
+  {
+    // processing term:  seq.update( s, i, u )
+    TypeNode tn = t.getType();
+    Node sku = nm->mkSkolem("sku", tn, "created for update");
+    Node lt0 = nm->mkNode(STRING_LENGTH, t[0]);
+    // 0 <= i < len( s )
+    Node cond = nm->mkNode(
+        AND, nm->mkNode(GEQ, t[1], d_zero), nm->mkNode(GT, lt0, t[1]));
+    Node sk1 = nm->mkSkolem("su1", tn, "created for update");
+    Node sk2 = nm->mkSkolem("su2", tn, "created for update");
+    Node sk3 = nm->mkSkolem("su3", tn, "created for update");
+    Node lsk2 = nm->mkNode(STRING_LENGTH, sk2);
+    // the length of the replaced part of s, that is,
+    //   ite( len( u ) <= len( s ) - i, len( u ), len( s ) - i )
+    Node lrem = nm->mkNode(MINUS, lt0, t[1]);
+    Node lu = nm->mkNode(STRING_LENGTH, t[2]);
+    Node lrep = nm->mkNode(ITE, nm->mkNode(LEQ, lu, lrem), lu, lrem);
+    std::vector<Node> conj;
+    conj.push_back(t[0].eqNode(nm->mkNode(STRING_CONCAT, sk1, sk2, sk3)));
+    conj.push_back(nm->mkNode(STRING_LENGTH, sk1).eqNode(t[1]));
+    conj.push_back(lsk2.eqNode(lrep));
+    conj.push_back(sku.eqNode(nm->mkNode(
+        STRING_CONCAT, sk1, nm->mkNode(STRING_SUBSTR, t[2], d_zero, lsk2), sk3)));
+
+    // assert:
+    //   IF    0 <= i < len( s )
+    //   THEN: s = su1 ++ su2 ++ su3 AND len( su1 ) = i AND
+    //         len( su2 ) = ite( len( u ) <= len( s ) - i, len( u ), len( s ) - i )
+    //         AND sku = su1 ++ seq.extract( u, 0, len( su2 ) ) ++ su3
+    //   ELSE: sku = s
+    Node lemma =
+        nm->mkNode(ITE, cond, nm->mkNode(AND, conj), sku.eqNode(t[0]));
+    new_nodes.push_back(lemma);
+
+    // Thus, seq.update( s, i, u ) = sku
+    retNode = sku;
+  }
   else if (t.getKind() == kind::STRING_STRIDOF)
   {
     // processing term:  indexof( x, y, n )
@@ -22,6 +22,7 @@
 #include "options/strings_options.h"
 #include "smt/logic_exception.h"
 #include "theory/arith/arith_msum.h"
+#include "theory/strings/regexp_automaton.h"
 #include "theory/theory.h"
 
 using namespace std;
@@ -1032,7 +1033,17 @@ Node TheoryStringsRewriter::rewriteMembership(TNode node) {
   } else if(x.getKind()==kind::CONST_STRING && isConstRegExp(r)) {
     //test whether x in node[1]
     CVC4::String s = x.getConst<String>();
-    retNode = NodeManager::currentNM()->mkConst( testConstStringInRegExp( s, 0, r ) );
+    RegExpAutomaton* a =
+        options::stringRegExpAutomaton() ? RegExpAutomaton::get(r) : nullptr;
+    if (a != nullptr && a->isValid())
+    {
+      retNode = NodeManager::currentNM()->mkConst(a->accepts(s));
+    }
+    else
+    {
+      retNode = NodeManager::currentNM()->mkConst(
+          testConstStringInRegExp(s, 0, r));
+    }
   } else if(r.getKind() == kind::REGEXP_SIGMA) {
     Node one = NodeManager::currentNM()->mkConst( ::CVC4::Rational(1) );
     retNode = one.eqNode(NodeManager::currentNM()->mkNode(kind::STRING_LENGTH, x));
@@ -1134,7 +1145,11 @@ RewriteResponse TheoryStringsRewriter::postRewrite(TNode node) {
   Node retNode = node;
   Node orig = retNode;
 
-  if(node.getKind() == kind::STRING_CONCAT) {
+  if (isSequenceTerm(node))
+  {
+    retNode = rewriteSequence(node);
+  }
+  else if(node.getKind() == kind::STRING_CONCAT) {
     retNode = rewriteConcat(node);
   } else if(node.getKind() == kind::EQUAL) {
     retNode = rewriteEquality(node);
@@ -1769,14 +1784,11 @@ Node TheoryStringsRewriter::rewriteContains( Node node ) {
       {
         Node cn = ncp.first;
         Assert(cn.isConst());
-        std::vector<unsigned> cc_vec;
-        const std::vector<unsigned>& cvec = cn.getConst<String>().getVec();
-        for (unsigned i = 0, size = cvec.size(); i < size; i++)
+        const String& cs = cn.getConst<String>();
+        for (unsigned i = 0, size = cs.size(); i < size; i++)
         {
           // make the character
-          cc_vec.clear();
-          cc_vec.insert(cc_vec.end(), cvec.begin() + i, cvec.begin() + i + 1);
-          Node ch = NodeManager::currentNM()->mkConst(String(cc_vec));
+          Node ch = NodeManager::currentNM()->mkConst(cs.substr(i, 1));
           count_const[j][ch] += ncp.second;
           if (std::find(chars.begin(), chars.end(), ch) == chars.end())
           {
@@ -2337,10 +2349,8 @@ Node TheoryStringsRewriter::rewriteStringCode(Node n)
     Node ret;
     if (s.size() == 1)
     {
-      std::vector<unsigned> vec = s.getVec();
-      Assert(vec.size() == 1);
       ret = NodeManager::currentNM()->mkConst(
-          Rational(CVC4::String::convertUnsignedIntToCode(vec[0])));
+          Rational(CVC4::String::convertUnsignedIntToCode(s[0])));
     }
     else
     {
@@ -2389,7 +2399,6 @@ Node TheoryStringsRewriter::splitConstant( Node a, Node b, int& index, bool isRe
 bool TheoryStringsRewriter::canConstantContainConcat( Node c, Node n, int& firstc, int& lastc ) {
   Assert( c.isConst() );
   CVC4::String t = c.getConst<String>();
-  const std::vector<unsigned>& tvec = t.getVec();
   Assert( n.getKind()==kind::STRING_CONCAT );
   //must find constant components in order
   size_t pos = 0;
@@ -2410,11 +2419,11 @@ bool TheoryStringsRewriter::canConstantContainConcat( Node c, Node n, int& first
     else if (n[i].getKind() == kind::STRING_ITOS)
     {
       // find the first occurrence of a digit starting at pos
-      while (pos < tvec.size() && !String::isDigit(tvec[pos]))
+      while (pos < t.size() && !String::isDigit(t[pos]))
       {
         pos++;
       }
-      if (pos == tvec.size())
+      if (pos == t.size())
       {
         return false;
       }
@@ -2913,12 +2922,11 @@ bool TheoryStringsRewriter::stripConstantEndpoints(std::vector<Node>& n1,
         }
         else if (n2[index1].getKind() == kind::STRING_ITOS)
         {
-          const std::vector<unsigned>& svec = s.getVec();
           // can remove up to the first occurrence of a digit
-          for (unsigned i = 0; i < svec.size(); i++)
+          for (unsigned i = 0; i < s.size(); i++)
           {
-            unsigned sindex = r == 0 ? i : svec.size() - i;
-            if (String::isDigit(svec[sindex]))
+            unsigned sindex = r == 0 ? i : s.size() - 1 - i;
+            if (String::isDigit(s[sindex]))
             {
               break;
             }
@@ -2979,8 +2987,7 @@ bool TheoryStringsRewriter::stripConstantEndpoints(std::vector<Node>& n1,
           }
           else
           {
-            const std::vector<unsigned>& tvec = t.getVec();
-            Assert(tvec.size() > 0);
+            Assert(t.size() > 0);
 
             // if n1.size()>1, then if the first (resp. last) character of
             // n2[index1]
@@ -2989,8 +2996,8 @@ bool TheoryStringsRewriter::stripConstantEndpoints(std::vector<Node>& n1,
             //    str.contains( y, "a12" )
             //    str.contains( str.++( y, int.to.str(x) ), "a0b") -->
             //    str.contains( y, "a0b" )
-            unsigned i = r == 0 ? 0 : (tvec.size() - 1);
-            if (!String::isDigit(tvec[i]))
+            unsigned i = r == 0 ? 0 : (t.size() - 1);
+            if (!String::isDigit(t[i]))
             {
               removeComponent = true;
             }
@@ -3452,6 +3459,256 @@ Node TheoryStringsRewriter::getStringOrEmpty(Node n)
   return res;
 }
 
+bool TheoryStringsRewriter::isSequenceTerm(TNode node)
+{
+  switch (node.getKind())
+  {
+    case kind::SEQ_UNIT:
+    case kind::SEQ_NTH:
+    case kind::SEQ_UPDATE: return true;
+    case kind::EQUAL:
+    case kind::STRING_CONCAT:
+    case kind::STRING_LENGTH:
+    case kind::STRING_SUBSTR: return node[0].getType().isSequence();
+    default: return false;
+  }
+}
+
+Node TheoryStringsRewriter::rewriteSequence(Node node)
+{
+  NodeManager* nm = NodeManager::currentNM();
+  Kind k = node.getKind();
+  if (k == kind::EQUAL)
+  {
+    if (node[0] == node[1])
+    {
+      return returnRewrite(node, nm->mkConst(true), "seq-eq-refl");
+    }
+    else if (node[0].isConst() && node[1].isConst())
+    {
+      return returnRewrite(node, nm->mkConst(false), "seq-eq-const");
+    }
+    Kind k0 = node[0].getKind();
+    Kind k1 = node[1].getKind();
+    if (k0 == kind::SEQ_UNIT && k1 == kind::SEQ_UNIT)
+    {
+      // units are injective
+      return returnRewrite(node, node[0][0].eqNode(node[1][0]), "seq-eq-unit");
+    }
+    if ((k0 == kind::SEQ_UNIT && k1 == kind::EMPTY_SEQUENCE)
+        || (k0 == kind::EMPTY_SEQUENCE && k1 == kind::SEQ_UNIT))
+    {
+      return returnRewrite(node, nm->mkConst(false), "seq-eq-unit-empty");
+    }
+    // ( len( s ) != len( t ) ) => ( s == t ---> false )
+    Node lenEq = nm->mkNode(kind::STRING_LENGTH, node[0])
+                     .eqNode(nm->mkNode(kind::STRING_LENGTH, node[1]));
+    lenEq = Rewriter::rewrite(lenEq);
+    if (lenEq.isConst() && !lenEq.getConst<bool>())
+    {
+      return returnRewrite(node, lenEq, "seq-eq-len-deq");
+    }
+    // standard ordering
+    if (node[0] > node[1])
+    {
+      return nm->mkNode(kind::EQUAL, node[1], node[0]);
+    }
+    return node;
+  }
+  else if (k == kind::STRING_CONCAT)
+  {
+    // flatten and remove empty sequences
+    std::vector<Node> children;
+    bool changed = false;
+    for (const Node& nc : node)
+    {
+      if (nc.getKind() == kind::STRING_CONCAT)
+      {
+        children.insert(children.end(), nc.begin(), nc.end());
+        changed = true;
+      }
+      else if (nc.getKind() != kind::EMPTY_SEQUENCE)
+      {
+        children.push_back(nc);
+      }
+      else
+      {
+        changed = true;
+      }
+    }
+    if (!changed)
+    {
+      return node;
+    }
+    Node ret = children.empty()
+                   ? mkEmptyWord(node.getType())
+                   : (children.size() == 1
+                          ? children[0]
+                          : nm->mkNode(kind::STRING_CONCAT, children));
+    return returnRewrite(node, ret, "seq-concat-flatten");
+  }
+  else if (k == kind::STRING_LENGTH)
+  {
+    Kind k0 = node[0].getKind();
+    if (k0 == kind::EMPTY_SEQUENCE)
+    {
+      return returnRewrite(node, nm->mkConst(Rational(0)), "seq-len-empty");
+    }
+    else if (k0 == kind::SEQ_UNIT)
+    {
+      return returnRewrite(node, nm->mkConst(Rational(1)), "seq-len-unit");
+    }
+    else if (k0 == kind::SEQ_UPDATE)
+    {
+      // update preserves the length
+      Node ret = nm->mkNode(kind::STRING_LENGTH, node[0][0]);
+      return returnRewrite(node, ret, "seq-len-update");
+    }
+    else if (k0 == kind::STRING_CONCAT)
+    {
+      std::vector<Node> lens;
+      for (const Node& nc : node[0])
+      {
+        lens.push_back(nm->mkNode(kind::STRING_LENGTH, nc));
+      }
+      return returnRewrite(
+          node, nm->mkNode(kind::PLUS, lens), "seq-len-concat");
+    }
+    return node;
+  }
+  else if (k == kind::STRING_SUBSTR)
+  {
+    if ((node[1].isConst() && node[1].getConst<Rational>().sgn() < 0)
+        || (node[2].isConst() && node[2].getConst<Rational>().sgn() <= 0))
+    {
+      // negative start or non-positive length
+      return returnRewrite(
+          node, mkEmptyWord(node.getType()), "seq-extract-empty-range");
+    }
+    if (node[0].isConst() && node[1].isConst() && node[2].isConst())
+    {
+      std::vector<Node> elems;
+      getSequenceElements(node[0], elems);
+      Rational size(elems.size());
+      Rational start = node[1].getConst<Rational>();
+      Rational end = start + node[2].getConst<Rational>();
+      std::vector<Node> relems;
+      if (start < size)
+      {
+        unsigned s = start.getNumerator().toUnsignedInt();
+        unsigned e = end < size ? end.getNumerator().toUnsignedInt()
+                                : elems.size();
+        relems.insert(relems.end(), elems.begin() + s, elems.begin() + e);
+      }
+      Node ret = mkSequence(node.getType(), relems);
+      return returnRewrite(node, ret, "seq-extract-const");
+    }
+    return node;
+  }
+  else if (k == kind::SEQ_NTH)
+  {
+    if (node[1].isConst())
+    {
+      // the elements of node[0] that precede its first non-unit component
+      std::vector<Node> elems;
+      std::vector<Node> c;
+      getConcat(node[0], c);
+      for (const Node& nc : c)
+      {
+        if (nc.getKind() != kind::SEQ_UNIT)
+        {
+          break;
+        }
+        elems.push_back(nc[0]);
+      }
+      const Rational& index = node[1].getConst<Rational>();
+      if (index.sgn() >= 0 && index < Rational(elems.size()))
+      {
+        Node ret = elems[index.getNumerator().toUnsignedInt()];
+        return returnRewrite(node, ret, "seq-nth-eval");
+      }
+    }
+    return node;
+  }
+  else if (k == kind::SEQ_UPDATE)
+  {
+    if (node[1].isConst() && node[1].getConst<Rational>().sgn() < 0)
+    {
+      return returnRewrite(node, node[0], "seq-update-neg");
+    }
+    if (node[2].getKind() == kind::EMPTY_SEQUENCE)
+    {
+      return returnRewrite(node, node[0], "seq-update-empty");
+    }
+    if (node[0].isConst() && node[1].isConst() && node[2].isConst())
+    {
+      std::vector<Node> elems;
+      getSequenceElements(node[0], elems);
+      const Rational& index = node[1].getConst<Rational>();
+      if (index < Rational(elems.size()))
+      {
+        std::vector<Node> uelems;
+        getSequenceElements(node[2], uelems);
+        unsigned start = index.getNumerator().toUnsignedInt();
+        for (unsigned i = 0, size = uelems.size();
+             i < size && start + i < elems.size();
+             i++)
+        {
+          elems[start + i] = uelems[i];
+        }
+      }
+      Node ret = mkSequence(node.getType(), elems);
+      return returnRewrite(node, ret, "seq-update-const");
+    }
+    return node;
+  }
+  return node;
+}
+
+Node TheoryStringsRewriter::mkEmptyWord(TypeNode tn)
+{
+  if (tn.isString())
+  {
+    return NodeManager::currentNM()->mkConst(::CVC4::String(""));
+  }
+  Assert(tn.isSequence());
+  return NodeManager::currentNM()->mkNullaryOperator(tn,
+                                                     kind::EMPTY_SEQUENCE);
+}
+
+void TheoryStringsRewriter::getSequenceElements(Node c,
+                                                std::vector<Node>& elems)
+{
+  Assert(c.getType().isSequence() && c.isConst());
+  if (c.getKind() == kind::SEQ_UNIT)
+  {
+    elems.push_back(c[0]);
+  }
+  else if (c.getKind() == kind::STRING_CONCAT)
+  {
+    for (const Node& cc : c)
+    {
+      elems.push_back(cc[0]);
+    }
+  }
+}
+
+Node TheoryStringsRewriter::mkSequence(TypeNode tn,
+                                       const std::vector<Node>& elems)
+{
+  NodeManager* nm = NodeManager::currentNM();
+  if (elems.empty())
+  {
+    return mkEmptyWord(tn);
+  }
+  std::vector<Node> units;
+  for (const Node& e : elems)
+  {
+    units.push_back(nm->mkNode(kind::SEQ_UNIT, e));
+  }
+  return units.size() == 1 ? units[0] : nm->mkNode(kind::STRING_CONCAT, units);
+}
+
 Node TheoryStringsRewriter::returnRewrite(Node node, Node ret, const char* c)
 {
   Trace("strings-rewrite") << "Rewrite " << node << " to " << ret << " by " << c
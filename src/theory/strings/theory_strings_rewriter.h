@@ -121,6 +121,32 @@ private:
    * Returns the rewritten form of node.
    */
   static Node rewriteStringCode(Node node);
+  /** rewrite sequence
+   * This is the entry point for post-rewriting terms node whose kind is one of
+   * the sequence operators, or that are equalities, concatenations, lengths
+   * or substrings of sequences, that is, terms of the form
+   *   t1 = t2, seq.++( t1, ..., tn ), seq.len( t ), seq.extract( s, i, n ),
+   *   seq.unit( e ), seq.nth( s, i ), seq.update( s, i, t )
+   * where s, t, t1, ..., tn are sequences. Returns the rewritten form of node.
+   */
+  static Node rewriteSequence(Node node);
+  /** Is node a term that is rewritten by rewriteSequence? */
+  static bool isSequenceTerm(TNode node);
+  /**
+   * Returns the empty string if tn is the string type, and the empty sequence
+   * of type tn if tn is a sequence type.
+   */
+  static Node mkEmptyWord(TypeNode tn);
+  /**
+   * Get the elements of the sequence value c, that is, the arguments of the
+   * units of c, in order.
+   */
+  static void getSequenceElements(Node c, std::vector<Node>& elems);
+  /**
+   * Make the sequence of type tn whose elements are elems, which is a
+   * sequence value if the nodes in elems are constant.
+   */
+  static Node mkSequence(TypeNode tn, const std::vector<Node>& elems);
 
   /** gets the "vector form" of term n, adds it to c.
   * For example:
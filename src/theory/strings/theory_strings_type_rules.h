@@ -36,14 +36,18 @@ class StringConcatTypeRule {
 public:
   inline static TypeNode computeType(NodeManager* nodeManager, TNode n, bool check)
   {
+    TypeNode tret = n[0].getType(check);
     if( check ){
+      if (!tret.isStringLike()) {
+        throw TypeCheckingExceptionPrivate(n, "expecting string or sequence terms in concat");
+      }
       TNode::iterator it = n.begin();
       TNode::iterator it_end = n.end();
       int size = 0;
       for (; it != it_end; ++ it) {
        TypeNode t = (*it).getType(check);
-       if (!t.isString()) {
-         throw TypeCheckingExceptionPrivate(n, "expecting string terms in string concat");
+       if (t != tret) {
+         throw TypeCheckingExceptionPrivate(n, "expecting terms of the same string or sequence type in concat");
        }
        ++size;
       }
@@ -51,7 +55,23 @@ public:
         throw TypeCheckingExceptionPrivate(n, "expecting at least 2 terms in string concat");
       }
     }
-    return nodeManager->stringType();
+    return tret;
+  }
+
+  /**
+   * A concatenation is constant if it is a sequence value, that is, if all
+   * its children are constant units.
+   */
+  inline static bool computeIsConst(NodeManager* nodeManager, TNode n)
+  {
+    for (const Node& nc : n)
+    {
+      if (nc.getKind() != kind::SEQ_UNIT || !nc.isConst())
+      {
+        return false;
+      }
+    }
+    return true;
   }
 };
 
@@ -61,8 +81,8 @@ public:
   {
     if( check ) {
       TypeNode t = n[0].getType(check);
-      if (!t.isString()) {
-        throw TypeCheckingExceptionPrivate(n, "expecting string terms in string length");
+      if (!t.isStringLike()) {
+        throw TypeCheckingExceptionPrivate(n, "expecting a string or sequence term in length");
       }
     }
     return nodeManager->integerType();
@@ -73,12 +93,12 @@ class StringSubstrTypeRule {
 public:
   inline static TypeNode computeType(NodeManager* nodeManager, TNode n, bool check)
   {
+    TypeNode tret = n[0].getType(check);
     if( check ) {
-      TypeNode t = n[0].getType(check);
-      if (!t.isString()) {
-        throw TypeCheckingExceptionPrivate(n, "expecting a string term in substr");
+      if (!tret.isStringLike()) {
+        throw TypeCheckingExceptionPrivate(n, "expecting a string or sequence term in substr");
       }
-      t = n[1].getType(check);
+      TypeNode t = n[1].getType(check);
       if (!t.isInteger()) {
         throw TypeCheckingExceptionPrivate(n, "expecting a start int term in substr");
       }
@@ -87,7 +107,7 @@ public:
         throw TypeCheckingExceptionPrivate(n, "expecting a length int term in substr");
       }
     }
-    return nodeManager->stringType();
+    return tret;
   }
 };
 
@@ -484,6 +504,102 @@ public:
 };
 
 
+class EmptySequenceTypeRule {
+public:
+  inline static TypeNode computeType(NodeManager* nodeManager, TNode n, bool check)
+  {
+    Assert(n.getKind() == kind::EMPTY_SEQUENCE);
+    // nullary operators are given their type on creation, see
+    // NodeManager::mkNullaryOperator
+    Assert(check);
+    TypeNode tn = n.getType();
+    if (!tn.isSequence()) {
+      throw TypeCheckingExceptionPrivate(n, "non-sequence type found for the empty sequence");
+    }
+    return tn;
+  }
+
+  inline static bool computeIsConst(NodeManager* nodeManager, TNode n)
+  {
+    Assert(n.getKind() == kind::EMPTY_SEQUENCE);
+    return true;
+  }
+};
+
+class SeqUnitTypeRule {
+public:
+  inline static TypeNode computeType(NodeManager* nodeManager, TNode n, bool check)
+  {
+    return nodeManager->mkSequenceType(n[0].getType(check));
+  }
+
+  inline static bool computeIsConst(NodeManager* nodeManager, TNode n)
+  {
+    Assert(n.getKind() == kind::SEQ_UNIT);
+    return n[0].isConst();
+  }
+};
+
+class SeqNthTypeRule {
+public:
+  inline static TypeNode computeType(NodeManager* nodeManager, TNode n, bool check)
+  {
+    TypeNode t = n[0].getType(check);
+    if( check ) {
+      if (!t.isSequence()) {
+        throw TypeCheckingExceptionPrivate(n, "expecting a sequence term in nth");
+      }
+      if (!n[1].getType(check).isInteger()) {
+        throw TypeCheckingExceptionPrivate(n, "expecting an integer index in nth");
+      }
+    }
+    return t.getSequenceElementType();
+  }
+};
+
+class SeqUpdateTypeRule {
+public:
+  inline static TypeNode computeType(NodeManager* nodeManager, TNode n, bool check)
+  {
+    TypeNode t = n[0].getType(check);
+    if( check ) {
+      if (!t.isSequence()) {
+        throw TypeCheckingExceptionPrivate(n, "expecting a sequence term in update");
+      }
+      if (!n[1].getType(check).isInteger()) {
+        throw TypeCheckingExceptionPrivate(n, "expecting an integer index in update");
+      }
+      if (n[2].getType(check) != t) {
+        throw TypeCheckingExceptionPrivate(n, "expecting a sequence of the same type in update");
+      }
+    }
+    return t;
+  }
+};
+
+/** Cardinality and well-foundedness of sequence types */
+struct SequenceProperties {
+  inline static Cardinality computeCardinality(TypeNode type) {
+    Assert(type.getKind() == kind::SEQUENCE_TYPE);
+    // sequences over a finite or countable type are countable
+    Cardinality elementCard = type[0].getCardinality();
+    if (elementCard.isCountable()) {
+      return Cardinality::INTEGERS;
+    }
+    return elementCard;
+  }
+
+  inline static bool isWellFounded(TypeNode type) {
+    // the empty sequence is a ground term of every sequence type
+    return true;
+  }
+
+  inline static Node mkGroundTerm(TypeNode type) {
+    Assert(type.isSequence());
+    return NodeManager::currentNM()->mkNullaryOperator(type, kind::EMPTY_SEQUENCE);
+  }
+};/* struct SequenceProperties */
+
 }/* CVC4::theory::strings namespace */
 }/* CVC4::theory namespace */
 }/* CVC4 namespace */
@@ -19,6 +19,7 @@
 #ifndef __CVC4__THEORY__STRINGS__TYPE_ENUMERATOR_H
 #define __CVC4__THEORY__STRINGS__TYPE_ENUMERATOR_H
 
+#include <algorithm>
 #include <sstream>
 
 #include "util/regexp.h"
@@ -123,6 +124,213 @@ class StringEnumeratorLength {
   bool isFinished() { return d_curr.isNull(); }
 };
 
+/** Sequence enumerator
+ *
+ * Sequences are enumerated by increasing weight, where the weight of a
+ * sequence is the sum of (i + 1) for each element that is the i^th value of
+ * the element type. The sequences of weight w are the compositions of w,
+ * which we enumerate via the bit masks of w - 1 bits, where a set bit marks
+ * the end of an element. Compositions that refer to values beyond those of a
+ * finite element type are skipped.
+ */
+class SequenceEnumerator : public TypeEnumeratorBase<SequenceEnumerator>
+{
+ public:
+  SequenceEnumerator(TypeNode type, TypeEnumeratorProperties* tep = nullptr)
+      : TypeEnumeratorBase<SequenceEnumerator>(type),
+        d_elementEnum(type.getSequenceElementType(), tep),
+        d_weight(0),
+        d_mask(0)
+  {
+    d_curr = NodeManager::currentNM()->mkNullaryOperator(type,
+                                                         kind::EMPTY_SEQUENCE);
+  }
+  Node operator*() override { return d_curr; }
+  SequenceEnumerator& operator++() override
+  {
+    std::vector<unsigned> indices;
+    do
+    {
+      if (d_weight > 0 && d_mask + 1 < (uint64_t(1) << (d_weight - 1)))
+      {
+        d_mask++;
+      }
+      else if (d_weight < 64)
+      {
+        d_weight++;
+        d_mask = 0;
+      }
+      else
+      {
+        d_curr = Node::null();
+        return *this;
+      }
+    } while (!getIndices(indices));
+    NodeManager* nm = NodeManager::currentNM();
+    std::vector<Node> units;
+    for (unsigned i : indices)
+    {
+      units.push_back(nm->mkNode(kind::SEQ_UNIT, d_elements[i]));
+    }
+    d_curr = units.size() == 1 ? units[0]
+                               : nm->mkNode(kind::STRING_CONCAT, units);
+    return *this;
+  }
+
+  bool isFinished() override { return d_curr.isNull(); }
+
+ private:
+  /**
+   * Get the indices of the elements of the composition of d_weight given by
+   * d_mask, returns false if one of these exceeds the number of values of
+   * the element type.
+   */
+  bool getIndices(std::vector<unsigned>& indices)
+  {
+    indices.clear();
+    unsigned part = 1;
+    for (unsigned i = 0; i < d_weight; i++)
+    {
+      if (i + 1 == d_weight || ((d_mask >> i) & 1) != 0)
+      {
+        while (d_elements.size() < part)
+        {
+          if (d_elementEnum.isFinished())
+          {
+            return false;
+          }
+          d_elements.push_back(*d_elementEnum);
+          ++d_elementEnum;
+        }
+        indices.push_back(part - 1);
+        part = 1;
+      }
+      else
+      {
+        part++;
+      }
+    }
+    return true;
+  }
+  /** enumerator for the element type */
+  TypeEnumerator d_elementEnum;
+  /** the values of the element type enumerated so far */
+  std::vector<Node> d_elements;
+  /** the weight of the current sequence */
+  unsigned d_weight;
+  /** the composition of d_weight for the current sequence */
+  uint64_t d_mask;
+  /** the current sequence */
+  Node d_curr;
+};/* class SequenceEnumerator */
+
+/** Sequence enumerator length
+ *
+ * Enumerates the sequences of type tn of a fixed length. The tuples of
+ * indices of the elements are enumerated by increasing bound on their maximum
+ * index, where the values of the element type are enumerated lazily.
+ */
+class SequenceEnumeratorLength
+{
+ public:
+  SequenceEnumeratorLength(TypeNode tn, unsigned length)
+      : d_type(tn),
+        d_elementEnum(tn.getSequenceElementType()),
+        d_data(length, 0),
+        d_bound(1)
+  {
+    if (length > 0 && !getElement(0))
+    {
+      return;
+    }
+    mkCurr();
+  }
+
+  Node operator*() { return d_curr; }
+  SequenceEnumeratorLength& operator++()
+  {
+    if (d_data.empty())
+    {
+      d_curr = Node::null();
+      return *this;
+    }
+    do
+    {
+      bool changed = false;
+      for (unsigned i = 0; i < d_data.size(); ++i)
+      {
+        if (d_data[i] + 1 < d_bound)
+        {
+          ++d_data[i];
+          changed = true;
+          break;
+        }
+        d_data[i] = 0;
+      }
+      if (!changed)
+      {
+        // the tuples within the current bound are exhausted
+        if (!getElement(d_bound))
+        {
+          d_curr = Node::null();
+          return *this;
+        }
+        d_bound++;
+      }
+      // skip the tuples that were enumerated for a smaller bound
+    } while (*std::max_element(d_data.begin(), d_data.end()) + 1 < d_bound);
+    mkCurr();
+    return *this;
+  }
+
+  bool isFinished() { return d_curr.isNull(); }
+
+ private:
+  /** ensure the i^th value of the element type exists */
+  bool getElement(unsigned i)
+  {
+    while (d_elements.size() <= i)
+    {
+      if (d_elementEnum.isFinished())
+      {
+        return false;
+      }
+      d_elements.push_back(*d_elementEnum);
+      ++d_elementEnum;
+    }
+    return true;
+  }
+  /** make the current sequence from d_data */
+  void mkCurr()
+  {
+    NodeManager* nm = NodeManager::currentNM();
+    if (d_data.empty())
+    {
+      d_curr = nm->mkNullaryOperator(d_type, kind::EMPTY_SEQUENCE);
+      return;
+    }
+    std::vector<Node> units;
+    for (unsigned i : d_data)
+    {
+      units.push_back(nm->mkNode(kind::SEQ_UNIT, d_elements[i]));
+    }
+    d_curr = units.size() == 1 ? units[0]
+                               : nm->mkNode(kind::STRING_CONCAT, units);
+  }
+  /** the sequence type */
+  TypeNode d_type;
+  /** enumerator for the element type */
+  TypeEnumerator d_elementEnum;
+  /** the values of the element type enumerated so far */
+  std::vector<Node> d_elements;
+  /** the indices of the elements of the current sequence */
+  std::vector<unsigned> d_data;
+  /** the bound on the indices of the elements */
+  unsigned d_bound;
+  /** the current sequence */
+  Node d_curr;
+};/* class SequenceEnumeratorLength */
+
 }/* CVC4::theory::strings namespace */
 }/* CVC4::theory namespace */
 }/* CVC4 namespace */
@@ -17,16 +17,19 @@
 #include "theory/theory_engine.h"
 
 #include <list>
+#include <unordered_set>
 #include <vector>
 
 #include "decision/decision_engine.h"
 #include "expr/attribute.h"
+#include "expr/datatype.h"
 #include "expr/node.h"
 #include "expr/node_builder.h"
 #include "options/bv_options.h"
 #include "options/options.h"
 #include "options/proof_options.h"
 #include "options/quantifiers_options.h"
+#include "options/smt_options.h"
 #include "proof/cnf_proof.h"
 #include "proof/lemma_proof.h"
 #include "proof/proof_manager.h"
@@ -291,6 +294,7 @@ TheoryEngine::TheoryEngine(context::Context* context,
   d_aloc_curr_model(false),
   d_curr_model_builder(NULL),
   d_aloc_curr_model_builder(false),
+  d_modelTheories(Theory::AllTheories),
   d_ppCache(),
   d_possiblePropagations(context),
   d_hasPropagated(context),
@@ -597,6 +601,7 @@ void TheoryEngine::check(Theory::Effort effort) {
       }
       //checks for theories requiring the model go at last call
       d_curr_model->reset();
+      d_modelTheories = Theory::AllTheories;
       for (TheoryId theoryId = THEORY_FIRST; theoryId < THEORY_LAST; ++theoryId) {
         if( theoryId!=THEORY_QUANTIFIERS ){
           Theory* theory = d_theoryTable[theoryId];
@@ -621,9 +626,11 @@ void TheoryEngine::check(Theory::Effort effort) {
       }
       if (!d_inConflict && !needCheck())
       {
-        if (options::produceModels() && !d_curr_model->isBuilt())
+        // must build model at this point, unless it is built on demand (see
+        // getBuiltModel)
+        if (options::produceModels() && !options::modelLazy()
+            && !d_curr_model->isBuilt())
         {
-          // must build model at this point
           d_curr_model_builder->buildModel(d_curr_model);
         }
       }
@@ -869,7 +876,9 @@ bool TheoryEngine::collectModelInfo(theory::TheoryModel* m)
   // Consult each active theory to get all relevant information
   // concerning the model.
   for(TheoryId theoryId = theory::THEORY_FIRST; theoryId < theory::THEORY_LAST; ++theoryId) {
-    if(d_logicInfo.isTheoryEnabled(theoryId)) {
+    if (d_logicInfo.isTheoryEnabled(theoryId)
+        && Theory::setContains(theoryId, d_modelTheories))
+    {
       Trace("model-builder") << "  CollectModelInfo on theory: " << theoryId << endl;
       if (!d_theoryTable[theoryId]->collectModelInfo(m))
       {
@@ -912,6 +921,118 @@ TheoryModel* TheoryEngine::getModel() {
   return d_curr_model;
 }
 
+TheoryModel* TheoryEngine::getBuiltModel()
+{
+  buildModelOnDemand(Theory::AllTheories);
+  return d_curr_model;
+}
+
+TheoryModel* TheoryEngine::getBuiltModel(TNode n)
+{
+  buildModelOnDemand(getModelTheories(n));
+  return d_curr_model;
+}
+
+void TheoryEngine::buildModelOnDemand(Theory::Set theories)
+{
+  if (!options::modelLazy())
+  {
+    return;
+  }
+  if (d_curr_model->isBuilt())
+  {
+    if (Theory::setDifference(theories, d_modelTheories) == 0)
+    {
+      return;
+    }
+    // built for other queries, rebuild for those and this one
+    theories = Theory::setUnion(theories, d_modelTheories);
+    d_curr_model->reset();
+  }
+  // the state of the theories is that of the last satisfiability check
+  // until the next postsolve, hence the model can be built here as it would
+  // have been at the end of that check
+  Trace("model-builder") << "TheoryEngine: build model on demand for "
+                         << Theory::setToString(theories) << endl;
+  d_modelTheories = theories;
+  d_curr_model_builder->buildModel(d_curr_model);
+  // no lemmas can be added at this point, so it must succeed
+  AlwaysAssert(d_curr_model->isBuiltSuccess());
+  if (!d_incomplete && options::checkModels()
+      && d_modelTheories == Theory::AllTheories)
+  {
+    d_curr_model_builder->debugCheckModel(d_curr_model);
+  }
+  postProcessModel(d_curr_model);
+}
+
+Theory::Set TheoryEngine::getModelTheories(TNode n) const
+{
+  if (d_logicInfo.isQuantified())
+  {
+    return Theory::AllTheories;
+  }
+  Theory::Set theories = Theory::setInsert(THEORY_BUILTIN);
+  theories = Theory::setInsert(THEORY_BOOL, theories);
+  std::unordered_set<TNode, TNodeHashFunction> visited;
+  std::unordered_set<TypeNode, TypeNodeHashFunction> visitedTypes;
+  std::vector<TNode> visit;
+  std::vector<TypeNode> visitTypes;
+  visit.push_back(n);
+  while (!visit.empty())
+  {
+    TNode cur = visit.back();
+    visit.pop_back();
+    if (!visited.insert(cur).second)
+    {
+      continue;
+    }
+    theories = Theory::setInsert(Theory::theoryOf(cur), theories);
+    if (cur.getNumChildren() > 0)
+    {
+      theories = Theory::setInsert(kindToTheoryId(cur.getKind()), theories);
+    }
+    visitTypes.push_back(cur.getType());
+    visit.insert(visit.end(), cur.begin(), cur.end());
+  }
+  while (!visitTypes.empty())
+  {
+    TypeNode tn = visitTypes.back();
+    visitTypes.pop_back();
+    if (!visitedTypes.insert(tn).second)
+    {
+      continue;
+    }
+    theories = Theory::setInsert(Theory::theoryOf(tn), theories);
+    visitTypes.insert(visitTypes.end(), tn.begin(), tn.end());
+    if (tn.isDatatype())
+    {
+      const Datatype& dt = tn.getDatatype();
+      for (const DatatypeConstructor& c : dt)
+      {
+        for (const DatatypeConstructorArg& a : c)
+        {
+          visitTypes.push_back(TypeNode::fromType(a.getRangeType()));
+        }
+      }
+    }
+  }
+  // the models of the other theories consult the values of further terms,
+  // e.g. string lengths, so we do not restrict the model for them
+  Theory::Set independent = Theory::setInsert(THEORY_BUILTIN);
+  independent = Theory::setInsert(THEORY_BOOL, independent);
+  independent = Theory::setInsert(THEORY_UF, independent);
+  independent = Theory::setInsert(THEORY_ARITH, independent);
+  independent = Theory::setInsert(THEORY_BV, independent);
+  independent = Theory::setInsert(THEORY_ARRAYS, independent);
+  independent = Theory::setInsert(THEORY_DATATYPES, independent);
+  if (Theory::setDifference(theories, independent) != 0)
+  {
+    return Theory::AllTheories;
+  }
+  return theories;
+}
+
 void TheoryEngine::getSynthSolutions(std::map<Node, Node>& sol_map)
 {
   if (d_quantEngine)
@@ -1507,6 +1628,14 @@ void TheoryEngine::printInstantiations( std::ostream& out ) {
   }
 }
 
+void TheoryEngine::printQuantProfile(std::ostream& out)
+{
+  if (d_quantEngine)
+  {
+    d_quantEngine->printQuantProfile(out);
+  }
+}
+
 void TheoryEngine::printSynthSolution( std::ostream& out ) {
   if( d_quantEngine ){
     d_quantEngine->printSynthSolution( out );
@@ -211,6 +211,25 @@ class TheoryEngine {
    */
   theory::TheoryEngineModelBuilder* d_curr_model_builder;
   bool d_aloc_curr_model_builder;
+  /**
+   * The theories whose model information the current model is built from.
+   * This is all theories, unless the model was built on demand for a query
+   * on the value of a term (see getBuiltModel).
+   */
+  theory::Theory::Set d_modelTheories;
+  /**
+   * Builds the current model on demand from the model information of the
+   * given theories, unless it is built from all of them already.
+   */
+  void buildModelOnDemand(theory::Theory::Set theories);
+  /**
+   * Returns the theories whose model information determines the value of n,
+   * that is the theories of its subterms, their types and the component
+   * types of those. This is all theories if that cannot be determined
+   * syntactically, e.g. with quantifiers, or with theories whose models
+   * depend on the values of other theories, such as strings and sets.
+   */
+  theory::Theory::Set getModelTheories(TNode n) const;
 
   typedef std::unordered_map<Node, Node, NodeHashFunction> NodeMap;
   typedef std::unordered_map<TNode, Node, TNodeHashFunction> TNodeMap;
@@ -734,6 +753,19 @@ public:
    * Get the current model
    */
   theory::TheoryModel* getModel();
+  /**
+   * Get the current model, after building it if it is built on demand
+   * (option --model-lazy) and has not been built since the last
+   * satisfiability check. This should be used for user queries on the model
+   * after a satisfiable answer.
+   */
+  theory::TheoryModel* getBuiltModel();
+  /**
+   * Same as above, for a query on the value of n only. If the model is built
+   * on demand, it is built from the model information of the theories that
+   * n reaches (see getModelTheories), or rebuilt if it was built from fewer.
+   */
+  theory::TheoryModel* getBuiltModel(TNode n);
 
   /** get synth solutions
    *
@@ -796,6 +828,12 @@ public:
    */
   void printInstantiations( std::ostream& out );
 
+  /**
+   * Print the instantiation profile of the quantified formulas, if
+   * --quant-profile is enabled.
+   */
+  void printQuantProfile(std::ostream& out);
+
   /**
    * Print solution for synthesis conjectures found by ce_guided_instantiation module
    */
@@ -17,6 +17,7 @@
 #include "options/smt_options.h"
 #include "options/uf_options.h"
 #include "smt/smt_engine.h"
+#include "theory/evaluator.h"
 
 using namespace std;
 using namespace CVC4::kind;
@@ -215,10 +216,28 @@ Node TheoryModel::getModelValue(TNode n, bool hasBoundVars, bool useDontCares) c
         children.push_back(n.getOperator());
       }
       //evaluate the children
+      std::vector<Node> args;
+      std::vector<Node> vals;
+      if (n.getKind() == APPLY_UF)
+      {
+        args.push_back(n.getOperator());
+        vals.push_back(children[0]);
+      }
       for (unsigned i = 0; i < n.getNumChildren(); ++i) {
         ret = getModelValue(n[i], hasBoundVars);
         Debug("model-getvalue-debug") << "  " << n << "[" << i << "] is " << ret << std::endl;
         children.push_back(ret);
+        args.push_back(n[i]);
+        vals.push_back(ret);
+      }
+      // try to evaluate the term directly on the values of its children,
+      // which avoids constructing and rewriting the term below
+      ret = Evaluator().eval(n, args, vals);
+      if (!ret.isNull())
+      {
+        Debug("model-getvalue-debug") << "ret (evaluated): " << ret << std::endl;
+        d_modelCache[n] = ret;
+        return ret;
       }
       ret = NodeManager::currentNM()->mkNode(n.getKind(), children);
       Debug("model-getvalue-debug") << "ret (pre-rewrite): " << ret << std::endl;
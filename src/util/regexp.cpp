@@ -19,8 +19,10 @@
 
 #include <algorithm>
 #include <climits>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <sstream>
 
 #include "base/cvc4_assert.h"
@@ -58,22 +60,64 @@ unsigned String::convertUnsignedIntToCode(unsigned i)
   return (i + start_code()) % num_codes();
 }
 
+String::String(const std::vector<unsigned>& s) : d_start(0), d_size(s.size())
+{
+  std::vector<unsigned char> buf;
+  buf.reserve(s.size());
+  for (unsigned c : s)
+  {
+    Assert(c < num_codes());
+    buf.push_back(static_cast<unsigned char>(c));
+  }
+  d_buf = std::make_shared<const std::vector<unsigned char> >(std::move(buf));
+}
+
+String::String(std::vector<unsigned char>&& buf)
+    : d_buf(std::make_shared<const std::vector<unsigned char> >(std::move(buf))),
+      d_start(0),
+      d_size(d_buf->size())
+{
+}
+
+bool String::operator==(const String &y) const {
+  if (size() != y.size()) {
+    return false;
+  }
+  if (empty() || (d_buf == y.d_buf && d_start == y.d_start)) {
+    return true;
+  }
+  return std::memcmp(data(), y.data(), size()) == 0;
+}
+
 int String::cmp(const String &y) const {
   if (size() != y.size()) {
     return size() < y.size() ? -1 : 1;
   }
-  for (unsigned int i = 0; i < size(); ++i) {
-    if (d_str[i] != y.d_str[i]) {
-      return getUnsignedCharAt(i) < y.getUnsignedCharAt(i) ? -1 : 1;
-    }
+  if (empty()) {
+    return 0;
+  }
+  std::pair<const unsigned char *, const unsigned char *> m =
+      std::mismatch(data(), data() + size(), y.data());
+  if (m.first == data() + size()) {
+    return 0;
   }
-  return 0;
+  return convertUnsignedIntToChar(*m.first) < convertUnsignedIntToChar(*m.second)
+             ? -1
+             : 1;
 }
 
 String String::concat(const String &other) const {
-  std::vector<unsigned int> ret_vec(d_str);
-  ret_vec.insert(ret_vec.end(), other.d_str.begin(), other.d_str.end());
-  return String(ret_vec);
+  if (other.empty()) {
+    return *this;
+  }
+  if (empty()) {
+    return other;
+  }
+  std::vector<unsigned char> buf;
+  buf.reserve(size() + other.size());
+  buf.insert(buf.end(), data(), data() + size());
+  buf.insert(buf.end(), other.data(), other.data() + other.size());
+  return String(std::move(buf));
 }
 
 bool String::strncmp(const String &y, const std::size_t np) const {
@@ -87,10 +131,7 @@ bool String::strncmp(const String &y, const std::size_t np) const {
       return false;
     }
   }
-  for (std::size_t i = 0; i < n; ++i) {
-    if (d_str[i] != y.d_str[i]) return false;
-  }
-  return true;
+  return n == 0 || std::memcmp(data(), y.data(), n) == 0;
 }
 
 bool String::rstrncmp(const String &y, const std::size_t np) const {
@@ -104,15 +145,13 @@ bool String::rstrncmp(const String &y, const std::size_t np) const {
       return false;
     }
   }
-  for (std::size_t i = 0; i < n; ++i) {
-    if (d_str[size() - i - 1] != y.d_str[y.size() - i - 1]) return false;
-  }
-  return true;
+  return n == 0
+         || std::memcmp(data() + size() - n, y.data() + y.size() - n, n) == 0;
 }
 
-std::vector<unsigned> String::toInternal(const std::string &s,
-                                         bool useEscSequences) {
-  std::vector<unsigned> str;
+std::vector<unsigned char> String::toInternal(const std::string &s,
+                                              bool useEscSequences) {
+  std::vector<unsigned char> str;
   unsigned i = 0;
   while (i < s.size()) {
     if (s[i] == '\\' && useEscSequences) {
@@ -212,7 +251,7 @@ std::vector<unsigned> String::toInternal(const std::string &s,
 
 unsigned char String::getUnsignedCharAt(size_t pos) const {
   Assert(pos < size());
-  return convertUnsignedIntToChar(d_str[pos]);
+  return convertUnsignedIntToChar(data()[pos]);
 }
 
 std::size_t String::overlap(const String &y) const {
@@ -242,7 +281,7 @@ std::size_t String::roverlap(const String &y) const {
 std::string String::toString(bool useEscSequences) const {
   std::string str;
   for (unsigned int i = 0; i < size(); ++i) {
-    unsigned char c = convertUnsignedIntToChar(d_str[i]);
+    unsigned char c = convertUnsignedIntToChar(data()[i]);
     if (!useEscSequences) {
       str += c;
     } else if (isprint(c)) {
@@ -306,11 +345,11 @@ bool String::isLeq(const String &y) const
     {
       return false;
     }
-    if (d_str[i] > y.d_str[i])
+    if ((*this)[i] > y[i])
     {
       return false;
     }
-    if (d_str[i] < y.d_str[i])
+    if ((*this)[i] < y[i])
     {
       return true;
     }
@@ -320,9 +359,9 @@ bool String::isLeq(const String &y) const
 
 bool String::isRepeated() const {
   if (size() > 1) {
-    unsigned int f = d_str[0];
+    const unsigned char *d = data();
     for (unsigned i = 1; i < size(); ++i) {
-      if (f != d_str[i]) return false;
+      if (d[0] != d[i]) return false;
     }
   }
   return true;
@@ -332,7 +371,7 @@ bool String::tailcmp(const String &y, int &c) const {
   int id_x = size() - 1;
   int id_y = y.size() - 1;
   while (id_x >= 0 && id_y >= 0) {
-    if (d_str[id_x] != y.d_str[id_y]) {
+    if ((*this)[id_x] != y[id_y]) {
       c = id_x;
       return false;
     }
@@ -348,10 +387,20 @@ std::size_t String::find(const String &y, const std::size_t start) const {
   if (y.empty()) return start;
   if (empty()) return std::string::npos;
 
-  std::vector<unsigned>::const_iterator itr = std::search(
-      d_str.begin() + start, d_str.end(), y.d_str.begin(), y.d_str.end());
-  if (itr != d_str.end()) {
-    return itr - d_str.begin();
+  // find the first character of y with memchr, then compare the rest
+  const unsigned char *d = data();
+  const unsigned char *yd = y.data();
+  const unsigned char *end = d + size() - y.size() + 1;
+  const unsigned char *p = d + start;
+  while (p < end) {
+    p = static_cast<const unsigned char *>(std::memchr(p, yd[0], end - p));
+    if (p == nullptr) {
+      break;
+    }
+    if (std::memcmp(p + 1, yd + 1, y.size() - 1) == 0) {
+      return p - d;
+    }
+    ++p;
   }
   return std::string::npos;
 }
@@ -361,10 +410,15 @@ std::size_t String::rfind(const String &y, const std::size_t start) const {
   if (y.empty()) return start;
   if (empty()) return std::string::npos;
 
-  std::vector<unsigned>::const_reverse_iterator itr = std::search(
-      d_str.rbegin() + start, d_str.rend(), y.d_str.rbegin(), y.d_str.rend());
-  if (itr != d_str.rend()) {
-    return itr - d_str.rbegin();
+  typedef std::reverse_iterator<const unsigned char *> rev_iterator;
+  rev_iterator rbegin(data() + size());
+  rev_iterator rend(data());
+  rev_iterator itr = std::search(rbegin + start,
+                                 rend,
+                                 rev_iterator(y.data() + y.size()),
+                                 rev_iterator(y.data()));
+  if (itr != rend) {
+    return itr - rbegin;
   }
   return std::string::npos;
 }
@@ -372,11 +426,12 @@ std::size_t String::rfind(const String &y, const std::size_t start) const {
 String String::replace(const String &s, const String &t) const {
   std::size_t ret = find(s);
   if (ret != std::string::npos) {
-    std::vector<unsigned int> vec;
-    vec.insert(vec.begin(), d_str.begin(), d_str.begin() + ret);
-    vec.insert(vec.end(), t.d_str.begin(), t.d_str.end());
-    vec.insert(vec.end(), d_str.begin() + ret + s.size(), d_str.end());
-    return String(vec);
+    std::vector<unsigned char> buf;
+    buf.reserve(size() - s.size() + t.size());
+    buf.insert(buf.end(), data(), data() + ret);
+    buf.insert(buf.end(), t.data(), t.data() + t.size());
+    buf.insert(buf.end(), data() + ret + s.size(), data() + size());
+    return String(std::move(buf));
   } else {
     return *this;
   }
@@ -384,26 +439,36 @@ String String::replace(const String &s, const String &t) const {
 
 String String::substr(std::size_t i) const {
   Assert(i <= size());
-  std::vector<unsigned int> ret_vec;
-  std::vector<unsigned int>::const_iterator itr = d_str.begin() + i;
-  ret_vec.insert(ret_vec.end(), itr, d_str.end());
-  return String(ret_vec);
+  return substr(i, size() - i);
 }
 
 String String::substr(std::size_t i, std::size_t j) const {
   Assert(i + j <= size());
-  std::vector<unsigned int> ret_vec;
-  std::vector<unsigned int>::const_iterator itr = d_str.begin() + i;
-  ret_vec.insert(ret_vec.end(), itr, itr + j);
-  return String(ret_vec);
+  // substrings share the buffer of this string
+  return j == 0 ? String() : String(d_buf, d_start + i, j);
+}
+
+std::vector<unsigned> String::getVec() const
+{
+  return std::vector<unsigned>(data(), data() + size());
+}
+
+std::size_t String::hash() const
+{
+  std::size_t h = size();
+  for (std::size_t i = 0; i < size(); ++i)
+  {
+    h = h * 31 + data()[i];
+  }
+  return h;
 }
 
 bool String::isNumber() const {
-  if (d_str.empty()) {
+  if (empty()) {
     return false;
   }
-  for (unsigned character : d_str) {
-    if (!isDigit(character))
+  for (std::size_t i = 0; i < size(); ++i) {
+    if (!isDigit((*this)[i]))
     {
       return false;
     }
@@ -426,7 +491,7 @@ int String::toNumber() const {
   if (isNumber()) {
     int ret = 0;
     for (unsigned int i = 0; i < size(); ++i) {
-      unsigned char c = convertUnsignedIntToChar(d_str[i]);
+      unsigned char c = convertUnsignedIntToChar((*this)[i]);
       ret = ret * 10 + (int)c - (int)'0';
     }
     return ret;
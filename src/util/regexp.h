@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include <functional>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -37,8 +38,8 @@ class CVC4_PUBLIC String {
  public:
   /**
    * The start ASCII code. In our string representation below, we represent
-   * characters using a vector d_vec of unsigned integers. We refer to this as
-   * the "internal representation" for the string.
+   * characters using unsigned integers, stored as bytes in d_buf below. We
+   * refer to this as the "internal representation" for the string.
    *
    * We make unsigned integer 0 correspond to the 65th character ("A") in the
    * ASCII alphabet to make models intuitive. In particular, say if we have
@@ -68,8 +69,8 @@ class CVC4_PUBLIC String {
 
   /** constructors for String
   *
-  * Internally, a CVC4::String is represented by a vector of unsigned
-  * integers (d_str), where the correspondence between C++ characters
+  * Internally, a CVC4::String is represented by a sequence of unsigned
+  * integers (d_buf), where the correspondence between C++ characters
   * to and from unsigned integers is determined by
   * by convertCharToUnsignedInt and convertUnsignedIntToChar.
   *
@@ -83,26 +84,23 @@ class CVC4_PUBLIC String {
   * If useEscSequences is false, then the characters of the constructed
   * CVC4::String correspond one-to-one with the input string.
   */
-  String() = default;
+  String() : d_start(0), d_size(0) {}
   explicit String(const std::string& s, bool useEscSequences = false)
-      : d_str(toInternal(s, useEscSequences)) {}
+      : String(toInternal(s, useEscSequences)) {}
   explicit String(const char* s, bool useEscSequences = false)
-      : d_str(toInternal(std::string(s), useEscSequences)) {}
+      : String(toInternal(std::string(s), useEscSequences)) {}
   explicit String(const unsigned char c)
-      : d_str({convertCharToUnsignedInt(c)}) {}
-  explicit String(const std::vector<unsigned>& s) : d_str(s) {}
-
-  String& operator=(const String& y) {
-    if (this != &y) {
-      d_str = y.d_str;
-    }
-    return *this;
-  }
+      : String(std::vector<unsigned char>{
+            static_cast<unsigned char>(convertCharToUnsignedInt(c))}) {}
+  explicit String(const std::vector<unsigned>& s);
+
+  String(const String& y) = default;
+  String& operator=(const String& y) = default;
 
   String concat(const String& other) const;
 
-  bool operator==(const String& y) const { return cmp(y) == 0; }
-  bool operator!=(const String& y) const { return cmp(y) != 0; }
+  bool operator==(const String& y) const;
+  bool operator!=(const String& y) const { return !(*this == y); }
   bool operator<(const String& y) const { return cmp(y) < 0; }
   bool operator>(const String& y) const { return cmp(y) > 0; }
   bool operator<=(const String& y) const { return cmp(y) <= 0; }
@@ -128,13 +126,13 @@ class CVC4_PUBLIC String {
   */
   std::string toString(bool useEscSequences = false) const;
   /** is this the empty string? */
-  bool empty() const { return d_str.empty(); }
+  bool empty() const { return d_size == 0; }
   /** is this the empty string? */
   bool isEmptyString() const { return empty(); }
   /** is less than or equal to string y */
   bool isLeq(const String& y) const;
   /** Return the length of the string */
-  std::size_t size() const { return d_str.size(); }
+  std::size_t size() const { return d_size; }
 
   unsigned char getFirstChar() const { return getUnsignedCharAt(0); }
   unsigned char getLastChar() const { return getUnsignedCharAt(size() - 1); }
@@ -181,24 +179,48 @@ class CVC4_PUBLIC String {
   bool isNumber() const;
   int toNumber() const;
 
-  const std::vector<unsigned>& getVec() const { return d_str; }
+  /**
+   * Get the internal unsigned of the character at position i, see
+   * convertUnsignedIntToChar.
+   */
+  unsigned operator[](std::size_t i) const { return data()[i]; }
+  /**
+   * Get the internal unsigneds of the characters of this string. This returns
+   * a copy; operator[] accesses a single character without copying.
+   */
+  std::vector<unsigned> getVec() const;
+  /** Get a hash value for this string */
+  std::size_t hash() const;
   /** is the unsigned a digit?
-  * The input should be the same type as the element type of d_str
+  * The input should be an internal unsigned, see operator[]
   */
   static bool isDigit(unsigned character);
 
   /**
    * Returns the maximum length of string representable by this class.
-   * Corresponds to the maximum size of d_str.
+   * Corresponds to the maximum size of d_buf.
    */
   static size_t maxSize();
  private:
   // guarded
   static unsigned char hexToDec(unsigned char c);
 
-  static std::vector<unsigned> toInternal(const std::string& s,
-                                          bool useEscSequences = true);
+  /** Construct the string whose internal unsigneds are the bytes of buf */
+  explicit String(std::vector<unsigned char>&& buf);
+  /** Construct the substring of length size at start of buf */
+  String(const std::shared_ptr<const std::vector<unsigned char> >& buf,
+         std::size_t start,
+         std::size_t size)
+      : d_buf(buf), d_start(start), d_size(size) {}
+
+  static std::vector<unsigned char> toInternal(const std::string& s,
+                                               bool useEscSequences = true);
   unsigned char getUnsignedCharAt(size_t pos) const;
+  /** Get the internal unsigneds of this string, or null if it is empty */
+  const unsigned char* data() const
+  {
+    return d_size == 0 ? nullptr : d_buf->data() + d_start;
+  }
 
   /**
    * Returns a negative number if *this < y, 0 if *this and y are equal and a
@@ -206,14 +228,23 @@ class CVC4_PUBLIC String {
    */
   int cmp(const String& y) const;
 
-  std::vector<unsigned> d_str;
+  /**
+   * The buffer storing the internal unsigneds of this string, one byte per
+   * character, since they are less than num_codes(). Buffers are immutable,
+   * and are shared between a string, its copies and its substrings.
+   */
+  std::shared_ptr<const std::vector<unsigned char> > d_buf;
+  /** The position of the first character of this string in d_buf */
+  std::size_t d_start;
+  /** The length of this string */
+  std::size_t d_size;
 }; /* class String */
 
 namespace strings {
 
 struct CVC4_PUBLIC StringHashFunction {
   size_t operator()(const ::CVC4::String& s) const {
-    return std::hash<std::string>()(s.toString());
+    return s.hash();
   }
 }; /* struct StringHashFunction */
 
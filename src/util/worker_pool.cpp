@@ -0,0 +1,88 @@
+/*********************                                                        */
+/*! \file worker_pool.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A fixed set of worker threads.
+ **
+ ** A fixed set of worker threads that run the parts of a batch of jobs.
+ **/
+
+#include "util/worker_pool.h"
+
+#include "base/cvc4_assert.h"
+
+namespace CVC4 {
+
+WorkerPool::WorkerPool(size_t numWorkers)
+  : d_threads()
+  , d_mutex()
+  , d_start()
+  , d_done()
+  , d_job(NULL)
+  , d_active(0)
+  , d_pending(0)
+  , d_batch(0)
+  , d_stop(false)
+{
+  for(size_t t = 0; t < numWorkers; ++t){
+    d_threads.push_back(std::thread(&WorkerPool::work, this, t));
+  }
+}
+
+WorkerPool::~WorkerPool(){
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_stop = true;
+  }
+  d_start.notify_all();
+  for(std::thread& t : d_threads){
+    t.join();
+  }
+}
+
+void WorkerPool::run(size_t n, const std::function<void(size_t)>& job){
+  Assert(n >= 1 && n <= d_threads.size() + 1);
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_job = &job;
+    d_active = n - 1;
+    d_pending = n - 1;
+    ++d_batch;
+  }
+  d_start.notify_all();
+  job(0);
+  std::unique_lock<std::mutex> lock(d_mutex);
+  d_done.wait(lock, [this]{ return d_pending == 0; });
+  d_job = NULL;
+}
+
+void WorkerPool::work(size_t t){
+  uint64_t seen = 0;
+  std::unique_lock<std::mutex> lock(d_mutex);
+  while(true){
+    d_start.wait(lock, [&]{ return d_stop || d_batch != seen; });
+    if(d_stop){
+      return;
+    }
+    seen = d_batch;
+    if(t >= d_active){
+      continue;
+    }
+    const std::function<void(size_t)>* job = d_job;
+    lock.unlock();
+    (*job)(t + 1);
+    lock.lock();
+    if(--d_pending == 0){
+      d_done.notify_one();
+    }
+  }
+}
+
+}/* CVC4 namespace */
@@ -0,0 +1,77 @@
+/*********************                                                        */
+/*! \file worker_pool.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A fixed set of worker threads.
+ **
+ ** A fixed set of worker threads that run the parts of a batch of jobs.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__UTIL__WORKER_POOL_H
+#define __CVC4__UTIL__WORKER_POOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CVC4 {
+
+/**
+ * A fixed set of worker threads that run the parts of a batch of jobs. The
+ * threads are started once and wait for the next batch in between, so that a
+ * batch does not pay for starting threads.
+ */
+class WorkerPool {
+public:
+  /** Starts numWorkers threads. */
+  WorkerPool(size_t numWorkers);
+  /** Stops and joins the threads. */
+  ~WorkerPool();
+
+  /** The number of worker threads. */
+  size_t size() const { return d_threads.size(); }
+
+  /**
+   * Calls job(i) for each i in [0, n), where job(0) runs on the calling
+   * thread and job(i) for i > 0 on worker i-1. Returns once all calls have
+   * returned. n must be at most size() + 1.
+   */
+  void run(size_t n, const std::function<void(size_t)>& job);
+
+private:
+  /** The loop of worker t. */
+  void work(size_t t);
+
+  std::vector<std::thread> d_threads;
+  std::mutex d_mutex;
+  /** Signals a new batch, or that the workers must stop. */
+  std::condition_variable d_start;
+  /** Signals that the last worker of a batch is done. */
+  std::condition_variable d_done;
+  /** The job of the current batch. */
+  const std::function<void(size_t)>* d_job;
+  /** The number of workers taking part in the current batch. */
+  size_t d_active;
+  /** The number of workers of the current batch that are not done. */
+  size_t d_pending;
+  /** Incremented with each batch. */
+  uint64_t d_batch;
+  /** Whether the workers must stop. */
+  bool d_stop;
+};/* class WorkerPool */
+
+}/* CVC4 namespace */
+
+#endif /* __CVC4__UTIL__WORKER_POOL_H */
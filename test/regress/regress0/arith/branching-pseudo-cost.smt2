@@ -0,0 +1,19 @@
+; COMMAND-LINE: --incremental --arith-branching=pseudo-cost --arith-cut-pool
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (and (<= 0 x) (<= x 10) (<= 0 y) (<= y 10) (<= 0 z) (<= z 10)))
+(assert (= (+ (* 3 x) (* 5 y) (* 7 z)) 29))
+(assert (>= (+ x y) 3))
+(check-sat)
+(push 1)
+(assert (< (+ x y z) 5))
+(assert (> (* 2 z) 3))
+(check-sat)
+(pop 1)
+(assert (distinct x y z))
+(check-sat)
@@ -0,0 +1,18 @@
+; COMMAND-LINE: --incremental --arith-cut-pool --arith-cut-pool-max-age=1
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (and (<= 0 x) (<= x 10) (<= 0 y) (<= y 10) (<= 0 z) (<= z 10)))
+(assert (= (+ (* 4 x) (* 6 y) (* 9 z)) 35))
+(check-sat)
+(push 1)
+(assert (>= z 3))
+(assert (>= y 1))
+(check-sat)
+(pop 1)
+(assert (distinct x y))
+(check-sat)
@@ -0,0 +1,19 @@
+; COMMAND-LINE: --incremental --use-fp-simplex --heuristic-pivots=0 --standard-effort-variable-order-pivots=0
+; EXPECT: sat
+; EXPECT: unsat
+; With no pivots allowed in the first pass of the exact simplex, every check
+; that needs a pivot goes through the floating-point relaxation.
+(set-logic QF_LRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(assert (<= (+ x y z) 10))
+(assert (>= (- x y) (/ 1 3)))
+(assert (>= (+ (* 2 y) z) 4))
+(assert (>= (- z x) (- 2)))
+(assert (> x 1))
+(check-sat)
+(push 1)
+(assert (>= (+ x (* 3 y) (* 2 z)) 20))
+(check-sat)
+(pop 1)
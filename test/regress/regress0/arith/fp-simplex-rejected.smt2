@@ -0,0 +1,18 @@
+; COMMAND-LINE: --incremental --use-fp-simplex --heuristic-pivots=0 --standard-effort-variable-order-pivots=0
+; EXPECT: sat
+; EXPECT: unsat
+; The bound 10^-12 is below the tolerance of the floating-point relaxation,
+; which considers the starting assignment x = y = z = 0 feasible. The exact
+; simplex must reject that answer: it repairs it to a model in the first
+; check and finds the conflict on the cycle in the second.
+(set-logic QF_LRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(assert (>= (- x y) (/ 1 1000000000000)))
+(assert (>= (- y z) 0))
+(check-sat)
+(push 1)
+(assert (>= (- z x) 0))
+(check-sat)
+(pop 1)
@@ -0,0 +1,17 @@
+; COMMAND-LINE: --incremental --use-fp-simplex
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_LRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(assert (<= (+ x y z) 10))
+(assert (>= (- x y) (/ 1 3)))
+(assert (>= (+ (* 2 y) z) 4))
+(assert (>= (- z x) (- 2)))
+(assert (> x 1))
+(check-sat)
+(push 1)
+(assert (>= (+ x (* 3 y) (* 2 z)) 20))
+(check-sat)
+(pop 1)
@@ -0,0 +1,14 @@
+; COMMAND-LINE: --arith-pivot-threads=4
+; EXPECT: unsat
+(set-logic QF_LRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(declare-fun w () Real)
+(assert (<= (+ x y z w) 10))
+(assert (>= (- x y) 1))
+(assert (>= (- y z) 1))
+(assert (>= (- z w) 1))
+(assert (>= w 1))
+(assert (>= (+ (* 2 x) y) 15))
+(check-sat)
@@ -0,0 +1,20 @@
+; COMMAND-LINE: --incremental --use-revised-simplex
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_LRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(assert (>= (+ x y z) 6))
+(assert (<= (- x y) 1))
+(assert (<= (- y z) 1))
+(assert (<= (+ x (* 2 z)) 7))
+(check-sat)
+(push 1)
+(assert (<= (+ x y) 1))
+(assert (<= z 4))
+(check-sat)
+(pop 1)
+(assert (>= x 2))
+(check-sat)
@@ -0,0 +1,17 @@
+; COMMAND-LINE: --bv-quick-xplain
+; COMMAND-LINE: --bv-algebraic-solver
+; COMMAND-LINE: --bitblast=eager --no-check-proofs
+; EXPECT: unsat
+; The shifts below are by at least the bit-width, so their bits depend on the
+; atom y >= 8 that their bit-blasting strategy introduces. Every bit-blaster
+; that reuses the bits of the terms above the shifts must define that atom.
+(set-logic QF_BV)
+(set-info :status unsat)
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+(declare-fun z () (_ BitVec 8))
+(assert (bvuge y #x08))
+(assert (or (= (bvmul (bvshl x y) z) #x03)
+            (= (bvmul (bvlshr x y) z) #x05)
+            (= (bvand (bvashr x y) #x7e) #x02)))
+(check-sat)
@@ -0,0 +1,10 @@
+; COMMAND-LINE: --bv-fixed-bits-solver
+; EXPECT: unsat
+(set-logic QF_BV)
+(set-info :status unsat)
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+(assert (= ((_ extract 0 0) x) #b1))
+(assert (= ((_ extract 0 0) y) #b1))
+(assert (= ((_ extract 0 0) (bvmul x y)) #b0))
+(check-sat)
@@ -0,0 +1,10 @@
+; COMMAND-LINE: --bv-fixed-bits-solver
+; EXPECT: sat
+(set-logic QF_BV)
+(set-info :status sat)
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+(assert (bvult (bvadd x #x01) #x10))
+(assert (= (concat ((_ extract 7 4) y) #x0) (bvshl x #x04)))
+(assert (not (= y #x00)))
+(check-sat)
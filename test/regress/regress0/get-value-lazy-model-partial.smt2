@@ -0,0 +1,21 @@
+; COMMAND-LINE: --incremental --model-lazy
+; EXPECT: sat
+; EXPECT: ((x 2))
+; EXPECT: (((f x) 3))
+; EXPECT: (((select a 2) 5))
+; EXPECT: ((x 2) ((f x) 3))
+(set-info :smt-lib-version 2.0)
+(set-option :produce-models true)
+(set-logic QF_AUFLIA)
+
+(declare-fun f (Int) Int)
+(declare-fun a () (Array Int Int))
+(declare-fun x () Int)
+(assert (= x 2))
+(assert (= (f x) 3))
+(assert (= (select a x) 5))
+(check-sat)
+(get-value (x))
+(get-value ((f x)))
+(get-value ((select a 2)))
+(get-value (x (f x)))
@@ -0,0 +1,22 @@
+; COMMAND-LINE: --incremental --model-lazy
+; EXPECT: sat
+; EXPECT: (((f 0) 1))
+; EXPECT: sat
+; EXPECT: ((x 2) ((f x) 3))
+; EXPECT: sat
+(set-info :smt-lib-version 2.0)
+(set-option :produce-models true)
+(set-logic QF_UFLIA)
+
+(declare-fun f (Int) Int)
+(declare-fun x () Int)
+(assert (= (f 0) 1))
+(check-sat)
+(get-value ((f 0)))
+(push)
+(assert (= x 2))
+(assert (= (f x) 3))
+(check-sat)
+(get-value (x (f x)))
+(pop)
+(check-sat)
@@ -0,0 +1,18 @@
+; COMMAND-LINE: --incremental --use-theory=idl
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_IDL)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (<= (- x y) 2))
+(assert (<= (- y z) (- 3)))
+(assert (or (>= (- x z) 0) (<= (- z y) 5)))
+(check-sat)
+(push 1)
+(assert (> (- x z) (- 1)))
+(check-sat)
+(pop 1)
+(assert (distinct x (- z 1)))
+(check-sat)
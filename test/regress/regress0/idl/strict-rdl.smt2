@@ -0,0 +1,10 @@
+; COMMAND-LINE: --use-theory=idl
+; EXPECT: unsat
+(set-logic QF_RDL)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(assert (< (- x y) 0))
+(assert (< (- y z) 0))
+(assert (or (< (- z x) 0) (= x z)))
+(check-sat)
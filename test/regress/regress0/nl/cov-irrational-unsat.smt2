@@ -0,0 +1,10 @@
+; COMMAND-LINE: --nl-ext --nl-cov
+; EXPECT: unsat
+(set-logic QF_NRA)
+(set-info :status unsat)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(assert (= (* x x) 2.0))
+(assert (> (* x x x) 3.0))
+(assert (< (* x y) y))
+(check-sat)
@@ -0,0 +1,10 @@
+; COMMAND-LINE: --nl-ext --nl-cov
+; EXPECT: sat
+(set-logic QF_NRA)
+(set-info :status sat)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(assert (= (* x x x) 8.0))
+(assert (= (* x y y) 18.0))
+(assert (> y 0.0))
+(check-sat)
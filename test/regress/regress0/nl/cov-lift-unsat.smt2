@@ -0,0 +1,10 @@
+; COMMAND-LINE: --nl-ext --nl-cov
+; EXPECT: unsat
+(set-logic QF_NRA)
+(set-info :status unsat)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(assert (= (* x x) 4.0))
+(assert (> x 0.0))
+(assert (< (* x y y) (- 1.0)))
+(check-sat)
@@ -0,0 +1,19 @@
+; COMMAND-LINE: --incremental --nl-ext --nl-ext-inc-refine
+; EXPECT: unsat
+; EXPECT: unsat
+(set-logic QF_NRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(assert (> x 0))
+(assert (> y 0))
+(assert (< x 1))
+(push 1)
+(assert (< y 1))
+(assert (> (* x y) 1))
+(check-sat)
+(pop 1)
+(push 1)
+(assert (<= y 1))
+(assert (>= (* x y) 1))
+(check-sat)
+(pop 1)
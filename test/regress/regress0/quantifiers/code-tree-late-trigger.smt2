@@ -0,0 +1,16 @@
+; COMMAND-LINE: --no-quant-cf
+; EXPECT: unsat
+; The trigger of the first quantified formula matches no term, so it adds no
+; instantiation in the first round. The trigger of the second one, created
+; after f was matched for the first, must still be matched in that round.
+(set-logic UF)
+(declare-sort U 0)
+(declare-fun f (U U) U)
+(declare-fun P (U) Bool)
+(declare-fun a () U)
+(declare-fun b () U)
+(declare-fun c () U)
+(assert (forall ((x U)) (! (P x) :pattern ((f x c)))))
+(assert (forall ((x U) (y U)) (! (not (= (f x y) a)) :pattern ((f x y)))))
+(assert (= (f a b) a))
+(check-sat)
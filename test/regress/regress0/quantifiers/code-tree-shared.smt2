@@ -0,0 +1,17 @@
+; EXPECT: unsat
+(set-logic UF)
+(declare-sort U 0)
+(declare-fun f (U U) U)
+(declare-fun P (U) Bool)
+(declare-fun Q (U) Bool)
+(declare-fun R (U U) Bool)
+(declare-fun a () U)
+(declare-fun b () U)
+(declare-fun c () U)
+(assert (forall ((x U) (y U)) (! (R x y) :pattern ((f x y)))))
+(assert (forall ((z U)) (! (P (f z z)) :pattern ((f z z)))))
+(assert (forall ((x U)) (! (Q x) :pattern ((f x a)))))
+(assert (= c (f b b)))
+(assert (= (f a b) (f b a)))
+(assert (or (not (P c)) (not (Q b)) (not (R a b))))
+(check-sat)
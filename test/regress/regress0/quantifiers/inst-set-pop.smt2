@@ -0,0 +1,21 @@
+; COMMAND-LINE: --incremental
+; EXPECT: unsat
+; EXPECT: unsat
+; EXPECT: unsat
+(set-logic UF)
+(declare-sort U 0)
+(declare-fun f (U U) U)
+(declare-fun P (U) Bool)
+(declare-fun a () U)
+(declare-fun b () U)
+(assert (forall ((x U) (y U)) (! (P (f x y)) :pattern ((f x y)))))
+(push 1)
+(assert (not (P (f a b))))
+(check-sat)
+(pop 1)
+(push 1)
+(assert (not (P (f a b))))
+(check-sat)
+(pop 1)
+(assert (or (not (P (f b a))) (not (P (f a b)))))
+(check-sat)
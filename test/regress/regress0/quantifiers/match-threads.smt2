@@ -0,0 +1,16 @@
+; COMMAND-LINE: --quant-match-threads=4
+; EXPECT: unsat
+(set-logic UF)
+(declare-sort U 0)
+(declare-fun f (U U) U)
+(declare-fun g (U) U)
+(declare-fun h (U) U)
+(declare-fun P (U) Bool)
+(declare-fun a () U)
+(declare-fun b () U)
+(assert (forall ((x U) (y U)) (! (P (f x y)) :pattern ((f x y)))))
+(assert (forall ((x U)) (! (= (g (g x)) x) :pattern ((g x)))))
+(assert (forall ((x U)) (! (= (h x) (g x)) :pattern ((h x)))))
+(assert (= a (h (g b))))
+(assert (or (not (= a b)) (not (P (f a b)))))
+(check-sat)
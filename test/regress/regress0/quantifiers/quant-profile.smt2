@@ -0,0 +1,12 @@
+; COMMAND-LINE: --quant-profile
+; ERROR-SCRUBBER: grep -o "^(quantifier-profile"
+; EXPECT: unsat
+; EXPECT-ERROR: (quantifier-profile
+(set-logic UF)
+(declare-sort U 0)
+(declare-fun f (U) U)
+(declare-fun P (U) Bool)
+(declare-fun a () U)
+(assert (forall ((x U)) (! (P (f x)) :pattern ((f x)))))
+(assert (not (P (f a))))
+(check-sat)
@@ -0,0 +1,24 @@
+; COMMAND-LINE: --incremental
+; EXPECT: unsat
+; EXPECT: unsat
+; EXPECT: unsat
+(set-logic UF)
+(declare-sort U 0)
+(declare-fun f (U) U)
+(declare-fun P (U) Bool)
+(declare-fun a () U)
+(declare-fun b () U)
+(declare-fun c () U)
+(assert (forall ((x U)) (! (P (f x)) :pattern ((f x)))))
+(push 1)
+(assert (= a (f b)))
+(assert (not (P a)))
+(check-sat)
+(pop 1)
+(assert (or (= c (f a)) (= c (f b))))
+(assert (not (P c)))
+(check-sat)
+(push 1)
+(assert (= a b))
+(check-sat)
+(pop 1)
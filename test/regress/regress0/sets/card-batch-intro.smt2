@@ -0,0 +1,19 @@
+; COMMAND-LINE: --sets-card-intro-batch
+; COMMAND-LINE: --no-sets-card-intro-batch
+; EXPECT: unsat
+(set-logic QF_UFLIAFS)
+(set-info :status unsat)
+(declare-sort E 0)
+(declare-fun a () (Set E))
+(declare-fun b () (Set E))
+(declare-fun c () (Set E))
+(declare-fun u () (Set E))
+(assert (= u (union a (union b c))))
+(assert (>= (card a) 4))
+(assert (>= (card b) 4))
+(assert (>= (card c) 4))
+(assert (= (card (intersection a b)) 0))
+(assert (= (card (intersection b c)) 0))
+(assert (= (card (intersection a c)) 0))
+(assert (<= (card u) 11))
+(check-sat)
@@ -0,0 +1,21 @@
+; COMMAND-LINE: --strings-nf-cache
+; COMMAND-LINE: --no-strings-nf-cache
+; EXPECT: unsat
+(set-info :smt-lib-version 2.5)
+(set-logic QF_SLIA)
+(set-info :status unsat)
+
+; normal forms of equivalence classes that are unchanged across the
+; incremental checks are reused
+(declare-fun x () String)
+(declare-fun y () String)
+(declare-fun z () String)
+(declare-fun w () String)
+
+(assert (= (str.++ x "ab" y) (str.++ z "ab" w)))
+(assert (= (str.len x) (str.len z)))
+(assert (or (= y "c") (= y "d")))
+(assert (or (= w "e") (= w "f")))
+(assert (not (= x z)))
+
+(check-sat)
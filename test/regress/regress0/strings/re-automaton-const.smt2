@@ -0,0 +1,24 @@
+(set-info :smt-lib-version 2.5)
+(set-logic QF_S)
+(set-info :status unsat)
+
+; memberships of constants that are decided by the regular expression automata
+(declare-fun b () Bool)
+
+(assert (or b
+  (not (str.in.re "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa" (re.* (re.* (re.* (re.* (str.to.re "a")))))))
+  (str.in.re "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab" (re.* (re.* (re.* (re.* (str.to.re "a"))))))
+  (not (str.in.re "log-2018_ok" (re.++ (re.+ (re.union (re.range "a" "z") (str.to.re "-"))) (re.range "0" "9") (re.* re.allchar))))
+  (str.in.re "Log" (re.+ (re.range "a" "z")))
+  (not (str.in.re "abab" (re.inter (re.* (str.to.re "ab")) (re.++ (re.* re.allchar) (str.to.re "b")))))
+  (str.in.re "aba" (re.inter (re.* (str.to.re "ab")) (re.++ (re.* re.allchar) (str.to.re "a"))))
+  (not (str.in.re "bbb" (re.loop (str.to.re "b") 2 5)))
+  (str.in.re "bbbbbb" (re.loop (str.to.re "b") 2 5))
+  (not (str.in.re "cccccc" (re.loop (str.to.re "c") 5)))
+  (str.in.re "cccc" (re.loop (str.to.re "c") 5))
+  (not (str.in.re "" (re.opt (str.to.re "x"))))
+  (str.in.re "" re.nostr)
+))
+(assert (not b))
+
+(check-sat)
@@ -0,0 +1,16 @@
+(set-info :smt-lib-version 2.5)
+(set-logic QF_S)
+(set-option :strings-exp true)
+(set-info :status unsat)
+
+; the intersection of the memberships of x is empty, which is detected on the
+; product of their automata
+(declare-fun x () String)
+(declare-fun y () String)
+
+(assert (str.in.re x (re.+ (re.union (re.range "a" "z") (str.to.re "-")))))
+(assert (str.in.re x (re.++ (re.* re.allchar) (re.range "0" "9") (re.* re.allchar))))
+(assert (or (= y x) (= y "abc")))
+(assert (not (str.in.re y (re.* (re.range "a" "c")))))
+
+(check-sat)
@@ -0,0 +1,14 @@
+; EXPECT: sat
+(set-logic QF_SLIA)
+(set-info :status sat)
+(declare-fun s () (Seq Int))
+(declare-fun t () (Seq Int))
+(declare-fun i () Int)
+(assert (= (seq.len s) 3))
+(assert (and (<= 0 i) (< i (seq.len s))))
+(assert (= (seq.nth s i) 5))
+(assert (= t (seq.update s i (seq.unit 7))))
+(assert (not (= s t)))
+(assert (= (seq.extract t 0 1) (seq.unit 7)))
+(assert (not (= s (as seq.empty (Seq Int)))))
+(check-sat)
@@ -0,0 +1,11 @@
+; EXPECT: unsat
+(set-logic QF_SLIA)
+(set-info :status unsat)
+(declare-fun x () (Seq Int))
+(declare-fun y () (Seq Int))
+(declare-fun a () Int)
+(declare-fun b () Int)
+(assert (= (seq.++ x (seq.unit a)) (seq.++ y (seq.unit b))))
+(assert (= (seq.len x) (seq.len y)))
+(assert (> a b))
+(check-sat)
@@ -0,0 +1,26 @@
+; COMMAND-LINE: --minimize-unsat-cores --check-unsat-cores
+; SCRUBBER: sort
+; EXPECT: (
+; EXPECT: )
+; EXPECT: a3
+; EXPECT: a5
+; EXPECT: unsat
+; {a3, a5} is the only unsat core none of whose subsets is an unsat core.
+(set-option :produce-unsat-cores true)
+(set-logic QF_UF)
+(declare-sort U 0)
+(declare-fun f (U) U)
+(declare-fun x () U)
+(declare-fun y () U)
+(declare-fun z () U)
+(declare-fun p () Bool)
+(declare-fun q () Bool)
+(assert (! (or p q) :named a0))
+(assert (! (=> p (= x y)) :named a1))
+(assert (! (=> q (= y z)) :named a2))
+(assert (! (= x y) :named a3))
+(assert (! (= y z) :named a4))
+(assert (! (not (= (f x) (f y))) :named a5))
+(assert (! (not (= (f z) z)) :named a6))
+(check-sat)
+(get-unsat-core)
@@ -0,0 +1,357 @@
+; COMMAND-LINE: --arith-pivot-threads=4 --use-fcsimplex
+; COMMAND-LINE: --arith-pivot-threads=4 --use-soi
+; EXPECT: unsat
+; Every variable occurs in every row, so that a batch of candidate entering
+; variables of the focusing and sum-of-infeasibilities simplex procedures
+; has enough column entries to be evaluated on several threads.
+(set-logic QF_LRA)
+(declare-fun x0 () Real)
+(declare-fun x1 () Real)
+(declare-fun x2 () Real)
+(declare-fun x3 () Real)
+(declare-fun x4 () Real)
+(declare-fun x5 () Real)
+(declare-fun x6 () Real)
+(declare-fun x7 () Real)
+(declare-fun x8 () Real)
+(declare-fun x9 () Real)
+(declare-fun x10 () Real)
+(declare-fun x11 () Real)
+(declare-fun x12 () Real)
+(declare-fun x13 () Real)
+(declare-fun x14 () Real)
+(declare-fun x15 () Real)
+(declare-fun x16 () Real)
+(declare-fun x17 () Real)
+(declare-fun x18 () Real)
+(declare-fun x19 () Real)
+(declare-fun x20 () Real)
+(declare-fun x21 () Real)
+(declare-fun x22 () Real)
+(declare-fun x23 () Real)
+(assert (>= x0 0))
+(assert (>= x1 0))
+(assert (>= x2 0))
+(assert (>= x3 0))
+(assert (>= x4 0))
+(assert (>= x5 0))
+(assert (>= x6 0))
+(assert (>= x7 0))
+(assert (>= x8 0))
+(assert (>= x9 0))
+(assert (>= x10 0))
+(assert (>= x11 0))
+(assert (>= x12 0))
+(assert (>= x13 0))
+(assert (>= x14 0))
+(assert (>= x15 0))
+(assert (>= x16 0))
+(assert (>= x17 0))
+(assert (>= x18 0))
+(assert (>= x19 0))
+(assert (>= x20 0))
+(assert (>= x21 0))
+(assert (>= x22 0))
+(assert (>= x23 0))
+(assert (>= (+ (* 5 x0) (* 3 x1) (* 5 x2) (* 1 x3) (* 2 x4) (* 1 x5) (* 4 x6) (* 3 x7) (* 1 x8) (* 4 x9) (* 3 x10) (* 3 x11) (* 1 x12) (* 5 x13) (* 5 x14) (* 2 x15) (* 1 x16) (* 3 x17) (* 3 x18) (* 5 x19) (* 1 x20) (* 2 x21) (* 5 x22) (* 1 x23)) 87))
+(assert (>= (+ (* 3 x0) (* 3 x1) (* 5 x2) (* 1 x3) (* 4 x4) (* 2 x5) (* 5 x6) (* 3 x7) (* 3 x8) (* 4 x9) (* 3 x10) (* 2 x11) (* 2 x12) (* 4 x13) (* 5 x14) (* 2 x15) (* 5 x16) (* 2 x17) (* 5 x18) (* 4 x19) (* 5 x20) (* 4 x21) (* 2 x22) (* 2 x23)) 94))
+(assert (>= (+ (* 5 x0) (* 1 x1) (* 4 x2) (* 3 x3) (* 4 x4) (* 1 x5) (* 5 x6) (* 3 x7) (* 2 x8) (* 2 x9) (* 4 x10) (* 3 x11) (* 4 x12) (* 1 x13) (* 5 x14) (* 4 x15) (* 4 x16) (* 4 x17) (* 3 x18) (* 2 x19) (* 4 x20) (* 3 x21) (* 2 x22) (* 2 x23)) 100))
+(assert (>= (+ (* 3 x0) (* 3 x1) (* 1 x2) (* 3 x3) (* 5 x4) (* 1 x5) (* 5 x6) (* 5 x7) (* 3 x8) (* 4 x9) (* 2 x10) (* 4 x11) (* 3 x12) (* 5 x13) (* 3 x14) (* 5 x15) (* 4 x16) (* 1 x17) (* 1 x18) (* 1 x19) (* 3 x20) (* 4 x21) (* 3 x22) (* 2 x23)) 103))
+(assert (>= (+ (* 4 x0) (* 3 x1) (* 4 x2) (* 3 x3) (* 3 x4) (* 1 x5) (* 5 x6) (* 3 x7) (* 5 x8) (* 5 x9) (* 1 x10) (* 2 x11) (* 3 x12) (* 1 x13) (* 5 x14) (* 3 x15) (* 1 x16) (* 5 x17) (* 4 x18) (* 2 x19) (* 3 x20) (* 2 x21) (* 4 x22) (* 2 x23)) 127))
+(assert (>= (+ (* 4 x0) (* 2 x1) (* 1 x2) (* 4 x3) (* 3 x4) (* 5 x5) (* 2 x6) (* 2 x7) (* 3 x8) (* 4 x9) (* 5 x10) (* 5 x11) (* 5 x12) (* 5 x13) (* 4 x14) (* 1 x15) (* 4 x16) (* 4 x17) (* 5 x18) (* 4 x19) (* 4 x20) (* 2 x21) (* 2 x22) (* 1 x23)) 130))
+(assert (>= (+ (* 4 x0) (* 5 x1) (* 3 x2) (* 2 x3) (* 5 x4) (* 4 x5) (* 4 x6) (* 2 x7) (* 4 x8) (* 5 x9) (* 3 x10) (* 4 x11) (* 3 x12) (* 5 x13) (* 5 x14) (* 1 x15) (* 2 x16) (* 2 x17) (* 5 x18) (* 3 x19) (* 1 x20) (* 3 x21) (* 1 x22) (* 1 x23)) 137))
+(assert (>= (+ (* 4 x0) (* 4 x1) (* 5 x2) (* 3 x3) (* 2 x4) (* 5 x5) (* 5 x6) (* 3 x7) (* 1 x8) (* 3 x9) (* 3 x10) (* 3 x11) (* 3 x12) (* 1 x13) (* 3 x14) (* 3 x15) (* 2 x16) (* 4 x17) (* 5 x18) (* 4 x19) (* 1 x20) (* 1 x21) (* 1 x22) (* 1 x23)) 130))
+(assert (>= (+ (* 1 x0) (* 5 x1) (* 3 x2) (* 4 x3) (* 5 x4) (* 1 x5) (* 2 x6) (* 4 x7) (* 4 x8) (* 1 x9) (* 4 x10) (* 3 x11) (* 2 x12) (* 1 x13) (* 2 x14) (* 5 x15) (* 4 x16) (* 3 x17) (* 2 x18) (* 3 x19) (* 1 x20) (* 4 x21) (* 4 x22) (* 2 x23)) 108))
+(assert (>= (+ (* 2 x0) (* 1 x1) (* 5 x2) (* 2 x3) (* 1 x4) (* 1 x5) (* 3 x6) (* 3 x7) (* 2 x8) (* 3 x9) (* 5 x10) (* 3 x11) (* 3 x12) (* 4 x13) (* 2 x14) (* 5 x15) (* 3 x16) (* 5 x17) (* 4 x18) (* 3 x19) (* 5 x20) (* 5 x21) (* 5 x22) (* 3 x23)) 125))
+(assert (>= (+ (* 4 x0) (* 2 x1) (* 1 x2) (* 1 x3) (* 2 x4) (* 2 x5) (* 3 x6) (* 3 x7) (* 4 x8) (* 4 x9) (* 1 x10) (* 2 x11) (* 5 x12) (* 4 x13) (* 2 x14) (* 3 x15) (* 2 x16) (* 1 x17) (* 4 x18) (* 2 x19) (* 3 x20) (* 5 x21) (* 3 x22) (* 5 x23)) 98))
+(assert (>= (+ (* 3 x0) (* 4 x1) (* 1 x2) (* 3 x3) (* 4 x4) (* 4 x5) (* 3 x6) (* 5 x7) (* 1 x8) (* 1 x9) (* 4 x10) (* 2 x11) (* 5 x12) (* 1 x13) (* 2 x14) (* 5 x15) (* 1 x16) (* 3 x17) (* 5 x18) (* 3 x19) (* 1 x20) (* 1 x21) (* 1 x22) (* 3 x23)) 115))
+(assert (>= (+ (* 3 x0) (* 1 x1) (* 2 x2) (* 4 x3) (* 2 x4) (* 2 x5) (* 5 x6) (* 2 x7) (* 5 x8) (* 2 x9) (* 5 x10) (* 5 x11) (* 2 x12) (* 4 x13) (* 3 x14) (* 3 x15) (* 3 x16) (* 2 x17) (* 3 x18) (* 1 x19) (* 4 x20) (* 3 x21) (* 5 x22) (* 5 x23)) 93))
+(assert (>= (+ (* 1 x0) (* 1 x1) (* 3 x2) (* 2 x3) (* 4 x4) (* 5 x5) (* 4 x6) (* 1 x7) (* 5 x8) (* 1 x9) (* 3 x10) (* 3 x11) (* 4 x12) (* 1 x13) (* 1 x14) (* 2 x15) (* 1 x16) (* 5 x17) (* 1 x18) (* 4 x19) (* 5 x20) (* 4 x21) (* 4 x22) (* 1 x23)) 94))
+(assert (>= (+ (* 1 x0) (* 4 x1) (* 3 x2) (* 5 x3) (* 2 x4) (* 1 x5) (* 1 x6) (* 4 x7) (* 3 x8) (* 4 x9) (* 5 x10) (* 2 x11) (* 4 x12) (* 5 x13) (* 2 x14) (* 4 x15) (* 5 x16) (* 2 x17) (* 2 x18) (* 2 x19) (* 1 x20) (* 5 x21) (* 1 x22) (* 4 x23)) 147))
+(assert (>= (+ (* 2 x0) (* 2 x1) (* 2 x2) (* 4 x3) (* 3 x4) (* 1 x5) (* 4 x6) (* 1 x7) (* 1 x8) (* 3 x9) (* 1 x10) (* 4 x11) (* 3 x12) (* 4 x13) (* 4 x14) (* 3 x15) (* 5 x16) (* 2 x17) (* 1 x18) (* 1 x19) (* 3 x20) (* 4 x21) (* 3 x22) (* 5 x23)) 113))
+(assert (>= (+ (* 1 x0) (* 4 x1) (* 4 x2) (* 4 x3) (* 5 x4) (* 3 x5) (* 2 x6) (* 1 x7) (* 3 x8) (* 3 x9) (* 3 x10) (* 2 x11) (* 4 x12) (* 4 x13) (* 5 x14) (* 3 x15) (* 5 x16) (* 3 x17) (* 4 x18) (* 2 x19) (* 4 x20) (* 3 x21) (* 2 x22) (* 2 x23)) 100))
+(assert (>= (+ (* 1 x0) (* 3 x1) (* 2 x2) (* 5 x3) (* 2 x4) (* 2 x5) (* 3 x6) (* 2 x7) (* 2 x8) (* 5 x9) (* 5 x10) (* 5 x11) (* 5 x12) (* 4 x13) (* 1 x14) (* 4 x15) (* 4 x16) (* 3 x17) (* 3 x18) (* 3 x19) (* 3 x20) (* 3 x21) (* 3 x22) (* 4 x23)) 150))
+(assert (>= (+ (* 5 x0) (* 5 x1) (* 2 x2) (* 1 x3) (* 2 x4) (* 4 x5) (* 4 x6) (* 5 x7) (* 4 x8) (* 3 x9) (* 4 x10) (* 3 x11) (* 3 x12) (* 2 x13) (* 1 x14) (* 2 x15) (* 1 x16) (* 2 x17) (* 5 x18) (* 5 x19) (* 5 x20) (* 1 x21) (* 4 x22) (* 2 x23)) 143))
+(assert (>= (+ (* 2 x0) (* 1 x1) (* 5 x2) (* 3 x3) (* 5 x4) (* 3 x5) (* 1 x6) (* 2 x7) (* 3 x8) (* 1 x9) (* 2 x10) (* 3 x11) (* 4 x12) (* 4 x13) (* 4 x14) (* 3 x15) (* 3 x16) (* 4 x17) (* 5 x18) (* 1 x19) (* 4 x20) (* 3 x21) (* 3 x22) (* 2 x23)) 102))
+(assert (>= (+ (* 1 x0) (* 5 x1) (* 4 x2) (* 3 x3) (* 1 x4) (* 1 x5) (* 3 x6) (* 4 x7) (* 5 x8) (* 5 x9) (* 3 x10) (* 4 x11) (* 3 x12) (* 5 x13) (* 3 x14) (* 5 x15) (* 4 x16) (* 2 x17) (* 4 x18) (* 1 x19) (* 3 x20) (* 4 x21) (* 2 x22) (* 4 x23)) 86))
+(assert (>= (+ (* 3 x0) (* 5 x1) (* 2 x2) (* 3 x3) (* 2 x4) (* 4 x5) (* 5 x6) (* 2 x7) (* 1 x8) (* 4 x9) (* 1 x10) (* 4 x11) (* 4 x12) (* 1 x13) (* 4 x14) (* 3 x15) (* 3 x16) (* 1 x17) (* 5 x18) (* 1 x19) (* 3 x20) (* 3 x21) (* 1 x22) (* 5 x23)) 98))
+(assert (>= (+ (* 5 x0) (* 4 x1) (* 2 x2) (* 5 x3) (* 5 x4) (* 2 x5) (* 4 x6) (* 1 x7) (* 5 x8) (* 2 x9) (* 2 x10) (* 4 x11) (* 5 x12) (* 4 x13) (* 5 x14) (* 3 x15) (* 3 x16) (* 5 x17) (* 4 x18) (* 4 x19) (* 1 x20) (* 3 x21) (* 5 x22) (* 4 x23)) 103))
+(assert (>= (+ (* 5 x0) (* 5 x1) (* 3 x2) (* 4 x3) (* 3 x4) (* 1 x5) (* 5 x6) (* 2 x7) (* 2 x8) (* 1 x9) (* 2 x10) (* 5 x11) (* 1 x12) (* 1 x13) (* 2 x14) (* 3 x15) (* 5 x16) (* 3 x17) (* 2 x18) (* 5 x19) (* 3 x20) (* 3 x21) (* 2 x22) (* 4 x23)) 146))
+(assert (>= (+ (* 5 x0) (* 2 x1) (* 2 x2) (* 3 x3) (* 4 x4) (* 4 x5) (* 1 x6) (* 4 x7) (* 2 x8) (* 2 x9) (* 3 x10) (* 2 x11) (* 4 x12) (* 1 x13) (* 2 x14) (* 4 x15) (* 2 x16) (* 1 x17) (* 4 x18) (* 2 x19) (* 3 x20) (* 1 x21) (* 2 x22) (* 5 x23)) 119))
+(assert (>= (+ (* 1 x0) (* 3 x1) (* 4 x2) (* 4 x3) (* 4 x4) (* 2 x5) (* 4 x6) (* 1 x7) (* 2 x8) (* 5 x9) (* 3 x10) (* 4 x11) (* 5 x12) (* 2 x13) (* 1 x14) (* 1 x15) (* 2 x16) (* 3 x17) (* 1 x18) (* 4 x19) (* 3 x20) (* 1 x21) (* 1 x22) (* 2 x23)) 137))
+(assert (>= (+ (* 5 x0) (* 1 x1) (* 5 x2) (* 5 x3) (* 2 x4) (* 2 x5) (* 1 x6) (* 3 x7) (* 3 x8) (* 4 x9) (* 3 x10) (* 2 x11) (* 1 x12) (* 5 x13) (* 4 x14) (* 5 x15) (* 5 x16) (* 1 x17) (* 5 x18) (* 4 x19) (* 3 x20) (* 3 x21) (* 3 x22) (* 1 x23)) 148))
+(assert (>= (+ (* 2 x0) (* 5 x1) (* 1 x2) (* 4 x3) (* 1 x4) (* 2 x5) (* 5 x6) (* 4 x7) (* 4 x8) (* 5 x9) (* 1 x10) (* 1 x11) (* 5 x12) (* 5 x13) (* 4 x14) (* 2 x15) (* 4 x16) (* 2 x17) (* 3 x18) (* 3 x19) (* 4 x20) (* 2 x21) (* 5 x22) (* 2 x23)) 149))
+(assert (>= (+ (* 1 x0) (* 1 x1) (* 3 x2) (* 4 x3) (* 4 x4) (* 2 x5) (* 3 x6) (* 4 x7) (* 5 x8) (* 2 x9) (* 2 x10) (* 1 x11) (* 1 x12) (* 1 x13) (* 1 x14) (* 2 x15) (* 2 x16) (* 3 x17) (* 5 x18) (* 5 x19) (* 2 x20) (* 2 x21) (* 4 x22) (* 4 x23)) 122))
+(assert (>= (+ (* 1 x0) (* 1 x1) (* 2 x2) (* 3 x3) (* 1 x4) (* 4 x5) (* 1 x6) (* 1 x7) (* 5 x8) (* 5 x9) (* 5 x10) (* 5 x11) (* 4 x12) (* 4 x13) (* 1 x14) (* 2 x15) (* 1 x16) (* 4 x17) (* 4 x18) (* 4 x19) (* 2 x20) (* 4 x21) (* 5 x22) (* 3 x23)) 113))
+(assert (>= (+ (* 4 x0) (* 3 x1) (* 1 x2) (* 1 x3) (* 1 x4) (* 3 x5) (* 3 x6) (* 1 x7) (* 3 x8) (* 4 x9) (* 4 x10) (* 5 x11) (* 2 x12) (* 4 x13) (* 3 x14) (* 4 x15) (* 2 x16) (* 5 x17) (* 2 x18) (* 5 x19) (* 5 x20) (* 3 x21) (* 2 x22) (* 1 x23)) 93))
+(assert (>= (+ (* 4 x0) (* 2 x1) (* 2 x2) (* 5 x3) (* 4 x4) (* 1 x5) (* 3 x6) (* 4 x7) (* 5 x8) (* 5 x9) (* 3 x10) (* 3 x11) (* 2 x12) (* 2 x13) (* 1 x14) (* 5 x15) (* 1 x16) (* 2 x17) (* 1 x18) (* 4 x19) (* 1 x20) (* 1 x21) (* 3 x22) (* 3 x23)) 133))
+(assert (>= (+ (* 2 x0) (* 1 x1) (* 1 x2) (* 5 x3) (* 2 x4) (* 5 x5) (* 1 x6) (* 2 x7) (* 5 x8) (* 3 x9) (* 2 x10) (* 5 x11) (* 3 x12) (* 4 x13) (* 2 x14) (* 5 x15) (* 2 x16) (* 2 x17) (* 3 x18) (* 2 x19) (* 3 x20) (* 2 x21) (* 1 x22) (* 3 x23)) 146))
+(assert (>= (+ (* 2 x0) (* 4 x1) (* 1 x2) (* 3 x3) (* 4 x4) (* 4 x5) (* 1 x6) (* 1 x7) (* 3 x8) (* 5 x9) (* 5 x10) (* 2 x11) (* 2 x12) (* 3 x13) (* 4 x14) (* 3 x15) (* 4 x16) (* 1 x17) (* 1 x18) (* 5 x19) (* 3 x20) (* 3 x21) (* 5 x22) (* 1 x23)) 103))
+(assert (>= (+ (* 1 x0) (* 5 x1) (* 5 x2) (* 5 x3) (* 1 x4) (* 2 x5) (* 4 x6) (* 1 x7) (* 3 x8) (* 4 x9) (* 5 x10) (* 5 x11) (* 2 x12) (* 2 x13) (* 5 x14) (* 3 x15) (* 4 x16) (* 3 x17) (* 3 x18) (* 1 x19) (* 5 x20) (* 2 x21) (* 1 x22) (* 3 x23)) 127))
+(assert (>= (+ (* 5 x0) (* 3 x1) (* 5 x2) (* 1 x3) (* 5 x4) (* 1 x5) (* 3 x6) (* 1 x7) (* 2 x8) (* 3 x9) (* 1 x10) (* 2 x11) (* 4 x12) (* 1 x13) (* 1 x14) (* 1 x15) (* 4 x16) (* 4 x17) (* 1 x18) (* 1 x19) (* 1 x20) (* 2 x21) (* 3 x22) (* 2 x23)) 89))
+(assert (>= (+ (* 5 x0) (* 5 x1) (* 1 x2) (* 3 x3) (* 1 x4) (* 4 x5) (* 2 x6) (* 2 x7) (* 2 x8) (* 5 x9) (* 2 x10) (* 4 x11) (* 1 x12) (* 3 x13) (* 3 x14) (* 5 x15) (* 2 x16) (* 5 x17) (* 4 x18) (* 2 x19) (* 1 x20) (* 5 x21) (* 1 x22) (* 1 x23)) 149))
+(assert (>= (+ (* 3 x0) (* 2 x1) (* 5 x2) (* 3 x3) (* 5 x4) (* 1 x5) (* 2 x6) (* 5 x7) (* 5 x8) (* 2 x9) (* 3 x10) (* 2 x11) (* 3 x12) (* 2 x13) (* 3 x14) (* 5 x15) (* 5 x16) (* 4 x17) (* 5 x18) (* 2 x19) (* 3 x20) (* 1 x21) (* 3 x22) (* 1 x23)) 83))
+(assert (>= (+ (* 5 x0) (* 1 x1) (* 1 x2) (* 1 x3) (* 3 x4) (* 3 x5) (* 1 x6) (* 5 x7) (* 4 x8) (* 3 x9) (* 4 x10) (* 1 x11) (* 4 x12) (* 4 x13) (* 2 x14) (* 5 x15) (* 5 x16) (* 2 x17) (* 2 x18) (* 4 x19) (* 3 x20) (* 5 x21) (* 2 x22) (* 4 x23)) 136))
+(assert (>= (+ (* 2 x0) (* 4 x1) (* 5 x2) (* 2 x3) (* 3 x4) (* 2 x5) (* 3 x6) (* 1 x7) (* 3 x8) (* 5 x9) (* 5 x10) (* 4 x11) (* 4 x12) (* 3 x13) (* 5 x14) (* 3 x15) (* 4 x16) (* 4 x17) (* 5 x18) (* 1 x19) (* 3 x20) (* 3 x21) (* 5 x22) (* 2 x23)) 142))
+(assert (>= (+ (* 3 x0) (* 4 x1) (* 3 x2) (* 1 x3) (* 2 x4) (* 3 x5) (* 5 x6) (* 1 x7) (* 3 x8) (* 3 x9) (* 4 x10) (* 3 x11) (* 1 x12) (* 4 x13) (* 4 x14) (* 2 x15) (* 2 x16) (* 1 x17) (* 5 x18) (* 2 x19) (* 4 x20) (* 4 x21) (* 4 x22) (* 5 x23)) 145))
+(assert (>= (+ (* 3 x0) (* 5 x1) (* 1 x2) (* 3 x3) (* 5 x4) (* 3 x5) (* 3 x6) (* 5 x7) (* 4 x8) (* 2 x9) (* 1 x10) (* 3 x11) (* 5 x12) (* 1 x13) (* 5 x14) (* 1 x15) (* 2 x16) (* 2 x17) (* 5 x18) (* 4 x19) (* 2 x20) (* 5 x21) (* 1 x22) (* 2 x23)) 144))
+(assert (>= (+ (* 3 x0) (* 2 x1) (* 1 x2) (* 3 x3) (* 5 x4) (* 5 x5) (* 5 x6) (* 5 x7) (* 3 x8) (* 3 x9) (* 2 x10) (* 3 x11) (* 5 x12) (* 1 x13) (* 2 x14) (* 2 x15) (* 5 x16) (* 2 x17) (* 3 x18) (* 5 x19) (* 4 x20) (* 5 x21) (* 2 x22) (* 5 x23)) 110))
+(assert (>= (+ (* 5 x0) (* 1 x1) (* 5 x2) (* 5 x3) (* 2 x4) (* 4 x5) (* 3 x6) (* 3 x7) (* 2 x8) (* 3 x9) (* 3 x10) (* 5 x11) (* 5 x12) (* 4 x13) (* 1 x14) (* 4 x15) (* 2 x16) (* 1 x17) (* 2 x18) (* 5 x19) (* 3 x20) (* 4 x21) (* 1 x22) (* 1 x23)) 104))
+(assert (>= (+ (* 3 x0) (* 2 x1) (* 2 x2) (* 4 x3) (* 4 x4) (* 3 x5) (* 3 x6) (* 3 x7) (* 3 x8) (* 1 x9) (* 4 x10) (* 1 x11) (* 4 x12) (* 1 x13) (* 3 x14) (* 3 x15) (* 1 x16) (* 3 x17) (* 2 x18) (* 4 x19) (* 3 x20) (* 1 x21) (* 4 x22) (* 4 x23)) 121))
+(assert (>= (+ (* 1 x0) (* 2 x1) (* 4 x2) (* 5 x3) (* 1 x4) (* 5 x5) (* 3 x6) (* 5 x7) (* 4 x8) (* 5 x9) (* 1 x10) (* 2 x11) (* 2 x12) (* 4 x13) (* 4 x14) (* 4 x15) (* 3 x16) (* 1 x17) (* 1 x18) (* 3 x19) (* 3 x20) (* 2 x21) (* 1 x22) (* 1 x23)) 143))
+(assert (>= (+ (* 4 x0) (* 4 x1) (* 1 x2) (* 4 x3) (* 4 x4) (* 2 x5) (* 3 x6) (* 3 x7) (* 4 x8) (* 3 x9) (* 2 x10) (* 3 x11) (* 1 x12) (* 3 x13) (* 3 x14) (* 4 x15) (* 4 x16) (* 1 x17) (* 5 x18) (* 5 x19) (* 4 x20) (* 4 x21) (* 2 x22) (* 2 x23)) 101))
+(assert (>= (+ (* 1 x0) (* 2 x1) (* 5 x2) (* 2 x3) (* 5 x4) (* 4 x5) (* 5 x6) (* 1 x7) (* 1 x8) (* 2 x9) (* 5 x10) (* 5 x11) (* 5 x12) (* 3 x13) (* 5 x14) (* 2 x15) (* 3 x16) (* 1 x17) (* 2 x18) (* 5 x19) (* 3 x20) (* 4 x21) (* 1 x22) (* 2 x23)) 141))
+(assert (>= (+ (* 1 x0) (* 3 x1) (* 1 x2) (* 1 x3) (* 4 x4) (* 3 x5) (* 4 x6) (* 5 x7) (* 4 x8) (* 2 x9) (* 2 x10) (* 1 x11) (* 4 x12) (* 5 x13) (* 2 x14) (* 5 x15) (* 1 x16) (* 3 x17) (* 2 x18) (* 2 x19) (* 4 x20) (* 4 x21) (* 5 x22) (* 5 x23)) 149))
+(assert (>= (+ (* 4 x0) (* 5 x1) (* 2 x2) (* 1 x3) (* 3 x4) (* 1 x5) (* 5 x6) (* 2 x7) (* 3 x8) (* 4 x9) (* 1 x10) (* 1 x11) (* 2 x12) (* 5 x13) (* 4 x14) (* 1 x15) (* 3 x16) (* 4 x17) (* 4 x18) (* 5 x19) (* 4 x20) (* 2 x21) (* 2 x22) (* 2 x23)) 92))
+(assert (>= (+ (* 1 x0) (* 4 x1) (* 5 x2) (* 1 x3) (* 2 x4) (* 3 x5) (* 1 x6) (* 3 x7) (* 5 x8) (* 1 x9) (* 4 x10) (* 2 x11) (* 1 x12) (* 3 x13) (* 5 x14) (* 2 x15) (* 4 x16) (* 1 x17) (* 1 x18) (* 2 x19) (* 2 x20) (* 1 x21) (* 4 x22) (* 4 x23)) 115))
+(assert (>= (+ (* 3 x0) (* 1 x1) (* 5 x2) (* 3 x3) (* 2 x4) (* 3 x5) (* 5 x6) (* 3 x7) (* 2 x8) (* 3 x9) (* 3 x10) (* 2 x11) (* 4 x12) (* 1 x13) (* 4 x14) (* 2 x15) (* 2 x16) (* 1 x17) (* 5 x18) (* 1 x19) (* 5 x20) (* 5 x21) (* 3 x22) (* 1 x23)) 139))
+(assert (>= (+ (* 3 x0) (* 1 x1) (* 1 x2) (* 3 x3) (* 3 x4) (* 1 x5) (* 3 x6) (* 2 x7) (* 5 x8) (* 1 x9) (* 3 x10) (* 3 x11) (* 2 x12) (* 5 x13) (* 3 x14) (* 2 x15) (* 2 x16) (* 4 x17) (* 1 x18) (* 1 x19) (* 2 x20) (* 4 x21) (* 3 x22) (* 4 x23)) 129))
+(assert (>= (+ (* 4 x0) (* 5 x1) (* 4 x2) (* 5 x3) (* 3 x4) (* 5 x5) (* 5 x6) (* 1 x7) (* 2 x8) (* 2 x9) (* 2 x10) (* 5 x11) (* 5 x12) (* 2 x13) (* 1 x14) (* 2 x15) (* 3 x16) (* 3 x17) (* 4 x18) (* 1 x19) (* 1 x20) (* 5 x21) (* 5 x22) (* 4 x23)) 142))
+(assert (>= (+ (* 4 x0) (* 4 x1) (* 5 x2) (* 2 x3) (* 2 x4) (* 1 x5) (* 4 x6) (* 2 x7) (* 2 x8) (* 4 x9) (* 3 x10) (* 2 x11) (* 2 x12) (* 1 x13) (* 3 x14) (* 3 x15) (* 4 x16) (* 2 x17) (* 3 x18) (* 2 x19) (* 2 x20) (* 4 x21) (* 4 x22) (* 4 x23)) 115))
+(assert (>= (+ (* 3 x0) (* 2 x1) (* 2 x2) (* 4 x3) (* 4 x4) (* 1 x5) (* 5 x6) (* 2 x7) (* 5 x8) (* 3 x9) (* 3 x10) (* 4 x11) (* 5 x12) (* 2 x13) (* 5 x14) (* 2 x15) (* 2 x16) (* 4 x17) (* 4 x18) (* 4 x19) (* 1 x20) (* 5 x21) (* 2 x22) (* 4 x23)) 110))
+(assert (>= (+ (* 5 x0) (* 5 x1) (* 5 x2) (* 4 x3) (* 3 x4) (* 2 x5) (* 3 x6) (* 4 x7) (* 3 x8) (* 4 x9) (* 1 x10) (* 3 x11) (* 3 x12) (* 5 x13) (* 3 x14) (* 1 x15) (* 4 x16) (* 1 x17) (* 3 x18) (* 3 x19) (* 2 x20) (* 1 x21) (* 3 x22) (* 1 x23)) 114))
+(assert (>= (+ (* 3 x0) (* 1 x1) (* 5 x2) (* 3 x3) (* 1 x4) (* 3 x5) (* 1 x6) (* 4 x7) (* 1 x8) (* 4 x9) (* 4 x10) (* 3 x11) (* 1 x12) (* 3 x13) (* 4 x14) (* 2 x15) (* 5 x16) (* 3 x17) (* 5 x18) (* 1 x19) (* 2 x20) (* 4 x21) (* 5 x22) (* 4 x23)) 135))
+(assert (>= (+ (* 4 x0) (* 4 x1) (* 3 x2) (* 5 x3) (* 4 x4) (* 4 x5) (* 1 x6) (* 4 x7) (* 3 x8) (* 4 x9) (* 5 x10) (* 3 x11) (* 4 x12) (* 1 x13) (* 2 x14) (* 5 x15) (* 3 x16) (* 2 x17) (* 4 x18) (* 3 x19) (* 5 x20) (* 1 x21) (* 3 x22) (* 1 x23)) 111))
+(assert (>= (+ (* 1 x0) (* 1 x1) (* 3 x2) (* 4 x3) (* 1 x4) (* 1 x5) (* 2 x6) (* 4 x7) (* 3 x8) (* 5 x9) (* 1 x10) (* 2 x11) (* 2 x12) (* 2 x13) (* 4 x14) (* 2 x15) (* 1 x16) (* 2 x17) (* 2 x18) (* 1 x19) (* 4 x20) (* 3 x21) (* 5 x22) (* 4 x23)) 97))
+(assert (>= (+ (* 2 x0) (* 5 x1) (* 1 x2) (* 4 x3) (* 5 x4) (* 2 x5) (* 5 x6) (* 1 x7) (* 2 x8) (* 5 x9) (* 3 x10) (* 1 x11) (* 4 x12) (* 3 x13) (* 3 x14) (* 5 x15) (* 4 x16) (* 1 x17) (* 1 x18) (* 1 x19) (* 5 x20) (* 3 x21) (* 3 x22) (* 4 x23)) 123))
+(assert (>= (+ (* 2 x0) (* 1 x1) (* 2 x2) (* 1 x3) (* 4 x4) (* 5 x5) (* 5 x6) (* 5 x7) (* 2 x8) (* 5 x9) (* 2 x10) (* 5 x11) (* 4 x12) (* 1 x13) (* 1 x14) (* 1 x15) (* 1 x16) (* 5 x17) (* 4 x18) (* 3 x19) (* 4 x20) (* 5 x21) (* 5 x22) (* 2 x23)) 131))
+(assert (>= (+ (* 4 x0) (* 5 x1) (* 5 x2) (* 5 x3) (* 1 x4) (* 2 x5) (* 2 x6) (* 4 x7) (* 3 x8) (* 3 x9) (* 2 x10) (* 3 x11) (* 5 x12) (* 2 x13) (* 2 x14) (* 4 x15) (* 2 x16) (* 1 x17) (* 5 x18) (* 2 x19) (* 1 x20) (* 4 x21) (* 2 x22) (* 4 x23)) 129))
+(assert (>= (+ (* 4 x0) (* 1 x1) (* 4 x2) (* 1 x3) (* 1 x4) (* 1 x5) (* 5 x6) (* 1 x7) (* 3 x8) (* 3 x9) (* 4 x10) (* 4 x11) (* 5 x12) (* 3 x13) (* 5 x14) (* 2 x15) (* 2 x16) (* 1 x17) (* 5 x18) (* 4 x19) (* 3 x20) (* 5 x21) (* 3 x22) (* 3 x23)) 129))
+(assert (>= (+ (* 2 x0) (* 4 x1) (* 2 x2) (* 1 x3) (* 3 x4) (* 5 x5) (* 4 x6) (* 3 x7) (* 2 x8) (* 2 x9) (* 2 x10) (* 2 x11) (* 2 x12) (* 4 x13) (* 4 x14) (* 3 x15) (* 3 x16) (* 3 x17) (* 4 x18) (* 1 x19) (* 1 x20) (* 5 x21) (* 2 x22) (* 5 x23)) 146))
+(assert (>= (+ (* 4 x0) (* 3 x1) (* 3 x2) (* 3 x3) (* 3 x4) (* 1 x5) (* 4 x6) (* 3 x7) (* 3 x8) (* 2 x9) (* 1 x10) (* 2 x11) (* 2 x12) (* 1 x13) (* 1 x14) (* 4 x15) (* 1 x16) (* 1 x17) (* 3 x18) (* 5 x19) (* 1 x20) (* 5 x21) (* 3 x22) (* 1 x23)) 128))
+(assert (>= (+ (* 4 x0) (* 2 x1) (* 3 x2) (* 5 x3) (* 1 x4) (* 5 x5) (* 5 x6) (* 4 x7) (* 1 x8) (* 1 x9) (* 2 x10) (* 3 x11) (* 5 x12) (* 3 x13) (* 5 x14) (* 1 x15) (* 1 x16) (* 4 x17) (* 3 x18) (* 1 x19) (* 3 x20) (* 5 x21) (* 4 x22) (* 3 x23)) 109))
+(assert (>= (+ (* 1 x0) (* 4 x1) (* 1 x2) (* 5 x3) (* 2 x4) (* 5 x5) (* 1 x6) (* 2 x7) (* 5 x8) (* 3 x9) (* 2 x10) (* 3 x11) (* 5 x12) (* 5 x13) (* 3 x14) (* 5 x15) (* 1 x16) (* 3 x17) (* 4 x18) (* 4 x19) (* 1 x20) (* 4 x21) (* 4 x22) (* 3 x23)) 114))
+(assert (>= (+ (* 1 x0) (* 3 x1) (* 1 x2) (* 2 x3) (* 5 x4) (* 4 x5) (* 1 x6) (* 2 x7) (* 1 x8) (* 5 x9) (* 5 x10) (* 3 x11) (* 4 x12) (* 1 x13) (* 5 x14) (* 3 x15) (* 1 x16) (* 2 x17) (* 5 x18) (* 2 x19) (* 2 x20) (* 3 x21) (* 1 x22) (* 5 x23)) 109))
+(assert (>= (+ (* 3 x0) (* 2 x1) (* 3 x2) (* 4 x3) (* 4 x4) (* 2 x5) (* 1 x6) (* 4 x7) (* 1 x8) (* 5 x9) (* 1 x10) (* 5 x11) (* 5 x12) (* 3 x13) (* 2 x14) (* 3 x15) (* 3 x16) (* 2 x17) (* 1 x18) (* 4 x19) (* 2 x20) (* 1 x21) (* 1 x22) (* 1 x23)) 114))
+(assert (>= (+ (* 2 x0) (* 4 x1) (* 2 x2) (* 5 x3) (* 2 x4) (* 4 x5) (* 5 x6) (* 3 x7) (* 5 x8) (* 4 x9) (* 3 x10) (* 2 x11) (* 4 x12) (* 3 x13) (* 5 x14) (* 1 x15) (* 1 x16) (* 3 x17) (* 2 x18) (* 4 x19) (* 3 x20) (* 5 x21) (* 1 x22) (* 4 x23)) 81))
+(assert (>= (+ (* 4 x0) (* 1 x1) (* 3 x2) (* 2 x3) (* 1 x4) (* 1 x5) (* 5 x6) (* 4 x7) (* 2 x8) (* 2 x9) (* 2 x10) (* 2 x11) (* 1 x12) (* 1 x13) (* 3 x14) (* 4 x15) (* 3 x16) (* 1 x17) (* 2 x18) (* 3 x19) (* 3 x20) (* 4 x21) (* 5 x22) (* 5 x23)) 144))
+(assert (>= (+ (* 2 x0) (* 4 x1) (* 1 x2) (* 3 x3) (* 4 x4) (* 1 x5) (* 2 x6) (* 2 x7) (* 2 x8) (* 4 x9) (* 3 x10) (* 1 x11) (* 5 x12) (* 2 x13) (* 4 x14) (* 3 x15) (* 3 x16) (* 4 x17) (* 1 x18) (* 5 x19) (* 1 x20) (* 2 x21) (* 3 x22) (* 5 x23)) 149))
+(assert (>= (+ (* 1 x0) (* 3 x1) (* 2 x2) (* 2 x3) (* 3 x4) (* 4 x5) (* 5 x6) (* 1 x7) (* 4 x8) (* 2 x9) (* 1 x10) (* 3 x11) (* 3 x12) (* 2 x13) (* 4 x14) (* 2 x15) (* 4 x16) (* 4 x17) (* 1 x18) (* 4 x19) (* 5 x20) (* 1 x21) (* 3 x22) (* 3 x23)) 141))
+(assert (>= (+ (* 5 x0) (* 4 x1) (* 4 x2) (* 3 x3) (* 5 x4) (* 1 x5) (* 2 x6) (* 1 x7) (* 5 x8) (* 1 x9) (* 5 x10) (* 1 x11) (* 1 x12) (* 5 x13) (* 1 x14) (* 1 x15) (* 4 x16) (* 4 x17) (* 3 x18) (* 2 x19) (* 5 x20) (* 1 x21) (* 5 x22) (* 4 x23)) 137))
+(assert (>= (+ (* 5 x0) (* 2 x1) (* 3 x2) (* 1 x3) (* 2 x4) (* 5 x5) (* 1 x6) (* 5 x7) (* 2 x8) (* 3 x9) (* 3 x10) (* 5 x11) (* 5 x12) (* 1 x13) (* 4 x14) (* 3 x15) (* 1 x16) (* 2 x17) (* 4 x18) (* 4 x19) (* 4 x20) (* 3 x21) (* 5 x22) (* 5 x23)) 86))
+(assert (>= (+ (* 5 x0) (* 1 x1) (* 5 x2) (* 1 x3) (* 2 x4) (* 3 x5) (* 2 x6) (* 3 x7) (* 2 x8) (* 1 x9) (* 2 x10) (* 3 x11) (* 5 x12) (* 1 x13) (* 1 x14) (* 3 x15) (* 3 x16) (* 4 x17) (* 4 x18) (* 1 x19) (* 5 x20) (* 1 x21) (* 4 x22) (* 3 x23)) 82))
+(assert (>= (+ (* 5 x0) (* 1 x1) (* 1 x2) (* 1 x3) (* 3 x4) (* 4 x5) (* 1 x6) (* 5 x7) (* 5 x8) (* 1 x9) (* 5 x10) (* 5 x11) (* 5 x12) (* 1 x13) (* 5 x14) (* 5 x15) (* 4 x16) (* 5 x17) (* 4 x18) (* 3 x19) (* 4 x20) (* 4 x21) (* 4 x22) (* 1 x23)) 105))
+(assert (>= (+ (* 5 x0) (* 3 x1) (* 1 x2) (* 5 x3) (* 1 x4) (* 4 x5) (* 4 x6) (* 3 x7) (* 5 x8) (* 2 x9) (* 3 x10) (* 1 x11) (* 4 x12) (* 3 x13) (* 3 x14) (* 4 x15) (* 5 x16) (* 3 x17) (* 1 x18) (* 5 x19) (* 1 x20) (* 2 x21) (* 3 x22) (* 2 x23)) 148))
+(assert (>= (+ (* 4 x0) (* 3 x1) (* 4 x2) (* 5 x3) (* 3 x4) (* 3 x5) (* 2 x6) (* 4 x7) (* 2 x8) (* 4 x9) (* 4 x10) (* 3 x11) (* 5 x12) (* 2 x13) (* 2 x14) (* 5 x15) (* 5 x16) (* 1 x17) (* 1 x18) (* 5 x19) (* 3 x20) (* 1 x21) (* 5 x22) (* 3 x23)) 147))
+(assert (>= (+ (* 2 x0) (* 4 x1) (* 5 x2) (* 4 x3) (* 3 x4) (* 1 x5) (* 4 x6) (* 2 x7) (* 2 x8) (* 1 x9) (* 5 x10) (* 3 x11) (* 4 x12) (* 1 x13) (* 2 x14) (* 5 x15) (* 1 x16) (* 1 x17) (* 5 x18) (* 1 x19) (* 3 x20) (* 5 x21) (* 1 x22) (* 1 x23)) 128))
+(assert (>= (+ (* 4 x0) (* 1 x1) (* 2 x2) (* 2 x3) (* 1 x4) (* 2 x5) (* 3 x6) (* 5 x7) (* 3 x8) (* 5 x9) (* 5 x10) (* 4 x11) (* 5 x12) (* 1 x13) (* 4 x14) (* 2 x15) (* 5 x16) (* 1 x17) (* 4 x18) (* 3 x19) (* 2 x20) (* 3 x21) (* 5 x22) (* 1 x23)) 135))
+(assert (>= (+ (* 5 x0) (* 1 x1) (* 5 x2) (* 2 x3) (* 4 x4) (* 5 x5) (* 2 x6) (* 1 x7) (* 4 x8) (* 3 x9) (* 3 x10) (* 2 x11) (* 4 x12) (* 5 x13) (* 1 x14) (* 3 x15) (* 3 x16) (* 2 x17) (* 5 x18) (* 5 x19) (* 3 x20) (* 2 x21) (* 3 x22) (* 2 x23)) 92))
+(assert (>= (+ (* 5 x0) (* 1 x1) (* 4 x2) (* 1 x3) (* 1 x4) (* 5 x5) (* 3 x6) (* 3 x7) (* 4 x8) (* 2 x9) (* 3 x10) (* 3 x11) (* 5 x12) (* 4 x13) (* 5 x14) (* 4 x15) (* 4 x16) (* 3 x17) (* 5 x18) (* 3 x19) (* 4 x20) (* 2 x21) (* 3 x22) (* 1 x23)) 107))
+(assert (>= (+ (* 4 x0) (* 1 x1) (* 1 x2) (* 1 x3) (* 5 x4) (* 3 x5) (* 3 x6) (* 2 x7) (* 5 x8) (* 4 x9) (* 2 x10) (* 3 x11) (* 2 x12) (* 3 x13) (* 2 x14) (* 3 x15) (* 5 x16) (* 5 x17) (* 3 x18) (* 3 x19) (* 3 x20) (* 4 x21) (* 2 x22) (* 1 x23)) 94))
+(assert (>= (+ (* 5 x0) (* 1 x1) (* 1 x2) (* 5 x3) (* 4 x4) (* 5 x5) (* 4 x6) (* 5 x7) (* 3 x8) (* 4 x9) (* 3 x10) (* 3 x11) (* 2 x12) (* 1 x13) (* 1 x14) (* 3 x15) (* 5 x16) (* 4 x17) (* 2 x18) (* 4 x19) (* 4 x20) (* 3 x21) (* 2 x22) (* 4 x23)) 80))
+(assert (>= (+ (* 1 x0) (* 3 x1) (* 5 x2) (* 1 x3) (* 3 x4) (* 3 x5) (* 4 x6) (* 3 x7) (* 4 x8) (* 4 x9) (* 4 x10) (* 5 x11) (* 5 x12) (* 5 x13) (* 1 x14) (* 5 x15) (* 4 x16) (* 1 x17) (* 4 x18) (* 3 x19) (* 5 x20) (* 2 x21) (* 3 x22) (* 3 x23)) 144))
+(assert (>= (+ (* 4 x0) (* 2 x1) (* 4 x2) (* 2 x3) (* 1 x4) (* 5 x5) (* 4 x6) (* 2 x7) (* 4 x8) (* 2 x9) (* 1 x10) (* 5 x11) (* 4 x12) (* 2 x13) (* 4 x14) (* 5 x15) (* 4 x16) (* 3 x17) (* 3 x18) (* 3 x19) (* 3 x20) (* 3 x21) (* 2 x22) (* 3 x23)) 129))
+(assert (>= (+ (* 3 x0) (* 2 x1) (* 3 x2) (* 3 x3) (* 4 x4) (* 1 x5) (* 1 x6) (* 4 x7) (* 4 x8) (* 5 x9) (* 4 x10) (* 2 x11) (* 5 x12) (* 2 x13) (* 5 x14) (* 1 x15) (* 2 x16) (* 2 x17) (* 5 x18) (* 5 x19) (* 1 x20) (* 5 x21) (* 5 x22) (* 2 x23)) 144))
+(assert (>= (+ (* 2 x0) (* 2 x1) (* 2 x2) (* 4 x3) (* 1 x4) (* 3 x5) (* 4 x6) (* 1 x7) (* 1 x8) (* 2 x9) (* 2 x10) (* 2 x11) (* 2 x12) (* 1 x13) (* 2 x14) (* 2 x15) (* 3 x16) (* 3 x17) (* 4 x18) (* 5 x19) (* 4 x20) (* 5 x21) (* 3 x22) (* 3 x23)) 104))
+(assert (>= (+ (* 2 x0) (* 1 x1) (* 4 x2) (* 3 x3) (* 5 x4) (* 2 x5) (* 3 x6) (* 1 x7) (* 1 x8) (* 3 x9) (* 2 x10) (* 3 x11) (* 4 x12) (* 4 x13) (* 5 x14) (* 5 x15) (* 4 x16) (* 5 x17) (* 4 x18) (* 1 x19) (* 1 x20) (* 4 x21) (* 5 x22) (* 1 x23)) 102))
+(assert (>= (+ (* 2 x0) (* 5 x1) (* 4 x2) (* 2 x3) (* 1 x4) (* 3 x5) (* 4 x6) (* 4 x7) (* 1 x8) (* 1 x9) (* 2 x10) (* 1 x11) (* 4 x12) (* 2 x13) (* 4 x14) (* 1 x15) (* 4 x16) (* 3 x17) (* 1 x18) (* 4 x19) (* 3 x20) (* 4 x21) (* 3 x22) (* 4 x23)) 81))
+(assert (>= (+ (* 2 x0) (* 1 x1) (* 1 x2) (* 2 x3) (* 5 x4) (* 1 x5) (* 1 x6) (* 2 x7) (* 4 x8) (* 1 x9) (* 2 x10) (* 1 x11) (* 1 x12) (* 2 x13) (* 3 x14) (* 4 x15) (* 4 x16) (* 1 x17) (* 3 x18) (* 1 x19) (* 1 x20) (* 3 x21) (* 3 x22) (* 2 x23)) 88))
+(assert (>= (+ (* 3 x0) (* 4 x1) (* 5 x2) (* 1 x3) (* 3 x4) (* 4 x5) (* 2 x6) (* 3 x7) (* 1 x8) (* 5 x9) (* 3 x10) (* 5 x11) (* 2 x12) (* 5 x13) (* 4 x14) (* 5 x15) (* 1 x16) (* 5 x17) (* 4 x18) (* 1 x19) (* 1 x20) (* 1 x21) (* 3 x22) (* 1 x23)) 150))
+(assert (>= (+ (* 3 x0) (* 4 x1) (* 5 x2) (* 1 x3) (* 3 x4) (* 3 x5) (* 3 x6) (* 3 x7) (* 1 x8) (* 3 x9) (* 4 x10) (* 1 x11) (* 3 x12) (* 3 x13) (* 1 x14) (* 3 x15) (* 2 x16) (* 1 x17) (* 4 x18) (* 2 x19) (* 4 x20) (* 2 x21) (* 3 x22) (* 3 x23)) 148))
+(assert (>= (+ (* 4 x0) (* 3 x1) (* 1 x2) (* 4 x3) (* 5 x4) (* 3 x5) (* 1 x6) (* 5 x7) (* 2 x8) (* 3 x9) (* 5 x10) (* 4 x11) (* 4 x12) (* 4 x13) (* 4 x14) (* 3 x15) (* 2 x16) (* 4 x17) (* 3 x18) (* 5 x19) (* 2 x20) (* 3 x21) (* 1 x22) (* 2 x23)) 93))
+(assert (>= (+ (* 4 x0) (* 1 x1) (* 1 x2) (* 2 x3) (* 4 x4) (* 3 x5) (* 3 x6) (* 2 x7) (* 3 x8) (* 5 x9) (* 1 x10) (* 5 x11) (* 4 x12) (* 2 x13) (* 1 x14) (* 4 x15) (* 4 x16) (* 2 x17) (* 4 x18) (* 4 x19) (* 4 x20) (* 2 x21) (* 1 x22) (* 1 x23)) 83))
+(assert (>= (+ (* 5 x0) (* 1 x1) (* 1 x2) (* 5 x3) (* 3 x4) (* 3 x5) (* 5 x6) (* 3 x7) (* 1 x8) (* 1 x9) (* 1 x10) (* 2 x11) (* 1 x12) (* 2 x13) (* 3 x14) (* 4 x15) (* 1 x16) (* 3 x17) (* 1 x18) (* 3 x19) (* 4 x20) (* 3 x21) (* 3 x22) (* 4 x23)) 131))
+(assert (>= (+ (* 2 x0) (* 2 x1) (* 5 x2) (* 2 x3) (* 4 x4) (* 1 x5) (* 4 x6) (* 3 x7) (* 3 x8) (* 1 x9) (* 4 x10) (* 2 x11) (* 5 x12) (* 1 x13) (* 1 x14) (* 5 x15) (* 4 x16) (* 4 x17) (* 4 x18) (* 5 x19) (* 1 x20) (* 4 x21) (* 5 x22) (* 4 x23)) 94))
+(assert (>= (+ (* 2 x0) (* 4 x1) (* 1 x2) (* 2 x3) (* 4 x4) (* 2 x5) (* 1 x6) (* 3 x7) (* 5 x8) (* 3 x9) (* 4 x10) (* 5 x11) (* 4 x12) (* 1 x13) (* 2 x14) (* 1 x15) (* 4 x16) (* 4 x17) (* 5 x18) (* 2 x19) (* 1 x20) (* 1 x21) (* 4 x22) (* 2 x23)) 138))
+(assert (>= (+ (* 3 x0) (* 1 x1) (* 1 x2) (* 5 x3) (* 5 x4) (* 3 x5) (* 4 x6) (* 5 x7) (* 1 x8) (* 3 x9) (* 2 x10) (* 4 x11) (* 3 x12) (* 5 x13) (* 5 x14) (* 2 x15) (* 1 x16) (* 3 x17) (* 1 x18) (* 2 x19) (* 3 x20) (* 3 x21) (* 1 x22) (* 1 x23)) 106))
+(assert (>= (+ (* 4 x0) (* 5 x1) (* 5 x2) (* 3 x3) (* 3 x4) (* 2 x5) (* 2 x6) (* 4 x7) (* 3 x8) (* 2 x9) (* 3 x10) (* 3 x11) (* 3 x12) (* 1 x13) (* 4 x14) (* 3 x15) (* 4 x16) (* 1 x17) (* 3 x18) (* 4 x19) (* 2 x20) (* 2 x21) (* 3 x22) (* 5 x23)) 128))
+(assert (>= (+ (* 5 x0) (* 3 x1) (* 2 x2) (* 1 x3) (* 1 x4) (* 1 x5) (* 5 x6) (* 3 x7) (* 1 x8) (* 4 x9) (* 4 x10) (* 2 x11) (* 3 x12) (* 3 x13) (* 4 x14) (* 1 x15) (* 1 x16) (* 5 x17) (* 1 x18) (* 2 x19) (* 2 x20) (* 1 x21) (* 5 x22) (* 3 x23)) 92))
+(assert (>= (+ (* 4 x0) (* 5 x1) (* 3 x2) (* 2 x3) (* 1 x4) (* 3 x5) (* 3 x6) (* 1 x7) (* 4 x8) (* 4 x9) (* 3 x10) (* 2 x11) (* 1 x12) (* 5 x13) (* 3 x14) (* 1 x15) (* 3 x16) (* 3 x17) (* 1 x18) (* 1 x19) (* 5 x20) (* 5 x21) (* 5 x22) (* 3 x23)) 114))
+(assert (>= (+ (* 5 x0) (* 3 x1) (* 2 x2) (* 2 x3) (* 1 x4) (* 3 x5) (* 1 x6) (* 4 x7) (* 2 x8) (* 5 x9) (* 4 x10) (* 3 x11) (* 1 x12) (* 5 x13) (* 4 x14) (* 5 x15) (* 5 x16) (* 1 x17) (* 1 x18) (* 4 x19) (* 1 x20) (* 2 x21) (* 2 x22) (* 4 x23)) 126))
+(assert (>= (+ (* 1 x0) (* 2 x1) (* 5 x2) (* 1 x3) (* 5 x4) (* 5 x5) (* 5 x6) (* 4 x7) (* 1 x8) (* 4 x9) (* 1 x10) (* 5 x11) (* 3 x12) (* 4 x13) (* 1 x14) (* 3 x15) (* 5 x16) (* 4 x17) (* 3 x18) (* 3 x19) (* 2 x20) (* 1 x21) (* 3 x22) (* 4 x23)) 127))
+(assert (>= (+ (* 4 x0) (* 3 x1) (* 2 x2) (* 1 x3) (* 1 x4) (* 4 x5) (* 2 x6) (* 1 x7) (* 3 x8) (* 2 x9) (* 2 x10) (* 5 x11) (* 4 x12) (* 4 x13) (* 1 x14) (* 2 x15) (* 2 x16) (* 5 x17) (* 3 x18) (* 4 x19) (* 5 x20) (* 1 x21) (* 4 x22) (* 5 x23)) 104))
+(assert (>= (+ (* 5 x0) (* 2 x1) (* 1 x2) (* 1 x3) (* 2 x4) (* 5 x5) (* 3 x6) (* 5 x7) (* 2 x8) (* 4 x9) (* 1 x10) (* 4 x11) (* 3 x12) (* 2 x13) (* 3 x14) (* 5 x15) (* 4 x16) (* 1 x17) (* 3 x18) (* 5 x19) (* 4 x20) (* 1 x21) (* 2 x22) (* 2 x23)) 146))
+(assert (>= (+ (* 2 x0) (* 2 x1) (* 1 x2) (* 1 x3) (* 3 x4) (* 5 x5) (* 1 x6) (* 4 x7) (* 2 x8) (* 4 x9) (* 2 x10) (* 1 x11) (* 4 x12) (* 3 x13) (* 3 x14) (* 2 x15) (* 5 x16) (* 5 x17) (* 2 x18) (* 4 x19) (* 2 x20) (* 5 x21) (* 1 x22) (* 1 x23)) 120))
+(assert (>= (+ (* 2 x0) (* 2 x1) (* 5 x2) (* 1 x3) (* 5 x4) (* 3 x5) (* 3 x6) (* 5 x7) (* 3 x8) (* 1 x9) (* 3 x10) (* 4 x11) (* 5 x12) (* 3 x13) (* 1 x14) (* 5 x15) (* 3 x16) (* 1 x17) (* 1 x18) (* 4 x19) (* 5 x20) (* 4 x21) (* 5 x22) (* 3 x23)) 128))
+(assert (>= (+ (* 3 x0) (* 3 x1) (* 1 x2) (* 5 x3) (* 2 x4) (* 1 x5) (* 5 x6) (* 2 x7) (* 3 x8) (* 2 x9) (* 1 x10) (* 4 x11) (* 4 x12) (* 4 x13) (* 4 x14) (* 5 x15) (* 1 x16) (* 2 x17) (* 1 x18) (* 1 x19) (* 5 x20) (* 5 x21) (* 3 x22) (* 3 x23)) 132))
+(assert (>= (+ (* 2 x0) (* 5 x1) (* 3 x2) (* 2 x3) (* 1 x4) (* 3 x5) (* 2 x6) (* 1 x7) (* 2 x8) (* 3 x9) (* 3 x10) (* 1 x11) (* 4 x12) (* 2 x13) (* 2 x14) (* 5 x15) (* 1 x16) (* 2 x17) (* 5 x18) (* 3 x19) (* 3 x20) (* 2 x21) (* 2 x22) (* 2 x23)) 118))
+(assert (>= (+ (* 3 x0) (* 4 x1) (* 5 x2) (* 1 x3) (* 3 x4) (* 3 x5) (* 5 x6) (* 3 x7) (* 5 x8) (* 2 x9) (* 2 x10) (* 3 x11) (* 3 x12) (* 4 x13) (* 1 x14) (* 5 x15) (* 1 x16) (* 2 x17) (* 2 x18) (* 4 x19) (* 3 x20) (* 2 x21) (* 2 x22) (* 2 x23)) 112))
+(assert (>= (+ (* 2 x0) (* 5 x1) (* 3 x2) (* 3 x3) (* 5 x4) (* 3 x5) (* 3 x6) (* 4 x7) (* 2 x8) (* 3 x9) (* 3 x10) (* 4 x11) (* 5 x12) (* 3 x13) (* 1 x14) (* 4 x15) (* 5 x16) (* 2 x17) (* 2 x18) (* 3 x19) (* 2 x20) (* 3 x21) (* 5 x22) (* 5 x23)) 148))
+(assert (>= (+ (* 4 x0) (* 1 x1) (* 3 x2) (* 2 x3) (* 3 x4) (* 4 x5) (* 5 x6) (* 4 x7) (* 5 x8) (* 1 x9) (* 3 x10) (* 4 x11) (* 5 x12) (* 3 x13) (* 2 x14) (* 4 x15) (* 4 x16) (* 5 x17) (* 2 x18) (* 5 x19) (* 1 x20) (* 3 x21) (* 4 x22) (* 1 x23)) 82))
+(assert (>= (+ (* 5 x0) (* 4 x1) (* 5 x2) (* 2 x3) (* 1 x4) (* 5 x5) (* 4 x6) (* 1 x7) (* 3 x8) (* 2 x9) (* 1 x10) (* 4 x11) (* 5 x12) (* 4 x13) (* 4 x14) (* 1 x15) (* 1 x16) (* 1 x17) (* 5 x18) (* 5 x19) (* 5 x20) (* 3 x21) (* 4 x22) (* 1 x23)) 94))
+(assert (>= (+ (* 2 x0) (* 2 x1) (* 4 x2) (* 3 x3) (* 5 x4) (* 5 x5) (* 1 x6) (* 3 x7) (* 3 x8) (* 3 x9) (* 4 x10) (* 1 x11) (* 5 x12) (* 2 x13) (* 3 x14) (* 2 x15) (* 1 x16) (* 1 x17) (* 3 x18) (* 2 x19) (* 5 x20) (* 2 x21) (* 5 x22) (* 5 x23)) 107))
+(assert (>= (+ (* 5 x0) (* 1 x1) (* 1 x2) (* 1 x3) (* 5 x4) (* 2 x5) (* 2 x6) (* 2 x7) (* 2 x8) (* 2 x9) (* 3 x10) (* 5 x11) (* 4 x12) (* 3 x13) (* 5 x14) (* 4 x15) (* 3 x16) (* 4 x17) (* 1 x18) (* 1 x19) (* 5 x20) (* 4 x21) (* 2 x22) (* 2 x23)) 144))
+(assert (>= (+ (* 2 x0) (* 3 x1) (* 5 x2) (* 3 x3) (* 3 x4) (* 1 x5) (* 4 x6) (* 4 x7) (* 2 x8) (* 2 x9) (* 4 x10) (* 1 x11) (* 2 x12) (* 1 x13) (* 4 x14) (* 2 x15) (* 2 x16) (* 3 x17) (* 2 x18) (* 1 x19) (* 5 x20) (* 5 x21) (* 5 x22) (* 4 x23)) 119))
+(assert (>= (+ (* 3 x0) (* 1 x1) (* 3 x2) (* 2 x3) (* 2 x4) (* 2 x5) (* 1 x6) (* 5 x7) (* 5 x8) (* 3 x9) (* 3 x10) (* 4 x11) (* 2 x12) (* 4 x13) (* 2 x14) (* 3 x15) (* 5 x16) (* 1 x17) (* 5 x18) (* 4 x19) (* 4 x20) (* 1 x21) (* 3 x22) (* 1 x23)) 91))
+(assert (>= (+ (* 2 x0) (* 4 x1) (* 1 x2) (* 4 x3) (* 3 x4) (* 4 x5) (* 2 x6) (* 1 x7) (* 3 x8) (* 2 x9) (* 3 x10) (* 3 x11) (* 5 x12) (* 5 x13) (* 3 x14) (* 2 x15) (* 5 x16) (* 1 x17) (* 3 x18) (* 4 x19) (* 4 x20) (* 5 x21) (* 4 x22) (* 2 x23)) 82))
+(assert (>= (+ (* 1 x0) (* 4 x1) (* 1 x2) (* 1 x3) (* 4 x4) (* 1 x5) (* 4 x6) (* 4 x7) (* 5 x8) (* 5 x9) (* 1 x10) (* 3 x11) (* 1 x12) (* 1 x13) (* 5 x14) (* 1 x15) (* 2 x16) (* 2 x17) (* 5 x18) (* 3 x19) (* 2 x20) (* 2 x21) (* 1 x22) (* 2 x23)) 82))
+(assert (>= (+ (* 2 x0) (* 4 x1) (* 1 x2) (* 1 x3) (* 1 x4) (* 5 x5) (* 5 x6) (* 1 x7) (* 4 x8) (* 3 x9) (* 4 x10) (* 4 x11) (* 3 x12) (* 2 x13) (* 2 x14) (* 1 x15) (* 4 x16) (* 5 x17) (* 5 x18) (* 2 x19) (* 1 x20) (* 5 x21) (* 4 x22) (* 5 x23)) 80))
+(assert (>= (+ (* 3 x0) (* 5 x1) (* 1 x2) (* 5 x3) (* 4 x4) (* 4 x5) (* 3 x6) (* 3 x7) (* 1 x8) (* 4 x9) (* 1 x10) (* 5 x11) (* 3 x12) (* 4 x13) (* 2 x14) (* 1 x15) (* 5 x16) (* 5 x17) (* 2 x18) (* 5 x19) (* 4 x20) (* 5 x21) (* 3 x22) (* 5 x23)) 86))
+(assert (>= (+ (* 1 x0) (* 4 x1) (* 4 x2) (* 5 x3) (* 5 x4) (* 3 x5) (* 4 x6) (* 1 x7) (* 1 x8) (* 3 x9) (* 1 x10) (* 2 x11) (* 3 x12) (* 3 x13) (* 2 x14) (* 3 x15) (* 3 x16) (* 1 x17) (* 3 x18) (* 3 x19) (* 1 x20) (* 5 x21) (* 3 x22) (* 2 x23)) 114))
+(assert (>= (+ (* 5 x0) (* 5 x1) (* 1 x2) (* 2 x3) (* 3 x4) (* 4 x5) (* 2 x6) (* 5 x7) (* 5 x8) (* 4 x9) (* 4 x10) (* 3 x11) (* 1 x12) (* 3 x13) (* 5 x14) (* 4 x15) (* 4 x16) (* 5 x17) (* 1 x18) (* 2 x19) (* 5 x20) (* 4 x21) (* 3 x22) (* 2 x23)) 116))
+(assert (>= (+ (* 5 x0) (* 5 x1) (* 1 x2) (* 1 x3) (* 3 x4) (* 3 x5) (* 3 x6) (* 4 x7) (* 3 x8) (* 5 x9) (* 4 x10) (* 2 x11) (* 4 x12) (* 4 x13) (* 5 x14) (* 4 x15) (* 3 x16) (* 3 x17) (* 4 x18) (* 4 x19) (* 1 x20) (* 3 x21) (* 1 x22) (* 4 x23)) 97))
+(assert (>= (+ (* 4 x0) (* 1 x1) (* 4 x2) (* 1 x3) (* 1 x4) (* 1 x5) (* 3 x6) (* 4 x7) (* 1 x8) (* 5 x9) (* 1 x10) (* 1 x11) (* 2 x12) (* 2 x13) (* 1 x14) (* 3 x15) (* 3 x16) (* 3 x17) (* 4 x18) (* 5 x19) (* 2 x20) (* 3 x21) (* 5 x22) (* 2 x23)) 88))
+(assert (>= (+ (* 5 x0) (* 2 x1) (* 5 x2) (* 5 x3) (* 2 x4) (* 4 x5) (* 5 x6) (* 1 x7) (* 3 x8) (* 2 x9) (* 2 x10) (* 4 x11) (* 5 x12) (* 3 x13) (* 2 x14) (* 5 x15) (* 5 x16) (* 1 x17) (* 4 x18) (* 2 x19) (* 3 x20) (* 4 x21) (* 5 x22) (* 5 x23)) 118))
+(assert (>= (+ (* 4 x0) (* 2 x1) (* 5 x2) (* 4 x3) (* 3 x4) (* 5 x5) (* 5 x6) (* 1 x7) (* 2 x8) (* 2 x9) (* 4 x10) (* 1 x11) (* 5 x12) (* 5 x13) (* 5 x14) (* 3 x15) (* 1 x16) (* 3 x17) (* 2 x18) (* 1 x19) (* 1 x20) (* 5 x21) (* 5 x22) (* 1 x23)) 83))
+(assert (>= (+ (* 5 x0) (* 3 x1) (* 2 x2) (* 5 x3) (* 3 x4) (* 4 x5) (* 3 x6) (* 3 x7) (* 2 x8) (* 2 x9) (* 2 x10) (* 1 x11) (* 2 x12) (* 2 x13) (* 4 x14) (* 4 x15) (* 2 x16) (* 4 x17) (* 5 x18) (* 2 x19) (* 3 x20) (* 3 x21) (* 5 x22) (* 2 x23)) 122))
+(assert (>= (+ (* 2 x0) (* 3 x1) (* 1 x2) (* 1 x3) (* 5 x4) (* 2 x5) (* 4 x6) (* 4 x7) (* 2 x8) (* 2 x9) (* 2 x10) (* 2 x11) (* 4 x12) (* 1 x13) (* 5 x14) (* 3 x15) (* 5 x16) (* 4 x17) (* 3 x18) (* 3 x19) (* 5 x20) (* 1 x21) (* 3 x22) (* 4 x23)) 93))
+(assert (>= (+ (* 5 x0) (* 1 x1) (* 3 x2) (* 3 x3) (* 5 x4) (* 3 x5) (* 1 x6) (* 5 x7) (* 4 x8) (* 3 x9) (* 4 x10) (* 4 x11) (* 4 x12) (* 5 x13) (* 2 x14) (* 1 x15) (* 5 x16) (* 2 x17) (* 1 x18) (* 3 x19) (* 4 x20) (* 5 x21) (* 2 x22) (* 1 x23)) 149))
+(assert (>= (+ (* 5 x0) (* 4 x1) (* 4 x2) (* 1 x3) (* 4 x4) (* 2 x5) (* 4 x6) (* 1 x7) (* 3 x8) (* 3 x9) (* 2 x10) (* 3 x11) (* 4 x12) (* 1 x13) (* 3 x14) (* 2 x15) (* 4 x16) (* 1 x17) (* 3 x18) (* 5 x19) (* 4 x20) (* 4 x21) (* 4 x22) (* 4 x23)) 83))
+(assert (>= (+ (* 4 x0) (* 2 x1) (* 3 x2) (* 2 x3) (* 1 x4) (* 2 x5) (* 5 x6) (* 1 x7) (* 4 x8) (* 3 x9) (* 3 x10) (* 5 x11) (* 2 x12) (* 3 x13) (* 5 x14) (* 2 x15) (* 3 x16) (* 3 x17) (* 2 x18) (* 3 x19) (* 2 x20) (* 2 x21) (* 2 x22) (* 3 x23)) 127))
+(assert (>= (+ (* 2 x0) (* 2 x1) (* 3 x2) (* 1 x3) (* 1 x4) (* 4 x5) (* 1 x6) (* 5 x7) (* 5 x8) (* 3 x9) (* 4 x10) (* 1 x11) (* 3 x12) (* 2 x13) (* 4 x14) (* 2 x15) (* 4 x16) (* 4 x17) (* 1 x18) (* 2 x19) (* 2 x20) (* 2 x21) (* 5 x22) (* 2 x23)) 149))
+(assert (>= (+ (* 3 x0) (* 5 x1) (* 5 x2) (* 5 x3) (* 1 x4) (* 2 x5) (* 2 x6) (* 3 x7) (* 5 x8) (* 2 x9) (* 4 x10) (* 3 x11) (* 2 x12) (* 1 x13) (* 2 x14) (* 3 x15) (* 3 x16) (* 1 x17) (* 2 x18) (* 3 x19) (* 5 x20) (* 4 x21) (* 1 x22) (* 3 x23)) 103))
+(assert (>= (+ (* 3 x0) (* 1 x1) (* 4 x2) (* 1 x3) (* 2 x4) (* 4 x5) (* 1 x6) (* 5 x7) (* 1 x8) (* 1 x9) (* 2 x10) (* 1 x11) (* 4 x12) (* 4 x13) (* 1 x14) (* 3 x15) (* 5 x16) (* 1 x17) (* 3 x18) (* 5 x19) (* 5 x20) (* 2 x21) (* 3 x22) (* 2 x23)) 113))
+(assert (>= (+ (* 2 x0) (* 5 x1) (* 5 x2) (* 1 x3) (* 3 x4) (* 2 x5) (* 4 x6) (* 3 x7) (* 4 x8) (* 1 x9) (* 2 x10) (* 5 x11) (* 2 x12) (* 2 x13) (* 5 x14) (* 3 x15) (* 2 x16) (* 1 x17) (* 1 x18) (* 4 x19) (* 3 x20) (* 4 x21) (* 1 x22) (* 4 x23)) 118))
+(assert (>= (+ (* 1 x0) (* 1 x1) (* 5 x2) (* 4 x3) (* 1 x4) (* 5 x5) (* 5 x6) (* 1 x7) (* 1 x8) (* 5 x9) (* 2 x10) (* 3 x11) (* 2 x12) (* 1 x13) (* 4 x14) (* 1 x15) (* 1 x16) (* 1 x17) (* 4 x18) (* 3 x19) (* 4 x20) (* 2 x21) (* 5 x22) (* 2 x23)) 80))
+(assert (>= (+ (* 4 x0) (* 4 x1) (* 5 x2) (* 2 x3) (* 2 x4) (* 2 x5) (* 1 x6) (* 2 x7) (* 3 x8) (* 1 x9) (* 4 x10) (* 1 x11) (* 4 x12) (* 4 x13) (* 5 x14) (* 2 x15) (* 5 x16) (* 4 x17) (* 3 x18) (* 3 x19) (* 4 x20) (* 2 x21) (* 4 x22) (* 5 x23)) 139))
+(assert (>= (+ (* 4 x0) (* 4 x1) (* 5 x2) (* 5 x3) (* 2 x4) (* 3 x5) (* 3 x6) (* 1 x7) (* 2 x8) (* 3 x9) (* 3 x10) (* 4 x11) (* 1 x12) (* 4 x13) (* 5 x14) (* 5 x15) (* 4 x16) (* 4 x17) (* 3 x18) (* 2 x19) (* 2 x20) (* 3 x21) (* 2 x22) (* 4 x23)) 93))
+(assert (>= (+ (* 3 x0) (* 5 x1) (* 4 x2) (* 4 x3) (* 5 x4) (* 2 x5) (* 3 x6) (* 3 x7) (* 2 x8) (* 1 x9) (* 4 x10) (* 4 x11) (* 3 x12) (* 1 x13) (* 1 x14) (* 4 x15) (* 1 x16) (* 2 x17) (* 4 x18) (* 3 x19) (* 3 x20) (* 3 x21) (* 1 x22) (* 2 x23)) 134))
+(assert (>= (+ (* 4 x0) (* 2 x1) (* 3 x2) (* 4 x3) (* 3 x4) (* 4 x5) (* 5 x6) (* 1 x7) (* 1 x8) (* 2 x9) (* 5 x10) (* 1 x11) (* 5 x12) (* 2 x13) (* 5 x14) (* 2 x15) (* 3 x16) (* 2 x17) (* 2 x18) (* 5 x19) (* 3 x20) (* 5 x21) (* 4 x22) (* 4 x23)) 86))
+(assert (>= (+ (* 2 x0) (* 3 x1) (* 1 x2) (* 4 x3) (* 2 x4) (* 1 x5) (* 5 x6) (* 1 x7) (* 1 x8) (* 4 x9) (* 2 x10) (* 5 x11) (* 1 x12) (* 4 x13) (* 4 x14) (* 1 x15) (* 4 x16) (* 2 x17) (* 3 x18) (* 1 x19) (* 5 x20) (* 1 x21) (* 3 x22) (* 3 x23)) 82))
+(assert (>= (+ (* 4 x0) (* 3 x1) (* 3 x2) (* 5 x3) (* 2 x4) (* 4 x5) (* 5 x6) (* 2 x7) (* 1 x8) (* 4 x9) (* 5 x10) (* 3 x11) (* 5 x12) (* 1 x13) (* 2 x14) (* 5 x15) (* 1 x16) (* 5 x17) (* 4 x18) (* 2 x19) (* 3 x20) (* 5 x21) (* 4 x22) (* 2 x23)) 90))
+(assert (>= (+ (* 3 x0) (* 3 x1) (* 1 x2) (* 1 x3) (* 3 x4) (* 5 x5) (* 4 x6) (* 4 x7) (* 5 x8) (* 2 x9) (* 1 x10) (* 4 x11) (* 3 x12) (* 2 x13) (* 4 x14) (* 5 x15) (* 3 x16) (* 2 x17) (* 5 x18) (* 3 x19) (* 4 x20) (* 2 x21) (* 5 x22) (* 4 x23)) 144))
+(assert (>= (+ (* 2 x0) (* 2 x1) (* 3 x2) (* 2 x3) (* 2 x4) (* 3 x5) (* 1 x6) (* 3 x7) (* 1 x8) (* 5 x9) (* 5 x10) (* 2 x11) (* 1 x12) (* 2 x13) (* 5 x14) (* 2 x15) (* 3 x16) (* 5 x17) (* 3 x18) (* 5 x19) (* 2 x20) (* 1 x21) (* 2 x22) (* 2 x23)) 134))
+(assert (>= (+ (* 4 x0) (* 5 x1) (* 5 x2) (* 1 x3) (* 5 x4) (* 2 x5) (* 3 x6) (* 5 x7) (* 2 x8) (* 4 x9) (* 5 x10) (* 2 x11) (* 3 x12) (* 2 x13) (* 4 x14) (* 3 x15) (* 3 x16) (* 3 x17) (* 2 x18) (* 3 x19) (* 3 x20) (* 3 x21) (* 1 x22) (* 3 x23)) 114))
+(assert (>= (+ (* 4 x0) (* 3 x1) (* 1 x2) (* 4 x3) (* 1 x4) (* 2 x5) (* 5 x6) (* 2 x7) (* 2 x8) (* 3 x9) (* 4 x10) (* 5 x11) (* 5 x12) (* 1 x13) (* 4 x14) (* 3 x15) (* 1 x16) (* 4 x17) (* 4 x18) (* 3 x19) (* 3 x20) (* 2 x21) (* 2 x22) (* 1 x23)) 101))
+(assert (>= (+ (* 5 x0) (* 5 x1) (* 2 x2) (* 1 x3) (* 4 x4) (* 5 x5) (* 4 x6) (* 1 x7) (* 3 x8) (* 3 x9) (* 2 x10) (* 3 x11) (* 3 x12) (* 4 x13) (* 3 x14) (* 3 x15) (* 4 x16) (* 4 x17) (* 2 x18) (* 2 x19) (* 5 x20) (* 4 x21) (* 2 x22) (* 3 x23)) 132))
+(assert (>= (+ (* 2 x0) (* 4 x1) (* 5 x2) (* 4 x3) (* 3 x4) (* 4 x5) (* 5 x6) (* 2 x7) (* 1 x8) (* 1 x9) (* 4 x10) (* 4 x11) (* 3 x12) (* 2 x13) (* 4 x14) (* 2 x15) (* 5 x16) (* 1 x17) (* 2 x18) (* 5 x19) (* 1 x20) (* 4 x21) (* 2 x22) (* 3 x23)) 127))
+(assert (>= (+ (* 2 x0) (* 2 x1) (* 1 x2) (* 1 x3) (* 3 x4) (* 4 x5) (* 4 x6) (* 3 x7) (* 1 x8) (* 1 x9) (* 5 x10) (* 5 x11) (* 4 x12) (* 5 x13) (* 5 x14) (* 3 x15) (* 5 x16) (* 1 x17) (* 5 x18) (* 5 x19) (* 4 x20) (* 3 x21) (* 3 x22) (* 3 x23)) 118))
+(assert (>= (+ (* 2 x0) (* 5 x1) (* 5 x2) (* 4 x3) (* 2 x4) (* 1 x5) (* 3 x6) (* 5 x7) (* 4 x8) (* 5 x9) (* 2 x10) (* 1 x11) (* 1 x12) (* 3 x13) (* 3 x14) (* 1 x15) (* 3 x16) (* 1 x17) (* 5 x18) (* 1 x19) (* 4 x20) (* 4 x21) (* 4 x22) (* 4 x23)) 106))
+(assert (>= (+ (* 5 x0) (* 5 x1) (* 1 x2) (* 3 x3) (* 1 x4) (* 4 x5) (* 2 x6) (* 3 x7) (* 3 x8) (* 4 x9) (* 1 x10) (* 5 x11) (* 2 x12) (* 2 x13) (* 3 x14) (* 5 x15) (* 1 x16) (* 2 x17) (* 4 x18) (* 5 x19) (* 5 x20) (* 3 x21) (* 3 x22) (* 3 x23)) 86))
+(assert (>= (+ (* 3 x0) (* 1 x1) (* 3 x2) (* 5 x3) (* 4 x4) (* 2 x5) (* 5 x6) (* 3 x7) (* 1 x8) (* 2 x9) (* 2 x10) (* 5 x11) (* 1 x12) (* 3 x13) (* 4 x14) (* 5 x15) (* 2 x16) (* 3 x17) (* 3 x18) (* 3 x19) (* 2 x20) (* 2 x21) (* 5 x22) (* 5 x23)) 108))
+(assert (>= (+ (* 2 x0) (* 2 x1) (* 3 x2) (* 1 x3) (* 5 x4) (* 4 x5) (* 3 x6) (* 1 x7) (* 1 x8) (* 3 x9) (* 4 x10) (* 5 x11) (* 3 x12) (* 3 x13) (* 3 x14) (* 4 x15) (* 2 x16) (* 2 x17) (* 2 x18) (* 3 x19) (* 5 x20) (* 4 x21) (* 1 x22) (* 2 x23)) 87))
+(assert (>= (+ (* 2 x0) (* 4 x1) (* 4 x2) (* 2 x3) (* 4 x4) (* 5 x5) (* 1 x6) (* 5 x7) (* 5 x8) (* 5 x9) (* 4 x10) (* 2 x11) (* 2 x12) (* 4 x13) (* 2 x14) (* 3 x15) (* 5 x16) (* 5 x17) (* 5 x18) (* 5 x19) (* 5 x20) (* 3 x21) (* 3 x22) (* 3 x23)) 87))
+(assert (>= (+ (* 3 x0) (* 2 x1) (* 4 x2) (* 5 x3) (* 3 x4) (* 5 x5) (* 1 x6) (* 2 x7) (* 5 x8) (* 4 x9) (* 4 x10) (* 4 x11) (* 1 x12) (* 3 x13) (* 2 x14) (* 2 x15) (* 5 x16) (* 3 x17) (* 5 x18) (* 4 x19) (* 3 x20) (* 2 x21) (* 5 x22) (* 3 x23)) 150))
+(assert (>= (+ (* 1 x0) (* 2 x1) (* 5 x2) (* 5 x3) (* 4 x4) (* 3 x5) (* 5 x6) (* 2 x7) (* 2 x8) (* 4 x9) (* 1 x10) (* 5 x11) (* 1 x12) (* 1 x13) (* 1 x14) (* 2 x15) (* 2 x16) (* 2 x17) (* 5 x18) (* 1 x19) (* 4 x20) (* 2 x21) (* 3 x22) (* 2 x23)) 103))
+(assert (>= (+ (* 2 x0) (* 5 x1) (* 2 x2) (* 1 x3) (* 1 x4) (* 1 x5) (* 2 x6) (* 5 x7) (* 2 x8) (* 5 x9) (* 5 x10) (* 5 x11) (* 2 x12) (* 5 x13) (* 4 x14) (* 4 x15) (* 4 x16) (* 1 x17) (* 3 x18) (* 4 x19) (* 1 x20) (* 2 x21) (* 2 x22) (* 5 x23)) 138))
+(assert (>= (+ (* 1 x0) (* 5 x1) (* 4 x2) (* 4 x3) (* 3 x4) (* 4 x5) (* 2 x6) (* 3 x7) (* 3 x8) (* 1 x9) (* 1 x10) (* 4 x11) (* 3 x12) (* 2 x13) (* 4 x14) (* 4 x15) (* 3 x16) (* 5 x17) (* 4 x18) (* 1 x19) (* 1 x20) (* 5 x21) (* 5 x22) (* 1 x23)) 112))
+(assert (>= (+ (* 4 x0) (* 4 x1) (* 4 x2) (* 2 x3) (* 2 x4) (* 3 x5) (* 4 x6) (* 2 x7) (* 4 x8) (* 3 x9) (* 5 x10) (* 2 x11) (* 3 x12) (* 2 x13) (* 4 x14) (* 1 x15) (* 2 x16) (* 4 x17) (* 3 x18) (* 3 x19) (* 2 x20) (* 1 x21) (* 3 x22) (* 2 x23)) 118))
+(assert (>= (+ (* 1 x0) (* 2 x1) (* 5 x2) (* 4 x3) (* 1 x4) (* 2 x5) (* 1 x6) (* 4 x7) (* 4 x8) (* 4 x9) (* 5 x10) (* 1 x11) (* 5 x12) (* 4 x13) (* 3 x14) (* 4 x15) (* 4 x16) (* 1 x17) (* 4 x18) (* 4 x19) (* 5 x20) (* 4 x21) (* 2 x22) (* 4 x23)) 120))
+(assert (>= (+ (* 1 x0) (* 2 x1) (* 2 x2) (* 4 x3) (* 4 x4) (* 3 x5) (* 5 x6) (* 1 x7) (* 2 x8) (* 4 x9) (* 1 x10) (* 4 x11) (* 5 x12) (* 4 x13) (* 2 x14) (* 4 x15) (* 3 x16) (* 4 x17) (* 2 x18) (* 4 x19) (* 5 x20) (* 5 x21) (* 2 x22) (* 5 x23)) 139))
+(assert (>= (+ (* 4 x0) (* 2 x1) (* 5 x2) (* 4 x3) (* 4 x4) (* 5 x5) (* 4 x6) (* 3 x7) (* 5 x8) (* 2 x9) (* 1 x10) (* 4 x11) (* 1 x12) (* 2 x13) (* 3 x14) (* 2 x15) (* 1 x16) (* 4 x17) (* 3 x18) (* 5 x19) (* 1 x20) (* 4 x21) (* 5 x22) (* 3 x23)) 132))
+(assert (>= (+ (* 3 x0) (* 5 x1) (* 3 x2) (* 2 x3) (* 1 x4) (* 1 x5) (* 2 x6) (* 5 x7) (* 4 x8) (* 2 x9) (* 2 x10) (* 5 x11) (* 3 x12) (* 1 x13) (* 4 x14) (* 3 x15) (* 1 x16) (* 2 x17) (* 4 x18) (* 2 x19) (* 3 x20) (* 4 x21) (* 5 x22) (* 1 x23)) 109))
+(assert (>= (+ (* 5 x0) (* 4 x1) (* 3 x2) (* 5 x3) (* 3 x4) (* 5 x5) (* 4 x6) (* 5 x7) (* 1 x8) (* 1 x9) (* 1 x10) (* 2 x11) (* 2 x12) (* 3 x13) (* 5 x14) (* 2 x15) (* 4 x16) (* 1 x17) (* 5 x18) (* 5 x19) (* 4 x20) (* 5 x21) (* 3 x22) (* 1 x23)) 96))
+(assert (>= (+ (* 4 x0) (* 1 x1) (* 2 x2) (* 1 x3) (* 2 x4) (* 3 x5) (* 5 x6) (* 4 x7) (* 2 x8) (* 1 x9) (* 5 x10) (* 3 x11) (* 1 x12) (* 2 x13) (* 4 x14) (* 2 x15) (* 5 x16) (* 1 x17) (* 2 x18) (* 5 x19) (* 5 x20) (* 1 x21) (* 5 x22) (* 5 x23)) 111))
+(assert (>= (+ (* 2 x0) (* 2 x1) (* 4 x2) (* 1 x3) (* 4 x4) (* 2 x5) (* 4 x6) (* 4 x7) (* 4 x8) (* 5 x9) (* 5 x10) (* 4 x11) (* 4 x12) (* 2 x13) (* 3 x14) (* 5 x15) (* 5 x16) (* 5 x17) (* 3 x18) (* 2 x19) (* 4 x20) (* 1 x21) (* 1 x22) (* 2 x23)) 109))
+(assert (>= (+ (* 3 x0) (* 5 x1) (* 5 x2) (* 4 x3) (* 1 x4) (* 3 x5) (* 2 x6) (* 1 x7) (* 1 x8) (* 4 x9) (* 4 x10) (* 2 x11) (* 1 x12) (* 3 x13) (* 3 x14) (* 4 x15) (* 3 x16) (* 2 x17) (* 3 x18) (* 2 x19) (* 5 x20) (* 2 x21) (* 4 x22) (* 5 x23)) 85))
+(assert (>= (+ (* 2 x0) (* 2 x1) (* 5 x2) (* 2 x3) (* 4 x4) (* 3 x5) (* 1 x6) (* 2 x7) (* 3 x8) (* 2 x9) (* 4 x10) (* 4 x11) (* 1 x12) (* 1 x13) (* 3 x14) (* 4 x15) (* 2 x16) (* 1 x17) (* 3 x18) (* 2 x19) (* 3 x20) (* 1 x21) (* 4 x22) (* 3 x23)) 98))
+(assert (>= (+ (* 3 x0) (* 2 x1) (* 3 x2) (* 4 x3) (* 4 x4) (* 3 x5) (* 2 x6) (* 2 x7) (* 1 x8) (* 2 x9) (* 2 x10) (* 2 x11) (* 5 x12) (* 5 x13) (* 1 x14) (* 4 x15) (* 3 x16) (* 1 x17) (* 1 x18) (* 3 x19) (* 3 x20) (* 1 x21) (* 2 x22) (* 2 x23)) 85))
+(assert (>= (+ (* 2 x0) (* 4 x1) (* 3 x2) (* 1 x3) (* 5 x4) (* 1 x5) (* 2 x6) (* 3 x7) (* 3 x8) (* 4 x9) (* 5 x10) (* 4 x11) (* 2 x12) (* 4 x13) (* 5 x14) (* 1 x15) (* 5 x16) (* 1 x17) (* 3 x18) (* 5 x19) (* 4 x20) (* 1 x21) (* 2 x22) (* 5 x23)) 128))
+(assert (>= (+ (* 1 x0) (* 3 x1) (* 4 x2) (* 5 x3) (* 5 x4) (* 4 x5) (* 4 x6) (* 1 x7) (* 1 x8) (* 2 x9) (* 3 x10) (* 2 x11) (* 1 x12) (* 4 x13) (* 2 x14) (* 1 x15) (* 2 x16) (* 1 x17) (* 3 x18) (* 5 x19) (* 3 x20) (* 2 x21) (* 3 x22) (* 1 x23)) 80))
+(assert (>= (+ (* 2 x0) (* 4 x1) (* 2 x2) (* 3 x3) (* 4 x4) (* 5 x5) (* 1 x6) (* 4 x7) (* 1 x8) (* 4 x9) (* 3 x10) (* 4 x11) (* 1 x12) (* 1 x13) (* 2 x14) (* 4 x15) (* 1 x16) (* 5 x17) (* 3 x18) (* 5 x19) (* 1 x20) (* 5 x21) (* 4 x22) (* 2 x23)) 127))
+(assert (>= (+ (* 3 x0) (* 4 x1) (* 2 x2) (* 4 x3) (* 3 x4) (* 5 x5) (* 4 x6) (* 1 x7) (* 2 x8) (* 4 x9) (* 1 x10) (* 1 x11) (* 2 x12) (* 4 x13) (* 3 x14) (* 5 x15) (* 4 x16) (* 2 x17) (* 3 x18) (* 1 x19) (* 2 x20) (* 5 x21) (* 4 x22) (* 2 x23)) 101))
+(assert (>= (+ (* 5 x0) (* 3 x1) (* 1 x2) (* 4 x3) (* 1 x4) (* 5 x5) (* 4 x6) (* 5 x7) (* 1 x8) (* 2 x9) (* 2 x10) (* 5 x11) (* 4 x12) (* 1 x13) (* 1 x14) (* 4 x15) (* 5 x16) (* 3 x17) (* 5 x18) (* 1 x19) (* 3 x20) (* 5 x21) (* 2 x22) (* 4 x23)) 88))
+(assert (>= (+ (* 1 x0) (* 4 x1) (* 1 x2) (* 4 x3) (* 5 x4) (* 3 x5) (* 2 x6) (* 3 x7) (* 3 x8) (* 4 x9) (* 5 x10) (* 3 x11) (* 1 x12) (* 5 x13) (* 1 x14) (* 3 x15) (* 4 x16) (* 1 x17) (* 4 x18) (* 2 x19) (* 1 x20) (* 3 x21) (* 4 x22) (* 4 x23)) 143))
+(assert (>= (+ (* 1 x0) (* 5 x1) (* 2 x2) (* 2 x3) (* 5 x4) (* 1 x5) (* 1 x6) (* 2 x7) (* 2 x8) (* 1 x9) (* 5 x10) (* 1 x11) (* 3 x12) (* 2 x13) (* 1 x14) (* 2 x15) (* 1 x16) (* 1 x17) (* 1 x18) (* 1 x19) (* 5 x20) (* 5 x21) (* 2 x22) (* 2 x23)) 124))
+(assert (>= (+ (* 4 x0) (* 3 x1) (* 4 x2) (* 5 x3) (* 3 x4) (* 1 x5) (* 4 x6) (* 5 x7) (* 2 x8) (* 1 x9) (* 4 x10) (* 3 x11) (* 3 x12) (* 4 x13) (* 5 x14) (* 4 x15) (* 2 x16) (* 3 x17) (* 5 x18) (* 1 x19) (* 5 x20) (* 2 x21) (* 5 x22) (* 4 x23)) 140))
+(assert (>= (+ (* 2 x0) (* 5 x1) (* 5 x2) (* 4 x3) (* 5 x4) (* 3 x5) (* 1 x6) (* 4 x7) (* 2 x8) (* 1 x9) (* 4 x10) (* 1 x11) (* 5 x12) (* 4 x13) (* 4 x14) (* 4 x15) (* 5 x16) (* 2 x17) (* 1 x18) (* 4 x19) (* 3 x20) (* 5 x21) (* 5 x22) (* 2 x23)) 102))
+(assert (>= (+ (* 4 x0) (* 1 x1) (* 5 x2) (* 3 x3) (* 2 x4) (* 2 x5) (* 5 x6) (* 1 x7) (* 2 x8) (* 4 x9) (* 2 x10) (* 5 x11) (* 5 x12) (* 1 x13) (* 3 x14) (* 1 x15) (* 1 x16) (* 5 x17) (* 5 x18) (* 5 x19) (* 4 x20) (* 2 x21) (* 2 x22) (* 3 x23)) 83))
+(assert (>= (+ (* 5 x0) (* 5 x1) (* 2 x2) (* 5 x3) (* 3 x4) (* 1 x5) (* 2 x6) (* 3 x7) (* 1 x8) (* 4 x9) (* 2 x10) (* 4 x11) (* 5 x12) (* 3 x13) (* 4 x14) (* 3 x15) (* 1 x16) (* 5 x17) (* 3 x18) (* 2 x19) (* 5 x20) (* 4 x21) (* 3 x22) (* 2 x23)) 94))
+(assert (>= (+ (* 5 x0) (* 4 x1) (* 4 x2) (* 4 x3) (* 4 x4) (* 5 x5) (* 3 x6) (* 1 x7) (* 3 x8) (* 4 x9) (* 5 x10) (* 2 x11) (* 3 x12) (* 3 x13) (* 5 x14) (* 3 x15) (* 1 x16) (* 5 x17) (* 2 x18) (* 3 x19) (* 3 x20) (* 3 x21) (* 5 x22) (* 1 x23)) 127))
+(assert (>= (+ (* 5 x0) (* 5 x1) (* 3 x2) (* 2 x3) (* 3 x4) (* 5 x5) (* 4 x6) (* 5 x7) (* 1 x8) (* 4 x9) (* 2 x10) (* 2 x11) (* 2 x12) (* 1 x13) (* 3 x14) (* 1 x15) (* 4 x16) (* 2 x17) (* 2 x18) (* 4 x19) (* 2 x20) (* 4 x21) (* 5 x22) (* 3 x23)) 130))
+(assert (>= (+ (* 4 x0) (* 1 x1) (* 2 x2) (* 2 x3) (* 5 x4) (* 5 x5) (* 1 x6) (* 4 x7) (* 3 x8) (* 2 x9) (* 5 x10) (* 3 x11) (* 5 x12) (* 3 x13) (* 4 x14) (* 3 x15) (* 1 x16) (* 5 x17) (* 3 x18) (* 1 x19) (* 3 x20) (* 4 x21) (* 2 x22) (* 4 x23)) 91))
+(assert (>= (+ (* 5 x0) (* 1 x1) (* 2 x2) (* 5 x3) (* 2 x4) (* 2 x5) (* 5 x6) (* 1 x7) (* 3 x8) (* 1 x9) (* 2 x10) (* 2 x11) (* 3 x12) (* 4 x13) (* 4 x14) (* 4 x15) (* 1 x16) (* 4 x17) (* 2 x18) (* 5 x19) (* 2 x20) (* 2 x21) (* 5 x22) (* 3 x23)) 113))
+(assert (>= (+ (* 1 x0) (* 4 x1) (* 1 x2) (* 4 x3) (* 1 x4) (* 2 x5) (* 3 x6) (* 5 x7) (* 3 x8) (* 4 x9) (* 5 x10) (* 4 x11) (* 2 x12) (* 5 x13) (* 5 x14) (* 1 x15) (* 2 x16) (* 2 x17) (* 3 x18) (* 4 x19) (* 4 x20) (* 5 x21) (* 2 x22) (* 2 x23)) 137))
+(assert (>= (+ (* 3 x0) (* 4 x1) (* 3 x2) (* 2 x3) (* 1 x4) (* 5 x5) (* 5 x6) (* 3 x7) (* 5 x8) (* 3 x9) (* 3 x10) (* 5 x11) (* 5 x12) (* 1 x13) (* 4 x14) (* 4 x15) (* 2 x16) (* 2 x17) (* 5 x18) (* 5 x19) (* 5 x20) (* 5 x21) (* 4 x22) (* 4 x23)) 89))
+(assert (>= (+ (* 5 x0) (* 2 x1) (* 5 x2) (* 4 x3) (* 4 x4) (* 3 x5) (* 5 x6) (* 1 x7) (* 5 x8) (* 5 x9) (* 2 x10) (* 3 x11) (* 5 x12) (* 2 x13) (* 3 x14) (* 5 x15) (* 1 x16) (* 3 x17) (* 2 x18) (* 1 x19) (* 4 x20) (* 5 x21) (* 2 x22) (* 1 x23)) 121))
+(assert (>= (+ (* 4 x0) (* 4 x1) (* 1 x2) (* 4 x3) (* 4 x4) (* 5 x5) (* 5 x6) (* 4 x7) (* 2 x8) (* 5 x9) (* 2 x10) (* 3 x11) (* 4 x12) (* 1 x13) (* 2 x14) (* 1 x15) (* 5 x16) (* 5 x17) (* 2 x18) (* 2 x19) (* 5 x20) (* 2 x21) (* 3 x22) (* 5 x23)) 102))
+(assert (>= (+ (* 2 x0) (* 3 x1) (* 1 x2) (* 5 x3) (* 1 x4) (* 4 x5) (* 1 x6) (* 2 x7) (* 1 x8) (* 4 x9) (* 3 x10) (* 3 x11) (* 2 x12) (* 3 x13) (* 2 x14) (* 4 x15) (* 5 x16) (* 5 x17) (* 4 x18) (* 2 x19) (* 5 x20) (* 4 x21) (* 5 x22) (* 5 x23)) 114))
+(assert (>= (+ (* 5 x0) (* 5 x1) (* 2 x2) (* 2 x3) (* 1 x4) (* 5 x5) (* 4 x6) (* 4 x7) (* 1 x8) (* 3 x9) (* 5 x10) (* 3 x11) (* 1 x12) (* 5 x13) (* 2 x14) (* 3 x15) (* 4 x16) (* 1 x17) (* 3 x18) (* 3 x19) (* 5 x20) (* 3 x21) (* 5 x22) (* 4 x23)) 87))
+(assert (>= (+ (* 5 x0) (* 4 x1) (* 4 x2) (* 5 x3) (* 3 x4) (* 4 x5) (* 1 x6) (* 2 x7) (* 4 x8) (* 3 x9) (* 5 x10) (* 1 x11) (* 3 x12) (* 3 x13) (* 5 x14) (* 1 x15) (* 4 x16) (* 3 x17) (* 3 x18) (* 5 x19) (* 3 x20) (* 4 x21) (* 3 x22) (* 2 x23)) 150))
+(assert (>= (+ (* 3 x0) (* 2 x1) (* 3 x2) (* 3 x3) (* 5 x4) (* 3 x5) (* 2 x6) (* 3 x7) (* 1 x8) (* 2 x9) (* 5 x10) (* 1 x11) (* 5 x12) (* 4 x13) (* 1 x14) (* 2 x15) (* 2 x16) (* 2 x17) (* 4 x18) (* 5 x19) (* 2 x20) (* 3 x21) (* 2 x22) (* 1 x23)) 140))
+(assert (>= (+ (* 2 x0) (* 1 x1) (* 5 x2) (* 1 x3) (* 3 x4) (* 2 x5) (* 3 x6) (* 5 x7) (* 4 x8) (* 4 x9) (* 2 x10) (* 4 x11) (* 2 x12) (* 5 x13) (* 5 x14) (* 1 x15) (* 2 x16) (* 4 x17) (* 4 x18) (* 2 x19) (* 1 x20) (* 2 x21) (* 1 x22) (* 1 x23)) 91))
+(assert (>= (+ (* 5 x0) (* 2 x1) (* 5 x2) (* 3 x3) (* 1 x4) (* 3 x5) (* 3 x6) (* 5 x7) (* 2 x8) (* 5 x9) (* 5 x10) (* 2 x11) (* 3 x12) (* 3 x13) (* 4 x14) (* 1 x15) (* 4 x16) (* 4 x17) (* 1 x18) (* 4 x19) (* 2 x20) (* 4 x21) (* 5 x22) (* 2 x23)) 110))
+(assert (>= (+ (* 3 x0) (* 5 x1) (* 1 x2) (* 4 x3) (* 2 x4) (* 5 x5) (* 5 x6) (* 3 x7) (* 2 x8) (* 1 x9) (* 3 x10) (* 1 x11) (* 2 x12) (* 4 x13) (* 2 x14) (* 5 x15) (* 4 x16) (* 4 x17) (* 3 x18) (* 5 x19) (* 3 x20) (* 1 x21) (* 1 x22) (* 4 x23)) 127))
+(assert (>= (+ (* 5 x0) (* 3 x1) (* 5 x2) (* 5 x3) (* 3 x4) (* 2 x5) (* 5 x6) (* 2 x7) (* 2 x8) (* 1 x9) (* 2 x10) (* 4 x11) (* 3 x12) (* 5 x13) (* 4 x14) (* 2 x15) (* 2 x16) (* 4 x17) (* 5 x18) (* 3 x19) (* 4 x20) (* 5 x21) (* 2 x22) (* 3 x23)) 108))
+(assert (>= (+ (* 1 x0) (* 2 x1) (* 2 x2) (* 4 x3) (* 1 x4) (* 1 x5) (* 1 x6) (* 4 x7) (* 1 x8) (* 4 x9) (* 2 x10) (* 1 x11) (* 2 x12) (* 1 x13) (* 2 x14) (* 2 x15) (* 3 x16) (* 5 x17) (* 2 x18) (* 1 x19) (* 5 x20) (* 3 x21) (* 3 x22) (* 2 x23)) 144))
+(assert (>= (+ (* 5 x0) (* 2 x1) (* 2 x2) (* 5 x3) (* 1 x4) (* 1 x5) (* 2 x6) (* 2 x7) (* 1 x8) (* 3 x9) (* 5 x10) (* 4 x11) (* 1 x12) (* 4 x13) (* 4 x14) (* 5 x15) (* 5 x16) (* 4 x17) (* 1 x18) (* 3 x19) (* 2 x20) (* 2 x21) (* 2 x22) (* 4 x23)) 143))
+(assert (>= (+ (* 3 x0) (* 1 x1) (* 5 x2) (* 3 x3) (* 5 x4) (* 2 x5) (* 5 x6) (* 1 x7) (* 3 x8) (* 5 x9) (* 2 x10) (* 4 x11) (* 4 x12) (* 4 x13) (* 3 x14) (* 1 x15) (* 1 x16) (* 3 x17) (* 5 x18) (* 2 x19) (* 2 x20) (* 5 x21) (* 2 x22) (* 1 x23)) 90))
+(assert (>= (+ (* 3 x0) (* 5 x1) (* 5 x2) (* 2 x3) (* 2 x4) (* 3 x5) (* 2 x6) (* 1 x7) (* 3 x8) (* 4 x9) (* 1 x10) (* 2 x11) (* 3 x12) (* 5 x13) (* 2 x14) (* 2 x15) (* 2 x16) (* 5 x17) (* 4 x18) (* 3 x19) (* 2 x20) (* 2 x21) (* 2 x22) (* 3 x23)) 89))
+(assert (>= (+ (* 1 x0) (* 5 x1) (* 5 x2) (* 2 x3) (* 3 x4) (* 3 x5) (* 2 x6) (* 2 x7) (* 4 x8) (* 1 x9) (* 3 x10) (* 5 x11) (* 1 x12) (* 5 x13) (* 5 x14) (* 4 x15) (* 5 x16) (* 4 x17) (* 4 x18) (* 3 x19) (* 4 x20) (* 2 x21) (* 2 x22) (* 5 x23)) 132))
+(assert (>= (+ (* 1 x0) (* 1 x1) (* 4 x2) (* 2 x3) (* 3 x4) (* 5 x5) (* 3 x6) (* 1 x7) (* 1 x8) (* 3 x9) (* 3 x10) (* 2 x11) (* 1 x12) (* 4 x13) (* 2 x14) (* 4 x15) (* 2 x16) (* 2 x17) (* 1 x18) (* 3 x19) (* 1 x20) (* 3 x21) (* 3 x22) (* 3 x23)) 96))
+(assert (>= (+ (* 2 x0) (* 3 x1) (* 2 x2) (* 4 x3) (* 4 x4) (* 2 x5) (* 5 x6) (* 3 x7) (* 4 x8) (* 5 x9) (* 4 x10) (* 1 x11) (* 4 x12) (* 4 x13) (* 5 x14) (* 5 x15) (* 1 x16) (* 3 x17) (* 4 x18) (* 3 x19) (* 4 x20) (* 3 x21) (* 5 x22) (* 4 x23)) 89))
+(assert (>= (+ (* 4 x0) (* 4 x1) (* 2 x2) (* 3 x3) (* 5 x4) (* 5 x5) (* 2 x6) (* 5 x7) (* 4 x8) (* 2 x9) (* 1 x10) (* 2 x11) (* 2 x12) (* 4 x13) (* 3 x14) (* 5 x15) (* 2 x16) (* 1 x17) (* 4 x18) (* 5 x19) (* 2 x20) (* 4 x21) (* 5 x22) (* 2 x23)) 117))
+(assert (>= (+ (* 1 x0) (* 2 x1) (* 5 x2) (* 4 x3) (* 2 x4) (* 2 x5) (* 5 x6) (* 2 x7) (* 4 x8) (* 5 x9) (* 3 x10) (* 2 x11) (* 2 x12) (* 1 x13) (* 3 x14) (* 3 x15) (* 5 x16) (* 3 x17) (* 2 x18) (* 5 x19) (* 3 x20) (* 1 x21) (* 5 x22) (* 4 x23)) 91))
+(assert (>= (+ (* 1 x0) (* 2 x1) (* 4 x2) (* 4 x3) (* 4 x4) (* 4 x5) (* 5 x6) (* 5 x7) (* 1 x8) (* 2 x9) (* 2 x10) (* 5 x11) (* 3 x12) (* 1 x13) (* 2 x14) (* 5 x15) (* 4 x16) (* 1 x17) (* 5 x18) (* 5 x19) (* 2 x20) (* 4 x21) (* 5 x22) (* 2 x23)) 92))
+(assert (>= (+ (* 4 x0) (* 4 x1) (* 3 x2) (* 2 x3) (* 2 x4) (* 5 x5) (* 5 x6) (* 2 x7) (* 2 x8) (* 3 x9) (* 2 x10) (* 3 x11) (* 1 x12) (* 1 x13) (* 5 x14) (* 3 x15) (* 2 x16) (* 2 x17) (* 4 x18) (* 1 x19) (* 5 x20) (* 1 x21) (* 1 x22) (* 1 x23)) 101))
+(assert (>= (+ (* 4 x0) (* 5 x1) (* 5 x2) (* 2 x3) (* 4 x4) (* 4 x5) (* 2 x6) (* 3 x7) (* 5 x8) (* 3 x9) (* 1 x10) (* 4 x11) (* 3 x12) (* 2 x13) (* 2 x14) (* 1 x15) (* 5 x16) (* 2 x17) (* 1 x18) (* 5 x19) (* 1 x20) (* 4 x21) (* 1 x22) (* 4 x23)) 90))
+(assert (>= (+ (* 4 x0) (* 1 x1) (* 2 x2) (* 4 x3) (* 2 x4) (* 3 x5) (* 5 x6) (* 1 x7) (* 3 x8) (* 1 x9) (* 3 x10) (* 3 x11) (* 4 x12) (* 2 x13) (* 3 x14) (* 3 x15) (* 5 x16) (* 4 x17) (* 4 x18) (* 5 x19) (* 5 x20) (* 5 x21) (* 5 x22) (* 5 x23)) 101))
+(assert (>= (+ (* 3 x0) (* 5 x1) (* 1 x2) (* 3 x3) (* 4 x4) (* 4 x5) (* 3 x6) (* 3 x7) (* 2 x8) (* 3 x9) (* 2 x10) (* 4 x11) (* 1 x12) (* 5 x13) (* 4 x14) (* 1 x15) (* 4 x16) (* 2 x17) (* 2 x18) (* 3 x19) (* 3 x20) (* 3 x21) (* 5 x22) (* 4 x23)) 102))
+(assert (>= (+ (* 5 x0) (* 5 x1) (* 4 x2) (* 5 x3) (* 5 x4) (* 5 x5) (* 3 x6) (* 5 x7) (* 5 x8) (* 1 x9) (* 5 x10) (* 2 x11) (* 4 x12) (* 2 x13) (* 3 x14) (* 3 x15) (* 2 x16) (* 1 x17) (* 1 x18) (* 3 x19) (* 1 x20) (* 2 x21) (* 2 x22) (* 1 x23)) 116))
+(assert (>= (+ (* 3 x0) (* 5 x1) (* 4 x2) (* 2 x3) (* 2 x4) (* 2 x5) (* 3 x6) (* 2 x7) (* 4 x8) (* 2 x9) (* 1 x10) (* 1 x11) (* 5 x12) (* 3 x13) (* 1 x14) (* 1 x15) (* 2 x16) (* 4 x17) (* 3 x18) (* 5 x19) (* 5 x20) (* 3 x21) (* 3 x22) (* 4 x23)) 132))
+(assert (>= (+ (* 2 x0) (* 4 x1) (* 3 x2) (* 5 x3) (* 5 x4) (* 2 x5) (* 4 x6) (* 1 x7) (* 3 x8) (* 4 x9) (* 4 x10) (* 2 x11) (* 5 x12) (* 1 x13) (* 5 x14) (* 2 x15) (* 4 x16) (* 5 x17) (* 4 x18) (* 3 x19) (* 1 x20) (* 5 x21) (* 2 x22) (* 5 x23)) 129))
+(assert (>= (+ (* 3 x0) (* 1 x1) (* 5 x2) (* 2 x3) (* 3 x4) (* 1 x5) (* 4 x6) (* 1 x7) (* 2 x8) (* 1 x9) (* 4 x10) (* 5 x11) (* 3 x12) (* 5 x13) (* 2 x14) (* 1 x15) (* 4 x16) (* 5 x17) (* 2 x18) (* 2 x19) (* 4 x20) (* 1 x21) (* 5 x22) (* 3 x23)) 82))
+(assert (>= (+ (* 1 x0) (* 5 x1) (* 4 x2) (* 2 x3) (* 3 x4) (* 3 x5) (* 4 x6) (* 1 x7) (* 3 x8) (* 5 x9) (* 1 x10) (* 4 x11) (* 4 x12) (* 4 x13) (* 1 x14) (* 3 x15) (* 1 x16) (* 5 x17) (* 2 x18) (* 1 x19) (* 1 x20) (* 4 x21) (* 2 x22) (* 2 x23)) 109))
+(assert (>= (+ (* 2 x0) (* 4 x1) (* 2 x2) (* 4 x3) (* 5 x4) (* 3 x5) (* 3 x6) (* 1 x7) (* 5 x8) (* 1 x9) (* 2 x10) (* 2 x11) (* 4 x12) (* 1 x13) (* 1 x14) (* 1 x15) (* 2 x16) (* 3 x17) (* 4 x18) (* 5 x19) (* 2 x20) (* 2 x21) (* 4 x22) (* 1 x23)) 144))
+(assert (>= (+ (* 4 x0) (* 5 x1) (* 5 x2) (* 5 x3) (* 1 x4) (* 1 x5) (* 3 x6) (* 2 x7) (* 3 x8) (* 3 x9) (* 3 x10) (* 5 x11) (* 3 x12) (* 3 x13) (* 3 x14) (* 2 x15) (* 3 x16) (* 4 x17) (* 5 x18) (* 4 x19) (* 1 x20) (* 5 x21) (* 4 x22) (* 2 x23)) 119))
+(assert (>= (+ (* 3 x0) (* 5 x1) (* 3 x2) (* 4 x3) (* 2 x4) (* 2 x5) (* 2 x6) (* 1 x7) (* 5 x8) (* 2 x9) (* 5 x10) (* 2 x11) (* 3 x12) (* 1 x13) (* 2 x14) (* 3 x15) (* 5 x16) (* 3 x17) (* 3 x18) (* 1 x19) (* 2 x20) (* 2 x21) (* 4 x22) (* 3 x23)) 120))
+(assert (>= (+ (* 4 x0) (* 3 x1) (* 5 x2) (* 1 x3) (* 2 x4) (* 4 x5) (* 5 x6) (* 1 x7) (* 5 x8) (* 3 x9) (* 5 x10) (* 2 x11) (* 1 x12) (* 1 x13) (* 1 x14) (* 1 x15) (* 5 x16) (* 2 x17) (* 5 x18) (* 4 x19) (* 1 x20) (* 4 x21) (* 1 x22) (* 5 x23)) 116))
+(assert (>= (+ (* 1 x0) (* 5 x1) (* 2 x2) (* 4 x3) (* 2 x4) (* 5 x5) (* 3 x6) (* 4 x7) (* 5 x8) (* 1 x9) (* 4 x10) (* 2 x11) (* 2 x12) (* 2 x13) (* 1 x14) (* 5 x15) (* 5 x16) (* 5 x17) (* 1 x18) (* 3 x19) (* 1 x20) (* 3 x21) (* 5 x22) (* 2 x23)) 90))
+(assert (>= (+ (* 2 x0) (* 3 x1) (* 3 x2) (* 1 x3) (* 5 x4) (* 5 x5) (* 4 x6) (* 1 x7) (* 3 x8) (* 5 x9) (* 1 x10) (* 1 x11) (* 2 x12) (* 2 x13) (* 4 x14) (* 5 x15) (* 3 x16) (* 2 x17) (* 3 x18) (* 5 x19) (* 5 x20) (* 2 x21) (* 5 x22) (* 4 x23)) 86))
+(assert (>= (+ (* 5 x0) (* 5 x1) (* 3 x2) (* 1 x3) (* 3 x4) (* 2 x5) (* 1 x6) (* 2 x7) (* 5 x8) (* 4 x9) (* 5 x10) (* 2 x11) (* 2 x12) (* 5 x13) (* 3 x14) (* 4 x15) (* 2 x16) (* 4 x17) (* 5 x18) (* 1 x19) (* 5 x20) (* 5 x21) (* 2 x22) (* 5 x23)) 103))
+(assert (>= (+ (* 1 x0) (* 5 x1) (* 3 x2) (* 1 x3) (* 4 x4) (* 5 x5) (* 1 x6) (* 3 x7) (* 1 x8) (* 2 x9) (* 3 x10) (* 4 x11) (* 4 x12) (* 5 x13) (* 3 x14) (* 1 x15) (* 3 x16) (* 4 x17) (* 3 x18) (* 2 x19) (* 2 x20) (* 5 x21) (* 3 x22) (* 3 x23)) 108))
+(assert (>= (+ (* 2 x0) (* 2 x1) (* 5 x2) (* 4 x3) (* 2 x4) (* 2 x5) (* 5 x6) (* 4 x7) (* 4 x8) (* 3 x9) (* 2 x10) (* 1 x11) (* 4 x12) (* 4 x13) (* 4 x14) (* 2 x15) (* 1 x16) (* 2 x17) (* 3 x18) (* 5 x19) (* 1 x20) (* 1 x21) (* 1 x22) (* 1 x23)) 112))
+(assert (>= (+ (* 2 x0) (* 3 x1) (* 1 x2) (* 1 x3) (* 5 x4) (* 1 x5) (* 4 x6) (* 3 x7) (* 2 x8) (* 4 x9) (* 5 x10) (* 5 x11) (* 1 x12) (* 2 x13) (* 1 x14) (* 1 x15) (* 2 x16) (* 4 x17) (* 1 x18) (* 3 x19) (* 5 x20) (* 2 x21) (* 4 x22) (* 3 x23)) 89))
+(assert (>= (+ (* 3 x0) (* 1 x1) (* 3 x2) (* 1 x3) (* 4 x4) (* 4 x5) (* 4 x6) (* 5 x7) (* 4 x8) (* 3 x9) (* 2 x10) (* 5 x11) (* 5 x12) (* 5 x13) (* 2 x14) (* 4 x15) (* 2 x16) (* 1 x17) (* 3 x18) (* 5 x19) (* 2 x20) (* 4 x21) (* 5 x22) (* 4 x23)) 135))
+(assert (>= (+ (* 2 x0) (* 3 x1) (* 1 x2) (* 2 x3) (* 2 x4) (* 3 x5) (* 4 x6) (* 3 x7) (* 2 x8) (* 4 x9) (* 4 x10) (* 4 x11) (* 5 x12) (* 5 x13) (* 5 x14) (* 2 x15) (* 4 x16) (* 4 x17) (* 3 x18) (* 3 x19) (* 2 x20) (* 5 x21) (* 1 x22) (* 4 x23)) 117))
+(assert (>= (+ (* 3 x0) (* 1 x1) (* 3 x2) (* 5 x3) (* 4 x4) (* 5 x5) (* 5 x6) (* 1 x7) (* 5 x8) (* 4 x9) (* 1 x10) (* 3 x11) (* 5 x12) (* 4 x13) (* 4 x14) (* 2 x15) (* 4 x16) (* 5 x17) (* 2 x18) (* 2 x19) (* 5 x20) (* 1 x21) (* 4 x22) (* 1 x23)) 113))
+(assert (>= (+ (* 5 x0) (* 3 x1) (* 1 x2) (* 2 x3) (* 2 x4) (* 2 x5) (* 5 x6) (* 2 x7) (* 4 x8) (* 1 x9) (* 2 x10) (* 4 x11) (* 5 x12) (* 2 x13) (* 4 x14) (* 5 x15) (* 3 x16) (* 4 x17) (* 3 x18) (* 4 x19) (* 3 x20) (* 3 x21) (* 5 x22) (* 1 x23)) 109))
+(assert (>= (+ (* 4 x0) (* 5 x1) (* 5 x2) (* 5 x3) (* 3 x4) (* 2 x5) (* 1 x6) (* 2 x7) (* 2 x8) (* 4 x9) (* 4 x10) (* 4 x11) (* 2 x12) (* 1 x13) (* 3 x14) (* 3 x15) (* 2 x16) (* 3 x17) (* 4 x18) (* 4 x19) (* 2 x20) (* 2 x21) (* 5 x22) (* 5 x23)) 136))
+(assert (>= (+ (* 3 x0) (* 2 x1) (* 3 x2) (* 3 x3) (* 4 x4) (* 4 x5) (* 1 x6) (* 5 x7) (* 2 x8) (* 1 x9) (* 5 x10) (* 1 x11) (* 5 x12) (* 4 x13) (* 3 x14) (* 5 x15) (* 3 x16) (* 3 x17) (* 3 x18) (* 4 x19) (* 2 x20) (* 1 x21) (* 2 x22) (* 3 x23)) 103))
+(assert (>= (+ (* 3 x0) (* 3 x1) (* 4 x2) (* 2 x3) (* 2 x4) (* 2 x5) (* 2 x6) (* 2 x7) (* 2 x8) (* 4 x9) (* 1 x10) (* 1 x11) (* 4 x12) (* 2 x13) (* 4 x14) (* 4 x15) (* 1 x16) (* 5 x17) (* 3 x18) (* 2 x19) (* 1 x20) (* 3 x21) (* 3 x22) (* 4 x23)) 100))
+(assert (>= (+ (* 1 x0) (* 5 x1) (* 5 x2) (* 4 x3) (* 3 x4) (* 2 x5) (* 1 x6) (* 2 x7) (* 5 x8) (* 2 x9) (* 1 x10) (* 1 x11) (* 3 x12) (* 3 x13) (* 5 x14) (* 4 x15) (* 5 x16) (* 3 x17) (* 1 x18) (* 3 x19) (* 3 x20) (* 3 x21) (* 5 x22) (* 2 x23)) 84))
+(assert (>= (+ (* 5 x0) (* 3 x1) (* 4 x2) (* 5 x3) (* 3 x4) (* 3 x5) (* 1 x6) (* 4 x7) (* 4 x8) (* 3 x9) (* 4 x10) (* 1 x11) (* 4 x12) (* 1 x13) (* 5 x14) (* 4 x15) (* 4 x16) (* 2 x17) (* 2 x18) (* 3 x19) (* 4 x20) (* 5 x21) (* 3 x22) (* 1 x23)) 149))
+(assert (>= (+ (* 4 x0) (* 4 x1) (* 2 x2) (* 1 x3) (* 4 x4) (* 5 x5) (* 3 x6) (* 4 x7) (* 5 x8) (* 4 x9) (* 2 x10) (* 3 x11) (* 2 x12) (* 4 x13) (* 1 x14) (* 5 x15) (* 2 x16) (* 4 x17) (* 5 x18) (* 3 x19) (* 1 x20) (* 3 x21) (* 2 x22) (* 2 x23)) 124))
+(assert (>= (+ (* 3 x0) (* 4 x1) (* 2 x2) (* 5 x3) (* 3 x4) (* 3 x5) (* 5 x6) (* 1 x7) (* 3 x8) (* 5 x9) (* 1 x10) (* 4 x11) (* 4 x12) (* 3 x13) (* 5 x14) (* 2 x15) (* 2 x16) (* 2 x17) (* 4 x18) (* 1 x19) (* 3 x20) (* 2 x21) (* 5 x22) (* 2 x23)) 96))
+(assert (>= (+ (* 5 x0) (* 2 x1) (* 2 x2) (* 5 x3) (* 2 x4) (* 1 x5) (* 5 x6) (* 2 x7) (* 5 x8) (* 4 x9) (* 2 x10) (* 3 x11) (* 4 x12) (* 1 x13) (* 2 x14) (* 2 x15) (* 4 x16) (* 5 x17) (* 4 x18) (* 4 x19) (* 4 x20) (* 1 x21) (* 4 x22) (* 3 x23)) 109))
+(assert (>= (+ (* 2 x0) (* 5 x1) (* 1 x2) (* 4 x3) (* 1 x4) (* 1 x5) (* 3 x6) (* 4 x7) (* 5 x8) (* 2 x9) (* 5 x10) (* 4 x11) (* 5 x12) (* 2 x13) (* 2 x14) (* 3 x15) (* 2 x16) (* 3 x17) (* 1 x18) (* 2 x19) (* 5 x20) (* 4 x21) (* 2 x22) (* 4 x23)) 134))
+(assert (>= (+ (* 4 x0) (* 3 x1) (* 3 x2) (* 5 x3) (* 5 x4) (* 5 x5) (* 2 x6) (* 2 x7) (* 4 x8) (* 3 x9) (* 2 x10) (* 1 x11) (* 2 x12) (* 3 x13) (* 4 x14) (* 1 x15) (* 3 x16) (* 1 x17) (* 2 x18) (* 4 x19) (* 3 x20) (* 1 x21) (* 3 x22) (* 5 x23)) 134))
+(assert (>= (+ (* 3 x0) (* 4 x1) (* 1 x2) (* 3 x3) (* 5 x4) (* 2 x5) (* 4 x6) (* 1 x7) (* 5 x8) (* 3 x9) (* 3 x10) (* 2 x11) (* 1 x12) (* 3 x13) (* 1 x14) (* 5 x15) (* 5 x16) (* 5 x17) (* 2 x18) (* 2 x19) (* 3 x20) (* 3 x21) (* 3 x22) (* 1 x23)) 126))
+(assert (>= (+ (* 2 x0) (* 3 x1) (* 2 x2) (* 3 x3) (* 3 x4) (* 2 x5) (* 2 x6) (* 5 x7) (* 2 x8) (* 4 x9) (* 5 x10) (* 3 x11) (* 5 x12) (* 4 x13) (* 2 x14) (* 4 x15) (* 2 x16) (* 3 x17) (* 3 x18) (* 1 x19) (* 5 x20) (* 1 x21) (* 4 x22) (* 2 x23)) 98))
+(assert (>= (+ (* 3 x0) (* 4 x1) (* 5 x2) (* 1 x3) (* 3 x4) (* 2 x5) (* 5 x6) (* 5 x7) (* 2 x8) (* 5 x9) (* 2 x10) (* 1 x11) (* 4 x12) (* 1 x13) (* 2 x14) (* 5 x15) (* 3 x16) (* 4 x17) (* 5 x18) (* 4 x19) (* 5 x20) (* 1 x21) (* 1 x22) (* 3 x23)) 107))
+(assert (>= (+ (* 3 x0) (* 4 x1) (* 3 x2) (* 5 x3) (* 4 x4) (* 1 x5) (* 2 x6) (* 4 x7) (* 3 x8) (* 5 x9) (* 2 x10) (* 3 x11) (* 1 x12) (* 5 x13) (* 3 x14) (* 5 x15) (* 5 x16) (* 5 x17) (* 2 x18) (* 3 x19) (* 4 x20) (* 5 x21) (* 4 x22) (* 1 x23)) 144))
+(assert (>= (+ (* 1 x0) (* 2 x1) (* 1 x2) (* 4 x3) (* 4 x4) (* 4 x5) (* 1 x6) (* 2 x7) (* 1 x8) (* 1 x9) (* 1 x10) (* 5 x11) (* 2 x12) (* 5 x13) (* 4 x14) (* 5 x15) (* 3 x16) (* 5 x17) (* 1 x18) (* 2 x19) (* 2 x20) (* 3 x21) (* 5 x22) (* 1 x23)) 117))
+(assert (>= (+ (* 4 x0) (* 2 x1) (* 1 x2) (* 5 x3) (* 3 x4) (* 4 x5) (* 4 x6) (* 3 x7) (* 5 x8) (* 2 x9) (* 3 x10) (* 5 x11) (* 2 x12) (* 2 x13) (* 4 x14) (* 4 x15) (* 2 x16) (* 1 x17) (* 1 x18) (* 3 x19) (* 4 x20) (* 3 x21) (* 3 x22) (* 2 x23)) 103))
+(assert (>= (+ (* 2 x0) (* 2 x1) (* 3 x2) (* 1 x3) (* 4 x4) (* 5 x5) (* 5 x6) (* 5 x7) (* 4 x8) (* 3 x9) (* 4 x10) (* 4 x11) (* 4 x12) (* 1 x13) (* 4 x14) (* 1 x15) (* 2 x16) (* 3 x17) (* 3 x18) (* 1 x19) (* 2 x20) (* 5 x21) (* 1 x22) (* 4 x23)) 145))
+(assert (>= (+ (* 1 x0) (* 3 x1) (* 3 x2) (* 1 x3) (* 3 x4) (* 2 x5) (* 1 x6) (* 4 x7) (* 2 x8) (* 5 x9) (* 3 x10) (* 4 x11) (* 2 x12) (* 4 x13) (* 5 x14) (* 4 x15) (* 1 x16) (* 5 x17) (* 2 x18) (* 5 x19) (* 3 x20) (* 5 x21) (* 2 x22) (* 1 x23)) 88))
+(assert (>= (+ (* 5 x0) (* 1 x1) (* 1 x2) (* 4 x3) (* 1 x4) (* 3 x5) (* 4 x6) (* 3 x7) (* 5 x8) (* 3 x9) (* 3 x10) (* 2 x11) (* 2 x12) (* 4 x13) (* 2 x14) (* 2 x15) (* 4 x16) (* 5 x17) (* 3 x18) (* 4 x19) (* 5 x20) (* 2 x21) (* 1 x22) (* 5 x23)) 95))
+(assert (>= (+ (* 5 x0) (* 4 x1) (* 4 x2) (* 2 x3) (* 3 x4) (* 5 x5) (* 5 x6) (* 3 x7) (* 3 x8) (* 5 x9) (* 1 x10) (* 5 x11) (* 5 x12) (* 5 x13) (* 1 x14) (* 3 x15) (* 2 x16) (* 3 x17) (* 4 x18) (* 1 x19) (* 1 x20) (* 5 x21) (* 2 x22) (* 2 x23)) 86))
+(assert (>= (+ (* 5 x0) (* 4 x1) (* 2 x2) (* 4 x3) (* 2 x4) (* 1 x5) (* 4 x6) (* 2 x7) (* 3 x8) (* 2 x9) (* 5 x10) (* 4 x11) (* 4 x12) (* 5 x13) (* 2 x14) (* 5 x15) (* 1 x16) (* 3 x17) (* 2 x18) (* 3 x19) (* 3 x20) (* 3 x21) (* 5 x22) (* 1 x23)) 88))
+(assert (>= (+ (* 3 x0) (* 1 x1) (* 3 x2) (* 5 x3) (* 2 x4) (* 4 x5) (* 4 x6) (* 3 x7) (* 4 x8) (* 2 x9) (* 3 x10) (* 4 x11) (* 5 x12) (* 5 x13) (* 5 x14) (* 4 x15) (* 1 x16) (* 1 x17) (* 2 x18) (* 1 x19) (* 2 x20) (* 3 x21) (* 1 x22) (* 1 x23)) 123))
+(assert (>= (+ (* 4 x0) (* 5 x1) (* 5 x2) (* 4 x3) (* 5 x4) (* 1 x5) (* 1 x6) (* 1 x7) (* 4 x8) (* 1 x9) (* 3 x10) (* 3 x11) (* 2 x12) (* 2 x13) (* 1 x14) (* 3 x15) (* 5 x16) (* 2 x17) (* 2 x18) (* 1 x19) (* 2 x20) (* 4 x21) (* 1 x22) (* 3 x23)) 138))
+(assert (>= (+ (* 2 x0) (* 4 x1) (* 5 x2) (* 2 x3) (* 4 x4) (* 4 x5) (* 5 x6) (* 4 x7) (* 1 x8) (* 3 x9) (* 2 x10) (* 5 x11) (* 2 x12) (* 1 x13) (* 5 x14) (* 1 x15) (* 5 x16) (* 5 x17) (* 3 x18) (* 4 x19) (* 5 x20) (* 4 x21) (* 1 x22) (* 3 x23)) 137))
+(assert (>= (+ (* 2 x0) (* 3 x1) (* 5 x2) (* 2 x3) (* 1 x4) (* 1 x5) (* 5 x6) (* 1 x7) (* 5 x8) (* 5 x9) (* 5 x10) (* 5 x11) (* 2 x12) (* 2 x13) (* 1 x14) (* 5 x15) (* 4 x16) (* 3 x17) (* 1 x18) (* 1 x19) (* 3 x20) (* 3 x21) (* 4 x22) (* 3 x23)) 84))
+(assert (>= (+ (* 2 x0) (* 5 x1) (* 4 x2) (* 4 x3) (* 5 x4) (* 3 x5) (* 2 x6) (* 4 x7) (* 1 x8) (* 3 x9) (* 5 x10) (* 3 x11) (* 5 x12) (* 5 x13) (* 2 x14) (* 4 x15) (* 4 x16) (* 4 x17) (* 5 x18) (* 2 x19) (* 5 x20) (* 1 x21) (* 2 x22) (* 4 x23)) 80))
+(assert (>= (+ (* 4 x0) (* 2 x1) (* 2 x2) (* 4 x3) (* 1 x4) (* 2 x5) (* 3 x6) (* 1 x7) (* 2 x8) (* 1 x9) (* 4 x10) (* 4 x11) (* 2 x12) (* 4 x13) (* 3 x14) (* 5 x15) (* 3 x16) (* 1 x17) (* 3 x18) (* 1 x19) (* 2 x20) (* 2 x21) (* 5 x22) (* 4 x23)) 102))
+(assert (>= (+ (* 3 x0) (* 1 x1) (* 4 x2) (* 1 x3) (* 4 x4) (* 1 x5) (* 2 x6) (* 4 x7) (* 1 x8) (* 4 x9) (* 1 x10) (* 1 x11) (* 5 x12) (* 3 x13) (* 1 x14) (* 3 x15) (* 1 x16) (* 2 x17) (* 2 x18) (* 2 x19) (* 1 x20) (* 5 x21) (* 5 x22) (* 5 x23)) 81))
+(assert (>= (+ (* 5 x0) (* 4 x1) (* 1 x2) (* 4 x3) (* 2 x4) (* 3 x5) (* 3 x6) (* 4 x7) (* 2 x8) (* 5 x9) (* 1 x10) (* 4 x11) (* 1 x12) (* 2 x13) (* 5 x14) (* 3 x15) (* 5 x16) (* 4 x17) (* 4 x18) (* 5 x19) (* 1 x20) (* 2 x21) (* 4 x22) (* 5 x23)) 148))
+(assert (>= (+ (* 5 x0) (* 3 x1) (* 1 x2) (* 5 x3) (* 3 x4) (* 3 x5) (* 4 x6) (* 2 x7) (* 1 x8) (* 2 x9) (* 3 x10) (* 3 x11) (* 5 x12) (* 2 x13) (* 1 x14) (* 4 x15) (* 5 x16) (* 2 x17) (* 5 x18) (* 1 x19) (* 3 x20) (* 2 x21) (* 4 x22) (* 1 x23)) 136))
+(assert (>= (+ (* 1 x0) (* 3 x1) (* 4 x2) (* 1 x3) (* 2 x4) (* 5 x5) (* 5 x6) (* 4 x7) (* 5 x8) (* 2 x9) (* 2 x10) (* 3 x11) (* 1 x12) (* 1 x13) (* 3 x14) (* 1 x15) (* 1 x16) (* 1 x17) (* 5 x18) (* 2 x19) (* 3 x20) (* 1 x21) (* 2 x22) (* 2 x23)) 114))
+(assert (>= (+ (* 3 x0) (* 5 x1) (* 2 x2) (* 2 x3) (* 1 x4) (* 3 x5) (* 1 x6) (* 5 x7) (* 3 x8) (* 1 x9) (* 2 x10) (* 3 x11) (* 3 x12) (* 5 x13) (* 4 x14) (* 3 x15) (* 4 x16) (* 5 x17) (* 1 x18) (* 2 x19) (* 3 x20) (* 1 x21) (* 1 x22) (* 5 x23)) 103))
+(assert (>= (+ (* 5 x0) (* 4 x1) (* 1 x2) (* 3 x3) (* 1 x4) (* 2 x5) (* 1 x6) (* 3 x7) (* 4 x8) (* 2 x9) (* 5 x10) (* 3 x11) (* 2 x12) (* 2 x13) (* 1 x14) (* 5 x15) (* 3 x16) (* 3 x17) (* 1 x18) (* 5 x19) (* 2 x20) (* 2 x21) (* 1 x22) (* 4 x23)) 143))
+(assert (>= (+ (* 2 x0) (* 1 x1) (* 3 x2) (* 4 x3) (* 5 x4) (* 5 x5) (* 5 x6) (* 4 x7) (* 3 x8) (* 1 x9) (* 2 x10) (* 4 x11) (* 4 x12) (* 3 x13) (* 1 x14) (* 3 x15) (* 2 x16) (* 2 x17) (* 2 x18) (* 4 x19) (* 5 x20) (* 3 x21) (* 3 x22) (* 2 x23)) 146))
+(assert (>= (+ (* 5 x0) (* 4 x1) (* 2 x2) (* 1 x3) (* 5 x4) (* 2 x5) (* 2 x6) (* 4 x7) (* 5 x8) (* 2 x9) (* 1 x10) (* 2 x11) (* 4 x12) (* 3 x13) (* 1 x14) (* 5 x15) (* 3 x16) (* 4 x17) (* 4 x18) (* 4 x19) (* 3 x20) (* 4 x21) (* 4 x22) (* 2 x23)) 147))
+(assert (>= (+ (* 3 x0) (* 1 x1) (* 1 x2) (* 2 x3) (* 2 x4) (* 4 x5) (* 5 x6) (* 2 x7) (* 1 x8) (* 4 x9) (* 1 x10) (* 1 x11) (* 1 x12) (* 5 x13) (* 1 x14) (* 1 x15) (* 1 x16) (* 3 x17) (* 5 x18) (* 1 x19) (* 3 x20) (* 2 x21) (* 1 x22) (* 4 x23)) 106))
+(assert (>= (+ (* 5 x0) (* 1 x1) (* 4 x2) (* 5 x3) (* 5 x4) (* 3 x5) (* 4 x6) (* 1 x7) (* 1 x8) (* 2 x9) (* 2 x10) (* 5 x11) (* 4 x12) (* 5 x13) (* 4 x14) (* 3 x15) (* 3 x16) (* 1 x17) (* 3 x18) (* 2 x19) (* 3 x20) (* 3 x21) (* 2 x22) (* 1 x23)) 115))
+(assert (>= (+ (* 5 x0) (* 1 x1) (* 5 x2) (* 2 x3) (* 3 x4) (* 2 x5) (* 1 x6) (* 2 x7) (* 3 x8) (* 3 x9) (* 2 x10) (* 2 x11) (* 1 x12) (* 4 x13) (* 3 x14) (* 2 x15) (* 1 x16) (* 1 x17) (* 2 x18) (* 3 x19) (* 4 x20) (* 1 x21) (* 3 x22) (* 1 x23)) 134))
+(assert (>= (+ (* 2 x0) (* 5 x1) (* 5 x2) (* 1 x3) (* 4 x4) (* 3 x5) (* 4 x6) (* 1 x7) (* 2 x8) (* 2 x9) (* 5 x10) (* 2 x11) (* 3 x12) (* 1 x13) (* 4 x14) (* 5 x15) (* 2 x16) (* 5 x17) (* 2 x18) (* 4 x19) (* 4 x20) (* 1 x21) (* 3 x22) (* 1 x23)) 132))
+(assert (>= (+ (* 2 x0) (* 2 x1) (* 3 x2) (* 4 x3) (* 3 x4) (* 3 x5) (* 3 x6) (* 2 x7) (* 2 x8) (* 1 x9) (* 3 x10) (* 5 x11) (* 1 x12) (* 3 x13) (* 4 x14) (* 4 x15) (* 3 x16) (* 5 x17) (* 3 x18) (* 5 x19) (* 2 x20) (* 1 x21) (* 3 x22) (* 4 x23)) 106))
+(assert (>= (+ (* 2 x0) (* 5 x1) (* 3 x2) (* 4 x3) (* 3 x4) (* 1 x5) (* 3 x6) (* 3 x7) (* 1 x8) (* 5 x9) (* 4 x10) (* 2 x11) (* 1 x12) (* 1 x13) (* 3 x14) (* 4 x15) (* 1 x16) (* 2 x17) (* 3 x18) (* 3 x19) (* 2 x20) (* 4 x21) (* 4 x22) (* 1 x23)) 112))
+(assert (>= (+ (* 4 x0) (* 2 x1) (* 4 x2) (* 2 x3) (* 1 x4) (* 5 x5) (* 2 x6) (* 4 x7) (* 5 x8) (* 2 x9) (* 3 x10) (* 1 x11) (* 3 x12) (* 5 x13) (* 2 x14) (* 3 x15) (* 2 x16) (* 1 x17) (* 3 x18) (* 3 x19) (* 1 x20) (* 2 x21) (* 1 x22) (* 4 x23)) 138))
+(assert (>= (+ (* 4 x0) (* 1 x1) (* 5 x2) (* 4 x3) (* 5 x4) (* 5 x5) (* 5 x6) (* 2 x7) (* 4 x8) (* 1 x9) (* 3 x10) (* 2 x11) (* 1 x12) (* 5 x13) (* 3 x14) (* 3 x15) (* 3 x16) (* 2 x17) (* 1 x18) (* 3 x19) (* 5 x20) (* 3 x21) (* 3 x22) (* 5 x23)) 142))
+(assert (>= (+ (* 3 x0) (* 4 x1) (* 4 x2) (* 3 x3) (* 5 x4) (* 3 x5) (* 2 x6) (* 3 x7) (* 4 x8) (* 2 x9) (* 3 x10) (* 2 x11) (* 5 x12) (* 4 x13) (* 1 x14) (* 5 x15) (* 2 x16) (* 1 x17) (* 5 x18) (* 3 x19) (* 1 x20) (* 1 x21) (* 4 x22) (* 4 x23)) 138))
+(assert (>= (+ (* 5 x0) (* 4 x1) (* 2 x2) (* 1 x3) (* 4 x4) (* 4 x5) (* 3 x6) (* 1 x7) (* 3 x8) (* 1 x9) (* 1 x10) (* 4 x11) (* 3 x12) (* 3 x13) (* 1 x14) (* 3 x15) (* 4 x16) (* 5 x17) (* 1 x18) (* 4 x19) (* 5 x20) (* 5 x21) (* 4 x22) (* 3 x23)) 127))
+(assert (>= (+ (* 5 x0) (* 2 x1) (* 2 x2) (* 5 x3) (* 2 x4) (* 4 x5) (* 4 x6) (* 5 x7) (* 3 x8) (* 2 x9) (* 2 x10) (* 4 x11) (* 4 x12) (* 1 x13) (* 4 x14) (* 2 x15) (* 3 x16) (* 1 x17) (* 2 x18) (* 4 x19) (* 4 x20) (* 4 x21) (* 5 x22) (* 4 x23)) 140))
+(assert (>= (+ (* 3 x0) (* 1 x1) (* 4 x2) (* 3 x3) (* 3 x4) (* 3 x5) (* 4 x6) (* 4 x7) (* 5 x8) (* 2 x9) (* 1 x10) (* 5 x11) (* 3 x12) (* 3 x13) (* 5 x14) (* 3 x15) (* 2 x16) (* 1 x17) (* 2 x18) (* 3 x19) (* 1 x20) (* 3 x21) (* 2 x22) (* 5 x23)) 119))
+(assert (>= (+ (* 3 x0) (* 5 x1) (* 1 x2) (* 4 x3) (* 5 x4) (* 5 x5) (* 5 x6) (* 3 x7) (* 1 x8) (* 1 x9) (* 1 x10) (* 3 x11) (* 2 x12) (* 2 x13) (* 1 x14) (* 4 x15) (* 4 x16) (* 3 x17) (* 2 x18) (* 1 x19) (* 2 x20) (* 4 x21) (* 3 x22) (* 3 x23)) 116))
+(assert (>= (+ (* 1 x0) (* 2 x1) (* 5 x2) (* 2 x3) (* 5 x4) (* 2 x5) (* 1 x6) (* 1 x7) (* 5 x8) (* 4 x9) (* 5 x10) (* 2 x11) (* 5 x12) (* 4 x13) (* 5 x14) (* 3 x15) (* 3 x16) (* 4 x17) (* 5 x18) (* 2 x19) (* 1 x20) (* 1 x21) (* 5 x22) (* 4 x23)) 122))
+(assert (>= (+ (* 4 x0) (* 2 x1) (* 5 x2) (* 3 x3) (* 5 x4) (* 3 x5) (* 1 x6) (* 4 x7) (* 3 x8) (* 3 x9) (* 5 x10) (* 5 x11) (* 3 x12) (* 1 x13) (* 2 x14) (* 3 x15) (* 1 x16) (* 2 x17) (* 3 x18) (* 4 x19) (* 5 x20) (* 3 x21) (* 3 x22) (* 5 x23)) 96))
+(assert (>= (+ (* 1 x0) (* 2 x1) (* 4 x2) (* 5 x3) (* 1 x4) (* 3 x5) (* 2 x6) (* 3 x7) (* 1 x8) (* 2 x9) (* 1 x10) (* 2 x11) (* 5 x12) (* 5 x13) (* 2 x14) (* 1 x15) (* 4 x16) (* 5 x17) (* 3 x18) (* 1 x19) (* 3 x20) (* 3 x21) (* 5 x22) (* 4 x23)) 129))
+(assert (>= (+ (* 5 x0) (* 1 x1) (* 4 x2) (* 5 x3) (* 1 x4) (* 5 x5) (* 4 x6) (* 4 x7) (* 4 x8) (* 2 x9) (* 4 x10) (* 4 x11) (* 4 x12) (* 2 x13) (* 1 x14) (* 4 x15) (* 4 x16) (* 4 x17) (* 3 x18) (* 4 x19) (* 5 x20) (* 2 x21) (* 2 x22) (* 2 x23)) 108))
+(assert (>= (+ (* 2 x0) (* 5 x1) (* 5 x2) (* 5 x3) (* 3 x4) (* 1 x5) (* 1 x6) (* 2 x7) (* 1 x8) (* 5 x9) (* 4 x10) (* 5 x11) (* 4 x12) (* 4 x13) (* 2 x14) (* 5 x15) (* 5 x16) (* 3 x17) (* 3 x18) (* 3 x19) (* 2 x20) (* 3 x21) (* 4 x22) (* 3 x23)) 95))
+(assert (>= (+ (* 4 x0) (* 4 x1) (* 5 x2) (* 2 x3) (* 5 x4) (* 5 x5) (* 4 x6) (* 5 x7) (* 4 x8) (* 4 x9) (* 1 x10) (* 3 x11) (* 1 x12) (* 5 x13) (* 3 x14) (* 1 x15) (* 5 x16) (* 1 x17) (* 3 x18) (* 2 x19) (* 5 x20) (* 1 x21) (* 1 x22) (* 4 x23)) 117))
+(assert (>= (+ (* 2 x0) (* 1 x1) (* 5 x2) (* 5 x3) (* 4 x4) (* 2 x5) (* 1 x6) (* 4 x7) (* 2 x8) (* 5 x9) (* 2 x10) (* 2 x11) (* 2 x12) (* 2 x13) (* 5 x14) (* 2 x15) (* 3 x16) (* 5 x17) (* 3 x18) (* 2 x19) (* 5 x20) (* 2 x21) (* 2 x22) (* 2 x23)) 92))
+(assert (>= (+ (* 3 x0) (* 5 x1) (* 4 x2) (* 5 x3) (* 3 x4) (* 5 x5) (* 4 x6) (* 5 x7) (* 2 x8) (* 3 x9) (* 2 x10) (* 1 x11) (* 2 x12) (* 2 x13) (* 1 x14) (* 3 x15) (* 3 x16) (* 3 x17) (* 4 x18) (* 5 x19) (* 4 x20) (* 3 x21) (* 5 x22) (* 2 x23)) 114))
+(assert (>= (+ (* 3 x0) (* 4 x1) (* 1 x2) (* 5 x3) (* 4 x4) (* 3 x5) (* 1 x6) (* 3 x7) (* 4 x8) (* 5 x9) (* 3 x10) (* 2 x11) (* 2 x12) (* 2 x13) (* 3 x14) (* 4 x15) (* 5 x16) (* 5 x17) (* 2 x18) (* 1 x19) (* 3 x20) (* 3 x21) (* 5 x22) (* 3 x23)) 131))
+(assert (>= (+ (* 4 x0) (* 2 x1) (* 4 x2) (* 3 x3) (* 5 x4) (* 4 x5) (* 2 x6) (* 2 x7) (* 4 x8) (* 4 x9) (* 1 x10) (* 2 x11) (* 3 x12) (* 4 x13) (* 2 x14) (* 5 x15) (* 2 x16) (* 5 x17) (* 5 x18) (* 2 x19) (* 1 x20) (* 1 x21) (* 3 x22) (* 4 x23)) 115))
+(assert (>= (+ (* 4 x0) (* 5 x1) (* 5 x2) (* 5 x3) (* 5 x4) (* 2 x5) (* 3 x6) (* 2 x7) (* 2 x8) (* 2 x9) (* 2 x10) (* 1 x11) (* 3 x12) (* 3 x13) (* 2 x14) (* 2 x15) (* 5 x16) (* 4 x17) (* 3 x18) (* 2 x19) (* 5 x20) (* 2 x21) (* 1 x22) (* 2 x23)) 116))
+(assert (>= (+ (* 2 x0) (* 4 x1) (* 4 x2) (* 4 x3) (* 2 x4) (* 4 x5) (* 3 x6) (* 1 x7) (* 1 x8) (* 3 x9) (* 2 x10) (* 1 x11) (* 2 x12) (* 2 x13) (* 4 x14) (* 2 x15) (* 1 x16) (* 1 x17) (* 5 x18) (* 1 x19) (* 2 x20) (* 4 x21) (* 3 x22) (* 5 x23)) 115))
+(assert (>= (+ (* 4 x0) (* 1 x1) (* 4 x2) (* 3 x3) (* 4 x4) (* 1 x5) (* 4 x6) (* 3 x7) (* 1 x8) (* 3 x9) (* 2 x10) (* 4 x11) (* 1 x12) (* 2 x13) (* 3 x14) (* 2 x15) (* 1 x16) (* 3 x17) (* 2 x18) (* 5 x19) (* 2 x20) (* 4 x21) (* 1 x22) (* 4 x23)) 93))
+(assert (>= (+ (* 4 x0) (* 2 x1) (* 1 x2) (* 2 x3) (* 4 x4) (* 3 x5) (* 4 x6) (* 5 x7) (* 3 x8) (* 5 x9) (* 1 x10) (* 4 x11) (* 1 x12) (* 5 x13) (* 4 x14) (* 4 x15) (* 1 x16) (* 1 x17) (* 3 x18) (* 1 x19) (* 1 x20) (* 5 x21) (* 5 x22) (* 1 x23)) 85))
+(assert (>= (+ (* 3 x0) (* 2 x1) (* 3 x2) (* 2 x3) (* 2 x4) (* 2 x5) (* 4 x6) (* 4 x7) (* 4 x8) (* 2 x9) (* 3 x10) (* 2 x11) (* 3 x12) (* 5 x13) (* 2 x14) (* 5 x15) (* 4 x16) (* 1 x17) (* 3 x18) (* 5 x19) (* 4 x20) (* 5 x21) (* 1 x22) (* 1 x23)) 139))
+(assert (>= (+ (* 1 x0) (* 3 x1) (* 1 x2) (* 5 x3) (* 4 x4) (* 4 x5) (* 1 x6) (* 3 x7) (* 5 x8) (* 5 x9) (* 1 x10) (* 4 x11) (* 4 x12) (* 2 x13) (* 3 x14) (* 1 x15) (* 4 x16) (* 3 x17) (* 1 x18) (* 4 x19) (* 3 x20) (* 2 x21) (* 5 x22) (* 3 x23)) 104))
+(assert (>= (+ (* 3 x0) (* 5 x1) (* 3 x2) (* 5 x3) (* 1 x4) (* 3 x5) (* 1 x6) (* 5 x7) (* 2 x8) (* 4 x9) (* 4 x10) (* 5 x11) (* 3 x12) (* 5 x13) (* 4 x14) (* 3 x15) (* 5 x16) (* 2 x17) (* 4 x18) (* 2 x19) (* 5 x20) (* 5 x21) (* 2 x22) (* 3 x23)) 110))
+(assert (>= (+ (* 2 x0) (* 5 x1) (* 1 x2) (* 5 x3) (* 5 x4) (* 1 x5) (* 4 x6) (* 4 x7) (* 4 x8) (* 1 x9) (* 5 x10) (* 3 x11) (* 1 x12) (* 5 x13) (* 2 x14) (* 1 x15) (* 4 x16) (* 2 x17) (* 1 x18) (* 3 x19) (* 1 x20) (* 5 x21) (* 4 x22) (* 5 x23)) 89))
+(assert (>= (+ (* 5 x0) (* 5 x1) (* 1 x2) (* 3 x3) (* 1 x4) (* 2 x5) (* 1 x6) (* 4 x7) (* 5 x8) (* 2 x9) (* 5 x10) (* 4 x11) (* 2 x12) (* 5 x13) (* 5 x14) (* 5 x15) (* 1 x16) (* 2 x17) (* 3 x18) (* 3 x19) (* 2 x20) (* 5 x21) (* 2 x22) (* 4 x23)) 127))
+(assert (<= (+ x0 x1 x2 x3 x4 x5 x6 x7 x8 x9 x10 x11 x12 x13 x14 x15 x16 x17 x18 x19 x20 x21 x22 x23) 20))
+(check-sat)
@@ -941,6 +941,70 @@ class TheoryBVGaussWhite : public CxxTest::TestSuite
     std::cout << "matrix 34, modulo 11" << std::endl;
     testGaussElimX(Integer(11), rhs, lhs, passes::Result::PARTIAL);
   }
+
+  void testGaussElimLargeMod()
+  {
+    std::vector<Integer> rhs, resrhs;
+    std::vector<std::vector<Integer>> lhs, reslhs;
+
+    /* -------------------------------------------------------------------
+     *   lhs     rhs  -->    lhs    rhs   modulo { 2^32-5, 2^32+15 }
+     *  --^---    ^         --^--    ^
+     *  2 4  6   18         1 0 0    4
+     *  4 5  6   24         0 1 0   -2
+     *  3 1 -2    4         0 0 1    3
+     * ------------------------------------------------------------------- */
+    rhs = {Integer(18), Integer(24), Integer(4)};
+    lhs = {{Integer(2), Integer(4), Integer(6)},
+           {Integer(4), Integer(5), Integer(6)},
+           {Integer(3), Integer(1), Integer(-2)}};
+    reslhs = {{Integer(1), Integer(0), Integer(0)},
+              {Integer(0), Integer(1), Integer(0)},
+              {Integer(0), Integer(0), Integer(1)}};
+    /* largest prime that fits into 32 bits, GE on machine words */
+    std::cout << "matrix 2, modulo 4294967291" << std::endl;
+    resrhs = {Integer(4), Integer("4294967289"), Integer(3)};
+    testGaussElimX(Integer("4294967291"),
+                   rhs,
+                   lhs,
+                   passes::Result::UNIQUE,
+                   &resrhs,
+                   &reslhs);
+    /* smallest prime that does not fit into 32 bits, GE on Integers */
+    std::cout << "matrix 2, modulo 4294967311" << std::endl;
+    resrhs = {Integer(4), Integer("4294967309"), Integer(3)};
+    testGaussElimX(Integer("4294967311"),
+                   rhs,
+                   lhs,
+                   passes::Result::UNIQUE,
+                   &resrhs,
+                   &reslhs);
+
+    /* -------------------------------------------------------------------
+     *    lhs    rhs  -->    lhs    rhs  modulo 2^32-5
+     *  ---^---   ^        ---^---   ^
+     *  x y z w            x y z w
+     *  1 2 6 0   2        1 2 0 0  -10
+     *  0 0 2 2   2        0 0 1 0    2
+     *  0 0 1 0   2        0 0 0 1   -1
+     * ------------------------------------------------------------------- */
+    rhs = {Integer(2), Integer(2), Integer(2)};
+    lhs = {{Integer(1), Integer(2), Integer(6), Integer(0)},
+           {Integer(0), Integer(0), Integer(2), Integer(2)},
+           {Integer(0), Integer(0), Integer(1), Integer(0)}};
+    std::cout << "matrix 34, modulo 4294967291" << std::endl;
+    resrhs = {Integer("4294967281"), Integer(2), Integer("4294967290")};
+    reslhs = {{Integer(1), Integer(2), Integer(0), Integer(0)},
+              {Integer(0), Integer(0), Integer(1), Integer(0)},
+              {Integer(0), Integer(0), Integer(0), Integer(1)}};
+    testGaussElimX(Integer("4294967291"),
+                   rhs,
+                   lhs,
+                   passes::Result::PARTIAL,
+                   &resrhs,
+                   &reslhs);
+  }
+
   void testGaussElimRewriteForUremUnique1()
   {
     /* -------------------------------------------------------------------
@@ -0,0 +1,84 @@
+/*********************                                                        */
+/*! \file smt2_printer_black.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Andrew Reynolds
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Black box testing of the SMT-LIBv2 printer
+ **
+ ** Black box testing of the SMT-LIBv2 printer, by printing terms and parsing
+ ** them back.
+ **/
+
+#include <cxxtest/TestSuite.h>
+#include <sstream>
+
+#include "expr/expr.h"
+#include "expr/expr_manager.h"
+#include "options/language.h"
+#include "options/options.h"
+#include "parser/parser.h"
+#include "parser/parser_builder.h"
+#include "parser/smt2/smt2.h"
+#include "util/rational.h"
+
+using namespace CVC4;
+using namespace CVC4::parser;
+using namespace std;
+
+class Smt2PrinterBlack : public CxxTest::TestSuite
+{
+  ExprManager* d_exprManager;
+  Options d_options;
+
+ public:
+  void setUp() override { d_exprManager = new ExprManager; }
+
+  void tearDown() override { delete d_exprManager; }
+
+  /**
+   * Prints e in the SMT-LIBv2 language, parses it back with p and checks that
+   * the result is e.
+   */
+  void checkRoundTrip(Parser* p, Expr e, const string& expected)
+  {
+    stringstream ss;
+    e.toStream(ss, -1, false, 0, language::output::LANG_SMTLIB_V2_6);
+    TS_ASSERT_EQUALS(ss.str(), expected);
+    p->setInput(Input::newStringInput(
+        language::input::LANG_SMTLIB_V2_6, ss.str(), "test"));
+    Expr pe = p->nextExpression();
+    TS_ASSERT_EQUALS(pe, e);
+  }
+
+  void testSubstrAndExtract()
+  {
+    Parser* p = ParserBuilder(d_exprManager, "test")
+                    .withStringInput("")
+                    .withOptions(d_options)
+                    .withInputLanguage(language::input::LANG_SMTLIB_V2_6)
+                    .build();
+    static_cast<Smt2*>(p)->setLogic("ALL");
+
+    Expr s = p->mkVar("s", d_exprManager->stringType());
+    Expr q = p->mkVar(
+        "q", d_exprManager->mkSequenceType(d_exprManager->integerType()));
+    Expr zero = d_exprManager->mkConst(Rational(0));
+    Expr one = d_exprManager->mkConst(Rational(1));
+
+    checkRoundTrip(p,
+                   d_exprManager->mkExpr(kind::STRING_SUBSTR, s, zero, one),
+                   "(str.substr s 0 1)");
+    checkRoundTrip(p,
+                   d_exprManager->mkExpr(kind::STRING_SUBSTR, q, zero, one),
+                   "(seq.extract q 0 1)");
+    checkRoundTrip(
+        p, d_exprManager->mkExpr(kind::STRING_LENGTH, q), "(seq.len q)");
+    delete p;
+  }
+};
@@ -0,0 +1,236 @@
+/*********************                                                        */
+/*! \file evaluator_black.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Andres Noetzli
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Black box testing of CVC4::theory::Evaluator
+ **
+ ** Black box testing of CVC4::theory::Evaluator.
+ **/
+
+#include "expr/datatype.h"
+#include "expr/node.h"
+#include "expr/node_manager.h"
+#include "smt/smt_engine.h"
+#include "smt/smt_engine_scope.h"
+#include "theory/evaluator.h"
+#include "theory/rewriter.h"
+#include "util/bitvector.h"
+#include "util/rational.h"
+#include "util/regexp.h"
+
+#include <cxxtest/TestSuite.h>
+#include <vector>
+
+using namespace CVC4;
+using namespace CVC4::smt;
+using namespace CVC4::theory;
+
+class TheoryEvaluatorBlack : public CxxTest::TestSuite
+{
+  ExprManager *d_em;
+  NodeManager *d_nm;
+  SmtEngine *d_smt;
+  SmtScope *d_scope;
+
+ public:
+  TheoryEvaluatorBlack() {}
+
+  void setUp()
+  {
+    Options opts;
+    opts.setOutputLanguage(language::output::LANG_SMTLIB_V2);
+    d_em = new ExprManager(opts);
+    d_nm = NodeManager::fromExprManager(d_em);
+    d_smt = new SmtEngine(d_em);
+    d_scope = new SmtScope(d_smt);
+  }
+
+  void tearDown()
+  {
+    delete d_scope;
+    delete d_smt;
+    delete d_em;
+  }
+
+  /**
+   * Checks that evaluating n under the substitution args -> vals gives the
+   * same constant as substituting and rewriting n.
+   */
+  void checkEval(Node n,
+                 const std::vector<Node>& args,
+                 const std::vector<Node>& vals)
+  {
+    Evaluator eval;
+    Node r = eval.eval(n, args, vals);
+    TS_ASSERT(!r.isNull());
+    Node s = n.substitute(args.begin(), args.end(), vals.begin(), vals.end());
+    TS_ASSERT_EQUALS(r, Rewriter::rewrite(s));
+  }
+
+  void testArith()
+  {
+    TypeNode intType = d_nm->integerType();
+    Node x = d_nm->mkSkolem("x", intType);
+    Node y = d_nm->mkSkolem("y", intType);
+    Node zero = d_nm->mkConst(Rational(0));
+    Node three = d_nm->mkConst(Rational(3));
+    std::vector<Node> args = {x, y};
+    std::vector<Node> vals = {d_nm->mkConst(Rational(-7)), three};
+
+    checkEval(d_nm->mkNode(kind::PLUS, x, d_nm->mkNode(kind::MULT, three, y)),
+              args,
+              vals);
+    checkEval(d_nm->mkNode(kind::INTS_DIVISION_TOTAL, x, y), args, vals);
+    checkEval(d_nm->mkNode(kind::INTS_MODULUS_TOTAL, x, y), args, vals);
+    checkEval(d_nm->mkNode(kind::INTS_DIVISION_TOTAL, x, zero), args, vals);
+    checkEval(d_nm->mkNode(kind::DIVISION_TOTAL, x, y), args, vals);
+    checkEval(d_nm->mkNode(kind::ABS, x), args, vals);
+    checkEval(d_nm->mkNode(kind::LEQ, x, d_nm->mkNode(kind::UMINUS, y)),
+              args,
+              vals);
+    checkEval(d_nm->mkNode(kind::ITE,
+                           d_nm->mkNode(kind::GT, x, y),
+                           x,
+                           d_nm->mkNode(kind::MINUS, y, x)),
+              args,
+              vals);
+  }
+
+  void testBitVector()
+  {
+    TypeNode bvType = d_nm->mkBitVectorType(8);
+    Node x = d_nm->mkSkolem("x", bvType);
+    Node y = d_nm->mkSkolem("y", bvType);
+    std::vector<Node> args = {x, y};
+    std::vector<Node> vals = {d_nm->mkConst(BitVector(8, 200u)),
+                              d_nm->mkConst(BitVector(8, 3u))};
+
+    checkEval(d_nm->mkNode(kind::BITVECTOR_PLUS, x, y), args, vals);
+    checkEval(d_nm->mkNode(kind::BITVECTOR_MULT, x, y), args, vals);
+    checkEval(d_nm->mkNode(kind::BITVECTOR_UDIV_TOTAL, x, y), args, vals);
+    checkEval(d_nm->mkNode(kind::BITVECTOR_ASHR, x, y), args, vals);
+    checkEval(d_nm->mkNode(kind::BITVECTOR_CONCAT, x, y), args, vals);
+    checkEval(d_nm->mkNode(kind::BITVECTOR_SLT, x, y), args, vals);
+    checkEval(d_nm->mkNode(kind::BITVECTOR_ULT, x, y), args, vals);
+    Node ext = d_nm->mkConst<BitVectorExtract>(BitVectorExtract(5, 2));
+    checkEval(d_nm->mkNode(ext, x), args, vals);
+    Node sext = d_nm->mkConst<BitVectorSignExtend>(BitVectorSignExtend(4));
+    checkEval(d_nm->mkNode(sext, x), args, vals);
+  }
+
+  void testStrings()
+  {
+    TypeNode strType = d_nm->stringType();
+    TypeNode intType = d_nm->integerType();
+    Node x = d_nm->mkSkolem("x", strType);
+    Node y = d_nm->mkSkolem("y", strType);
+    Node i = d_nm->mkSkolem("i", intType);
+    std::vector<Node> args = {x, y, i};
+    std::vector<Node> vals = {d_nm->mkConst(String("abcab")),
+                              d_nm->mkConst(String("ab")),
+                              d_nm->mkConst(Rational(3))};
+
+    checkEval(d_nm->mkNode(kind::STRING_CONCAT, x, y), args, vals);
+    checkEval(d_nm->mkNode(kind::STRING_LENGTH, x), args, vals);
+    checkEval(d_nm->mkNode(kind::STRING_SUBSTR, x, i, i), args, vals);
+    checkEval(
+        d_nm->mkNode(kind::STRING_SUBSTR, x, i, d_nm->mkConst(Rational(10))),
+        args,
+        vals);
+    checkEval(d_nm->mkNode(kind::STRING_STRCTN, x, y), args, vals);
+    checkEval(d_nm->mkNode(kind::STRING_PREFIX, y, x), args, vals);
+    checkEval(d_nm->mkNode(kind::STRING_SUFFIX, y, x), args, vals);
+    checkEval(d_nm->mkNode(kind::STRING_STRREPL, x, y, x), args, vals);
+  }
+
+  void testLambda()
+  {
+    TypeNode intType = d_nm->integerType();
+    Node f = d_nm->mkSkolem("f", d_nm->mkFunctionType(intType, intType));
+    Node x = d_nm->mkSkolem("x", intType);
+    Node b = d_nm->mkBoundVar("b", intType);
+    Node one = d_nm->mkConst(Rational(1));
+    Node body = b.eqNode(one).iteNode(one, d_nm->mkNode(kind::PLUS, b, b));
+    Node lambda = d_nm->mkNode(
+        kind::LAMBDA, d_nm->mkNode(kind::BOUND_VAR_LIST, b), body);
+    std::vector<Node> args = {f, x};
+    std::vector<Node> vals = {lambda, d_nm->mkConst(Rational(5))};
+
+    Evaluator eval;
+    Node fx = d_nm->mkNode(kind::APPLY_UF, f, x);
+    TS_ASSERT_EQUALS(eval.eval(fx, args, vals), d_nm->mkConst(Rational(10)));
+    Node ffx = d_nm->mkNode(kind::APPLY_UF, f, fx);
+    TS_ASSERT_EQUALS(eval.eval(ffx, args, vals), d_nm->mkConst(Rational(20)));
+    Node fone = d_nm->mkNode(kind::APPLY_UF, f, one);
+    TS_ASSERT_EQUALS(eval.eval(fone, args, vals), one);
+  }
+
+  void testDatatypes()
+  {
+    TypeNode intType = d_nm->integerType();
+    Datatype list("list");
+    DatatypeConstructor consc("cons", "is_cons");
+    consc.addArg("car", intType.toType());
+    consc.addArg("cdr", DatatypeSelfType());
+    list.addConstructor(consc);
+    DatatypeConstructor nilc("nil", "is_nil");
+    list.addConstructor(nilc);
+    DatatypeType listType = d_em->mkDatatypeType(list);
+    const Datatype& dt = listType.getDatatype();
+
+    Node cons = Node::fromExpr(dt[0].getConstructor());
+    Node car = Node::fromExpr(dt[0].getSelectorInternal(listType, 0));
+    Node cdr = Node::fromExpr(dt[0].getSelectorInternal(listType, 1));
+    Node isNil = Node::fromExpr(dt[1].getTester());
+    Node nil = d_nm->mkNode(kind::APPLY_CONSTRUCTOR,
+                            Node::fromExpr(dt[1].getConstructor()));
+    Node one = d_nm->mkConst(Rational(1));
+    Node two = d_nm->mkConst(Rational(2));
+
+    Node x = d_nm->mkSkolem("x", intType);
+    Node l = d_nm->mkSkolem("l", TypeNode::fromType(listType));
+    std::vector<Node> args = {x, l};
+    std::vector<Node> vals = {one,
+                              d_nm->mkNode(kind::APPLY_CONSTRUCTOR, cons, two, nil)};
+
+    Node t = d_nm->mkNode(kind::APPLY_CONSTRUCTOR, cons, x, l);
+    Node cdrt = d_nm->mkNode(kind::APPLY_SELECTOR_TOTAL, cdr, t);
+    Node cdrl = d_nm->mkNode(kind::APPLY_SELECTOR_TOTAL, cdr, l);
+    checkEval(t, args, vals);
+    checkEval(d_nm->mkNode(kind::APPLY_SELECTOR_TOTAL, car, cdrt), args, vals);
+    checkEval(d_nm->mkNode(kind::APPLY_TESTER, isNil, cdrt), args, vals);
+    checkEval(d_nm->mkNode(kind::APPLY_TESTER, isNil, cdrl), args, vals);
+    checkEval(cdrt.eqNode(l), args, vals);
+    checkEval(t.eqNode(l), args, vals);
+    checkEval(d_nm->mkNode(kind::APPLY_TESTER, isNil, l)
+                  .iteNode(x, d_nm->mkNode(kind::APPLY_SELECTOR_TOTAL, car, l)),
+              args,
+              vals);
+
+    // the selector of another constructor is left to the rewriter
+    Evaluator eval;
+    TS_ASSERT(
+        eval.eval(d_nm->mkNode(kind::APPLY_SELECTOR_TOTAL, car, cdrl), args, vals)
+            .isNull());
+  }
+
+  void testUnsupported()
+  {
+    TypeNode intType = d_nm->integerType();
+    Node x = d_nm->mkSkolem("x", intType);
+    Node y = d_nm->mkSkolem("y", intType);
+    std::vector<Node> args = {x};
+    std::vector<Node> vals = {d_nm->mkConst(Rational(1))};
+
+    // y is not given a value
+    Evaluator eval;
+    TS_ASSERT(eval.eval(d_nm->mkNode(kind::PLUS, x, y), args, vals).isNull());
+  }
+};
@@ -0,0 +1,178 @@
+/*********************                                                        */
+/*! \file theory_arith_basis_factorization_black.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Black box testing of CVC4::theory::arith::BasisFactorization
+ **
+ ** Black box testing of CVC4::theory::arith::BasisFactorization.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <vector>
+
+#include "theory/arith/basis_factorization.h"
+#include "util/rational.h"
+
+using namespace CVC4;
+using namespace CVC4::theory::arith;
+using namespace std;
+
+typedef BasisFactorization::SparseVector SparseVector;
+typedef BasisFactorization::DenseVector DenseVector;
+
+class TheoryArithBasisFactorizationBlack : public CxxTest::TestSuite
+{
+  /* The basis matrix, by rows. */
+  vector<vector<Rational>> d_basis;
+
+  vector<SparseVector> getColumns()
+  {
+    vector<SparseVector> columns(d_basis.size());
+    for (uint32_t i = 0; i < d_basis.size(); ++i)
+    {
+      for (uint32_t j = 0; j < d_basis.size(); ++j)
+      {
+        if (!d_basis[i][j].isZero())
+        {
+          columns[j].push_back(make_pair(i, d_basis[i][j]));
+        }
+      }
+    }
+    return columns;
+  }
+
+  void replaceColumn(BasisFactorization& factors,
+                     uint32_t pos,
+                     const vector<Rational>& column,
+                     bool expected)
+  {
+    SparseVector sparse;
+    for (uint32_t i = 0; i < column.size(); ++i)
+    {
+      d_basis[i][pos] = column[i];
+      if (!column[i].isZero())
+      {
+        sparse.push_back(make_pair(i, column[i]));
+      }
+    }
+    TS_ASSERT_EQUALS(factors.replaceColumn(pos, sparse), expected);
+  }
+
+  /* Checks ftran and btran against the basis for all unit vectors. */
+  void checkSolves(const BasisFactorization& factors)
+  {
+    uint32_t dim = d_basis.size();
+    for (uint32_t r = 0; r < dim; ++r)
+    {
+      DenseVector x(dim);
+      x[r] = Rational(1);
+      factors.ftran(x);
+      for (uint32_t i = 0; i < dim; ++i)
+      {
+        Rational sum(0);
+        for (uint32_t j = 0; j < dim; ++j)
+        {
+          sum += d_basis[i][j] * x[j];
+        }
+        TS_ASSERT_EQUALS(sum, Rational(i == r ? 1 : 0));
+      }
+
+      DenseVector y(dim);
+      y[r] = Rational(1);
+      factors.btran(y);
+      for (uint32_t j = 0; j < dim; ++j)
+      {
+        Rational sum(0);
+        for (uint32_t i = 0; i < dim; ++i)
+        {
+          sum += y[i] * d_basis[i][j];
+        }
+        TS_ASSERT_EQUALS(sum, Rational(j == r ? 1 : 0));
+      }
+    }
+  }
+
+ public:
+  void setUp()
+  {
+    /*  2 0 1 0
+     *  0 3 0 1
+     *  1 0 0 2
+     *  0 1 4 0 */
+    d_basis = {{Rational(2), Rational(0), Rational(1), Rational(0)},
+               {Rational(0), Rational(3), Rational(0), Rational(1)},
+               {Rational(1), Rational(0), Rational(0), Rational(2)},
+               {Rational(0), Rational(1), Rational(4), Rational(0)}};
+  }
+
+  void testFactorize()
+  {
+    BasisFactorization factors(10);
+    TS_ASSERT(!factors.isValid());
+    TS_ASSERT(factors.factorize(getColumns()));
+    TS_ASSERT(factors.isValid());
+    TS_ASSERT_EQUALS(factors.getDimension(), 4u);
+    TS_ASSERT_EQUALS(factors.getNumUpdates(), 0u);
+    checkSolves(factors);
+  }
+
+  void testFactorizeSingular()
+  {
+    /* the last row is the sum of the first two */
+    d_basis = {{Rational(1), Rational(2), Rational(0)},
+               {Rational(0), Rational(1), Rational(1)},
+               {Rational(1), Rational(3), Rational(1)}};
+    BasisFactorization factors(10);
+    TS_ASSERT(!factors.factorize(getColumns()));
+    TS_ASSERT(!factors.isValid());
+  }
+
+  void testUpdates()
+  {
+    BasisFactorization factors(3);
+    TS_ASSERT(factors.factorize(getColumns()));
+
+    replaceColumn(factors,
+                  1,
+                  {Rational(1), Rational(0), Rational(-1, 2), Rational(5)},
+                  true);
+    checkSolves(factors);
+    replaceColumn(factors,
+                  0,
+                  {Rational(0), Rational(7), Rational(3), Rational(0)},
+                  true);
+    checkSolves(factors);
+    TS_ASSERT(!factors.needsRefactorization());
+    replaceColumn(factors,
+                  3,
+                  {Rational(2), Rational(2), Rational(0), Rational(1)},
+                  true);
+    checkSolves(factors);
+    TS_ASSERT_EQUALS(factors.getNumUpdates(), 3u);
+    TS_ASSERT(factors.needsRefactorization());
+
+    TS_ASSERT(factors.factorize(getColumns()));
+    TS_ASSERT_EQUALS(factors.getNumUpdates(), 0u);
+    checkSolves(factors);
+  }
+
+  void testUpdateSingular()
+  {
+    BasisFactorization factors(10);
+    TS_ASSERT(factors.factorize(getColumns()));
+    /* a copy of column 0 */
+    replaceColumn(factors,
+                  2,
+                  {Rational(2), Rational(0), Rational(1), Rational(0)},
+                  false);
+    TS_ASSERT(!factors.isValid());
+  }
+};
@@ -0,0 +1,104 @@
+/*********************                                                        */
+/*! \file theory_arith_univariate_polynomial_black.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Black box testing of CVC4::theory::arith::UnivariatePolynomial
+ **
+ ** Black box testing of CVC4::theory::arith::UnivariatePolynomial and
+ ** CVC4::theory::arith::RealRoot.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <vector>
+
+#include "theory/arith/univariate_polynomial.h"
+#include "util/rational.h"
+
+using namespace CVC4;
+using namespace CVC4::theory::arith;
+using namespace std;
+
+typedef UnivariatePolynomial UPoly;
+
+class TheoryArithUnivariatePolynomialBlack : public CxxTest::TestSuite
+{
+  UPoly d_x;
+
+  /* Returns x - r. */
+  UPoly mkLinear(const Rational& r) { return d_x - UPoly(r); }
+
+ public:
+  void setUp() { d_x = UPoly::mkVariable(); }
+
+  void testArithmetic()
+  {
+    UPoly p = mkLinear(Rational(1)) * mkLinear(Rational(-2));
+    TS_ASSERT_EQUALS(p.getDegree(), 2);
+    TS_ASSERT_EQUALS(p.getCoefficient(0), Rational(-2));
+    TS_ASSERT_EQUALS(p.getCoefficient(1), Rational(1));
+    TS_ASSERT_EQUALS(p.evaluate(Rational(3)), Rational(10));
+    TS_ASSERT(p.derivative() == d_x * UPoly(Rational(2)) + UPoly(Rational(1)));
+    TS_ASSERT((p - p).isZero());
+
+    UPoly q, r;
+    p.divide(mkLinear(Rational(1)), q, r);
+    TS_ASSERT(q == mkLinear(Rational(-2)));
+    TS_ASSERT(r.isZero());
+    p.divide(d_x, q, r);
+    TS_ASSERT(q == mkLinear(Rational(-1)));
+    TS_ASSERT(r == UPoly(Rational(-2)));
+  }
+
+  void testGcd()
+  {
+    UPoly a = mkLinear(Rational(1, 2)) * mkLinear(Rational(3));
+    UPoly b = mkLinear(Rational(1, 2)) * mkLinear(Rational(-3));
+    TS_ASSERT(UPoly::gcd(a * UPoly(Rational(4)), b) == mkLinear(Rational(1, 2)));
+
+    UPoly c = a * a * mkLinear(Rational(3));
+    TS_ASSERT(c.squareFreePart() == a);
+  }
+
+  void testIsolateRealRoots()
+  {
+    // (x^2 - 2) * (x - 1)^2 * (x^2 + 1)
+    UPoly p = (d_x * d_x - UPoly(Rational(2))) * mkLinear(Rational(1))
+              * mkLinear(Rational(1)) * (d_x * d_x + UPoly(Rational(1)));
+    vector<RealRoot> roots = isolateRealRoots(p);
+    TS_ASSERT_EQUALS(roots.size(), 3u);
+    // -sqrt(2)
+    TS_ASSERT(roots[0].getLower() < Rational(-14142, 10000));
+    TS_ASSERT_EQUALS(roots[0].signOf(d_x * d_x - UPoly(Rational(2))), 0);
+    TS_ASSERT_EQUALS(roots[0].signOf(d_x + UPoly(Rational(7, 5))), -1);
+    TS_ASSERT_EQUALS(roots[0].signOf(d_x + UPoly(Rational(3, 2))), 1);
+    // 1
+    TS_ASSERT(roots[1].getLower() <= Rational(1));
+    TS_ASSERT(Rational(1) <= roots[1].getUpper());
+    TS_ASSERT_EQUALS(roots[1].signOf(mkLinear(Rational(1))), 0);
+    TS_ASSERT_EQUALS(roots[1].signOf(mkLinear(Rational(2))), -1);
+    // sqrt(2)
+    TS_ASSERT(Rational(14142, 10000) < roots[2].getUpper());
+    for (unsigned i = 0; i < 20; ++i)
+    {
+      roots[2].refine();
+    }
+    TS_ASSERT(!roots[2].isRational());
+    TS_ASSERT(roots[2].getUpper() - roots[2].getLower() < Rational(1, 1000));
+    TS_ASSERT(roots[2].getLower() < Rational(14143, 10000));
+    TS_ASSERT(Rational(14142, 10000) < roots[2].getUpper());
+  }
+
+  void testNoRealRoots()
+  {
+    TS_ASSERT(isolateRealRoots(UPoly(Rational(3))).empty());
+    TS_ASSERT(isolateRealRoots(d_x * d_x + UPoly(Rational(1, 3))).empty());
+  }
+};
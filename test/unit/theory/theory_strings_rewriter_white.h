@@ -245,4 +245,27 @@ class TheoryStringsRewriterWhite : public CxxTest::TestSuite
     Node res_a_repl_substr = Rewriter::rewrite(a_repl_substr);
     TS_ASSERT_EQUALS(res_repl_substr_a, res_a_repl_substr);
   }
+
+  void testRewriteSeqConcat()
+  {
+    TypeNode seqType = d_nm->mkSequenceType(d_nm->integerType());
+
+    Node x = d_nm->mkVar("x", seqType);
+    Node y = d_nm->mkVar("y", seqType);
+    Node z = d_nm->mkVar("z", seqType);
+    Node empty = d_nm->mkNullaryOperator(seqType, kind::EMPTY_SEQUENCE);
+
+    // (seq.++ (seq.++ x y) seq.empty) --> (seq.++ x y), where flattening and
+    // removing the empty sequence leave the number of children unchanged
+    Node xy = d_nm->mkNode(kind::STRING_CONCAT, x, y);
+    Node xy_e = d_nm->mkNode(kind::STRING_CONCAT, xy, empty);
+    TS_ASSERT_EQUALS(Rewriter::rewrite(xy_e), Rewriter::rewrite(xy));
+
+    // (seq.++ (seq.++ x y) z) --> (seq.++ x y z)
+    Node xy_z = d_nm->mkNode(kind::STRING_CONCAT, xy, z);
+    Node yz = d_nm->mkNode(kind::STRING_CONCAT, y, z);
+    Node x_yz = d_nm->mkNode(kind::STRING_CONCAT, x, yz);
+    TS_ASSERT_EQUALS(Rewriter::rewrite(xy_z), Rewriter::rewrite(x_yz));
+    TS_ASSERT_EQUALS(Rewriter::rewrite(xy_z).getNumChildren(), 3u);
+  }
 };
@@ -0,0 +1,84 @@
+/*********************                                                        */
+/*! \file string_black.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Andrew Reynolds
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Black box testing of CVC4::String.
+ **
+ ** Black box testing of CVC4::String.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include "util/regexp.h"
+
+using namespace CVC4;
+using namespace std;
+
+class StringBlack : public CxxTest::TestSuite {
+public:
+
+  void testSubstr() {
+    String s("hello world");
+    String w = s.substr(6, 5);
+    TS_ASSERT_EQUALS(w, String("world"));
+    TS_ASSERT_EQUALS(w.toString(), "world");
+    TS_ASSERT_EQUALS(s.substr(6), w);
+    TS_ASSERT_EQUALS(s.prefix(5), String("hello"));
+    TS_ASSERT_EQUALS(s.suffix(5), w);
+    TS_ASSERT_EQUALS(w.substr(1, 2), String("or"));
+    TS_ASSERT(s.substr(11).empty());
+    TS_ASSERT_EQUALS(s.substr(3, 0), String());
+    TS_ASSERT_EQUALS(w.hash(), String("world").hash());
+  }
+
+  void testCompare() {
+    TS_ASSERT(String("abc") < String("abd"));
+    TS_ASSERT(String("ab") < String("abc"));
+    TS_ASSERT(String("b") > String("a"));
+    // compared as characters, not as internal unsigneds
+    TS_ASSERT(String("[") > String("A"));
+    TS_ASSERT(String("ab").isLeq(String("ac")));
+    TS_ASSERT(String("hello").substr(1, 3) == String("xell").substr(1, 3));
+    TS_ASSERT(String("abcd").strncmp(String("abxx"), 2));
+    TS_ASSERT(String("abcd").rstrncmp(String("xxcd"), 2));
+    TS_ASSERT(!String("abcd").rstrncmp(String("xxdd"), 2));
+    int c;
+    TS_ASSERT(String("xabc").tailcmp(String("abc"), c));
+    TS_ASSERT_EQUALS(c, 1);
+  }
+
+  void testFind() {
+    String s("hello world, hello");
+    String h("hello");
+    TS_ASSERT_EQUALS(s.find(h), 0u);
+    TS_ASSERT_EQUALS(s.find(h, 1), 13u);
+    TS_ASSERT_EQUALS(s.find(String("xyz")), std::string::npos);
+    TS_ASSERT_EQUALS(s.find(String(""), 3), 3u);
+    TS_ASSERT_EQUALS(s.substr(6).find(String("o")), 1u);
+    TS_ASSERT_EQUALS(String("abcab").rfind(String("ab")), 0u);
+    TS_ASSERT_EQUALS(String("abcab").rfind(String("ab"), 1), 3u);
+    TS_ASSERT_EQUALS(String("ab").overlap(String("bc")), 1u);
+    TS_ASSERT_EQUALS(String("bc").roverlap(String("ab")), 1u);
+  }
+
+  void testConstruct() {
+    String s("world");
+    TS_ASSERT_EQUALS(String(s.getVec()), s);
+    TS_ASSERT_EQUALS(s.concat(String("!")), String("world!"));
+    TS_ASSERT_EQUALS(s.replace(String("or"), String("xyz")), String("wxyzld"));
+    TS_ASSERT_EQUALS(String("\\x41", true), String("A"));
+    TS_ASSERT_EQUALS(String('A'), String("A"));
+    TS_ASSERT_EQUALS(String::convertUnsignedIntToChar(s[0]), 'w');
+    TS_ASSERT(String("123").isNumber());
+    TS_ASSERT_EQUALS(String("123").toNumber(), 123);
+    TS_ASSERT(String("aaa").isRepeated());
+    TS_ASSERT(!String("aab").isRepeated());
+  }
+};